@@ -0,0 +1,248 @@
+/*
+ * nghttp3
+ *
+ * Copyright (c) 2026 nghttp3 contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#ifdef HAVE_CONFIG_H
+#  include <config.h>
+#endif /* defined(HAVE_CONFIG_H) */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+
+#include <nghttp3/nghttp3.h>
+
+#include "nghttp3_http.h"
+
+#include "bench_util.h"
+
+typedef struct bench_name {
+  const uint8_t *name;
+  size_t namelen;
+} bench_name;
+
+#define MAKE_NAME(NAME)                                                        \
+  {                                                                            \
+    .name = (uint8_t *)(NAME),                                                 \
+    .namelen = sizeof(NAME) - 1,                                               \
+  }
+
+/* browser_req_names are the field names of the browser requests in
+   bench_qpack. */
+static const bench_name browser_req_names[] = {
+  MAKE_NAME(":method"),
+  MAKE_NAME(":scheme"),
+  MAKE_NAME(":authority"),
+  MAKE_NAME(":path"),
+  MAKE_NAME("user-agent"),
+  MAKE_NAME("accept"),
+  MAKE_NAME("accept-encoding"),
+  MAKE_NAME("accept-language"),
+  MAKE_NAME("cookie"),
+  MAKE_NAME("sec-ch-ua"),
+  MAKE_NAME("sec-ch-ua-mobile"),
+  MAKE_NAME("sec-ch-ua-platform"),
+  MAKE_NAME("referer"),
+  MAKE_NAME("sec-fetch-dest"),
+  MAKE_NAME("sec-fetch-mode"),
+  MAKE_NAME("sec-fetch-site"),
+  MAKE_NAME("priority"),
+};
+
+/* api_resp_names are the field names of the API responses in
+   bench_qpack. */
+static const bench_name api_resp_names[] = {
+  MAKE_NAME(":status"),
+  MAKE_NAME("date"),
+  MAKE_NAME("server"),
+  MAKE_NAME("vary"),
+  MAKE_NAME("strict-transport-security"),
+  MAKE_NAME("x-request-id"),
+  MAKE_NAME("content-type"),
+  MAKE_NAME("content-length"),
+  MAKE_NAME("cache-control"),
+  MAKE_NAME("access-control-allow-origin"),
+  MAKE_NAME("access-control-allow-credentials"),
+  MAKE_NAME("x-ratelimit-limit"),
+  MAKE_NAME("x-ratelimit-remaining"),
+  MAKE_NAME("etag"),
+  MAKE_NAME("last-modified"),
+  MAKE_NAME("content-encoding"),
+};
+
+/* long_names are the field names which are 16 bytes or longer. */
+static const bench_name long_names[] = {
+  MAKE_NAME("sec-ch-ua-platform-version"),
+  MAKE_NAME("sec-ch-ua-full-version-list"),
+  MAKE_NAME("strict-transport-security"),
+  MAKE_NAME("access-control-allow-credentials"),
+  MAKE_NAME("access-control-expose-headers"),
+  MAKE_NAME("content-security-policy-report-only"),
+  MAKE_NAME("cross-origin-embedder-policy"),
+  MAKE_NAME("cross-origin-opener-policy"),
+  MAKE_NAME("x-envoy-upstream-service-time"),
+  MAKE_NAME("x-amzn-trace-id"),
+  MAKE_NAME("upgrade-insecure-requests"),
+  MAKE_NAME("x-content-type-options"),
+};
+
+static const struct {
+  const char *name;
+  const bench_name *names;
+  size_t nnames;
+} mixes[] = {
+  {"browser-req", browser_req_names, ARRLEN(browser_req_names)},
+  {"api-resp", api_resp_names, ARRLEN(api_resp_names)},
+  {"long", long_names, ARRLEN(long_names)},
+};
+
+static const int8_t VALID_HD_NAME_CHARS[256] = {
+  ['!'] = 1,  ['#'] = 1,  ['$'] = 1,  ['%'] = 1,  ['&'] = 1,  ['\''] = 1,
+  ['*'] = 1,  ['+'] = 1,  ['-'] = 1,  ['.'] = 1,  ['0'] = 1,  ['1'] = 1,
+  ['2'] = 1,  ['3'] = 1,  ['4'] = 1,  ['5'] = 1,  ['6'] = 1,  ['7'] = 1,
+  ['8'] = 1,  ['9'] = 1,  ['A'] = -1, ['B'] = -1, ['C'] = -1, ['D'] = -1,
+  ['E'] = -1, ['F'] = -1, ['G'] = -1, ['H'] = -1, ['I'] = -1, ['J'] = -1,
+  ['K'] = -1, ['L'] = -1, ['M'] = -1, ['N'] = -1, ['O'] = -1, ['P'] = -1,
+  ['Q'] = -1, ['R'] = -1, ['S'] = -1, ['T'] = -1, ['U'] = -1, ['V'] = -1,
+  ['W'] = -1, ['X'] = -1, ['Y'] = -1, ['Z'] = -1, ['^'] = 1,  ['_'] = 1,
+  ['`'] = 1,  ['a'] = 1,  ['b'] = 1,  ['c'] = 1,  ['d'] = 1,  ['e'] = 1,
+  ['f'] = 1,  ['g'] = 1,  ['h'] = 1,  ['i'] = 1,  ['j'] = 1,  ['k'] = 1,
+  ['l'] = 1,  ['m'] = 1,  ['n'] = 1,  ['o'] = 1,  ['p'] = 1,  ['q'] = 1,
+  ['r'] = 1,  ['s'] = 1,  ['t'] = 1,  ['u'] = 1,  ['v'] = 1,  ['w'] = 1,
+  ['x'] = 1,  ['y'] = 1,  ['z'] = 1,  ['|'] = 1,  ['~'] = 1,
+};
+
+/* scalar_check_header_name is nghttp3_check_header_name before the
+   SIMD kernels were added. */
+static int scalar_check_header_name(const uint8_t *name, size_t len) {
+  const uint8_t *last;
+
+  if (len == 0) {
+    return 0;
+  }
+  if (*name == ':') {
+    if (len == 1) {
+      return 0;
+    }
+    ++name;
+    --len;
+  }
+
+  for (last = name + len; name != last; ++name) {
+    if (VALID_HD_NAME_CHARS[*name] != 1) {
+      return 0;
+    }
+  }
+
+  return 1;
+}
+
+typedef int (*bench_check_header_name)(const uint8_t *name, size_t len);
+
+typedef struct bench_result {
+  uint64_t ns;
+  /* nvalid is the number of names which are valid. */
+  uint64_t nvalid;
+} bench_result;
+
+static void run(bench_result *res, bench_check_header_name check_header_name,
+                const bench_name *names, size_t nnames, uint64_t nops) {
+  uint64_t i, ts, nvalid = 0;
+  size_t j = 0;
+
+  ts = bench_timestamp();
+
+  for (i = 0; i < nops; ++i) {
+    nvalid += (uint64_t)check_header_name(names[j].name, names[j].namelen);
+
+    if (++j == nnames) {
+      j = 0;
+    }
+  }
+
+  res->ns = bench_timestamp() - ts;
+  res->nvalid = nvalid;
+}
+
+static void print_usage(FILE *out) {
+  fprintf(out, "Usage: bench_http [-n OPS]\n"
+               "\n"
+               "Validates OPS field names (default: 10000000) per header "
+               "mix with\n"
+               "the scalar loop that nghttp3_check_header_name used "
+               "before (scalar)\n"
+               "and nghttp3_check_header_name (check), and reports the "
+               "time per\n"
+               "name.\n");
+}
+
+int main(int argc, char **argv) {
+  /* Both functions are called through a pointer so that neither is
+     inlined into the loop. */
+  static const bench_check_header_name volatile checks[] = {
+    scalar_check_header_name,
+    nghttp3_check_header_name,
+  };
+  uint64_t nops = 10000000;
+  bench_result scalarres, checkres;
+  size_t i;
+  int c;
+
+  for (c = 1; c < argc; ++c) {
+    if (strcmp(argv[c], "-n") == 0 && c + 1 < argc) {
+      if (bench_parse_uint(&nops, argv[++c]) != 0 || nops == 0) {
+        fprintf(stderr, "-n: invalid argument\n");
+        return EXIT_FAILURE;
+      }
+      continue;
+    }
+
+    if (strcmp(argv[c], "-h") == 0) {
+      print_usage(stdout);
+      return EXIT_SUCCESS;
+    }
+
+    print_usage(stderr);
+    return EXIT_FAILURE;
+  }
+
+  printf("%-12s %10s %10s %8s\n", "mix", "scalar-ns", "check-ns", "speedup");
+
+  for (i = 0; i < ARRLEN(mixes); ++i) {
+    run(&scalarres, checks[0], mixes[i].names, mixes[i].nnames, nops);
+    run(&checkres, checks[1], mixes[i].names, mixes[i].nnames, nops);
+
+    if (scalarres.nvalid != nops || checkres.nvalid != nops) {
+      fprintf(stderr, "%s: invalid name\n", mixes[i].name);
+      return EXIT_FAILURE;
+    }
+
+    printf("%-12s %10.2f %10.2f %8.2f\n", mixes[i].name,
+           (double)scalarres.ns / (double)nops,
+           (double)checkres.ns / (double)nops,
+           (double)scalarres.ns / (double)checkres.ns);
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,657 @@
+/*
+ * nghttp3
+ *
+ * Copyright (c) 2026 nghttp3 contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#ifdef HAVE_CONFIG_H
+#  include <config.h>
+#endif /* defined(HAVE_CONFIG_H) */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+
+#include <nghttp3/nghttp3.h>
+
+#include "bench_util.h"
+
+/* BENCH_QPACK_MAX_NVLEN is the maximum number of fields in a field
+   section in the corpora. */
+#define BENCH_QPACK_MAX_NVLEN 32
+
+/* BENCH_QPACK_ACK_DELAY is the number of field sections that are
+   encoded before the decoder stream is delivered to the encoder.
+   This keeps Known Received Count behind the insert count so that
+   the blocked stream limit affects the encoder decisions. */
+#define BENCH_QPACK_ACK_DELAY 8
+
+typedef struct bench_section {
+  const nghttp3_nv *nva;
+  size_t nvlen;
+  /* vary_idx is the index of a field in nva whose value is made
+     unique per field section by appending a counter, or -1. */
+  int vary_idx;
+} bench_section;
+
+typedef struct bench_corpus {
+  const char *name;
+  const bench_section *sections;
+  size_t nsections;
+  /* gen, if not NULL, generates the |n|th field section into nva
+     instead of sections, and returns the number of fields.
+     dtable_capacity is the dynamic table capacity in use.  scratch
+     of length scratchlen is used to store names and values. */
+  size_t (*gen)(nghttp3_nv *nva, uint64_t n, size_t dtable_capacity,
+                char *scratch, size_t scratchlen);
+} bench_corpus;
+
+#define BROWSER_COMMON                                                         \
+  MAKE_NV(":method", "GET"), MAKE_NV(":scheme", "https"),                      \
+    MAKE_NV(":authority", "www.example.com"),                                  \
+    MAKE_NV("user-agent",                                                      \
+            "Mozilla/5.0 (X11; Linux x86_64) AppleWebKit/537.36 (KHTML, "      \
+            "like Gecko) Chrome/126.0.0.0 Safari/537.36"),                     \
+    MAKE_NV("accept-encoding", "gzip, deflate, br, zstd"),                     \
+    MAKE_NV("accept-language", "en-US,en;q=0.9"),                              \
+    MAKE_NV("cookie", "session=3f1a9c0e5b7d4e2f8a6c1b0d9e7f5a3c; "             \
+                      "prefs=theme%3Ddark%26lang%3Den; _ga=GA1.2.1234567890."  \
+                      "1700000000"),                                           \
+    MAKE_NV("sec-ch-ua", "\"Chromium\";v=\"126\", \"Not.A/Brand\";v=\"24\""),  \
+    MAKE_NV("sec-ch-ua-mobile", "?0"),                                         \
+    MAKE_NV("sec-ch-ua-platform", "\"Linux\"")
+
+static const nghttp3_nv browser_document[] = {
+  BROWSER_COMMON,
+  MAKE_NV(":path", "/index.html?v="),
+  MAKE_NV("accept", "text/html,application/xhtml+xml,application/xml;q=0.9,"
+                    "image/avif,image/webp,*/*;q=0.8"),
+  MAKE_NV("upgrade-insecure-requests", "1"),
+  MAKE_NV("sec-fetch-dest", "document"),
+  MAKE_NV("sec-fetch-mode", "navigate"),
+  MAKE_NV("sec-fetch-site", "none"),
+  MAKE_NV("sec-fetch-user", "?1"),
+  MAKE_NV("priority", "u=0, i"),
+};
+
+static const nghttp3_nv browser_style[] = {
+  BROWSER_COMMON,
+  MAKE_NV(":path", "/static/css/main.css?v="),
+  MAKE_NV("accept", "text/css,*/*;q=0.1"),
+  MAKE_NV("referer", "https://www.example.com/index.html"),
+  MAKE_NV("sec-fetch-dest", "style"),
+  MAKE_NV("sec-fetch-mode", "no-cors"),
+  MAKE_NV("sec-fetch-site", "same-origin"),
+  MAKE_NV("priority", "u=0"),
+};
+
+static const nghttp3_nv browser_script[] = {
+  BROWSER_COMMON,
+  MAKE_NV(":path", "/static/js/app.bundle.js?v="),
+  MAKE_NV("accept", "*/*"),
+  MAKE_NV("referer", "https://www.example.com/index.html"),
+  MAKE_NV("sec-fetch-dest", "script"),
+  MAKE_NV("sec-fetch-mode", "no-cors"),
+  MAKE_NV("sec-fetch-site", "same-origin"),
+  MAKE_NV("priority", "u=1"),
+};
+
+static const nghttp3_nv browser_image[] = {
+  BROWSER_COMMON,
+  MAKE_NV(":path", "/images/photo-"),
+  MAKE_NV("accept", "image/avif,image/webp,image/apng,image/svg+xml,image/*,"
+                    "*/*;q=0.8"),
+  MAKE_NV("referer", "https://www.example.com/index.html"),
+  MAKE_NV("sec-fetch-dest", "image"),
+  MAKE_NV("sec-fetch-mode", "no-cors"),
+  MAKE_NV("sec-fetch-site", "same-origin"),
+  MAKE_NV("priority", "u=5, i"),
+};
+
+static const nghttp3_nv browser_xhr[] = {
+  BROWSER_COMMON,
+  MAKE_NV(":path", "/api/v1/feed?cursor="),
+  MAKE_NV("accept", "application/json"),
+  MAKE_NV("content-type", "application/json"),
+  MAKE_NV("referer", "https://www.example.com/index.html"),
+  MAKE_NV("origin", "https://www.example.com"),
+  MAKE_NV("sec-fetch-dest", "empty"),
+  MAKE_NV("sec-fetch-mode", "cors"),
+  MAKE_NV("sec-fetch-site", "same-origin"),
+  MAKE_NV("priority", "u=1, i"),
+};
+
+/* The index of :path in the browser sections. */
+#define BROWSER_PATH_IDX 10
+
+static const bench_section browser_sections[] = {
+  {browser_document, ARRLEN(browser_document), BROWSER_PATH_IDX},
+  {browser_style, ARRLEN(browser_style), BROWSER_PATH_IDX},
+  {browser_script, ARRLEN(browser_script), BROWSER_PATH_IDX},
+  {browser_image, ARRLEN(browser_image), BROWSER_PATH_IDX},
+  {browser_image, ARRLEN(browser_image), BROWSER_PATH_IDX},
+  {browser_image, ARRLEN(browser_image), BROWSER_PATH_IDX},
+  {browser_xhr, ARRLEN(browser_xhr), BROWSER_PATH_IDX},
+  {browser_xhr, ARRLEN(browser_xhr), BROWSER_PATH_IDX},
+};
+
+#define API_COMMON                                                             \
+  MAKE_NV(":status", "200"),                                                   \
+    MAKE_NV("date", "Wed, 14 Oct 2026 08:12:31 GMT"),                          \
+    MAKE_NV("server", "nghttp3-bench"), MAKE_NV("vary", "accept-encoding"),    \
+    MAKE_NV("strict-transport-security",                                       \
+            "max-age=63072000; includeSubDomains; preload"),                   \
+    MAKE_NV("x-request-id", "7c0a8f2e-4b1d-4e6a-9f3c-")
+
+static const nghttp3_nv api_json[] = {
+  API_COMMON,
+  MAKE_NV("content-type", "application/json; charset=utf-8"),
+  MAKE_NV("content-length", "1432"),
+  MAKE_NV("cache-control", "private, no-store"),
+  MAKE_NV("access-control-allow-origin", "https://www.example.com"),
+  MAKE_NV("access-control-allow-credentials", "true"),
+  MAKE_NV("x-ratelimit-limit", "5000"),
+  MAKE_NV("x-ratelimit-remaining", "4987"),
+};
+
+static const nghttp3_nv api_cached[] = {
+  API_COMMON,
+  MAKE_NV("content-type", "application/json"),
+  MAKE_NV("content-length", "18211"),
+  MAKE_NV("cache-control", "public, max-age=300"),
+  MAKE_NV("etag", "\"5f2b1c7d9e0a\""),
+  MAKE_NV("last-modified", "Tue, 13 Oct 2026 22:04:10 GMT"),
+  MAKE_NV("content-encoding", "br"),
+};
+
+static const nghttp3_nv api_created[] = {
+  MAKE_NV(":status", "201"),
+  MAKE_NV("date", "Wed, 14 Oct 2026 08:12:31 GMT"),
+  MAKE_NV("server", "nghttp3-bench"),
+  MAKE_NV("vary", "accept-encoding"),
+  MAKE_NV("strict-transport-security",
+          "max-age=63072000; includeSubDomains; preload"),
+  MAKE_NV("x-request-id", "7c0a8f2e-4b1d-4e6a-9f3c-"),
+  MAKE_NV("content-type", "application/json"),
+  MAKE_NV("content-length", "87"),
+  MAKE_NV("location", "/api/v1/items/"),
+  MAKE_NV("cache-control", "no-cache"),
+};
+
+/* The index of x-request-id in the API sections. */
+#define API_REQUEST_ID_IDX 5
+
+static const bench_section api_sections[] = {
+  {api_json, ARRLEN(api_json), API_REQUEST_ID_IDX},
+  {api_json, ARRLEN(api_json), API_REQUEST_ID_IDX},
+  {api_json, ARRLEN(api_json), API_REQUEST_ID_IDX},
+  {api_cached, ARRLEN(api_cached), API_REQUEST_ID_IDX},
+  {api_created, ARRLEN(api_created), API_REQUEST_ID_IDX},
+};
+
+/* BENCH_QPACK_MANY_NAMES_NVLEN is the number of fields in a field
+   section of many-names corpus. */
+#define BENCH_QPACK_MANY_NAMES_NVLEN 16
+/* BENCH_QPACK_MANY_NAMES_ENTRY_SIZE is the dynamic table space that a
+   field of many-names corpus takes. */
+#define BENCH_QPACK_MANY_NAMES_ENTRY_SIZE (32 + sizeof("x-name-0000") - 1 + 1)
+
+/*
+ * gen_many_names generates a field section of small fields with
+ * distinct names.  The first field sections insert as many fields as
+ * half of |dtable_capacity| can hold, and the rest reference them in
+ * pseudo-random order.  This makes the steady state dominated by the
+ * encoder dynamic table lookup, and the number of entries it
+ * searches grows with |dtable_capacity|.
+ */
+static size_t gen_many_names(nghttp3_nv *nva, uint64_t n,
+                             size_t dtable_capacity, char *scratch,
+                             size_t scratchlen) {
+  size_t i, nentries;
+  uint64_t k;
+  int len;
+
+  nentries = dtable_capacity / 2 / BENCH_QPACK_MANY_NAMES_ENTRY_SIZE;
+  if (nentries == 0) {
+    nentries = 1024;
+  }
+
+  for (i = 0; i < BENCH_QPACK_MANY_NAMES_NVLEN; ++i) {
+    k = n * BENCH_QPACK_MANY_NAMES_NVLEN + i;
+    if (k >= nentries) {
+      k = (((uint32_t)k * 2654435761U) >> 8) % nentries;
+    }
+
+    len = snprintf(scratch, scratchlen, "x-name-%04" PRIu64, k);
+
+    nva[i] = (nghttp3_nv){
+      .name = (uint8_t *)scratch,
+      .value = (uint8_t *)"1",
+      .namelen = (size_t)len,
+      .valuelen = 1,
+    };
+
+    scratch += len;
+    scratchlen -= (size_t)len;
+  }
+
+  return BENCH_QPACK_MANY_NAMES_NVLEN;
+}
+
+/* BENCH_QPACK_ONE_NAME_ENTRY_SIZE is the dynamic table space that a
+   field of one-name corpus takes. */
+#define BENCH_QPACK_ONE_NAME_ENTRY_SIZE                                        \
+  (32 + sizeof("x-request-id") - 1 + sizeof("value-0000") - 1)
+
+/*
+ * gen_one_name is similar to gen_many_names, but all fields share a
+ * single name, and differ in value.
+ */
+static size_t gen_one_name(nghttp3_nv *nva, uint64_t n,
+                           size_t dtable_capacity, char *scratch,
+                           size_t scratchlen) {
+  size_t i, nentries;
+  uint64_t k;
+  int len;
+
+  nentries = dtable_capacity / 2 / BENCH_QPACK_ONE_NAME_ENTRY_SIZE;
+  if (nentries == 0) {
+    nentries = 1024;
+  }
+
+  for (i = 0; i < BENCH_QPACK_MANY_NAMES_NVLEN; ++i) {
+    k = n * BENCH_QPACK_MANY_NAMES_NVLEN + i;
+    if (k >= nentries) {
+      k = (((uint32_t)k * 2654435761U) >> 8) % nentries;
+    }
+
+    len = snprintf(scratch, scratchlen, "value-%04" PRIu64, k);
+
+    nva[i] = (nghttp3_nv){
+      .name = (uint8_t *)"x-request-id",
+      .value = (uint8_t *)scratch,
+      .namelen = sizeof("x-request-id") - 1,
+      .valuelen = (size_t)len,
+    };
+
+    scratch += len;
+    scratchlen -= (size_t)len;
+  }
+
+  return BENCH_QPACK_MANY_NAMES_NVLEN;
+}
+
+static const bench_corpus corpora[] = {
+  {"browser-req", browser_sections, ARRLEN(browser_sections), NULL},
+  {"api-resp", api_sections, ARRLEN(api_sections), NULL},
+  {"many-names", NULL, 0, gen_many_names},
+  {"one-name", NULL, 0, gen_one_name},
+};
+
+static const size_t dtable_capacities[] = {0, 4096, 16384, 65536};
+
+static const size_t blocked_streams[] = {0, 16, 100};
+
+typedef struct bench_result {
+  uint64_t nsections;
+  uint64_t nfields;
+  uint64_t enc_ns;
+  uint64_t dec_ns;
+  uint64_t reqbytes;
+  uint64_t encstreambytes;
+  uint64_t enc_nalloc;
+  uint64_t dec_nalloc;
+} bench_result;
+
+typedef struct bench_qpack {
+  bench_mem enc_mem;
+  bench_mem dec_mem;
+  nghttp3_qpack_encoder *enc;
+  nghttp3_qpack_decoder *dec;
+  nghttp3_buf pbuf, rbuf, ebuf;
+  uint8_t dstreambuf[65536];
+  nghttp3_buf dbuf;
+} bench_qpack;
+
+/*
+ * make_section copies |sec| into |nva|, and makes the value of the
+ * varying field unique using |n|.  |scratch| of length |scratchlen|
+ * is used to store the varying value.
+ */
+static void make_section(nghttp3_nv *nva, const bench_section *sec, uint64_t n,
+                         char *scratch, size_t scratchlen) {
+  const nghttp3_nv *nv;
+  int len;
+
+  memcpy(nva, sec->nva, sizeof(nva[0]) * sec->nvlen);
+
+  if (sec->vary_idx < 0) {
+    return;
+  }
+
+  nv = &sec->nva[sec->vary_idx];
+  len = snprintf(scratch, scratchlen, "%.*s%012" PRIx64, (int)nv->valuelen,
+                 (const char *)nv->value, n);
+
+  nva[sec->vary_idx].value = (uint8_t *)scratch;
+  nva[sec->vary_idx].valuelen = (size_t)len;
+}
+
+static int flush_decoder_stream(bench_qpack *bq) {
+  nghttp3_ssize nread;
+
+  if (nghttp3_buf_len(&bq->dbuf) == 0) {
+    return 0;
+  }
+
+  nread = nghttp3_qpack_encoder_read_decoder(bq->enc, bq->dbuf.pos,
+                                             nghttp3_buf_len(&bq->dbuf));
+  if (nread < 0) {
+    fprintf(stderr, "nghttp3_qpack_encoder_read_decoder: %s\n",
+            nghttp3_strerror((int)nread));
+    return -1;
+  }
+
+  nghttp3_buf_reset(&bq->dbuf);
+
+  return 0;
+}
+
+/*
+ * decode_block decodes field section in |src| of length |srclen|.
+ * It returns the number of fields decoded, or -1.
+ */
+static nghttp3_ssize decode_block(bench_qpack *bq,
+                                  nghttp3_qpack_stream_context *sctx,
+                                  const uint8_t *src, size_t srclen, int fin) {
+  nghttp3_qpack_nv nv;
+  uint8_t flags;
+  nghttp3_ssize nread;
+  nghttp3_ssize nfields = 0;
+
+  for (;;) {
+    nread = nghttp3_qpack_decoder_read_request(bq->dec, sctx, &nv, &flags, src,
+                                               srclen, fin);
+    if (nread < 0) {
+      fprintf(stderr, "nghttp3_qpack_decoder_read_request: %s\n",
+              nghttp3_strerror((int)nread));
+      return -1;
+    }
+
+    src += nread;
+    srclen -= (size_t)nread;
+
+    if (flags & NGHTTP3_QPACK_DECODE_FLAG_BLOCKED) {
+      fprintf(stderr, "field section is unexpectedly blocked\n");
+      return -1;
+    }
+
+    if (flags & NGHTTP3_QPACK_DECODE_FLAG_EMIT) {
+      nghttp3_rcbuf_decref(nv.name);
+      nghttp3_rcbuf_decref(nv.value);
+      ++nfields;
+    }
+
+    if ((flags & NGHTTP3_QPACK_DECODE_FLAG_FINAL) ||
+        (srclen == 0 && !(flags & NGHTTP3_QPACK_DECODE_FLAG_EMIT))) {
+      return nfields;
+    }
+  }
+}
+
+static int run(bench_result *res, const bench_corpus *corpus,
+               size_t dtable_capacity, size_t max_blocked_streams,
+               nghttp3_qpack_indexing_strat strat, uint64_t nsections) {
+  bench_qpack *bq;
+  nghttp3_nv nva[BENCH_QPACK_MAX_NVLEN];
+  char scratch[512];
+  const bench_section *sec;
+  size_t nvlen;
+  nghttp3_qpack_stream_context *sctx;
+  uint64_t i, t, enc_nalloc, dec_nalloc;
+  int64_t stream_id;
+  nghttp3_ssize nread, nfields;
+  int rv = -1;
+
+  bq = calloc(1, sizeof(*bq));
+  if (bq == NULL) {
+    return -1;
+  }
+
+  *res = (bench_result){0};
+
+  bench_mem_init(&bq->enc_mem);
+  bench_mem_init(&bq->dec_mem);
+
+  nghttp3_buf_init(&bq->pbuf);
+  nghttp3_buf_init(&bq->rbuf);
+  nghttp3_buf_init(&bq->ebuf);
+  bq->dbuf.begin = bq->dbuf.pos = bq->dbuf.last = bq->dstreambuf;
+  bq->dbuf.end = bq->dstreambuf + sizeof(bq->dstreambuf);
+
+  if (nghttp3_qpack_encoder_new2(&bq->enc, dtable_capacity, 0,
+                                 &bq->enc_mem.mem) != 0 ||
+      nghttp3_qpack_decoder_new(&bq->dec, dtable_capacity, max_blocked_streams,
+                                &bq->dec_mem.mem) != 0) {
+    fprintf(stderr, "could not create QPACK encoder/decoder\n");
+    goto fin;
+  }
+
+  nghttp3_qpack_encoder_set_max_dtable_capacity(bq->enc, dtable_capacity);
+  nghttp3_qpack_encoder_set_max_blocked_streams(bq->enc, max_blocked_streams);
+  nghttp3_qpack_encoder_set_indexing_strat(bq->enc, strat);
+  nghttp3_qpack_decoder_set_max_concurrent_streams(bq->dec, 1000000);
+
+  for (i = 0; i < nsections; ++i) {
+    stream_id = (int64_t)(i * 4);
+
+    if (corpus->gen) {
+      nvlen = corpus->gen(nva, i, dtable_capacity, scratch, sizeof(scratch));
+    } else {
+      sec = &corpus->sections[i % corpus->nsections];
+      nvlen = sec->nvlen;
+
+      make_section(nva, sec, i, scratch, sizeof(scratch));
+    }
+
+    nghttp3_buf_reset(&bq->pbuf);
+    nghttp3_buf_reset(&bq->rbuf);
+    nghttp3_buf_reset(&bq->ebuf);
+
+    enc_nalloc = bq->enc_mem.nalloc;
+
+    t = bench_timestamp();
+
+    if (nghttp3_qpack_encoder_encode(bq->enc, &bq->pbuf, &bq->rbuf, &bq->ebuf,
+                                     stream_id, nva, nvlen) != 0) {
+      fprintf(stderr, "nghttp3_qpack_encoder_encode failed\n");
+      goto fin;
+    }
+
+    if ((i + 1) % BENCH_QPACK_ACK_DELAY == 0 && flush_decoder_stream(bq) != 0) {
+      goto fin;
+    }
+
+    res->enc_ns += bench_timestamp() - t;
+    res->enc_nalloc += bq->enc_mem.nalloc - enc_nalloc;
+
+    res->reqbytes += nghttp3_buf_len(&bq->pbuf) + nghttp3_buf_len(&bq->rbuf);
+    res->encstreambytes += nghttp3_buf_len(&bq->ebuf);
+
+    dec_nalloc = bq->dec_mem.nalloc;
+
+    t = bench_timestamp();
+
+    if (nghttp3_buf_len(&bq->ebuf)) {
+      nread = nghttp3_qpack_decoder_read_encoder(bq->dec, bq->ebuf.pos,
+                                                 nghttp3_buf_len(&bq->ebuf));
+      if (nread < 0) {
+        fprintf(stderr, "nghttp3_qpack_decoder_read_encoder: %s\n",
+                nghttp3_strerror((int)nread));
+        goto fin;
+      }
+    }
+
+    if (nghttp3_qpack_stream_context_new(&sctx, stream_id,
+                                         &bq->dec_mem.mem) != 0) {
+      goto fin;
+    }
+
+    nfields = decode_block(bq, sctx, bq->pbuf.pos, nghttp3_buf_len(&bq->pbuf),
+                           0);
+    if (nfields == 0) {
+      nfields = decode_block(bq, sctx, bq->rbuf.pos,
+                             nghttp3_buf_len(&bq->rbuf), 1);
+    }
+
+    nghttp3_qpack_stream_context_del(sctx);
+
+    if (nfields < 0) {
+      goto fin;
+    }
+
+    if (nfields != (nghttp3_ssize)nvlen) {
+      fprintf(stderr, "decoded %td fields, want %zu\n", nfields, nvlen);
+      goto fin;
+    }
+
+    if (nghttp3_buf_left(&bq->dbuf) <
+        nghttp3_qpack_decoder_get_decoder_streamlen2(bq->dec)) {
+      fprintf(stderr, "decoder stream buffer is too small\n");
+      goto fin;
+    }
+
+    nghttp3_qpack_decoder_write_decoder(bq->dec, &bq->dbuf);
+
+    res->dec_ns += bench_timestamp() - t;
+    res->dec_nalloc += bq->dec_mem.nalloc - dec_nalloc;
+
+    res->nfields += nvlen;
+  }
+
+  res->nsections = nsections;
+
+  rv = 0;
+
+fin:
+  nghttp3_buf_free(&bq->ebuf, &bq->enc_mem.mem);
+  nghttp3_buf_free(&bq->rbuf, &bq->enc_mem.mem);
+  nghttp3_buf_free(&bq->pbuf, &bq->enc_mem.mem);
+  nghttp3_qpack_decoder_del(bq->dec);
+  nghttp3_qpack_encoder_del(bq->enc);
+  free(bq);
+
+  return rv;
+}
+
+static const char *strat_name(nghttp3_qpack_indexing_strat strat) {
+  switch (strat) {
+  case NGHTTP3_QPACK_INDEXING_STRAT_NONE:
+    return "none";
+  case NGHTTP3_QPACK_INDEXING_STRAT_EAGER:
+    return "eager";
+  default:
+    return "unknown";
+  }
+}
+
+static void print_usage(FILE *out) {
+  fprintf(out, "Usage: bench_qpack [-n SECTIONS]\n"
+               "\n"
+               "Encodes and decodes SECTIONS field sections (default: "
+               "20000) per\n"
+               "configuration, and reports per field and per field section "
+               "costs.\n"
+               "\n"
+               "Columns:\n"
+               "  enc-ns/f    encoder time per field in nanoseconds\n"
+               "  dec-ns/f    decoder time per field in nanoseconds\n"
+               "  bytes/fs    encoded bytes per field section\n"
+               "  ebytes/fs   encoder stream bytes per field section\n"
+               "  enc-alc/fs  encoder allocations per field section\n"
+               "  dec-alc/fs  decoder allocations per field section\n");
+}
+
+int main(int argc, char **argv) {
+  static const nghttp3_qpack_indexing_strat strats[] = {
+    NGHTTP3_QPACK_INDEXING_STRAT_NONE,
+    NGHTTP3_QPACK_INDEXING_STRAT_EAGER,
+  };
+  uint64_t nsections = 20000;
+  bench_result res;
+  size_t i, j, k, l;
+  int c;
+
+  for (c = 1; c < argc; ++c) {
+    if (strcmp(argv[c], "-n") == 0 && c + 1 < argc) {
+      if (bench_parse_uint(&nsections, argv[++c]) != 0 || nsections == 0) {
+        fprintf(stderr, "-n: invalid argument\n");
+        return EXIT_FAILURE;
+      }
+      continue;
+    }
+
+    if (strcmp(argv[c], "-h") == 0) {
+      print_usage(stdout);
+      return EXIT_SUCCESS;
+    }
+
+    print_usage(stderr);
+    return EXIT_FAILURE;
+  }
+
+  printf("%-12s %6s %7s %5s %10s %10s %10s %10s %10s %10s\n", "corpus",
+         "dtcap", "blocked", "strat", "enc-ns/f", "dec-ns/f", "bytes/fs",
+         "ebytes/fs", "enc-alc/fs", "dec-alc/fs");
+
+  for (i = 0; i < ARRLEN(corpora); ++i) {
+    for (j = 0; j < ARRLEN(dtable_capacities); ++j) {
+      for (k = 0; k < ARRLEN(blocked_streams); ++k) {
+        if (dtable_capacities[j] == 0 && k > 0) {
+          /* The blocked stream limit does not matter without dynamic
+             table. */
+          continue;
+        }
+
+        for (l = 0; l < ARRLEN(strats); ++l) {
+          if (run(&res, &corpora[i], dtable_capacities[j], blocked_streams[k],
+                  strats[l], nsections) != 0) {
+            return EXIT_FAILURE;
+          }
+
+          printf("%-12s %6zu %7zu %5s %10.1f %10.1f %10.1f %10.1f %10.2f "
+                 "%10.2f\n",
+                 corpora[i].name, dtable_capacities[j], blocked_streams[k],
+                 strat_name(strats[l]),
+                 (double)res.enc_ns / (double)res.nfields,
+                 (double)res.dec_ns / (double)res.nfields,
+                 (double)res.reqbytes / (double)res.nsections,
+                 (double)res.encstreambytes / (double)res.nsections,
+                 (double)res.enc_nalloc / (double)res.nsections,
+                 (double)res.dec_nalloc / (double)res.nsections);
+        }
+      }
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
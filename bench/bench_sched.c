@@ -0,0 +1,527 @@
+/*
+ * nghttp3
+ *
+ * Copyright (c) 2026 nghttp3 contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#ifdef HAVE_CONFIG_H
+#  include <config.h>
+#endif /* defined(HAVE_CONFIG_H) */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+
+#include <nghttp3/nghttp3.h>
+
+#include "nghttp3_tnode.h"
+#include "nghttp3_pq.h"
+#include "nghttp3_stream.h"
+#include "nghttp3_macro.h"
+
+#include "bench_util.h"
+
+/*
+ * pq_node and the functions below are the binary heap based
+ * scheduler which nghttp3_tnode_queue replaced.  They are kept here
+ * as the baseline.
+ */
+typedef struct pq_node {
+  nghttp3_pq_entry pe;
+  int64_t id;
+  uint64_t cycle;
+  int inc;
+} pq_node;
+
+#define PQ_MAX_CYCLE_GAP (1ULL << 24)
+
+static int pq_cycle_less(const nghttp3_pq_entry *lhsx,
+                         const nghttp3_pq_entry *rhsx) {
+  const pq_node *lhs = nghttp3_struct_of(lhsx, pq_node, pe);
+  const pq_node *rhs = nghttp3_struct_of(rhsx, pq_node, pe);
+
+  if (lhs->cycle == rhs->cycle) {
+    return lhs->id < rhs->id;
+  }
+
+  return rhs->cycle - lhs->cycle <= PQ_MAX_CYCLE_GAP;
+}
+
+static int pq_schedule(pq_node *node, nghttp3_pq *pq, uint64_t nwrite) {
+  uint64_t penalty = nwrite / NGHTTP3_STREAM_MIN_WRITELEN;
+  pq_node *top;
+
+  if (node->pe.index == NGHTTP3_PQ_BAD_INDEX) {
+    top = nghttp3_pq_empty(pq)
+            ? NULL
+            : nghttp3_struct_of(nghttp3_pq_top(pq), pq_node, pe);
+    node->cycle = (top ? top->cycle : 0) +
+                  ((nwrite == 0 || !node->inc) ? 0 : nghttp3_max(1, penalty));
+  } else if (nwrite > 0) {
+    if (!node->inc || nghttp3_pq_size(pq) == 1) {
+      return 0;
+    }
+
+    nghttp3_pq_remove(pq, &node->pe);
+    node->pe.index = NGHTTP3_PQ_BAD_INDEX;
+    node->cycle += nghttp3_max(1, penalty);
+  } else {
+    return 0;
+  }
+
+  return nghttp3_pq_push(pq, &node->pe);
+}
+
+static void pq_unschedule(pq_node *node, nghttp3_pq *pq) {
+  nghttp3_pq_remove(pq, &node->pe);
+  node->pe.index = NGHTTP3_PQ_BAD_INDEX;
+}
+
+/* bench_workload is the operation performed on the stream at the
+   top of the scheduler. */
+typedef enum bench_workload {
+  /* BENCH_WORKLOAD_RR writes to the top stream, and reschedules
+     it. */
+  BENCH_WORKLOAD_RR,
+  /* BENCH_WORKLOAD_CHURN finishes the top stream, and schedules a
+     new stream in its place. */
+  BENCH_WORKLOAD_CHURN,
+  /* BENCH_WORKLOAD_REVERSE unschedules the top stream, and once all
+     streams are unscheduled, schedules them again in the reverse
+     order of stream ID. */
+  BENCH_WORKLOAD_REVERSE,
+  /* BENCH_WORKLOAD_RANDOM is BENCH_WORKLOAD_REVERSE, but schedules
+     streams in a random order. */
+  BENCH_WORKLOAD_RANDOM,
+  /* BENCH_WORKLOAD_UNBLOCK unschedules the top stream as if it is
+     blocked by flow control, and schedules a blocked stream chosen at
+     random.  Half of the streams are blocked at any time. */
+  BENCH_WORKLOAD_UNBLOCK,
+} bench_workload;
+
+typedef struct bench_result {
+  uint64_t ns;
+  /* digest is the hash of the order in which streams are served.
+     Both implementations must produce the same value. */
+  uint64_t digest;
+} bench_result;
+
+static uint64_t digest_update(uint64_t digest, int64_t id) {
+  return (digest ^ (uint64_t)id) * 1099511628211ULL;
+}
+
+/*
+ * bench_rand returns the next pseudo random number from the state
+ * pointed by |px|.
+ */
+static uint64_t bench_rand(uint64_t *px) {
+  uint64_t x = *px;
+
+  x ^= x << 13;
+  x ^= x >> 7;
+  x ^= x << 17;
+
+  *px = x;
+
+  return x;
+}
+
+/*
+ * unblock_init initializes |blocked| of |n| entries for
+ * BENCH_WORKLOAD_UNBLOCK.  The streams in the latter half of |order|
+ * are blocked, and the function returns their number.
+ */
+static size_t unblock_init(size_t *blocked, const size_t *order, size_t n) {
+  size_t i, nblocked = n - n / 2;
+
+  for (i = 0; i < nblocked; ++i) {
+    blocked[i] = order[n / 2 + i];
+  }
+
+  return nblocked;
+}
+
+/*
+ * unblock_next replaces a stream chosen at random in |blocked| of
+ * |nblocked| entries with |idx|, and returns the chosen one.
+ */
+static size_t unblock_next(size_t *blocked, size_t nblocked, size_t idx,
+                           uint64_t *px) {
+  size_t i = (size_t)(bench_rand(px) % nblocked);
+  size_t res = blocked[i];
+
+  blocked[i] = idx;
+
+  return res;
+}
+
+/*
+ * order_new returns the order in which |n| streams are scheduled for
+ * |wl|.  The caller must free the returned array.  It returns NULL if
+ * it fails to allocate memory.
+ */
+static size_t *order_new(bench_workload wl, size_t n) {
+  size_t *order;
+  size_t i, j, t;
+  uint64_t x = 0x9e3779b97f4a7c15ULL;
+
+  order = malloc(sizeof(*order) * n);
+  if (order == NULL) {
+    return NULL;
+  }
+
+  for (i = 0; i < n; ++i) {
+    order[i] = wl == BENCH_WORKLOAD_REVERSE ? n - 1 - i : i;
+  }
+
+  if (wl == BENCH_WORKLOAD_RANDOM || wl == BENCH_WORKLOAD_UNBLOCK) {
+    for (i = n - 1; i > 0; --i) {
+      j = (size_t)(bench_rand(&x) % (i + 1));
+      t = order[i];
+      order[i] = order[j];
+      order[j] = t;
+    }
+  }
+
+  return order;
+}
+
+static int run_pq(bench_result *res, bench_workload wl, size_t nstreams,
+                  const size_t *order, uint64_t nops, int inc) {
+  const nghttp3_mem *mem = nghttp3_mem_default();
+  pq_node *nodes, *node;
+  nghttp3_pq pq;
+  int64_t next_id = 0;
+  uint64_t i, ts, x = 0x2545f4914f6cdd1dULL;
+  size_t j, *blocked, nblocked = 0, nsched = nstreams;
+  int rv = -1;
+
+  nodes = malloc(sizeof(*nodes) * nstreams);
+  if (nodes == NULL) {
+    return -1;
+  }
+
+  blocked = malloc(sizeof(*blocked) * nstreams);
+  if (blocked == NULL) {
+    free(nodes);
+    return -1;
+  }
+
+  if (wl == BENCH_WORKLOAD_UNBLOCK) {
+    nblocked = unblock_init(blocked, order, nstreams);
+    nsched = nstreams - nblocked;
+  }
+
+  nghttp3_pq_init(&pq, pq_cycle_less, mem);
+
+  for (j = 0; j < nstreams; ++j) {
+    nodes[j] = (pq_node){
+      .pe.index = NGHTTP3_PQ_BAD_INDEX,
+      .id = next_id,
+      .inc = inc,
+    };
+    next_id += 4;
+  }
+
+  for (j = 0; j < nsched; ++j) {
+    if (pq_schedule(&nodes[order[j]], &pq, 0) != 0) {
+      goto fin;
+    }
+  }
+
+  res->digest = 0;
+
+  ts = bench_timestamp();
+
+  for (i = 0; i < nops; ++i) {
+    node = nghttp3_struct_of(nghttp3_pq_top(&pq), pq_node, pe);
+
+    res->digest = digest_update(res->digest, node->id);
+
+    switch (wl) {
+    case BENCH_WORKLOAD_RR:
+      if (pq_schedule(node, &pq, NGHTTP3_STREAM_MIN_WRITELEN) != 0) {
+        goto fin;
+      }
+
+      break;
+    case BENCH_WORKLOAD_CHURN:
+      pq_unschedule(node, &pq);
+
+      node->id = next_id;
+      next_id += 4;
+
+      if (pq_schedule(node, &pq, 0) != 0) {
+        goto fin;
+      }
+
+      break;
+    case BENCH_WORKLOAD_REVERSE:
+    case BENCH_WORKLOAD_RANDOM:
+      pq_unschedule(node, &pq);
+
+      if (!nghttp3_pq_empty(&pq)) {
+        break;
+      }
+
+      for (j = 0; j < nstreams; ++j) {
+        if (pq_schedule(&nodes[order[j]], &pq, 0) != 0) {
+          goto fin;
+        }
+      }
+
+      break;
+    case BENCH_WORKLOAD_UNBLOCK:
+      pq_unschedule(node, &pq);
+
+      j = unblock_next(blocked, nblocked, (size_t)(node - nodes), &x);
+
+      if (pq_schedule(&nodes[j], &pq, 0) != 0) {
+        goto fin;
+      }
+
+      break;
+    }
+  }
+
+  res->ns = bench_timestamp() - ts;
+
+  rv = 0;
+
+fin:
+  nghttp3_pq_free(&pq);
+  free(blocked);
+  free(nodes);
+
+  return rv;
+}
+
+static int run_tnode_queue(bench_result *res, bench_workload wl,
+                           size_t nstreams, const size_t *order,
+                           uint64_t nops, int inc) {
+  const nghttp3_mem *mem = nghttp3_mem_default();
+  nghttp3_tnode *nodes, *node;
+  nghttp3_tnode_queue q;
+  int64_t next_id = 0;
+  uint64_t i, ts, x = 0x2545f4914f6cdd1dULL;
+  size_t j, *blocked, nblocked = 0, nsched = nstreams;
+  int rv = -1;
+
+  nodes = malloc(sizeof(*nodes) * nstreams);
+  if (nodes == NULL) {
+    return -1;
+  }
+
+  blocked = malloc(sizeof(*blocked) * nstreams);
+  if (blocked == NULL) {
+    free(nodes);
+    return -1;
+  }
+
+  if (wl == BENCH_WORKLOAD_UNBLOCK) {
+    nblocked = unblock_init(blocked, order, nstreams);
+    nsched = nstreams - nblocked;
+  }
+
+  nghttp3_tnode_queue_init(&q, mem);
+
+  for (j = 0; j < nstreams; ++j) {
+    nghttp3_tnode_init(&nodes[j], next_id);
+    nodes[j].pri.inc = (uint8_t)inc;
+    next_id += 4;
+  }
+
+  for (j = 0; j < nsched; ++j) {
+    if (nghttp3_tnode_schedule(&nodes[order[j]], &q, 0) != 0) {
+      goto fin;
+    }
+  }
+
+  res->digest = 0;
+
+  ts = bench_timestamp();
+
+  for (i = 0; i < nops; ++i) {
+    node = nghttp3_tnode_queue_top(&q);
+
+    res->digest = digest_update(res->digest, node->id);
+
+    switch (wl) {
+    case BENCH_WORKLOAD_RR:
+      if (nghttp3_tnode_schedule(node, &q, NGHTTP3_STREAM_MIN_WRITELEN) !=
+          0) {
+        goto fin;
+      }
+
+      break;
+    case BENCH_WORKLOAD_CHURN:
+      nghttp3_tnode_unschedule(node, &q);
+
+      node->id = next_id;
+      next_id += 4;
+
+      if (nghttp3_tnode_schedule(node, &q, 0) != 0) {
+        goto fin;
+      }
+
+      break;
+    case BENCH_WORKLOAD_REVERSE:
+    case BENCH_WORKLOAD_RANDOM:
+      nghttp3_tnode_unschedule(node, &q);
+
+      if (!nghttp3_tnode_queue_empty(&q)) {
+        break;
+      }
+
+      for (j = 0; j < nstreams; ++j) {
+        if (nghttp3_tnode_schedule(&nodes[order[j]], &q, 0) != 0) {
+          goto fin;
+        }
+      }
+
+      break;
+    case BENCH_WORKLOAD_UNBLOCK:
+      nghttp3_tnode_unschedule(node, &q);
+
+      j = unblock_next(blocked, nblocked, (size_t)(node - nodes), &x);
+
+      if (nghttp3_tnode_schedule(&nodes[j], &q, 0) != 0) {
+        goto fin;
+      }
+
+      break;
+    }
+  }
+
+  res->ns = bench_timestamp() - ts;
+
+  rv = 0;
+
+fin:
+  nghttp3_tnode_queue_free(&q);
+  free(blocked);
+  free(nodes);
+
+  return rv;
+}
+
+static const size_t nstreams_list[] = {10, 1000, 50000};
+
+static void print_usage(FILE *out) {
+  fprintf(out, "Usage: bench_sched [-n OPS]\n"
+               "\n"
+               "Runs OPS scheduler operations (default: 2000000) per "
+               "configuration\n"
+               "with the binary heap scheduler (pq) and the calendar "
+               "queue\n"
+               "scheduler (tnode_queue), and reports the time per "
+               "operation.\n"
+               "\n"
+               "Workloads:\n"
+               "  rr       write to the top stream, and reschedule it\n"
+               "  churn    finish the top stream, and schedule a new one\n"
+               "  reverse  unschedule the top stream, and reschedule all\n"
+               "           streams in the reverse order of stream ID\n"
+               "  random   unschedule the top stream, and reschedule all\n"
+               "           streams in a random order\n"
+               "  unblock  unschedule the top stream, and schedule one of "
+               "the\n"
+               "           unscheduled streams chosen at random\n");
+}
+
+int main(int argc, char **argv) {
+  static const struct {
+    const char *name;
+    bench_workload wl;
+    int inc;
+  } workloads[] = {
+    {"rr", BENCH_WORKLOAD_RR, 1},
+    {"churn", BENCH_WORKLOAD_CHURN, 1},
+    {"churn", BENCH_WORKLOAD_CHURN, 0},
+    {"reverse", BENCH_WORKLOAD_REVERSE, 0},
+    {"random", BENCH_WORKLOAD_RANDOM, 0},
+    {"unblock", BENCH_WORKLOAD_UNBLOCK, 0},
+  };
+  uint64_t nops = 2000000;
+  bench_result pqres, qres;
+  size_t *order;
+  size_t i, j;
+  int c, rv;
+
+  for (c = 1; c < argc; ++c) {
+    if (strcmp(argv[c], "-n") == 0 && c + 1 < argc) {
+      if (bench_parse_uint(&nops, argv[++c]) != 0 || nops == 0) {
+        fprintf(stderr, "-n: invalid argument\n");
+        return EXIT_FAILURE;
+      }
+      continue;
+    }
+
+    if (strcmp(argv[c], "-h") == 0) {
+      print_usage(stdout);
+      return EXIT_SUCCESS;
+    }
+
+    print_usage(stderr);
+    return EXIT_FAILURE;
+  }
+
+  printf("%-8s %3s %8s %10s %10s %8s\n", "workload", "inc", "streams",
+         "pq-ns/op", "tq-ns/op", "speedup");
+
+  for (i = 0; i < ARRLEN(workloads); ++i) {
+    for (j = 0; j < ARRLEN(nstreams_list); ++j) {
+      order = order_new(workloads[i].wl, nstreams_list[j]);
+      if (order == NULL) {
+        fprintf(stderr, "out of memory\n");
+        return EXIT_FAILURE;
+      }
+
+      rv = run_pq(&pqres, workloads[i].wl, nstreams_list[j], order, nops,
+                  workloads[i].inc);
+      if (rv == 0) {
+        rv = run_tnode_queue(&qres, workloads[i].wl, nstreams_list[j], order,
+                             nops, workloads[i].inc);
+      }
+
+      free(order);
+
+      if (rv != 0) {
+        fprintf(stderr, "out of memory\n");
+        return EXIT_FAILURE;
+      }
+
+      if (pqres.digest != qres.digest) {
+        fprintf(stderr, "%s: scheduling order differs with %zu streams\n",
+                workloads[i].name, nstreams_list[j]);
+        return EXIT_FAILURE;
+      }
+
+      printf("%-8s %3d %8zu %10.1f %10.1f %8.2f\n", workloads[i].name,
+             workloads[i].inc, nstreams_list[j],
+             (double)pqres.ns / (double)nops, (double)qres.ns / (double)nops,
+             (double)pqres.ns / (double)qres.ns);
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,440 @@
+/*
+ * nghttp3
+ *
+ * Copyright (c) 2026 nghttp3 contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#ifdef HAVE_CONFIG_H
+#  include <config.h>
+#endif /* defined(HAVE_CONFIG_H) */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+
+#include <nghttp3/nghttp3.h>
+
+#include "nghttp3_qpack.h"
+
+#include "bench_util.h"
+
+typedef struct bench_name {
+  const uint8_t *name;
+  size_t namelen;
+} bench_name;
+
+#define MAKE_NAME(NAME)                                                        \
+  {                                                                            \
+    .name = (uint8_t *)(NAME),                                                 \
+    .namelen = sizeof(NAME) - 1,                                               \
+  }
+
+/* browser_req_names are the field names of the browser requests in
+   bench_qpack. */
+static const bench_name browser_req_names[] = {
+  MAKE_NAME(":method"),
+  MAKE_NAME(":scheme"),
+  MAKE_NAME(":authority"),
+  MAKE_NAME(":path"),
+  MAKE_NAME("user-agent"),
+  MAKE_NAME("accept"),
+  MAKE_NAME("accept-encoding"),
+  MAKE_NAME("accept-language"),
+  MAKE_NAME("cookie"),
+  MAKE_NAME("sec-ch-ua"),
+  MAKE_NAME("sec-ch-ua-mobile"),
+  MAKE_NAME("sec-ch-ua-platform"),
+  MAKE_NAME("referer"),
+  MAKE_NAME("sec-fetch-dest"),
+  MAKE_NAME("sec-fetch-mode"),
+  MAKE_NAME("sec-fetch-site"),
+  MAKE_NAME("priority"),
+};
+
+/* api_resp_names are the field names of the API responses in
+   bench_qpack. */
+static const bench_name api_resp_names[] = {
+  MAKE_NAME(":status"),
+  MAKE_NAME("date"),
+  MAKE_NAME("server"),
+  MAKE_NAME("vary"),
+  MAKE_NAME("strict-transport-security"),
+  MAKE_NAME("x-request-id"),
+  MAKE_NAME("content-type"),
+  MAKE_NAME("content-length"),
+  MAKE_NAME("cache-control"),
+  MAKE_NAME("access-control-allow-origin"),
+  MAKE_NAME("access-control-allow-credentials"),
+  MAKE_NAME("x-ratelimit-limit"),
+  MAKE_NAME("x-ratelimit-remaining"),
+  MAKE_NAME("etag"),
+  MAKE_NAME("last-modified"),
+  MAKE_NAME("content-encoding"),
+};
+
+/* custom_names are the field names which do not have a token.  Some
+   of them share the length and the last byte with a token. */
+static const bench_name custom_names[] = {
+  MAKE_NAME("x-request-id"),
+  MAKE_NAME("x-ratelimit-limit"),
+  MAKE_NAME("x-ratelimit-remaining"),
+  MAKE_NAME("x-amz-cf-id"),
+  MAKE_NAME("x-cache"),
+  MAKE_NAME("x-served-by"),
+  MAKE_NAME("x-envoy-upstream-service-time"),
+  MAKE_NAME("cf-ray"),
+  MAKE_NAME("nel"),
+  MAKE_NAME("report-to"),
+  MAKE_NAME("sec-fetch-dest"),
+  MAKE_NAME("sec-fetch-user"),
+  MAKE_NAME("traceparent"),
+  MAKE_NAME("content-typo"),
+  MAKE_NAME("x-powered-by"),
+  MAKE_NAME("permissions-policy"),
+};
+
+static const struct {
+  const char *name;
+  const bench_name *names;
+  size_t nnames;
+} mixes[] = {
+  {"browser-req", browser_req_names, ARRLEN(browser_req_names)},
+  {"api-resp", api_resp_names, ARRLEN(api_resp_names)},
+  {"custom", custom_names, ARRLEN(custom_names)},
+};
+
+/* Generated by genlibtokenlookup.py --hash */
+#define QPACK_TOKEN_MIN_NAMELEN 2
+#define QPACK_TOKEN_MAX_NAMELEN 32
+#define QPACK_TOKEN_HASH_MUL 0xC4ACEB37U
+#define QPACK_TOKEN_HASH_BITS 8
+
+/* qpack_token_name_pool is the concatenation of the names. */
+static const uint8_t qpack_token_name_pool[] =
+  ":authority"
+  ":method"
+  ":path"
+  ":protocol"
+  ":scheme"
+  ":status"
+  "accept"
+  "accept-encoding"
+  "accept-language"
+  "accept-ranges"
+  "access-control-allow-credentials"
+  "access-control-allow-headers"
+  "access-control-allow-methods"
+  "access-control-allow-origin"
+  "access-control-expose-headers"
+  "access-control-request-headers"
+  "access-control-request-method"
+  "age"
+  "alt-svc"
+  "authorization"
+  "cache-control"
+  "connection"
+  "content-disposition"
+  "content-encoding"
+  "content-length"
+  "content-security-policy"
+  "content-type"
+  "cookie"
+  "date"
+  "early-data"
+  "etag"
+  "expect-ct"
+  "forwarded"
+  "host"
+  "if-modified-since"
+  "if-none-match"
+  "if-range"
+  "keep-alive"
+  "last-modified"
+  "link"
+  "location"
+  "origin"
+  "priority"
+  "proxy-connection"
+  "purpose"
+  "range"
+  "referer"
+  "server"
+  "set-cookie"
+  "strict-transport-security"
+  "te"
+  "timing-allow-origin"
+  "transfer-encoding"
+  "upgrade"
+  "upgrade-insecure-requests"
+  "user-agent"
+  "vary"
+  "x-content-type-options"
+  "x-forwarded-for"
+  "x-frame-options"
+  "x-xss-protection"
+  ;
+
+typedef struct qpack_token_slot {
+  /* name_offset is the offset of the name in qpack_token_name_pool. */
+  uint16_t name_offset;
+  /* namelen is the length of the name, or 0 if the slot is empty. */
+  uint8_t namelen;
+  int16_t token;
+} qpack_token_slot;
+
+static const qpack_token_slot qpack_token_slots[1 << QPACK_TOKEN_HASH_BITS] = {
+  [3] = {81, 13, NGHTTP3_QPACK_TOKEN_ACCEPT_RANGES},
+  [4] = {238, 30, NGHTTP3_QPACK_TOKEN_ACCESS_CONTROL_REQUEST_HEADERS},
+  [5] = {451, 9, NGHTTP3_QPACK_TOKEN_EXPECT_CT},
+  [6] = {10, 7, NGHTTP3_QPACK_TOKEN__METHOD},
+  [10] = {94, 32, NGHTTP3_QPACK_TOKEN_ACCESS_CONTROL_ALLOW_CREDENTIALS},
+  [12] = {320, 13, NGHTTP3_QPACK_TOKEN_CACHE_CONTROL},
+  [14] = {638, 19, NGHTTP3_QPACK_TOKEN_TIMING_ALLOW_ORIGIN},
+  [15] = {742, 15, NGHTTP3_QPACK_TOKEN_X_FORWARDED_FOR},
+  [19] = {511, 10, NGHTTP3_QPACK_TOKEN_KEEP_ALIVE},
+  [20] = {534, 4, NGHTTP3_QPACK_TOKEN_LINK},
+  [22] = {343, 19, NGHTTP3_QPACK_TOKEN_CONTENT_DISPOSITION},
+  [24] = {460, 9, NGHTTP3_QPACK_TOKEN_FORWARDED},
+  [32] = {307, 13, NGHTTP3_QPACK_TOKEN_AUTHORIZATION},
+  [41] = {297, 3, NGHTTP3_QPACK_TOKEN_AGE},
+  [43] = {636, 2, NGHTTP3_QPACK_TOKEN_TE},
+  [44] = {333, 10, NGHTTP3_QPACK_TOKEN_CONNECTION},
+  [46] = {583, 5, NGHTTP3_QPACK_TOKEN_RANGE},
+  [55] = {490, 13, NGHTTP3_QPACK_TOKEN_IF_NONE_MATCH},
+  [56] = {521, 13, NGHTTP3_QPACK_TOKEN_LAST_MODIFIED},
+  [61] = {51, 15, NGHTTP3_QPACK_TOKEN_ACCEPT_ENCODING},
+  [64] = {209, 29, NGHTTP3_QPACK_TOKEN_ACCESS_CONTROL_EXPOSE_HEADERS},
+  [69] = {268, 29, NGHTTP3_QPACK_TOKEN_ACCESS_CONTROL_REQUEST_METHOD},
+  [72] = {22, 9, NGHTTP3_QPACK_TOKEN__PROTOCOL},
+  [83] = {437, 10, NGHTTP3_QPACK_TOKEN_EARLY_DATA},
+  [91] = {757, 15, NGHTTP3_QPACK_TOKEN_X_FRAME_OPTIONS},
+  [92] = {362, 16, NGHTTP3_QPACK_TOKEN_CONTENT_ENCODING},
+  [94] = {182, 27, NGHTTP3_QPACK_TOKEN_ACCESS_CONTROL_ALLOW_ORIGIN},
+  [96] = {552, 8, NGHTTP3_QPACK_TOKEN_PRIORITY},
+  [97] = {66, 15, NGHTTP3_QPACK_TOKEN_ACCEPT_LANGUAGE},
+  [100] = {576, 7, NGHTTP3_QPACK_TOKEN_PURPOSE},
+  [103] = {31, 7, NGHTTP3_QPACK_TOKEN__SCHEME},
+  [104] = {503, 8, NGHTTP3_QPACK_TOKEN_IF_RANGE},
+  [111] = {0, 10, NGHTTP3_QPACK_TOKEN__AUTHORITY},
+  [118] = {611, 25, NGHTTP3_QPACK_TOKEN_STRICT_TRANSPORT_SECURITY},
+  [123] = {126, 28, NGHTTP3_QPACK_TOKEN_ACCESS_CONTROL_ALLOW_HEADERS},
+  [127] = {392, 23, NGHTTP3_QPACK_TOKEN_CONTENT_SECURITY_POLICY},
+  [132] = {716, 4, NGHTTP3_QPACK_TOKEN_VARY},
+  [134] = {681, 25, NGHTTP3_QPACK_TOKEN_UPGRADE_INSECURE_REQUESTS},
+  [136] = {601, 10, NGHTTP3_QPACK_TOKEN_SET_COOKIE},
+  [140] = {447, 4, NGHTTP3_QPACK_TOKEN_ETAG},
+  [141] = {378, 14, NGHTTP3_QPACK_TOKEN_CONTENT_LENGTH},
+  [144] = {560, 16, NGHTTP3_QPACK_TOKEN_PROXY_CONNECTION},
+  [148] = {595, 6, NGHTTP3_QPACK_TOKEN_SERVER},
+  [150] = {300, 7, NGHTTP3_QPACK_TOKEN_ALT_SVC},
+  [156] = {657, 17, NGHTTP3_QPACK_TOKEN_TRANSFER_ENCODING},
+  [158] = {154, 28, NGHTTP3_QPACK_TOKEN_ACCESS_CONTROL_ALLOW_METHODS},
+  [165] = {473, 17, NGHTTP3_QPACK_TOKEN_IF_MODIFIED_SINCE},
+  [167] = {427, 6, NGHTTP3_QPACK_TOKEN_COOKIE},
+  [172] = {588, 7, NGHTTP3_QPACK_TOKEN_REFERER},
+  [177] = {546, 6, NGHTTP3_QPACK_TOKEN_ORIGIN},
+  [178] = {415, 12, NGHTTP3_QPACK_TOKEN_CONTENT_TYPE},
+  [179] = {706, 10, NGHTTP3_QPACK_TOKEN_USER_AGENT},
+  [183] = {538, 8, NGHTTP3_QPACK_TOKEN_LOCATION},
+  [187] = {720, 22, NGHTTP3_QPACK_TOKEN_X_CONTENT_TYPE_OPTIONS},
+  [195] = {38, 7, NGHTTP3_QPACK_TOKEN__STATUS},
+  [230] = {433, 4, NGHTTP3_QPACK_TOKEN_DATE},
+  [231] = {469, 4, NGHTTP3_QPACK_TOKEN_HOST},
+  [241] = {17, 5, NGHTTP3_QPACK_TOKEN__PATH},
+  [245] = {45, 6, NGHTTP3_QPACK_TOKEN_ACCEPT},
+  [247] = {772, 16, NGHTTP3_QPACK_TOKEN_X_XSS_PROTECTION},
+  [252] = {674, 7, NGHTTP3_QPACK_TOKEN_UPGRADE},
+};
+
+/*
+ * qpack_token_name_eq returns nonzero if |a| and |b| of length |len|
+ * are equal.  |len| must be at least 2.  The names are compared with
+ * the loads of fixed size, the last of which may overlap the previous
+ * one, so that it does not call memcmp.
+ */
+static int qpack_token_name_eq(const uint8_t *a, const uint8_t *b,
+                               size_t len) {
+  uint64_t x, y;
+  uint32_t s, t;
+  uint16_t u, v;
+
+  if (len >= 8) {
+    for (; len > 8; a += 8, b += 8, len -= 8) {
+      memcpy(&x, a, 8);
+      memcpy(&y, b, 8);
+      if (x != y) {
+        return 0;
+      }
+    }
+
+    memcpy(&x, a + len - 8, 8);
+    memcpy(&y, b + len - 8, 8);
+
+    return x == y;
+  }
+
+  if (len >= 4) {
+    memcpy(&s, a, 4);
+    memcpy(&t, b, 4);
+    if (s != t) {
+      return 0;
+    }
+
+    memcpy(&s, a + len - 4, 4);
+    memcpy(&t, b + len - 4, 4);
+
+    return s == t;
+  }
+
+  memcpy(&u, a, 2);
+  memcpy(&v, b, 2);
+  if (u != v) {
+    return 0;
+  }
+
+  memcpy(&u, a + len - 2, 2);
+  memcpy(&v, b + len - 2, 2);
+
+  return u == v;
+}
+
+static int32_t hash_lookup_token(const uint8_t *name, size_t namelen) {
+  const qpack_token_slot *slot;
+  uint32_t key;
+
+  if (namelen < QPACK_TOKEN_MIN_NAMELEN ||
+      namelen > QPACK_TOKEN_MAX_NAMELEN) {
+    return -1;
+  }
+
+  key = (uint32_t)namelen | (uint32_t)name[0] << 8 |
+        (uint32_t)name[namelen - 2] << 16 | (uint32_t)name[namelen - 1] << 24;
+
+  slot = &qpack_token_slots[(key * QPACK_TOKEN_HASH_MUL) >>
+                            (32 - QPACK_TOKEN_HASH_BITS)];
+
+  /* An empty slot has namelen 0, which never matches. */
+  if (slot->namelen != namelen ||
+      !qpack_token_name_eq(qpack_token_name_pool + slot->name_offset, name,
+                           namelen)) {
+    return -1;
+  }
+
+  return slot->token;
+}
+
+typedef int32_t (*bench_lookup_token)(const uint8_t *name, size_t namelen);
+
+typedef struct bench_result {
+  uint64_t ns;
+  /* digest is the sum of the tokens looked up. */
+  uint64_t digest;
+} bench_result;
+
+static void run(bench_result *res, bench_lookup_token lookup_token,
+                const bench_name *names, size_t nnames, uint64_t nops) {
+  uint64_t i, ts, digest = 0;
+  size_t j = 0;
+
+  ts = bench_timestamp();
+
+  for (i = 0; i < nops; ++i) {
+    digest += (uint64_t)lookup_token(names[j].name, names[j].namelen);
+
+    if (++j == nnames) {
+      j = 0;
+    }
+  }
+
+  res->ns = bench_timestamp() - ts;
+  res->digest = digest;
+}
+
+static void print_usage(FILE *out) {
+  fprintf(out, "Usage: bench_token [-n OPS]\n"
+               "\n"
+               "Looks up the tokens of OPS field names (default: 10000000) "
+               "per\n"
+               "header mix with the switch based lookup function of the "
+               "library\n"
+               "(switch) and a perfect hash (hash), and reports the time per "
+               "lookup.\n");
+}
+
+int main(int argc, char **argv) {
+  /* Both functions are called through a pointer so that neither is
+     inlined into the loop. */
+  static const bench_lookup_token volatile lookups[] = {
+    nghttp3_qpack_lookup_token,
+    hash_lookup_token,
+  };
+  uint64_t nops = 10000000;
+  bench_result swres, hashres;
+  size_t i, j;
+  int c;
+
+  for (c = 1; c < argc; ++c) {
+    if (strcmp(argv[c], "-n") == 0 && c + 1 < argc) {
+      if (bench_parse_uint(&nops, argv[++c]) != 0 || nops == 0) {
+        fprintf(stderr, "-n: invalid argument\n");
+        return EXIT_FAILURE;
+      }
+      continue;
+    }
+
+    if (strcmp(argv[c], "-h") == 0) {
+      print_usage(stdout);
+      return EXIT_SUCCESS;
+    }
+
+    print_usage(stderr);
+    return EXIT_FAILURE;
+  }
+
+  printf("%-12s %10s %10s %8s\n", "mix", "switch-ns", "hash-ns", "speedup");
+
+  for (i = 0; i < ARRLEN(mixes); ++i) {
+    for (j = 0; j < mixes[i].nnames; ++j) {
+      if (lookups[0](mixes[i].names[j].name, mixes[i].names[j].namelen) !=
+          lookups[1](mixes[i].names[j].name, mixes[i].names[j].namelen)) {
+        fprintf(stderr, "%s: token differs for %.*s\n", mixes[i].name,
+                (int)mixes[i].names[j].namelen,
+                (const char *)mixes[i].names[j].name);
+        return EXIT_FAILURE;
+      }
+    }
+
+    run(&swres, lookups[0], mixes[i].names, mixes[i].nnames, nops);
+    run(&hashres, lookups[1], mixes[i].names, mixes[i].nnames, nops);
+
+    if (swres.digest != hashres.digest) {
+      fprintf(stderr, "%s: tokens differ\n", mixes[i].name);
+      return EXIT_FAILURE;
+    }
+
+    printf("%-12s %10.2f %10.2f %8.2f\n", mixes[i].name,
+           (double)swres.ns / (double)nops, (double)hashres.ns / (double)nops,
+           (double)swres.ns / (double)hashres.ns);
+  }
+
+  return EXIT_SUCCESS;
+}
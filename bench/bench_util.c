@@ -0,0 +1,126 @@
+/*
+ * nghttp3
+ *
+ * Copyright (c) 2026 nghttp3 contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "bench_util.h"
+
+#include <stdlib.h>
+#include <time.h>
+
+static void *bench_malloc(size_t size, void *user_data) {
+  bench_mem *bm = user_data;
+  void *p = malloc(size);
+
+  if (p) {
+    ++bm->nalloc;
+  }
+
+  return p;
+}
+
+static void bench_free(void *ptr, void *user_data) {
+  bench_mem *bm = user_data;
+
+  if (ptr) {
+    ++bm->nfree;
+  }
+
+  free(ptr);
+}
+
+static void *bench_calloc(size_t nmemb, size_t size, void *user_data) {
+  bench_mem *bm = user_data;
+  void *p = calloc(nmemb, size);
+
+  if (p) {
+    ++bm->nalloc;
+  }
+
+  return p;
+}
+
+static void *bench_realloc(void *ptr, size_t size, void *user_data) {
+  bench_mem *bm = user_data;
+  void *p = realloc(ptr, size);
+
+  if (p && !ptr) {
+    ++bm->nalloc;
+  } else if (p && p != ptr) {
+    /* A moved block costs another allocation. */
+    ++bm->nalloc;
+    ++bm->nfree;
+  }
+
+  return p;
+}
+
+void bench_mem_init(bench_mem *bm) {
+  *bm = (bench_mem){
+    .mem =
+      {
+        .user_data = bm,
+        .malloc = bench_malloc,
+        .free = bench_free,
+        .calloc = bench_calloc,
+        .realloc = bench_realloc,
+      },
+  };
+}
+
+static uint64_t timespec_ns(const struct timespec *ts) {
+  return (uint64_t)ts->tv_sec * 1000000000ULL + (uint64_t)ts->tv_nsec;
+}
+
+uint64_t bench_timestamp(void) {
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+
+  return timespec_ns(&ts);
+}
+
+uint64_t bench_cputime(void) {
+  struct timespec ts;
+
+  clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+
+  return timespec_ns(&ts);
+}
+
+int bench_parse_uint(uint64_t *dest, const char *s) {
+  char *end;
+  unsigned long long n;
+
+  if (*s == '\0') {
+    return -1;
+  }
+
+  n = strtoull(s, &end, 10);
+  if (*end != '\0') {
+    return -1;
+  }
+
+  *dest = (uint64_t)n;
+
+  return 0;
+}
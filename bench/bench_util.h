@@ -0,0 +1,79 @@
+/*
+ * nghttp3
+ *
+ * Copyright (c) 2026 nghttp3 contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#ifndef BENCH_UTIL_H
+#define BENCH_UTIL_H
+
+#ifdef HAVE_CONFIG_H
+#  include <config.h>
+#endif /* defined(HAVE_CONFIG_H) */
+
+#include <nghttp3/nghttp3.h>
+
+#define MAKE_NV(NAME, VALUE)                                                   \
+  {                                                                            \
+    .name = (uint8_t *)(NAME),                                                 \
+    .value = (uint8_t *)(VALUE),                                               \
+    .namelen = sizeof(NAME) - 1,                                               \
+    .valuelen = sizeof(VALUE) - 1,                                             \
+  }
+
+#define ARRLEN(A) (sizeof(A) / sizeof(A[0]))
+
+/*
+ * bench_mem is a memory allocator which counts allocations.  It
+ * forwards requests to malloc, calloc, realloc, and free.
+ */
+typedef struct bench_mem {
+  nghttp3_mem mem;
+  /* nalloc is the number of successful malloc, calloc, and realloc
+     calls which allocated a new block. */
+  uint64_t nalloc;
+  /* nfree is the number of free calls with non-NULL pointer. */
+  uint64_t nfree;
+} bench_mem;
+
+/*
+ * bench_mem_init initializes |bm|.
+ */
+void bench_mem_init(bench_mem *bm);
+
+/*
+ * bench_timestamp returns the current monotonic time in nanoseconds.
+ */
+uint64_t bench_timestamp(void);
+
+/*
+ * bench_cputime returns the CPU time consumed by this process in
+ * nanoseconds.
+ */
+uint64_t bench_cputime(void);
+
+/*
+ * bench_parse_uint parses |s| as a decimal unsigned integer, and
+ * assigns it to |*dest|.  It returns 0 if it succeeds, or -1.
+ */
+int bench_parse_uint(uint64_t *dest, const char *s);
+
+#endif /* !defined(BENCH_UTIL_H) */
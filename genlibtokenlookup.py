@@ -1,5 +1,12 @@
 #!/usr/bin/env python3
 
+# This script generates nghttp3_qpack_lookup_token in
+# lib/nghttp3_qpack.c from HEADERS.  With --hash, it generates the
+# perfect hash based lookup function which bench/bench_token.c
+# compares with it.
+
+import sys
+
 HEADERS = [
     (':authority', 0),
     (':path', 1),
@@ -121,6 +128,180 @@ def to_enum_hd(k):
         res += c
     return res
 
+# The perfect hash lookup function is a perfect hash over the names in
+# HEADERS.  A
+# name is reduced to a 32 bit key made of its length, its first byte,
+# and its last 2 bytes, which are distinct among HEADERS.  The key is
+# multiplied by the constant that find_hash_mul finds, and the top
+# HASH_BITS bits index qpack_token_slots.  A slot holds the length,
+# the token, and the offset in qpack_token_name_pool of the name that
+# has the hash, or the length 0 if no name has it.  Then the name is
+# compared once with the one at the offset.
+
+HASH_BITS = 8
+
+def unique_names(headers):
+    res = []
+    for k, _ in headers:
+        if k not in res:
+            res.append(k)
+    return res
+
+def name_key(k):
+    b = k.encode()
+    return len(b) | b[0] << 8 | b[-2] << 16 | b[-1] << 24
+
+def token_hash(mul, key):
+    return ((key * mul) & 0xFFFFFFFF) >> (32 - HASH_BITS)
+
+def find_hash_mul(keys):
+    # Search the odd multipliers in a fixed order so that the output
+    # is reproducible.
+    mul = 0x9E3779B1
+    for _ in range(1 << 20):
+        hashes = set(token_hash(mul, k) for k in keys)
+        if len(hashes) == len(keys):
+            return mul
+        mul = ((mul + 0x3C6EF372) & 0xFFFFFFFF) | 1
+    raise Exception('could not find a perfect hash')
+
+def build_perfect_hash(names):
+    keys = [name_key(k) for k in names]
+    if len(set(keys)) != len(keys):
+        raise Exception('name keys are not unique')
+
+    mul = find_hash_mul(keys)
+
+    slots = [None] * (1 << HASH_BITS)
+    for i, k in enumerate(keys):
+        slots[token_hash(mul, k)] = i
+
+    return mul, slots
+
+def gen_hash_index_header(fname):
+    names = sorted(unique_names(HEADERS))
+    mul, slots = build_perfect_hash(names)
+    offsets = []
+    off = 0
+    for k in names:
+        offsets.append(off)
+        off += len(k)
+    print('''\
+#define QPACK_TOKEN_MIN_NAMELEN {}
+#define QPACK_TOKEN_MAX_NAMELEN {}
+#define QPACK_TOKEN_HASH_MUL 0x{:08X}U
+#define QPACK_TOKEN_HASH_BITS {}
+
+/* qpack_token_name_pool is the concatenation of the names. */
+static const uint8_t qpack_token_name_pool[] ='''.format(
+    min(len(k) for k in names), max(len(k) for k in names), mul,
+    HASH_BITS))
+    for k in names:
+        print('  "{}"'.format(k))
+    print('''  ;
+
+typedef struct qpack_token_slot {
+  /* name_offset is the offset of the name in qpack_token_name_pool. */
+  uint16_t name_offset;
+  /* namelen is the length of the name, or 0 if the slot is empty. */
+  uint8_t namelen;
+  int16_t token;
+} qpack_token_slot;
+
+static const qpack_token_slot qpack_token_slots[1 << QPACK_TOKEN_HASH_BITS] = {''')
+    # The slots which are not listed are zero initialized, and empty.
+    for i, n in enumerate(slots):
+        if n is None:
+            continue
+        k = names[n]
+        line = '  [{}] = {{{}, {}, {}}},'.format(i, offsets[n], len(k),
+                                               to_enum_hd(k))
+        if len(line) > 80:
+            line = '  [{}] =\n    {{{}, {}, {}}},'.format(i, offsets[n], len(k),
+                                                   to_enum_hd(k))
+        print(line)
+    print('''\
+};
+
+/*
+ * qpack_token_name_eq returns nonzero if |a| and |b| of length |len|
+ * are equal.  |len| must be at least 2.  The names are compared with
+ * the loads of fixed size, the last of which may overlap the previous
+ * one, so that it does not call memcmp.
+ */
+static int qpack_token_name_eq(const uint8_t *a, const uint8_t *b,
+                               size_t len) {
+  uint64_t x, y;
+  uint32_t s, t;
+  uint16_t u, v;
+
+  if (len >= 8) {
+    for (; len > 8; a += 8, b += 8, len -= 8) {
+      memcpy(&x, a, 8);
+      memcpy(&y, b, 8);
+      if (x != y) {
+        return 0;
+      }
+    }
+
+    memcpy(&x, a + len - 8, 8);
+    memcpy(&y, b + len - 8, 8);
+
+    return x == y;
+  }
+
+  if (len >= 4) {
+    memcpy(&s, a, 4);
+    memcpy(&t, b, 4);
+    if (s != t) {
+      return 0;
+    }
+
+    memcpy(&s, a + len - 4, 4);
+    memcpy(&t, b + len - 4, 4);
+
+    return s == t;
+  }
+
+  memcpy(&u, a, 2);
+  memcpy(&v, b, 2);
+  if (u != v) {
+    return 0;
+  }
+
+  memcpy(&u, a + len - 2, 2);
+  memcpy(&v, b + len - 2, 2);
+
+  return u == v;
+}
+''')
+    print('static int32_t {}(const uint8_t *name, size_t namelen) {{'.format(
+        fname))
+    print('''\
+  const qpack_token_slot *slot;
+  uint32_t key;
+
+  if (namelen < QPACK_TOKEN_MIN_NAMELEN ||
+      namelen > QPACK_TOKEN_MAX_NAMELEN) {
+    return -1;
+  }
+
+  key = (uint32_t)namelen | (uint32_t)name[0] << 8 |
+        (uint32_t)name[namelen - 2] << 16 | (uint32_t)name[namelen - 1] << 24;
+
+  slot = &qpack_token_slots[(key * QPACK_TOKEN_HASH_MUL) >>
+                            (32 - QPACK_TOKEN_HASH_BITS)];
+
+  /* An empty slot has namelen 0, which never matches. */
+  if (slot->namelen != namelen ||
+      !qpack_token_name_eq(qpack_token_name_pool + slot->name_offset, name,
+                           namelen)) {
+    return -1;
+  }
+
+  return slot->token;
+}''')
+
 def build_header(headers):
     res = {}
     for k, _ in headers:
@@ -138,7 +319,7 @@ def build_header(headers):
 
 def gen_index_header():
     print('''\
-static int32_t lookup_token(const uint8_t *name, size_t namelen) {
+int32_t nghttp3_qpack_lookup_token(const uint8_t *name, size_t namelen) {
   switch (namelen) {''')
     b = build_header(HEADERS)
     for size in sorted(b.keys()):
@@ -167,4 +348,7 @@ static int32_t lookup_token(const uint8_t *name, size_t namelen) {
 }''')
 
 if __name__ == '__main__':
-    gen_index_header()
+    if len(sys.argv) > 1 and sys.argv[1] == '--hash':
+        gen_hash_index_header('hash_lookup_token')
+    else:
+        gen_index_header()
@@ -679,6 +679,28 @@ NGHTTP3_EXTERN nghttp3_vec nghttp3_rcbuf_get_buf(const nghttp3_rcbuf *rcbuf);
  */
 NGHTTP3_EXTERN int nghttp3_rcbuf_is_static(const nghttp3_rcbuf *rcbuf);
 
+/**
+ * @function
+ *
+ * `nghttp3_rcbuf_is_borrowed` returns nonzero if |rcbuf| is a
+ * borrowed view into the buffer passed to the library, and 0
+ * otherwise.  A borrowed view is only valid until the callback (or
+ * the function call) that it is passed to returns.
+ * `nghttp3_rcbuf_incref` and `nghttp3_rcbuf_decref` do nothing for a
+ * borrowed view; application must copy the buffer if it needs it
+ * later.
+ *
+ * Unlike the other field names and values that the library decodes,
+ * the buffer of a borrowed view is NOT NULL-terminated: the byte
+ * after its end belongs to the next data in the input.  Application
+ * must use the length returned by `nghttp3_rcbuf_get_buf`, and must
+ * not pass the buffer to the functions that expect a NULL-terminated
+ * string.  See `nghttp3_qpack_decoder_set_borrow_literals`.
+ *
+ * .. version-added:: 1.18.0
+ */
+NGHTTP3_EXTERN int nghttp3_rcbuf_is_borrowed(const nghttp3_rcbuf *rcbuf);
+
 /**
  * @struct
  *
@@ -1140,12 +1162,14 @@ typedef enum nghttp3_qpack_token {
 typedef struct nghttp3_qpack_nv {
   /**
    * :member:`name` is the buffer containing HTTP field name.
-   * NULL-termination is guaranteed.
+   * NULL-termination is guaranteed unless it is a borrowed view (see
+   * `nghttp3_rcbuf_is_borrowed`).
    */
   nghttp3_rcbuf *name;
   /**
    * :member:`value` is the buffer containing HTTP field value.
-   * NULL-termination is guaranteed.
+   * NULL-termination is guaranteed unless it is a borrowed view (see
+   * `nghttp3_rcbuf_is_borrowed`).
    */
   nghttp3_rcbuf *value;
   /**
@@ -1296,6 +1320,84 @@ NGHTTP3_EXTERN int nghttp3_qpack_encoder_encode(
   nghttp3_qpack_encoder *encoder, nghttp3_buf *pbuf, nghttp3_buf *rbuf,
   nghttp3_buf *ebuf, int64_t stream_id, const nghttp3_nv *nva, size_t nvlen);
 
+/**
+ * @struct
+ *
+ * :type:`nghttp3_prepared_nva` is a list of HTTP fields which is
+ * compiled once, and encoded many times.  It stores the copy of the
+ * fields, and the part of QPACK encoding which does not depend on
+ * the dynamic table, such as name tokens, hash values, static table
+ * matches, and the encoded field line representations which do not
+ * reference the dynamic table.  It is immutable once created, and
+ * can be shared by any number of encoders and connections.  The
+ * details of this structure are intentionally hidden from the public
+ * API.
+ *
+ * .. version-added:: 1.18.0
+ */
+typedef struct nghttp3_prepared_nva nghttp3_prepared_nva;
+
+/**
+ * @function
+ *
+ * `nghttp3_prepared_nva_new` compiles the list of HTTP fields |nva|
+ * of length |nvlen| into :type:`nghttp3_prepared_nva`, and assigns
+ * its pointer to |*ppnva| if it succeeds.  The names and values are
+ * copied, and the names are lowercased.
+ * :macro:`NGHTTP3_NV_FLAG_NO_COPY_NAME` and
+ * :macro:`NGHTTP3_NV_FLAG_NO_COPY_VALUE` are ignored.  |mem| is a
+ * memory allocator.  If |mem| is NULL, the default memory allocator
+ * is used.
+ *
+ * The result of encoding a prepared list is the same as encoding the
+ * original list with `nghttp3_qpack_encoder_encode`.
+ *
+ * This function returns 0 if it succeeds, or one of the following
+ * negative error codes:
+ *
+ * :macro:`NGHTTP3_ERR_NOMEM`
+ *     Out of memory.
+ *
+ * .. version-added:: 1.18.0
+ */
+NGHTTP3_EXTERN int nghttp3_prepared_nva_new(nghttp3_prepared_nva **ppnva,
+                                            const nghttp3_nv *nva,
+                                            size_t nvlen,
+                                            const nghttp3_mem *mem);
+
+/**
+ * @function
+ *
+ * `nghttp3_prepared_nva_del` frees memory allocated for |pnva|.  This
+ * function does nothing if |pnva| is NULL.
+ *
+ * .. version-added:: 1.18.0
+ */
+NGHTTP3_EXTERN void nghttp3_prepared_nva_del(nghttp3_prepared_nva *pnva);
+
+/**
+ * @function
+ *
+ * `nghttp3_qpack_encoder_encode_prepared` works like
+ * `nghttp3_qpack_encoder_encode`, but it encodes the list of HTTP
+ * fields compiled into |pnva|.  Only the decisions that depend on
+ * the dynamic table are made per call.
+ *
+ * This function returns 0 if it succeeds, or one of the following
+ * negative error codes:
+ *
+ * :macro:`NGHTTP3_ERR_NOMEM`
+ *     Out of memory
+ * :macro:`NGHTTP3_ERR_QPACK_FATAL`
+ *      |encoder| is in unrecoverable error state, and cannot be used
+ *      anymore.
+ *
+ * .. version-added:: 1.18.0
+ */
+NGHTTP3_EXTERN int nghttp3_qpack_encoder_encode_prepared(
+  nghttp3_qpack_encoder *encoder, nghttp3_buf *pbuf, nghttp3_buf *rbuf,
+  nghttp3_buf *ebuf, int64_t stream_id, const nghttp3_prepared_nva *pnva);
+
 /**
  * @function
  *
@@ -1596,6 +1698,13 @@ nghttp3_qpack_decoder_get_icnt(const nghttp3_qpack_decoder *decoder);
  * must be available.  Otherwise, `nghttp3_rcbuf_decref` will cause
  * undefined behavior.
  *
+ * If borrowing literals is enabled by
+ * `nghttp3_qpack_decoder_set_borrow_literals`, :member:`nv->name
+ * <nghttp3_qpack_nv.name>` and :member:`nv->value
+ * <nghttp3_qpack_nv.value>` might be borrowed views into |src|.  They
+ * are only valid until the next call of this function with |sctx|, or
+ * until |src| is invalidated, whichever comes first.
+ *
  * This function returns the number of bytes read, or one of the
  * following negative error codes:
  *
@@ -1707,6 +1816,28 @@ NGHTTP3_EXTERN void
 nghttp3_qpack_decoder_set_max_concurrent_streams(nghttp3_qpack_decoder *decoder,
                                                  size_t max_concurrent_streams);
 
+/**
+ * @function
+ *
+ * `nghttp3_qpack_decoder_set_borrow_literals`, if |borrow| is
+ * nonzero, makes |decoder| emit string literals that are not Huffman
+ * encoded and entirely contained in the input buffer of
+ * `nghttp3_qpack_decoder_read_request` as borrowed views into that
+ * buffer, instead of copying them into newly allocated buffers.  A
+ * field name is borrowed only if its field value is also entirely
+ * contained in the input buffer.  `nghttp3_rcbuf_is_borrowed` tells
+ * whether a name or a value is borrowed.  A borrowed view is not
+ * NULL-terminated, so an application which enables borrowing must
+ * not rely on the terminating NULL.  String literals on encoder
+ * stream are always copied because they are stored in the dynamic
+ * table.  By default, borrowing is disabled.
+ *
+ * .. version-added:: 1.18.0
+ */
+NGHTTP3_EXTERN void
+nghttp3_qpack_decoder_set_borrow_literals(nghttp3_qpack_decoder *decoder,
+                                          int borrow);
+
 /**
  * @function
  *
@@ -1794,11 +1925,28 @@ NGHTTP3_EXTERN void nghttp3_set_debug_vprintf_callback(
  */
 typedef struct nghttp3_conn nghttp3_conn;
 
+/**
+ * @struct
+ *
+ * :type:`nghttp3_pool` is an object pool from which streams and the
+ * chunks that buffer stream data are allocated.  It can be shared
+ * by several :type:`nghttp3_conn` objects through
+ * :member:`nghttp3_settings.pool`, so that the objects released by
+ * one connection are reused by another instead of being returned to
+ * the memory allocator.  It is not thread-safe; all connections that
+ * share a pool must be used by the same thread.  The details of this
+ * structure are intentionally hidden from the public API.
+ *
+ * .. version-added:: 1.18.0
+ */
+typedef struct nghttp3_pool nghttp3_pool;
+
 #define NGHTTP3_SETTINGS_V1 1
 #define NGHTTP3_SETTINGS_V2 2
 #define NGHTTP3_SETTINGS_V3 3
 #define NGHTTP3_SETTINGS_V4 4
-#define NGHTTP3_SETTINGS_VERSION NGHTTP3_SETTINGS_V4
+#define NGHTTP3_SETTINGS_V5 5
+#define NGHTTP3_SETTINGS_VERSION NGHTTP3_SETTINGS_V5
 
 /**
  * @struct
@@ -1899,6 +2047,93 @@ typedef struct nghttp3_settings {
    * .. version-added:: 1.13.0
    */
   nghttp3_qpack_indexing_strat qpack_indexing_strat;
+  /* The following fields have been added since
+     NGHTTP3_SETTINGS_V5. */
+  /**
+   * :member:`qpack_decoder_borrow_literals`, if set to nonzero,
+   * passes the field names and values that are string literals
+   * without Huffman encoding to
+   * :member:`nghttp3_callbacks.recv_header` and
+   * :member:`nghttp3_callbacks.recv_trailer` as borrowed views into
+   * the buffer passed to `nghttp3_conn_read_stream2`, if possible.  A
+   * borrowed view is only valid during the callback, and, unlike
+   * the other names and values passed to these callbacks, it is not
+   * NULL-terminated.  Application must copy the ones it needs later,
+   * and must not enable this if its callbacks rely on the terminating
+   * NULL.  See
+   * `nghttp3_qpack_decoder_set_borrow_literals` and
+   * `nghttp3_rcbuf_is_borrowed`.
+   *
+   * .. version-added:: 1.18.0
+   */
+  uint8_t qpack_decoder_borrow_literals;
+  /**
+   * :member:`read_data_veccnt` is the number of :type:`nghttp3_vec`,
+   * or :type:`nghttp3_data_buf`, which the library passes to
+   * :type:`nghttp3_read_data_callback`, or
+   * :type:`nghttp3_read_data_buf_callback`, at once.  The objects
+   * filled by a single call are sent in a single DATA frame.  If it
+   * is 0, the default value 8 is used.  A value larger than 1024 is
+   * treated as 1024.
+   *
+   * .. version-added:: 1.18.0
+   */
+  size_t read_data_veccnt;
+  /**
+   * :member:`unsent_bytes_watermark`, if nonzero, is the number of
+   * bytes per stream up to which the library keeps asking the
+   * application for body before writing a stream.  If it is 0, the
+   * library generates at most one DATA frame per stream each time it
+   * writes the stream.  A larger value lets the application emit more
+   * body per flush on the paths with large bandwidth-delay product,
+   * at the cost of memory that the body occupies until it is
+   * acknowledged.
+   *
+   * .. version-added:: 1.18.0
+   */
+  size_t unsent_bytes_watermark;
+  /**
+   * :member:`data_coalesce_size`, if nonzero, enables coalescing of
+   * small body pieces.  The library calls
+   * :type:`nghttp3_read_data_callback`, or
+   * :type:`nghttp3_read_data_buf_callback`, repeatedly, and sends all
+   * data it provides in a single DATA frame until the data reach
+   * this number of bytes, the callback is offered
+   * :member:`read_data_veccnt` objects in total, it provides no
+   * data, it returns :macro:`NGHTTP3_ERR_WOULDBLOCK`, or it sets
+   * :macro:`NGHTTP3_DATA_FLAG_EOF` or
+   * :macro:`NGHTTP3_DATA_FLAG_FLUSH` to |*pflags|.  Data are never
+   * held back once the callback returns
+   * :macro:`NGHTTP3_ERR_WOULDBLOCK`.
+   *
+   * .. version-added:: 1.18.0
+   */
+  uint64_t data_coalesce_size;
+  /**
+   * :member:`pool`, if not ``NULL``, is the object pool created by
+   * `nghttp3_pool_new`, from which the connection allocates streams
+   * and the chunks that buffer stream data.  If it is ``NULL``, the
+   * connection creates its own pool.  The pool must outlive the
+   * connection.
+   *
+   * .. version-added:: 1.18.0
+   */
+  nghttp3_pool *pool;
+  /**
+   * :member:`max_blocked_stream_data`, if nonzero, is the maximum
+   * number of bytes of stream data that the connection buffers in
+   * total for the streams blocked by QPACK decoder.  If receiving
+   * data on a blocked stream would exceed this limit, the stream is
+   * reset with :macro:`NGHTTP3_H3_EXCESSIVE_LOAD` through
+   * :member:`nghttp3_callbacks.stop_sending` and
+   * :member:`nghttp3_callbacks.reset_stream`, and the buffered data
+   * are discarded and reported by
+   * :member:`nghttp3_callbacks.deferred_consume`.  If it is 0, the
+   * amount of buffered data is limited only by QUIC flow control.
+   *
+   * .. version-added:: 1.18.0
+   */
+  size_t max_blocked_stream_data;
 } nghttp3_settings;
 
 #define NGHTTP3_PROTO_SETTINGS_V1 1
@@ -1947,7 +2182,9 @@ typedef struct nghttp3_proto_settings {
  * :type:`nghttp3_acked_stream_data` is a callback function which is
  * invoked when data sent on stream denoted by |stream_id| supplied
  * from application is acknowledged by remote endpoint.  The number of
- * bytes acknowledged is given in |datalen|.
+ * bytes acknowledged is given in |datalen|.  It is not invoked for
+ * the body read from :type:`nghttp3_data_fd` because the library owns
+ * those buffers.
  *
  * The implementation of this callback must return 0 if it succeeds.
  * Returning :macro:`NGHTTP3_ERR_CALLBACK_FAILURE` will return to the
@@ -2397,6 +2634,15 @@ typedef struct nghttp3_callbacks {
  *   <nghttp3_settings.glitch_ratelim_burst>` = 1000
  * - :member:`glitch_ratelim_rate
  *   <nghttp3_settings.glitch_ratelim_rate>` = 33
+ * - :member:`read_data_veccnt
+ *   <nghttp3_settings.read_data_veccnt>` = 8
+ * - :member:`unsent_bytes_watermark
+ *   <nghttp3_settings.unsent_bytes_watermark>` = 0
+ * - :member:`data_coalesce_size
+ *   <nghttp3_settings.data_coalesce_size>` = 0
+ * - :member:`pool <nghttp3_settings.pool>` = ``NULL``
+ * - :member:`max_blocked_stream_data
+ *   <nghttp3_settings.max_blocked_stream_data>` = 0
  */
 NGHTTP3_EXTERN void
 nghttp3_settings_default_versioned(int settings_version,
@@ -2453,6 +2699,49 @@ nghttp3_conn_server_new_versioned(nghttp3_conn **pconn, int callbacks_version,
  */
 NGHTTP3_EXTERN void nghttp3_conn_del(nghttp3_conn *conn);
 
+/**
+ * @function
+ *
+ * `nghttp3_pool_new` creates :type:`nghttp3_pool`.  The pointer to
+ * the object is stored in |*ppool|.  If |mem| is ``NULL``, the memory
+ * allocator returned by `nghttp3_mem_default` is used.
+ *
+ * This function returns 0 if it succeeds, or one of the following
+ * negative error codes:
+ *
+ * :macro:`NGHTTP3_ERR_NOMEM`
+ *     Out of memory.
+ *
+ * .. version-added:: 1.18.0
+ */
+NGHTTP3_EXTERN int nghttp3_pool_new(nghttp3_pool **ppool,
+                                    const nghttp3_mem *mem);
+
+/**
+ * @function
+ *
+ * `nghttp3_pool_del` frees resources allocated for |pool|.  This
+ * function also frees memory pointed by |pool| itself.  All
+ * :type:`nghttp3_conn` objects that use |pool| must be freed before
+ * calling this function.  This function does nothing if |pool| is
+ * NULL.
+ *
+ * .. version-added:: 1.18.0
+ */
+NGHTTP3_EXTERN void nghttp3_pool_del(nghttp3_pool *pool);
+
+/**
+ * @function
+ *
+ * `nghttp3_pool_shrink` returns the memory blocks of |pool| which
+ * hold no object in use to the memory allocator.  `nghttp3_conn_shrink`
+ * does not shrink the pool given by :member:`nghttp3_settings.pool`;
+ * application calls this function instead.
+ *
+ * .. version-added:: 1.18.0
+ */
+NGHTTP3_EXTERN void nghttp3_pool_shrink(nghttp3_pool *pool);
+
 /**
  * @function
  *
@@ -2598,6 +2887,70 @@ NGHTTP3_EXTERN nghttp3_ssize nghttp3_conn_writev_stream(nghttp3_conn *conn,
                                                         nghttp3_vec *vec,
                                                         size_t veccnt);
 
+/**
+ * @struct
+ *
+ * :type:`nghttp3_stream_vec` describes the data to send to a single
+ * stream that `nghttp3_conn_writev_streams` produces.
+ *
+ * .. version-added:: 1.18.0
+ */
+typedef struct nghttp3_stream_vec {
+  /**
+   * :member:`stream_id` is the stream ID to send the data to.
+   */
+  int64_t stream_id;
+  /**
+   * :member:`vec` points to the array of :type:`nghttp3_vec` that
+   * contains the data.  It points into the array passed to
+   * `nghttp3_conn_writev_streams`.
+   */
+  nghttp3_vec *vec;
+  /**
+   * :member:`veccnt` is the number of objects pointed by
+   * :member:`vec`.  It might be 0 if :member:`fin` is nonzero.
+   */
+  size_t veccnt;
+  /**
+   * :member:`fin` is nonzero if this is the last data to send to the
+   * stream.
+   */
+  int fin;
+} nghttp3_stream_vec;
+
+/**
+ * @function
+ *
+ * `nghttp3_conn_writev_streams` is the batched version of
+ * `nghttp3_conn_writev_stream`.  It stores the data to send from
+ * several streams to |vec| of length |veccnt|, and describes which
+ * part of |vec| belongs to which stream in |svec| of length
+ * |sveccnt|.  The streams appear in the order that repeated calls of
+ * `nghttp3_conn_writev_stream` would have returned them, and each
+ * stream appears at most once.  It stops when it runs out of streams
+ * to write, |vec| or |svec| is full, or the total length of the data
+ * reaches |maxlen|.  The data of the last stream might be truncated to
+ * fit in |maxlen|; then its :member:`nghttp3_stream_vec.fin` is 0.
+ *
+ * For each :type:`nghttp3_stream_vec` produced, an application has to
+ * call `nghttp3_conn_add_write_offset` with the number of bytes that
+ * underlying QUIC stack accepted as it does for
+ * `nghttp3_conn_writev_stream`.  If QUIC stack does not accept all
+ * data of a stream, the data of the subsequent streams can still be
+ * sent.  The data in |vec| is valid until the next call of this
+ * function or `nghttp3_conn_writev_stream`.
+ *
+ * This function returns the number of :type:`nghttp3_stream_vec`
+ * objects stored in |svec|, or one of the negative error codes that
+ * `nghttp3_conn_writev_stream` returns.
+ *
+ * .. version-added:: 1.18.0
+ */
+NGHTTP3_EXTERN nghttp3_ssize
+nghttp3_conn_writev_streams(nghttp3_conn *conn, nghttp3_stream_vec *svec,
+                            size_t sveccnt, nghttp3_vec *vec, size_t veccnt,
+                            size_t maxlen);
+
 /**
  * @function
  *
@@ -2877,6 +3230,18 @@ NGHTTP3_EXTERN int nghttp3_conn_close_stream(nghttp3_conn *conn,
  */
 #define NGHTTP3_DATA_FLAG_NO_END_STREAM 0x02U
 
+/**
+ * @macro
+ *
+ * :macro:`NGHTTP3_DATA_FLAG_FLUSH` indicates that the data provided
+ * so far should be sent in a DATA frame without waiting for more
+ * data.  It is only meaningful if
+ * :member:`nghttp3_settings.data_coalesce_size` is nonzero.
+ *
+ * .. version-added:: 1.18.0
+ */
+#define NGHTTP3_DATA_FLAG_FLUSH 0x04U
+
 /**
  * @function
  *
@@ -2945,6 +3310,135 @@ typedef struct nghttp3_data_reader {
   nghttp3_read_data_callback read_data;
 } nghttp3_data_reader;
 
+/**
+ * @functypedef
+ *
+ * :type:`nghttp3_release_data` is a callback function invoked when
+ * the library no longer refers to a buffer which an application
+ * handed over through :type:`nghttp3_read_data_buf_callback`.  It is
+ * called as soon as all bytes in the buffer have been acknowledged
+ * by a remote endpoint, or when the stream denoted by |stream_id| is
+ * closed or |conn| is deleted before that happens.
+ * |release_user_data| is :member:`nghttp3_data_buf.release_user_data`
+ * of the buffer.
+ *
+ * This callback may be invoked from `nghttp3_conn_del`.  The
+ * application must not call any library functions with |conn| from
+ * inside this callback.
+ *
+ * .. version-added:: 1.18.0
+ */
+typedef void (*nghttp3_release_data)(nghttp3_conn *conn, int64_t stream_id,
+                                     void *release_user_data,
+                                     void *conn_user_data);
+
+/**
+ * @struct
+ *
+ * :type:`nghttp3_data_buf` is a buffer of stream data whose ownership
+ * is transferred to the library.
+ *
+ * .. version-added:: 1.18.0
+ */
+typedef struct nghttp3_data_buf {
+  /**
+   * :member:`base` points to the data.
+   */
+  uint8_t *base;
+  /**
+   * :member:`len` is the number of bytes which the buffer pointed by
+   * :member:`base` contains.
+   */
+  size_t len;
+  /**
+   * :member:`release` is a callback function which is invoked when
+   * the library no longer refers to this buffer.  If it is NULL, the
+   * buffer is treated like the one provided by
+   * :type:`nghttp3_read_data_callback`, and the application has to
+   * rely on :type:`nghttp3_acked_stream_data` to know when it is safe
+   * to free.
+   */
+  nghttp3_release_data release;
+  /**
+   * :member:`release_user_data` is an opaque pointer passed to
+   * :member:`release`.
+   */
+  void *release_user_data;
+} nghttp3_data_buf;
+
+/**
+ * @functypedef
+ *
+ * :type:`nghttp3_read_data_buf_callback` works like
+ * :type:`nghttp3_read_data_callback`, but the application fills
+ * |buf| of length |bufcnt| instead of :type:`nghttp3_vec`.  Each
+ * buffer carries its own :member:`nghttp3_data_buf.release` callback
+ * which is invoked when the buffer is no longer used by the library.
+ * The application does not have to map the cumulative byte count
+ * reported by :type:`nghttp3_acked_stream_data` back to its buffers,
+ * although that callback is still invoked.
+ *
+ * The ownership of the filled buffers is transferred to the library
+ * only if this callback returns the number of filled objects.  A
+ * buffer of length 0 is released immediately.
+ *
+ * .. version-added:: 1.18.0
+ */
+typedef nghttp3_ssize (*nghttp3_read_data_buf_callback)(
+  nghttp3_conn *conn, int64_t stream_id, nghttp3_data_buf *buf, size_t bufcnt,
+  uint32_t *pflags, void *conn_user_data, void *stream_user_data);
+
+/**
+ * @struct
+ *
+ * :type:`nghttp3_data_buf_reader` specifies the way how to generate
+ * request or response body with the buffers whose ownership is
+ * transferred to the library.
+ *
+ * .. version-added:: 1.18.0
+ */
+typedef struct nghttp3_data_buf_reader {
+  /**
+   * :member:`read_data_buf` is a callback function to generate body.
+   */
+  nghttp3_read_data_buf_callback read_data_buf;
+} nghttp3_data_buf_reader;
+
+/**
+ * @struct
+ *
+ * :type:`nghttp3_data_fd` specifies a range of a file which is sent
+ * as request or response body.  The library reads the range with
+ * pread(2) on demand into the buffers it owns, and frees each of
+ * them when its bytes have been acknowledged by a remote endpoint.
+ * :type:`nghttp3_acked_stream_data` is not invoked for those bytes.
+ * If pread(2) fails, or the file ends before the end of the range,
+ * the stream is reset with :macro:`NGHTTP3_H3_INTERNAL_ERROR` through
+ * :member:`nghttp3_callbacks.stop_sending` and
+ * :member:`nghttp3_callbacks.reset_stream`, and the connection
+ * carries on.
+ *
+ * .. version-added:: 1.18.0
+ */
+typedef struct nghttp3_data_fd {
+  /**
+   * :member:`fd` is a file descriptor to read body from.  The
+   * library does not close it.  The application must keep it open
+   * until :member:`nghttp3_callbacks.stream_close` is called for the
+   * stream, or :type:`nghttp3_conn` is deleted.
+   */
+  int fd;
+  /**
+   * :member:`offset` is the offset in the file where body starts.
+   */
+  uint64_t offset;
+  /**
+   * :member:`len` is the number of bytes to send.  If the file ends
+   * before :member:`len` bytes are read, the stream is reset.
+   */
+  uint64_t len;
+} nghttp3_data_fd;
+
 /**
  * @function
  *
@@ -2971,6 +3465,32 @@ NGHTTP3_EXTERN int nghttp3_conn_submit_request(
   nghttp3_conn *conn, int64_t stream_id, const nghttp3_nv *nva, size_t nvlen,
   const nghttp3_data_reader *dr, void *stream_user_data);
 
+/**
+ * @function
+ *
+ * `nghttp3_conn_submit_request_prepared` works like
+ * `nghttp3_conn_submit_request`, but it submits the HTTP request
+ * header fields compiled into |pnva|.  The fields are not copied.
+ * |pnva| must be kept alive until
+ * :member:`nghttp3_callbacks.stream_close` is called for the stream,
+ * or |conn| is deleted.
+ *
+ * This function returns 0 if it succeeds, or one of the following
+ * negative error codes:
+ *
+ * :macro:`NGHTTP3_ERR_CONN_CLOSING`
+ *     Connection is shutting down, and no new stream is allowed.
+ * :macro:`NGHTTP3_ERR_STREAM_IN_USE`
+ *     Stream has already been opened.
+ * :macro:`NGHTTP3_ERR_NOMEM`
+ *     Out of memory.
+ *
+ * .. version-added:: 1.18.0
+ */
+NGHTTP3_EXTERN int nghttp3_conn_submit_request_prepared(
+  nghttp3_conn *conn, int64_t stream_id, const nghttp3_prepared_nva *pnva,
+  const nghttp3_data_reader *dr, void *stream_user_data);
+
 /**
  * @function
  *
@@ -3014,6 +3534,134 @@ NGHTTP3_EXTERN int nghttp3_conn_submit_response(nghttp3_conn *conn,
                                                 size_t nvlen,
                                                 const nghttp3_data_reader *dr);
 
+/**
+ * @function
+ *
+ * `nghttp3_conn_submit_response_prepared` works like
+ * `nghttp3_conn_submit_response`, but it submits the HTTP response
+ * header fields compiled into |pnva|.  The fields are not copied.
+ * |pnva| must be kept alive until
+ * :member:`nghttp3_callbacks.stream_close` is called for the stream,
+ * or |conn| is deleted.
+ *
+ * This function returns 0 if it succeeds, or one of the following
+ * negative error codes:
+ *
+ * :macro:`NGHTTP3_ERR_STREAM_NOT_FOUND`
+ *     Stream not found
+ * :macro:`NGHTTP3_ERR_NOMEM`
+ *     Out of memory.
+ *
+ * .. version-added:: 1.18.0
+ */
+NGHTTP3_EXTERN int
+nghttp3_conn_submit_response_prepared(nghttp3_conn *conn, int64_t stream_id,
+                                      const nghttp3_prepared_nva *pnva,
+                                      const nghttp3_data_reader *dr);
+
+/**
+ * @function
+ *
+ * `nghttp3_conn_submit_request_data_buf` works like
+ * `nghttp3_conn_submit_request`, but the request body is generated
+ * by |dbr|.  If |dbr| is NULL, it implies the end of stream.
+ *
+ * This function returns 0 if it succeeds, or one of the following
+ * negative error codes:
+ *
+ * :macro:`NGHTTP3_ERR_CONN_CLOSING`
+ *     Connection is shutting down, and no new stream is allowed.
+ * :macro:`NGHTTP3_ERR_STREAM_IN_USE`
+ *     Stream has already been opened.
+ * :macro:`NGHTTP3_ERR_NOMEM`
+ *     Out of memory.
+ *
+ * .. version-added:: 1.18.0
+ */
+NGHTTP3_EXTERN int nghttp3_conn_submit_request_data_buf(
+  nghttp3_conn *conn, int64_t stream_id, const nghttp3_nv *nva, size_t nvlen,
+  const nghttp3_data_buf_reader *dbr, void *stream_user_data);
+
+/**
+ * @function
+ *
+ * `nghttp3_conn_submit_response_data_buf` works like
+ * `nghttp3_conn_submit_response`, but the response body is generated
+ * by |dbr|.  If |dbr| is NULL, it implies the end of stream.
+ *
+ * This function returns 0 if it succeeds, or one of the following
+ * negative error codes:
+ *
+ * :macro:`NGHTTP3_ERR_STREAM_NOT_FOUND`
+ *     Stream not found
+ * :macro:`NGHTTP3_ERR_NOMEM`
+ *     Out of memory.
+ *
+ * .. version-added:: 1.18.0
+ */
+NGHTTP3_EXTERN int
+nghttp3_conn_submit_response_data_buf(nghttp3_conn *conn, int64_t stream_id,
+                                      const nghttp3_nv *nva, size_t nvlen,
+                                      const nghttp3_data_buf_reader *dbr);
+
+/**
+ * @function
+ *
+ * `nghttp3_conn_submit_request_fd` works like
+ * `nghttp3_conn_submit_request`, but the request body is read from
+ * the file range specified by |dfd|.  If |dfd| is NULL, or
+ * :member:`dfd->len <nghttp3_data_fd.len>` is 0, it implies the end
+ * of stream.
+ *
+ * This function returns 0 if it succeeds, or one of the following
+ * negative error codes:
+ *
+ * :macro:`NGHTTP3_ERR_INVALID_ARGUMENT`
+ *     The range specified by |dfd| cannot be read with pread(2).
+ * :macro:`NGHTTP3_ERR_INVALID_STATE`
+ *     The library is built without pread(2).
+ * :macro:`NGHTTP3_ERR_CONN_CLOSING`
+ *     Connection is shutting down, and no new stream is allowed.
+ * :macro:`NGHTTP3_ERR_STREAM_IN_USE`
+ *     Stream has already been opened.
+ * :macro:`NGHTTP3_ERR_NOMEM`
+ *     Out of memory.
+ *
+ * .. version-added:: 1.18.0
+ */
+NGHTTP3_EXTERN int nghttp3_conn_submit_request_fd(
+  nghttp3_conn *conn, int64_t stream_id, const nghttp3_nv *nva, size_t nvlen,
+  const nghttp3_data_fd *dfd, void *stream_user_data);
+
+/**
+ * @function
+ *
+ * `nghttp3_conn_submit_response_fd` works like
+ * `nghttp3_conn_submit_response`, but the response body is read from
+ * the file range specified by |dfd|.  If |dfd| is NULL, or
+ * :member:`dfd->len <nghttp3_data_fd.len>` is 0, it implies the end
+ * of stream.
+ *
+ * This function returns 0 if it succeeds, or one of the following
+ * negative error codes:
+ *
+ * :macro:`NGHTTP3_ERR_INVALID_ARGUMENT`
+ *     The range specified by |dfd| cannot be read with pread(2).
+ * :macro:`NGHTTP3_ERR_INVALID_STATE`
+ *     The library is built without pread(2).
+ * :macro:`NGHTTP3_ERR_STREAM_NOT_FOUND`
+ *     Stream not found
+ * :macro:`NGHTTP3_ERR_NOMEM`
+ *     Out of memory.
+ *
+ * .. version-added:: 1.18.0
+ */
+NGHTTP3_EXTERN int nghttp3_conn_submit_response_fd(nghttp3_conn *conn,
+                                                   int64_t stream_id,
+                                                   const nghttp3_nv *nva,
+                                                   size_t nvlen,
+                                                   const nghttp3_data_fd *dfd);
+
 /**
  * @function
  *
@@ -3299,6 +3947,141 @@ NGHTTP3_EXTERN int nghttp3_conn_set_server_stream_priority_versioned(
   nghttp3_conn *conn, int64_t stream_id, int pri_version,
   const nghttp3_pri *pri);
 
+/**
+ * @functypedef
+ *
+ * :type:`nghttp3_scheduler_schedule` is invoked when a stream denoted
+ * by |stream_id| has data to send, and it is not scheduled yet.  The
+ * scheduler should return |stream_id| from
+ * :member:`nghttp3_scheduler.next` until
+ * :member:`nghttp3_scheduler.unschedule` is called for the stream.
+ * |pri| is the current priority of the stream.  The
+ * |sched_user_data| is the pointer passed to
+ * `nghttp3_conn_set_scheduler`.
+ *
+ * The implementation of this callback must return 0 if it succeeds.
+ * Returning :macro:`NGHTTP3_ERR_CALLBACK_FAILURE` will return to the
+ * caller immediately.  Any values other than 0 is treated as
+ * :macro:`NGHTTP3_ERR_CALLBACK_FAILURE`.
+ *
+ * .. version-added:: 1.18.0
+ */
+typedef int (*nghttp3_scheduler_schedule)(nghttp3_conn *conn,
+                                          int64_t stream_id,
+                                          const nghttp3_pri *pri,
+                                          void *sched_user_data);
+
+/**
+ * @functypedef
+ *
+ * :type:`nghttp3_scheduler_unschedule` is invoked when a stream
+ * denoted by |stream_id| has nothing to send, is blocked, or is
+ * closed.  It is also invoked before the priority of the stream
+ * changes, and the stream is scheduled again with the new priority
+ * if it still has data to send.
+ *
+ * .. version-added:: 1.18.0
+ */
+typedef void (*nghttp3_scheduler_unschedule)(nghttp3_conn *conn,
+                                             int64_t stream_id,
+                                             void *sched_user_data);
+
+/**
+ * @functypedef
+ *
+ * :type:`nghttp3_scheduler_next` is invoked when the library picks
+ * the next stream to send data.  It must return the ID of a scheduled
+ * stream, or -1 if there is none.  This callback does not remove the
+ * stream from the scheduler.  Returning the ID of a stream that is not
+ * scheduled is treated as if -1 is returned.
+ *
+ * .. version-added:: 1.18.0
+ */
+typedef int64_t (*nghttp3_scheduler_next)(nghttp3_conn *conn,
+                                          void *sched_user_data);
+
+/**
+ * @functypedef
+ *
+ * :type:`nghttp3_scheduler_on_written` is invoked when |nwrite| bytes
+ * are written to a stream denoted by |stream_id| by
+ * `nghttp3_conn_add_write_offset`, and the stream still has data to
+ * send.  The scheduler might move the stream behind the other streams
+ * for round-robin.
+ *
+ * The implementation of this callback must return 0 if it succeeds.
+ * Returning :macro:`NGHTTP3_ERR_CALLBACK_FAILURE` will return to the
+ * caller immediately.  Any values other than 0 is treated as
+ * :macro:`NGHTTP3_ERR_CALLBACK_FAILURE`.
+ *
+ * .. version-added:: 1.18.0
+ */
+typedef int (*nghttp3_scheduler_on_written)(nghttp3_conn *conn,
+                                            int64_t stream_id,
+                                            uint64_t nwrite,
+                                            void *sched_user_data);
+
+/**
+ * @struct
+ *
+ * :type:`nghttp3_scheduler` is a set of callbacks that decides the
+ * order in which request streams send data.  Only client initiated
+ * bidirectional streams are scheduled.  Control and QPACK streams are
+ * always sent first.
+ *
+ * .. version-added:: 1.18.0
+ */
+typedef struct nghttp3_scheduler {
+  /**
+   * :member:`schedule` is a callback function which is invoked when a
+   * stream gets ready to send data.  This field is required.
+   */
+  nghttp3_scheduler_schedule schedule;
+  /**
+   * :member:`unschedule` is a callback function which is invoked when
+   * a stream stops sending data.  This field is required.
+   */
+  nghttp3_scheduler_unschedule unschedule;
+  /**
+   * :member:`next` is a callback function which is invoked to get
+   * the next stream to send data.  This field is required.
+   */
+  nghttp3_scheduler_next next;
+  /**
+   * :member:`on_written` is a callback function which is invoked when
+   * data of a scheduled stream is written.  This field is optional.
+   */
+  nghttp3_scheduler_on_written on_written;
+} nghttp3_scheduler;
+
+/**
+ * @function
+ *
+ * `nghttp3_conn_set_scheduler` replaces the built-in :rfc:`9218`
+ * scheduler of |conn| with |sched|.  The object pointed by |sched| is
+ * copied.  |sched_user_data| is passed to the callbacks of |sched|.
+ * If |sched| is NULL, the built-in scheduler is restored.
+ *
+ * `nghttp3_conn_writev_streams` unschedules the streams it writes
+ * while it builds a batch, and schedules them again before it
+ * returns if they still have data to send.
+ *
+ * The callbacks are not invoked when |conn| is freed.
+ *
+ * This function returns 0 if it succeeds, or one of the following
+ * negative error codes:
+ *
+ * :macro:`NGHTTP3_ERR_INVALID_ARGUMENT`
+ *     A required callback in |sched| is NULL.
+ * :macro:`NGHTTP3_ERR_INVALID_STATE`
+ *     There is a scheduled stream.
+ *
+ * .. version-added:: 1.18.0
+ */
+NGHTTP3_EXTERN int nghttp3_conn_set_scheduler(nghttp3_conn *conn,
+                                              const nghttp3_scheduler *sched,
+                                              void *sched_user_data);
+
 /**
  * @function
  *
@@ -3353,6 +4136,359 @@ NGHTTP3_EXTERN int nghttp3_conn_is_drained(nghttp3_conn *conn);
  */
 NGHTTP3_EXTERN int nghttp3_conn_is_drained2(const nghttp3_conn *conn);
 
+/**
+ * @enum
+ *
+ * :type:`nghttp3_frame_stats_type` is the index into the per frame
+ * type counters in :type:`nghttp3_conn_stats`.
+ *
+ * .. version-added:: 1.18.0
+ */
+typedef enum nghttp3_frame_stats_type {
+  /**
+   * :enum:`NGHTTP3_FRAME_STATS_TYPE_DATA` is DATA frame.
+   */
+  NGHTTP3_FRAME_STATS_TYPE_DATA,
+  /**
+   * :enum:`NGHTTP3_FRAME_STATS_TYPE_HEADERS` is HEADERS frame.
+   */
+  NGHTTP3_FRAME_STATS_TYPE_HEADERS,
+  /**
+   * :enum:`NGHTTP3_FRAME_STATS_TYPE_SETTINGS` is SETTINGS frame.
+   */
+  NGHTTP3_FRAME_STATS_TYPE_SETTINGS,
+  /**
+   * :enum:`NGHTTP3_FRAME_STATS_TYPE_GOAWAY` is GOAWAY frame.
+   */
+  NGHTTP3_FRAME_STATS_TYPE_GOAWAY,
+  /**
+   * :enum:`NGHTTP3_FRAME_STATS_TYPE_MAX_PUSH_ID` is MAX_PUSH_ID
+   * frame.
+   */
+  NGHTTP3_FRAME_STATS_TYPE_MAX_PUSH_ID,
+  /**
+   * :enum:`NGHTTP3_FRAME_STATS_TYPE_PRIORITY_UPDATE` is
+   * PRIORITY_UPDATE frame.
+   */
+  NGHTTP3_FRAME_STATS_TYPE_PRIORITY_UPDATE,
+  /**
+   * :enum:`NGHTTP3_FRAME_STATS_TYPE_ORIGIN` is ORIGIN frame.
+   */
+  NGHTTP3_FRAME_STATS_TYPE_ORIGIN,
+  /**
+   * :enum:`NGHTTP3_FRAME_STATS_TYPE_OTHER` is any other frame,
+   * including unknown and reserved frame types.
+   */
+  NGHTTP3_FRAME_STATS_TYPE_OTHER
+} nghttp3_frame_stats_type;
+
+/**
+ * @macro
+ *
+ * :macro:`NGHTTP3_FRAME_STATS_TYPE_MAX` is the number of
+ * :type:`nghttp3_frame_stats_type`.
+ *
+ * .. version-added:: 1.18.0
+ */
+#define NGHTTP3_FRAME_STATS_TYPE_MAX (NGHTTP3_FRAME_STATS_TYPE_OTHER + 1)
+
+/**
+ * @struct
+ *
+ * :type:`nghttp3_frame_stats` is the counters of a single HTTP/3
+ * frame type.
+ *
+ * .. version-added:: 1.18.0
+ */
+typedef struct nghttp3_frame_stats {
+  /**
+   * :member:`frames` is the number of frames.
+   */
+  uint64_t frames;
+  /**
+   * :member:`bytes` is the number of bytes of frames, including
+   * frame header.
+   */
+  uint64_t bytes;
+} nghttp3_frame_stats;
+
+#define NGHTTP3_CONN_STATS_V1 1
+#define NGHTTP3_CONN_STATS_VERSION NGHTTP3_CONN_STATS_V1
+
+/**
+ * @struct
+ *
+ * :type:`nghttp3_conn_stats` is the collection of the counters of
+ * :type:`nghttp3_conn`.  Unless stated otherwise, they are cumulative
+ * since the creation of :type:`nghttp3_conn`.  Use
+ * `nghttp3_conn_get_stats` to get them.
+ *
+ * .. version-added:: 1.18.0
+ */
+typedef struct nghttp3_conn_stats {
+  /**
+   * :member:`frame_recv` is the counters of received frames indexed
+   * by :type:`nghttp3_frame_stats_type`.  It only covers the frames
+   * on control stream and request streams.  A frame is counted when
+   * its frame header is received.
+   */
+  nghttp3_frame_stats frame_recv[NGHTTP3_FRAME_STATS_TYPE_MAX];
+  /**
+   * :member:`frame_sent` is the counters of frames sent indexed by
+   * :type:`nghttp3_frame_stats_type`.  A frame is counted when it is
+   * serialized into a stream buffer.
+   */
+  nghttp3_frame_stats frame_sent[NGHTTP3_FRAME_STATS_TYPE_MAX];
+  /**
+   * :member:`data_bytes_recv` is the number of bytes received in the
+   * payload of DATA frames.
+   */
+  uint64_t data_bytes_recv;
+  /**
+   * :member:`data_bytes_sent` is the number of bytes sent in the
+   * payload of DATA frames.
+   */
+  uint64_t data_bytes_sent;
+  /**
+   * :member:`header_bytes_recv` is the number of bytes of encoded
+   * field sections received in HEADERS frames.
+   */
+  uint64_t header_bytes_recv;
+  /**
+   * :member:`header_bytes_sent` is the number of bytes of encoded
+   * field sections sent in HEADERS frames.
+   */
+  uint64_t header_bytes_sent;
+  /**
+   * :member:`qpack_enc_static_hits` is the number of field lines
+   * that QPACK encoder encoded with a reference to the static table.
+   */
+  uint64_t qpack_enc_static_hits;
+  /**
+   * :member:`qpack_enc_dynamic_hits` is the number of field lines
+   * that QPACK encoder encoded with a reference to the dynamic
+   * table.
+   */
+  uint64_t qpack_enc_dynamic_hits;
+  /**
+   * :member:`qpack_enc_literals` is the number of field lines that
+   * QPACK encoder encoded with a literal name.
+   */
+  uint64_t qpack_enc_literals;
+  /**
+   * :member:`qpack_enc_huffman_bytes_saved` is the number of bytes
+   * that QPACK encoder saved by Huffman encoding string literals,
+   * including the ones sent on QPACK encoder stream.
+   */
+  uint64_t qpack_enc_huffman_bytes_saved;
+  /**
+   * :member:`qpack_dec_static_hits` is the number of field lines
+   * that QPACK decoder decoded with a reference to the static table.
+   */
+  uint64_t qpack_dec_static_hits;
+  /**
+   * :member:`qpack_dec_dynamic_hits` is the number of field lines
+   * that QPACK decoder decoded with a reference to the dynamic
+   * table.
+   */
+  uint64_t qpack_dec_dynamic_hits;
+  /**
+   * :member:`qpack_dec_literals` is the number of field lines that
+   * QPACK decoder decoded with a literal name.
+   */
+  uint64_t qpack_dec_literals;
+  /**
+   * :member:`qpack_blocked` is the number of times that a stream is
+   * blocked by QPACK decoder.
+   */
+  uint64_t qpack_blocked;
+  /**
+   * :member:`qpack_blocked_duration` is the cumulative duration
+   * that streams spent blocked by QPACK decoder.  The duration is
+   * measured with the timestamps passed to
+   * `nghttp3_conn_read_stream2`, and only the streams that have been
+   * unblocked are taken into account.  A stream that is blocked or
+   * unblocked by `nghttp3_conn_read_stream`, which has no timestamp,
+   * is not taken into account.
+   */
+  nghttp3_duration qpack_blocked_duration;
+  /**
+   * :member:`inq_bytes` is the number of bytes that are currently
+   * buffered because the streams are blocked by QPACK decoder.
+   */
+  uint64_t inq_bytes;
+  /**
+   * :member:`outq_bytes` is the number of bytes that are currently
+   * queued for transmission, and not acknowledged yet.
+   */
+  uint64_t outq_bytes;
+  /**
+   * :member:`sched_pops` is the number of times that a request
+   * stream is taken from the scheduler to write its data.
+   */
+  uint64_t sched_pops;
+} nghttp3_conn_stats;
+
+/**
+ * @function
+ *
+ * `nghttp3_conn_get_stats` stores the counters of |conn| in the
+ * object pointed by |dest|.  The counters are maintained always, and
+ * calling this function does not change them.  The cost of this
+ * function is proportional to the number of streams because of
+ * :member:`nghttp3_conn_stats.inq_bytes` and
+ * :member:`nghttp3_conn_stats.outq_bytes`.
+ *
+ * .. version-added:: 1.18.0
+ */
+NGHTTP3_EXTERN void nghttp3_conn_get_stats_versioned(const nghttp3_conn *conn,
+                                                     int stats_version,
+                                                     nghttp3_conn_stats *dest);
+
+#define NGHTTP3_CONN_MEM_USAGE_V1 1
+#define NGHTTP3_CONN_MEM_USAGE_VERSION NGHTTP3_CONN_MEM_USAGE_V1
+
+/**
+ * @struct
+ *
+ * :type:`nghttp3_conn_mem_usage` is the number of bytes of memory
+ * held by :type:`nghttp3_conn`, broken down by its subsystems.  The
+ * numbers are computed from the internal data structures, and
+ * include neither the overhead of the memory allocator nor the
+ * memory held by the application, such as the data passed to
+ * :type:`nghttp3_read_data_callback`.  Use
+ * `nghttp3_conn_get_mem_usage` to get them.
+ *
+ * .. version-added:: 1.18.0
+ */
+typedef struct nghttp3_conn_mem_usage {
+  /**
+   * :member:`conn` is the size of :type:`nghttp3_conn` object
+   * itself, including the array of
+   * :member:`nghttp3_settings.read_data_veccnt` objects passed to
+   * read_data callback once it is allocated.
+   */
+  size_t conn;
+  /**
+   * :member:`out_chunk_objalloc` is the number of bytes of memory
+   * blocks allocated by the object pool for the small chunks that
+   * buffer outgoing frames, and for the buffers that hold body read
+   * by `nghttp3_conn_submit_response_fd` and
+   * `nghttp3_conn_submit_request_fd`.  It includes the chunks that
+   * are in the pool for reuse.  If the library is built with
+   * NOMEMPOOL, the chunks are allocated individually, and this field
+   * is always 0.  If :member:`nghttp3_settings.pool` is given, the
+   * pool is not owned by the connection, and this field is 0.
+   */
+  size_t out_chunk_objalloc;
+  /**
+   * :member:`stream_objalloc` is the number of bytes of memory
+   * blocks allocated by the object pool for streams.  It includes
+   * the streams that are in the pool for reuse.  The same remarks on
+   * NOMEMPOOL and :member:`nghttp3_settings.pool` as
+   * :member:`out_chunk_objalloc` apply.
+   */
+  size_t stream_objalloc;
+  /**
+   * :member:`qpack_encoder_dtable` is the number of bytes held by
+   * the dynamic table of QPACK encoder, including the name and value
+   * of each entry and the hash table to look them up.  A name or
+   * value shared by several owners is attributed in proportion to
+   * its reference count.
+   */
+  size_t qpack_encoder_dtable;
+  /**
+   * :member:`qpack_decoder_dtable` is the number of bytes held by
+   * the dynamic table of QPACK decoder, including the name and value
+   * of each entry.  A name or value that is still referenced by a
+   * field passed to the application is attributed as described in
+   * :member:`qpack_encoder_dtable`.
+   */
+  size_t qpack_decoder_dtable;
+  /**
+   * :member:`stream_inq` is the number of bytes of the buffers that
+   * hold incoming stream data while the streams are blocked by QPACK
+   * decoder, including the ring buffers that keep track of them.
+   * The buffers are allocated by an object pool, and the buffers
+   * that are in the pool for reuse are included.  The same remarks
+   * on NOMEMPOOL and :member:`nghttp3_settings.pool` as
+   * :member:`out_chunk_objalloc` apply to the buffers.
+   */
+  size_t stream_inq;
+  /**
+   * :member:`stream_outq` is the number of bytes of the ring buffers
+   * of outgoing data and frames queued to streams, and the buffers
+   * privately owned by them.
+   */
+  size_t stream_outq;
+  /**
+   * :member:`stream_chunks` is the number of bytes of the ring
+   * buffers of chunks that buffer outgoing frames, and the chunks
+   * which are too large to come from the pool counted in
+   * :member:`out_chunk_objalloc`.
+   */
+  size_t stream_chunks;
+  /**
+   * :member:`map` is the number of bytes of the hash tables that
+   * look up streams by stream ID.
+   */
+  size_t map;
+  /**
+   * :member:`ksl` is the number of bytes of the blocks of the skip
+   * lists that order the streams blocked by QPACK encoder.  The same
+   * remark on NOMEMPOOL as :member:`out_chunk_objalloc` applies.
+   */
+  size_t ksl;
+  /**
+   * :member:`qpack_buf` is the number of bytes of the scratch
+   * buffers used to encode field sections and the buffer of QPACK
+   * decoder stream.
+   */
+  size_t qpack_buf;
+  /**
+   * :member:`total` is the sum of all other fields.
+   */
+  size_t total;
+} nghttp3_conn_mem_usage;
+
+/**
+ * @function
+ *
+ * `nghttp3_conn_get_mem_usage` stores the number of bytes of memory
+ * held by |conn| in the object pointed by |dest|.  The cost of this
+ * function is proportional to the number of streams and the number
+ * of entries in QPACK dynamic tables.
+ *
+ * .. version-added:: 1.18.0
+ */
+NGHTTP3_EXTERN void
+nghttp3_conn_get_mem_usage_versioned(const nghttp3_conn *conn,
+                                     int mem_usage_version,
+                                     nghttp3_conn_mem_usage *dest);
+
+/**
+ * @function
+ *
+ * `nghttp3_conn_shrink` releases the memory that |conn| keeps for
+ * reuse but does not need to hold its current state.  It returns the
+ * unused memory blocks of the object pools to the memory allocator,
+ * frees the buffers of the empty queues of streams and the scratch
+ * buffers used to encode field sections, and shrinks the hash table
+ * of streams.  Application may call this function when |conn|
+ * becomes idle.  It does not change the protocol state of |conn|,
+ * and the released memory is allocated again when needed.
+ *
+ * This function returns 0 if it succeeds, or one of the following
+ * negative error codes:
+ *
+ * :macro:`NGHTTP3_ERR_NOMEM`
+ *     Out of memory.  The hash table of streams is not shrunk, but
+ *     everything else has been released.  |conn| is still usable.
+ *
+ * .. version-added:: 1.18.0
+ */
+NGHTTP3_EXTERN int nghttp3_conn_shrink(nghttp3_conn *conn);
+
 /**
  * @function
  *
@@ -3565,6 +4701,23 @@ NGHTTP3_EXTERN size_t nghttp3_put_uvarintlen(uint64_t n);
   nghttp3_conn_get_stream_priority2_versioned((CONN), NGHTTP3_PRI_VERSION,     \
                                               (DEST), (STREAM_ID))
 
+/*
+ * `nghttp3_conn_get_stats` is a wrapper around
+ * `nghttp3_conn_get_stats_versioned` to set the correct struct
+ * version.
+ */
+#define nghttp3_conn_get_stats(CONN, DEST)                                     \
+  nghttp3_conn_get_stats_versioned((CONN), NGHTTP3_CONN_STATS_VERSION, (DEST))
+
+/*
+ * `nghttp3_conn_get_mem_usage` is a wrapper around
+ * `nghttp3_conn_get_mem_usage_versioned` to set the correct struct
+ * version.
+ */
+#define nghttp3_conn_get_mem_usage(CONN, DEST)                                 \
+  nghttp3_conn_get_mem_usage_versioned((CONN), NGHTTP3_CONN_MEM_USAGE_VERSION, \
+                                       (DEST))
+
 /*
  * `nghttp3_pri_parse_priority` is a wrapper around
  * `nghttp3_pri_parse_priority_versioned` to set the correct struct
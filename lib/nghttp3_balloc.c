@@ -59,6 +59,17 @@ void nghttp3_balloc_clear(nghttp3_balloc *balloc) {
   nghttp3_buf_wrap_init(&balloc->buf, (void *)"", 0);
 }
 
+size_t nghttp3_balloc_get_memusage(const nghttp3_balloc *balloc) {
+  const nghttp3_memblock_hd *p;
+  size_t n = 0;
+
+  for (p = balloc->head; p; p = p->next) {
+    n += sizeof(nghttp3_memblock_hd) + 0x8U + balloc->blklen;
+  }
+
+  return n;
+}
+
 int nghttp3_balloc_get(nghttp3_balloc *balloc, void **pbuf, size_t n) {
   uint8_t *p;
   nghttp3_memblock_hd *hd;
@@ -75,11 +86,8 @@ int nghttp3_balloc_get(nghttp3_balloc *balloc, void **pbuf, size_t n) {
     hd = (void *)p;
     hd->next = balloc->head;
     balloc->head = hd;
-    nghttp3_buf_wrap_init(
-      &balloc->buf,
-      (uint8_t *)(((uintptr_t)p + sizeof(nghttp3_memblock_hd) + 0xFU) &
-                  ~(uintptr_t)0xFU),
-      balloc->blklen);
+    nghttp3_buf_wrap_init(&balloc->buf, nghttp3_memblock_begin(hd),
+                          balloc->blklen);
   }
 
   assert(((uintptr_t)balloc->buf.last & 0xFU) == 0);
@@ -46,6 +46,16 @@ struct nghttp3_memblock_hd {
   };
 };
 
+/*
+ * nghttp3_memblock_begin returns the pointer to the beginning of the
+ * usable region of the memory block |hd|.  It is aligned to 16 bytes
+ * boundary.
+ */
+static inline uint8_t *nghttp3_memblock_begin(nghttp3_memblock_hd *hd) {
+  return (uint8_t *)(((uintptr_t)hd + sizeof(nghttp3_memblock_hd) + 0xFU) &
+                     ~(uintptr_t)0xFU);
+}
+
 /*
  * nghttp3_balloc is a custom memory allocator.  It allocates |blklen|
  * bytes of memory at once on demand, and returns its slice when the
@@ -92,4 +102,10 @@ int nghttp3_balloc_get(nghttp3_balloc *balloc, void **pbuf, size_t n);
  */
 void nghttp3_balloc_clear(nghttp3_balloc *balloc);
 
+/*
+ * nghttp3_balloc_get_memusage returns the number of bytes allocated
+ * for memory blocks by |balloc|, including their headers.
+ */
+size_t nghttp3_balloc_get_memusage(const nghttp3_balloc *balloc);
+
 #endif /* !defined(NGHTTP3_BALLOC_H) */
@@ -69,11 +69,26 @@ typedef enum nghttp3_buf_type {
   /* NGHTTP3_BUF_TYPE_ALIEN_NO_ACK is like NGHTTP3_BUF_TYPE_ALIEN, but
      acked_data callback is not called. */
   NGHTTP3_BUF_TYPE_ALIEN_NO_ACK,
+  /* NGHTTP3_BUF_TYPE_ALIEN_RELEASE is like NGHTTP3_BUF_TYPE_ALIEN,
+     but its ownership has been transferred to the library.  release
+     callback is called when the buffer is no longer used. */
+  NGHTTP3_BUF_TYPE_ALIEN_RELEASE,
+  /* NGHTTP3_BUF_TYPE_FILE indicates that the buffer holds data read
+     from a file descriptor, and is allocated from
+     file_chunk_objalloc of nghttp3_conn.  Like
+     NGHTTP3_BUF_TYPE_ALIEN_NO_ACK, acked_data callback is not called.
+     The buffer is owned by the library, and is returned to
+     file_chunk_objalloc when it is no longer used. */
+  NGHTTP3_BUF_TYPE_FILE,
 } nghttp3_buf_type;
 
 typedef struct nghttp3_typed_buf {
   nghttp3_buf buf;
   nghttp3_buf_type type;
+  /* release and release_user_data are only used if type is
+     NGHTTP3_BUF_TYPE_ALIEN_RELEASE. */
+  nghttp3_release_data release;
+  void *release_user_data;
 } nghttp3_typed_buf;
 
 void nghttp3_typed_buf_init(nghttp3_typed_buf *tbuf, const nghttp3_buf *buf,
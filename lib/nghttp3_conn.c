@@ -27,6 +27,9 @@
 #include <assert.h>
 #include <string.h>
 #include <stdio.h>
+#ifdef HAVE_PREAD
+#  include <unistd.h>
+#endif /* defined(HAVE_PREAD) */
 
 #include "nghttp3_mem.h"
 #include "nghttp3_macro.h"
@@ -251,6 +254,78 @@ static int conn_call_end_origin(nghttp3_conn *conn) {
   return 0;
 }
 
+/*
+ * frame_stats_type returns nghttp3_frame_stats_type for HTTP/3 frame
+ * type |type|.
+ */
+static nghttp3_frame_stats_type frame_stats_type(uint64_t type) {
+  switch (type) {
+  case NGHTTP3_FRAME_DATA:
+    return NGHTTP3_FRAME_STATS_TYPE_DATA;
+  case NGHTTP3_FRAME_HEADERS:
+    return NGHTTP3_FRAME_STATS_TYPE_HEADERS;
+  case NGHTTP3_FRAME_SETTINGS:
+    return NGHTTP3_FRAME_STATS_TYPE_SETTINGS;
+  case NGHTTP3_FRAME_GOAWAY:
+    return NGHTTP3_FRAME_STATS_TYPE_GOAWAY;
+  case NGHTTP3_FRAME_MAX_PUSH_ID:
+    return NGHTTP3_FRAME_STATS_TYPE_MAX_PUSH_ID;
+  case NGHTTP3_FRAME_PRIORITY_UPDATE:
+  case NGHTTP3_FRAME_PRIORITY_UPDATE_PUSH_ID:
+    return NGHTTP3_FRAME_STATS_TYPE_PRIORITY_UPDATE;
+  case NGHTTP3_FRAME_ORIGIN:
+    return NGHTTP3_FRAME_STATS_TYPE_ORIGIN;
+  default:
+    return NGHTTP3_FRAME_STATS_TYPE_OTHER;
+  }
+}
+
+/*
+ * frame_stats_add adds a frame of type |type| whose payload length is
+ * |payloadlen| to |fstats| which is indexed by
+ * nghttp3_frame_stats_type.
+ */
+static void frame_stats_add(nghttp3_frame_stats *fstats, uint64_t type,
+                            uint64_t payloadlen) {
+  nghttp3_frame_stats *fs = &fstats[frame_stats_type(type)];
+
+  ++fs->frames;
+  fs->bytes += nghttp3_frame_write_hd_len(type, payloadlen) + payloadlen;
+}
+
+/*
+ * conn_add_frame_recv_stats updates the counters of |conn| for a
+ * received frame of type |type| whose payload length is
+ * |payloadlen|.  It is called when the frame header is read.
+ */
+static void conn_add_frame_recv_stats(nghttp3_conn *conn, uint64_t type,
+                                      uint64_t payloadlen) {
+  frame_stats_add(conn->stats.frame_recv, type, payloadlen);
+
+  switch (type) {
+  case NGHTTP3_FRAME_DATA:
+    conn->stats.data_bytes_recv += payloadlen;
+    break;
+  case NGHTTP3_FRAME_HEADERS:
+    conn->stats.header_bytes_recv += payloadlen;
+    break;
+  }
+}
+
+void nghttp3_conn_add_frame_sent_stats(nghttp3_conn *conn, uint64_t type,
+                                       uint64_t payloadlen) {
+  frame_stats_add(conn->stats.frame_sent, type, payloadlen);
+
+  switch (type) {
+  case NGHTTP3_FRAME_DATA:
+    conn->stats.data_bytes_sent += payloadlen;
+    break;
+  case NGHTTP3_FRAME_HEADERS:
+    conn->stats.header_bytes_sent += payloadlen;
+    break;
+  }
+}
+
 static int conn_glitch_ratelim_drain(nghttp3_conn *conn, uint64_t n,
                                      nghttp3_tstamp ts) {
   if (ts == UINT64_MAX) {
@@ -270,18 +345,6 @@ static int ricnt_less(const nghttp3_pq_entry *lhsx,
   return lhs->qpack_sctx.ricnt < rhs->qpack_sctx.ricnt;
 }
 
-static int cycle_less(const nghttp3_pq_entry *lhsx,
-                      const nghttp3_pq_entry *rhsx) {
-  const nghttp3_tnode *lhs = nghttp3_struct_of(lhsx, nghttp3_tnode, pe);
-  const nghttp3_tnode *rhs = nghttp3_struct_of(rhsx, nghttp3_tnode, pe);
-
-  if (lhs->cycle == rhs->cycle) {
-    return lhs->id < rhs->id;
-  }
-
-  return rhs->cycle - lhs->cycle <= NGHTTP3_TNODE_MAX_CYCLE_GAP;
-}
-
 static int conn_new(nghttp3_conn **pconn, int server, int callbacks_version,
                     const nghttp3_callbacks *callbacks, int settings_version,
                     const nghttp3_settings *settings, const nghttp3_mem *mem,
@@ -312,9 +375,12 @@ static int conn_new(nghttp3_conn **pconn, int server, int callbacks_version,
     return NGHTTP3_ERR_NOMEM;
   }
 
-  nghttp3_objalloc_init(&conn->out_chunk_objalloc,
-                        NGHTTP3_STREAM_MIN_CHUNK_SIZE * 16, mem);
-  nghttp3_objalloc_stream_init(&conn->stream_objalloc, 8, mem);
+  if (settings->pool) {
+    conn->pool = settings->pool;
+  } else {
+    nghttp3_pool_init(&conn->local_pool, mem);
+    conn->pool = &conn->local_pool;
+  }
 
   if (callbacks->rand) {
     callbacks->rand((uint8_t *)&map_seed, sizeof(map_seed));
@@ -323,9 +389,12 @@ static int conn_new(nghttp3_conn **pconn, int server, int callbacks_version,
   }
 
   nghttp3_map_init(&conn->streams, map_seed, mem);
+  nghttp3_slots_init(&conn->bidi_slots, mem);
 
   nghttp3_qpack_decoder_init(&conn->qdec, settings->qpack_max_dtable_capacity,
                              settings->qpack_blocked_streams, mem);
+  nghttp3_qpack_decoder_set_borrow_literals(
+    &conn->qdec, settings->qpack_decoder_borrow_literals);
 
   nghttp3_qpack_encoder_init(
     &conn->qenc, settings->qpack_encoder_max_dtable_capacity, ++map_seed, mem);
@@ -335,7 +404,7 @@ static int conn_new(nghttp3_conn **pconn, int server, int callbacks_version,
   nghttp3_pq_init(&conn->qpack_blocked_streams, ricnt_less, mem);
 
   for (i = 0; i < NGHTTP3_URGENCY_LEVELS; ++i) {
-    nghttp3_pq_init(&conn->sched[i].spq, cycle_less, mem);
+    nghttp3_tnode_queue_init(&conn->sched[i].q, mem);
   }
 
   nghttp3_idtr_init(&conn->remote.bidi.idtr, mem);
@@ -345,6 +414,13 @@ static int conn_new(nghttp3_conn **pconn, int server, int callbacks_version,
 
   conn->callbacks = *callbacks;
   conn->local.settings = *settings;
+
+  if (settings->read_data_veccnt == 0) {
+    conn->local.settings.read_data_veccnt = NGHTTP3_DEFAULT_READ_DATA_VECCNT;
+  } else if (settings->read_data_veccnt > NGHTTP3_MAX_READ_DATA_VECCNT) {
+    conn->local.settings.read_data_veccnt = NGHTTP3_MAX_READ_DATA_VECCNT;
+  }
+
   if (server) {
     if (settings->origin_list) {
       conn->local.settings.origin_list = &conn->local.origin_list;
@@ -420,11 +496,12 @@ void nghttp3_conn_del(nghttp3_conn *conn) {
 
   nghttp3_buf_free(&conn->tx.qpack.ebuf, conn->mem);
   nghttp3_buf_free(&conn->tx.qpack.rbuf, conn->mem);
+  nghttp3_mem_free(conn->mem, conn->tx.data_vec);
 
   nghttp3_idtr_free(&conn->remote.bidi.idtr);
 
   for (i = 0; i < NGHTTP3_URGENCY_LEVELS; ++i) {
-    nghttp3_pq_free(&conn->sched[i].spq);
+    nghttp3_tnode_queue_free(&conn->sched[i].q);
   }
 
   nghttp3_pq_free(&conn->qpack_blocked_streams);
@@ -434,9 +511,11 @@ void nghttp3_conn_del(nghttp3_conn *conn) {
 
   nghttp3_map_each(&conn->streams, free_stream, NULL);
   nghttp3_map_free(&conn->streams);
+  nghttp3_slots_free(&conn->bidi_slots);
 
-  nghttp3_objalloc_free(&conn->stream_objalloc);
-  nghttp3_objalloc_free(&conn->out_chunk_objalloc);
+  if (conn->pool == &conn->local_pool) {
+    nghttp3_pool_free(&conn->local_pool);
+  }
 
   nghttp3_mem_free(conn->mem, conn->rx.originbuf);
 
@@ -781,6 +860,8 @@ nghttp3_ssize nghttp3_conn_read_control(nghttp3_conn *conn,
       rstate->left = rvint->acc;
       nghttp3_varint_read_state_reset(rvint);
 
+      conn_add_frame_recv_stats(conn, rstate->fr.hd.type, rstate->left);
+
       if (!(conn->flags & NGHTTP3_CONN_FLAG_SETTINGS_RECVED)) {
         if (rstate->fr.hd.type != NGHTTP3_FRAME_SETTINGS) {
           return NGHTTP3_ERR_H3_MISSING_SETTINGS;
@@ -1336,10 +1417,14 @@ nghttp3_ssize nghttp3_conn_read_control(nghttp3_conn *conn,
 }
 
 static int conn_delete_stream(nghttp3_conn *conn, nghttp3_stream *stream) {
+  size_t buffered = nghttp3_stream_get_buffered_datalen(stream);
   int rv;
 
-  rv = conn_call_deferred_consume(conn, stream,
-                                  nghttp3_stream_get_buffered_datalen(stream));
+  assert(conn->rx.blocked_inq_bytes >= buffered);
+
+  conn->rx.blocked_inq_bytes -= buffered;
+
+  rv = conn_call_deferred_consume(conn, stream, buffered);
   if (rv != 0) {
     return rv;
   }
@@ -1367,6 +1452,14 @@ static int conn_delete_stream(nghttp3_conn *conn, nghttp3_stream *stream) {
     --conn->remote.bidi.num_streams;
   }
 
+  if (nghttp3_client_stream_bidi(stream->node.id) &&
+      nghttp3_slots_remove(&conn->bidi_slots,
+                           (uint64_t)stream->node.id >> 2) != 0) {
+    assert(conn->nbidi_outliers > 0);
+
+    --conn->nbidi_outliers;
+  }
+
   rv =
     nghttp3_map_remove(&conn->streams, (nghttp3_map_key_type)stream->node.id);
 
@@ -1405,14 +1498,17 @@ static int conn_process_blocked_stream_data(nghttp3_conn *conn,
 
     buf->pos += nproc;
 
+    assert(conn->rx.blocked_inq_bytes >= nproc);
+
+    conn->rx.blocked_inq_bytes -= nproc;
+
     rv = conn_call_deferred_consume(conn, stream, (size_t)nconsumed);
     if (rv != 0) {
       return rv;
     }
 
     if (nghttp3_buf_len(buf) == 0) {
-      nghttp3_buf_free(buf, stream->mem);
-      nghttp3_ringbuf_pop_front(&stream->inq);
+      nghttp3_stream_pop_inq(stream);
     }
 
     if (stream->flags & NGHTTP3_STREAM_FLAG_QPACK_DECODE_BLOCKED) {
@@ -1447,6 +1543,13 @@ nghttp3_ssize nghttp3_conn_read_qpack_encoder(nghttp3_conn *conn,
     stream->qpack_blocked_pe.index = NGHTTP3_PQ_BAD_INDEX;
     stream->flags &= (uint16_t)~NGHTTP3_STREAM_FLAG_QPACK_DECODE_BLOCKED;
 
+    /* nghttp3_conn_read_stream passes UINT64_MAX, which is not a
+       timestamp. */
+    if (ts != UINT64_MAX && stream->qpack_blocked_ts != UINT64_MAX &&
+        ts > stream->qpack_blocked_ts) {
+      conn->stats.qpack_blocked_duration += ts - stream->qpack_blocked_ts;
+    }
+
     rv = conn_process_blocked_stream_data(conn, stream, ts);
     if (rv != 0) {
       return rv;
@@ -1466,6 +1569,96 @@ static nghttp3_tnode *stream_get_sched_node(nghttp3_stream *stream) {
   return &stream->node;
 }
 
+/*
+ * conn_abort_blocked_stream resets |stream| which is blocked by QPACK
+ * decoder, and discards the data buffered in its inq.  The discarded
+ * data are reported to an application as consumed.
+ *
+ * This function returns 0 if it succeeds, or one of the following
+ * negative error codes:
+ *
+ * NGHTTP3_ERR_NOMEM
+ *     Out of memory
+ * NGHTTP3_ERR_CALLBACK_FAILURE
+ *     User callback failed
+ */
+static int conn_abort_blocked_stream(nghttp3_conn *conn,
+                                     nghttp3_stream *stream) {
+  size_t buffered = nghttp3_stream_get_buffered_datalen(stream);
+  int rv;
+
+  assert(stream->flags & NGHTTP3_STREAM_FLAG_QPACK_DECODE_BLOCKED);
+
+  if (stream->qpack_blocked_pe.index != NGHTTP3_PQ_BAD_INDEX) {
+    nghttp3_conn_qpack_blocked_streams_remove(conn, stream);
+    stream->qpack_blocked_pe.index = NGHTTP3_PQ_BAD_INDEX;
+  }
+
+  stream->flags &= (uint16_t)~NGHTTP3_STREAM_FLAG_QPACK_DECODE_BLOCKED;
+
+  for (; nghttp3_ringbuf_len(&stream->inq);) {
+    nghttp3_stream_pop_inq(stream);
+  }
+
+  assert(conn->rx.blocked_inq_bytes >= buffered);
+
+  conn->rx.blocked_inq_bytes -= buffered;
+
+  rv = nghttp3_conn_shutdown_stream_read(conn, stream->node.id);
+  if (rv != 0) {
+    return rv;
+  }
+
+  rv = conn_call_stop_sending(conn, stream, NGHTTP3_H3_EXCESSIVE_LOAD);
+  if (rv != 0) {
+    return rv;
+  }
+
+  rv = conn_call_reset_stream(conn, stream, NGHTTP3_H3_EXCESSIVE_LOAD);
+  if (rv != 0) {
+    return rv;
+  }
+
+  return conn_call_deferred_consume(conn, stream, buffered);
+}
+
+/*
+ * conn_buffer_blocked_stream_data buffers |datalen| bytes pointed by
+ * |data| to |stream| which is blocked by QPACK decoder.  If the
+ * number of bytes buffered for all blocked streams would exceed
+ * nghttp3_settings.max_blocked_stream_data, |stream| is reset instead,
+ * and NGHTTP3_STREAM_FLAG_SHUT_RD is set to it.
+ *
+ * This function returns 0 if it succeeds, or one of the following
+ * negative error codes:
+ *
+ * NGHTTP3_ERR_NOMEM
+ *     Out of memory
+ * NGHTTP3_ERR_CALLBACK_FAILURE
+ *     User callback failed
+ */
+static int conn_buffer_blocked_stream_data(nghttp3_conn *conn,
+                                           nghttp3_stream *stream,
+                                           const uint8_t *data,
+                                           size_t datalen) {
+  size_t max_data = conn->local.settings.max_blocked_stream_data;
+  int rv;
+
+  if (max_data && (conn->rx.blocked_inq_bytes > max_data ||
+                   datalen > max_data - conn->rx.blocked_inq_bytes)) {
+    return conn_abort_blocked_stream(conn, stream);
+  }
+
+  rv = nghttp3_stream_buffer_data(stream, data, datalen);
+  if (rv != 0) {
+    return rv;
+  }
+
+  conn->rx.blocked_inq_bytes += datalen;
+
+  return 0;
+}
+
 static int conn_update_stream_priority(nghttp3_conn *conn,
                                        nghttp3_stream *stream,
                                        const nghttp3_pri *pri) {
@@ -1486,6 +1679,34 @@ static int conn_update_stream_priority(nghttp3_conn *conn,
   return 0;
 }
 
+/*
+ * conn_decode_frame_hd decodes frame type and length at |p| if both
+ * of them are entirely contained in [|p|, |end|).  It stores frame
+ * type in |*ptype|, and frame length in |*plen|.  This function
+ * returns the number of bytes decoded, or 0 if the buffer ends in
+ * the middle of the frame header.  |p| must not equal to |end|.
+ */
+static size_t conn_decode_frame_hd(uint64_t *ptype, uint64_t *plen,
+                                   const uint8_t *p, const uint8_t *end) {
+  size_t len = (size_t)(end - p);
+  size_t typelen, lenlen;
+
+  typelen = nghttp3_get_uvarintlen(p);
+  if (len <= typelen) {
+    return 0;
+  }
+
+  lenlen = nghttp3_get_uvarintlen(p + typelen);
+  if (len - typelen < lenlen) {
+    return 0;
+  }
+
+  nghttp3_get_uvarint(ptype, p);
+  nghttp3_get_uvarint(plen, p + typelen);
+
+  return typelen + lenlen;
+}
+
 nghttp3_ssize nghttp3_conn_read_bidi(nghttp3_conn *conn, size_t *pnproc,
                                      nghttp3_stream *stream, const uint8_t *src,
                                      size_t srclen, int fin,
@@ -1512,10 +1733,17 @@ nghttp3_ssize nghttp3_conn_read_bidi(nghttp3_conn *conn, size_t *pnproc,
       return 0;
     }
 
-    rv = nghttp3_stream_buffer_data(stream, p, (size_t)(end - p));
+    rv = conn_buffer_blocked_stream_data(conn, stream, p, (size_t)(end - p));
     if (rv != 0) {
       return rv;
     }
+
+    if (stream->flags & NGHTTP3_STREAM_FLAG_SHUT_RD) {
+      *pnproc = srclen;
+
+      return (nghttp3_ssize)srclen;
+    }
+
     return 0;
   }
 
@@ -1524,6 +1752,19 @@ nghttp3_ssize nghttp3_conn_read_bidi(nghttp3_conn *conn, size_t *pnproc,
     switch (rstate->state) {
     case NGHTTP3_REQ_STREAM_STATE_FRAME_TYPE:
       assert(end - p > 0);
+      /* Most of the time, a whole frame header is in the buffer.
+         Decode it at once, and fall back to the resumable varint
+         reader only when it straddles the buffer boundary. */
+      if (rvint->left == 0) {
+        len = conn_decode_frame_hd(&rstate->fr.hd.type, &rstate->left, p, end);
+        if (len) {
+          p += len;
+          nconsumed += len;
+
+          goto frame_hd_decoded;
+        }
+      }
+
       nread = nghttp3_read_varint(rvint, p, end, fin);
       if (nread < 0) {
         return NGHTTP3_ERR_H3_GENERAL_PROTOCOL_ERROR;
@@ -1558,6 +1799,9 @@ nghttp3_ssize nghttp3_conn_read_bidi(nghttp3_conn *conn, size_t *pnproc,
       rstate->left = rvint->acc;
       nghttp3_varint_read_state_reset(rvint);
 
+    frame_hd_decoded:
+      conn_add_frame_recv_stats(conn, rstate->fr.hd.type, rstate->left);
+
       switch (rstate->fr.hd.type) {
       case NGHTTP3_FRAME_DATA:
         rv = nghttp3_stream_transit_rx_http_state(
@@ -1671,11 +1915,21 @@ nghttp3_ssize nghttp3_conn_read_bidi(nghttp3_conn *conn, size_t *pnproc,
       rstate->left -= (uint64_t)nread;
 
       if (stream->flags & NGHTTP3_STREAM_FLAG_QPACK_DECODE_BLOCKED) {
+        stream->qpack_blocked_ts = ts;
+        ++conn->stats.qpack_blocked;
+
         if (p != end && nghttp3_stream_get_buffered_datalen(stream) == 0) {
-          rv = nghttp3_stream_buffer_data(stream, p, (size_t)(end - p));
+          rv = conn_buffer_blocked_stream_data(conn, stream, p,
+                                               (size_t)(end - p));
           if (rv != 0) {
             return rv;
           }
+
+          if (stream->flags & NGHTTP3_STREAM_FLAG_SHUT_RD) {
+            *pnproc = srclen;
+
+            return (nghttp3_ssize)(nconsumed + (size_t)(end - p));
+          }
         }
         *pnproc = (size_t)(p - src);
         return (nghttp3_ssize)nconsumed;
@@ -1809,10 +2063,15 @@ int nghttp3_conn_on_data(nghttp3_conn *conn, nghttp3_stream *stream,
   return 0;
 }
 
-static nghttp3_pq *conn_get_sched_pq(nghttp3_conn *conn, nghttp3_tnode *tnode) {
+static int conn_has_ext_sched(const nghttp3_conn *conn) {
+  return conn->ext_sched.ops.next != NULL;
+}
+
+static nghttp3_tnode_queue *conn_get_sched_queue(nghttp3_conn *conn,
+                                                 nghttp3_tnode *tnode) {
   assert(tnode->pri.urgency < NGHTTP3_URGENCY_LEVELS);
 
-  return &conn->sched[tnode->pri.urgency].spq;
+  return &conn->sched[tnode->pri.urgency].q;
 }
 
 static nghttp3_ssize conn_decode_headers(nghttp3_conn *conn,
@@ -1888,7 +2147,7 @@ static nghttp3_ssize conn_decode_headers(nghttp3_conn *conn,
 
     if (flags & NGHTTP3_QPACK_DECODE_FLAG_EMIT) {
       rv = nghttp3_http_on_header(
-        http, &nv, request, trailers,
+        http, &nv, stream->qpack_sctx.field_flags, request, trailers,
         conn->server && conn->local.settings.enable_connect_protocol);
       switch (rv) {
       case NGHTTP3_ERR_MALFORMED_HTTP_HEADER:
@@ -2104,8 +2363,9 @@ int nghttp3_conn_create_stream(nghttp3_conn *conn, nghttp3_stream **pstream,
   };
 
   rv = nghttp3_stream_new(&stream, stream_id, &callbacks,
-                          &conn->out_chunk_objalloc, &conn->stream_objalloc,
-                          conn->mem);
+                          &conn->pool->out_chunk_objalloc,
+                          &conn->pool->inq_chunk_objalloc,
+                          &conn->pool->stream_objalloc, conn->mem);
   if (rv != 0) {
     return rv;
   }
@@ -2119,6 +2379,12 @@ int nghttp3_conn_create_stream(nghttp3_conn *conn, nghttp3_stream **pstream,
     return rv;
   }
 
+  if (nghttp3_client_stream_bidi(stream_id) &&
+      nghttp3_slots_insert(&conn->bidi_slots, (uint64_t)stream_id >> 2,
+                           stream) != 0) {
+    ++conn->nbidi_outliers;
+  }
+
   if (conn->server && nghttp3_client_stream_bidi(stream_id)) {
     ++conn->remote.bidi.num_streams;
   }
@@ -2130,6 +2396,15 @@ int nghttp3_conn_create_stream(nghttp3_conn *conn, nghttp3_stream **pstream,
 
 nghttp3_stream *nghttp3_conn_find_stream(const nghttp3_conn *conn,
                                          int64_t stream_id) {
+  nghttp3_stream *stream;
+
+  if (nghttp3_client_stream_bidi(stream_id)) {
+    stream = nghttp3_slots_find(&conn->bidi_slots, (uint64_t)stream_id >> 2);
+    if (stream || conn->nbidi_outliers == 0) {
+      return stream;
+    }
+  }
+
   return nghttp3_map_find(&conn->streams, (nghttp3_map_key_type)stream_id);
 }
 
@@ -2232,6 +2507,41 @@ int nghttp3_conn_bind_qpack_streams(nghttp3_conn *conn, int64_t qenc_stream_id,
   return nghttp3_stream_write_stream_type(stream);
 }
 
+/*
+ * conn_fill_outq calls nghttp3_stream_fill_outq for |stream|.  If the
+ * file range which provides the body of |stream| cannot be read,
+ * |stream| is reset with NGHTTP3_H3_INTERNAL_ERROR through
+ * stop_sending and reset_stream callbacks, and
+ * NGHTTP3_STREAM_FLAG_SHUT_WR is set to it.  The connection carries
+ * on.
+ *
+ * This function returns 0 if it succeeds, or one of the following
+ * negative error codes:
+ *
+ * NGHTTP3_ERR_NOMEM
+ *     Out of memory
+ * NGHTTP3_ERR_CALLBACK_FAILURE
+ *     Callback function failed.
+ */
+static int conn_fill_outq(nghttp3_conn *conn, nghttp3_stream *stream) {
+  int rv;
+
+  rv = nghttp3_stream_fill_outq(stream);
+  if (rv != NGHTTP3_ERR_H3_INTERNAL_ERROR) {
+    return rv;
+  }
+
+  nghttp3_stream_clear_frq(stream);
+  nghttp3_conn_shutdown_stream_write(conn, stream->node.id);
+
+  rv = conn_call_stop_sending(conn, stream, NGHTTP3_H3_INTERNAL_ERROR);
+  if (rv != 0) {
+    return rv;
+  }
+
+  return conn_call_reset_stream(conn, stream, NGHTTP3_H3_INTERNAL_ERROR);
+}
+
 static nghttp3_ssize conn_writev_stream(nghttp3_conn *conn, int64_t *pstream_id,
                                         int *pfin, nghttp3_vec *vec,
                                         size_t veccnt, nghttp3_stream *stream) {
@@ -2243,10 +2553,14 @@ static nghttp3_ssize conn_writev_stream(nghttp3_conn *conn, int64_t *pstream_id,
   /* If stream is blocked by read callback, don't attempt to fill
      more. */
   if (!(stream->flags & NGHTTP3_STREAM_FLAG_READ_DATA_BLOCKED)) {
-    rv = nghttp3_stream_fill_outq(stream);
+    rv = conn_fill_outq(conn, stream);
     if (rv != 0) {
       return rv;
     }
+
+    if (stream->flags & NGHTTP3_STREAM_FLAG_SHUT_WR) {
+      return 0;
+    }
   }
 
   if (!nghttp3_stream_uni(stream->node.id) && conn->tx.qenc &&
@@ -2313,37 +2627,274 @@ nghttp3_ssize nghttp3_conn_writev_stream(nghttp3_conn *conn,
     }
   }
 
-  stream = nghttp3_conn_get_next_tx_stream(conn);
-  if (stream == NULL) {
-    return 0;
+  for (;;) {
+    stream = nghttp3_conn_get_next_tx_stream(conn);
+    if (stream == NULL) {
+      return 0;
+    }
+
+    ++conn->stats.sched_pops;
+
+    ncnt = conn_writev_stream(conn, pstream_id, pfin, vec, veccnt, stream);
+    if (ncnt < 0) {
+      return ncnt;
+    }
+
+    if (nghttp3_client_stream_bidi(stream->node.id) &&
+        !nghttp3_stream_require_schedule(stream)) {
+      nghttp3_conn_unschedule_stream(conn, stream);
+    }
+
+    /* Move on to the next stream if this one has just been reset. */
+    if (ncnt || !(stream->flags & NGHTTP3_STREAM_FLAG_SHUT_WR)) {
+      return ncnt;
+    }
   }
+}
 
-  ncnt = conn_writev_stream(conn, pstream_id, pfin, vec, veccnt, stream);
-  if (ncnt < 0) {
-    return ncnt;
+/*
+ * conn_add_stream_vec stores the data of |stream| to |*pvec| and
+ * describes it in |*psvec|.  |*pveccnt| and |*pleft| are the number
+ * of nghttp3_vec objects and the number of bytes that can still be
+ * stored.  The data is truncated if it exceeds |*pleft|.  All of
+ * them are advanced past the stored data.  |*pveccnt| and |*pleft|
+ * must be strictly positive.
+ *
+ * This function returns the number of bytes stored.
+ */
+static size_t conn_add_stream_vec(nghttp3_stream_vec **psvec,
+                                  nghttp3_vec **pvec, size_t *pveccnt,
+                                  size_t *pleft, nghttp3_stream *stream) {
+  nghttp3_vec *vec = *pvec;
+  size_t n, i, left = *pleft;
+  int fin;
+
+  n = nghttp3_stream_writev(stream, &fin, vec, *pveccnt);
+
+  for (i = 0; i < n; ++i) {
+    if (vec[i].len > left) {
+      if (left) {
+        vec[i++].len = left;
+        left = 0;
+      }
+
+      fin = 0;
+
+      break;
+    }
+
+    left -= vec[i].len;
   }
 
-  if (nghttp3_client_stream_bidi(stream->node.id) &&
+  **psvec = (nghttp3_stream_vec){
+    .stream_id = stream->node.id,
+    .vec = vec,
+    .veccnt = i,
+    .fin = fin,
+  };
+
+  ++*psvec;
+  *pvec += i;
+  *pveccnt -= i;
+
+  n = *pleft - left;
+  *pleft = left;
+
+  return n;
+}
+
+/*
+ * conn_restore_stream_schedule puts |stream| which was taken out of
+ * the scheduler by nghttp3_conn_writev_streams back with its cycle
+ * unchanged if it still has something to send.
+ *
+ * This function returns 0 if it succeeds, or one of the following
+ * negative error codes:
+ *
+ * NGHTTP3_ERR_NOMEM
+ *     Out of memory
+ * NGHTTP3_ERR_CALLBACK_FAILURE
+ *     Callback function failed.
+ */
+static int conn_restore_stream_schedule(nghttp3_conn *conn,
+                                        nghttp3_stream *stream) {
+  nghttp3_tnode *node = stream_get_sched_node(stream);
+
+  if (nghttp3_tnode_is_scheduled(node) ||
       !nghttp3_stream_require_schedule(stream)) {
+    return 0;
+  }
+
+  if (conn_has_ext_sched(conn)) {
+    return nghttp3_conn_schedule_stream(conn, stream);
+  }
+
+  return nghttp3_tnode_queue_push(conn_get_sched_queue(conn, node), node);
+}
+
+static int stream_vec_contains(const nghttp3_stream_vec *svec,
+                               const nghttp3_stream_vec *svend,
+                               int64_t stream_id) {
+  for (; svec != svend; ++svec) {
+    if (svec->stream_id == stream_id) {
+      return 1;
+    }
+  }
+
+  return 0;
+}
+
+nghttp3_ssize nghttp3_conn_writev_streams(nghttp3_conn *conn,
+                                          nghttp3_stream_vec *svec,
+                                          size_t sveccnt, nghttp3_vec *vec,
+                                          size_t veccnt, size_t maxlen) {
+  nghttp3_stream_vec *sv = svec, *svend = svec + sveccnt;
+  nghttp3_stream *stream, *qenc = conn->tx.qenc;
+  nghttp3_stream *uni[] = {conn->tx.ctrl, conn->tx.qdec, qenc};
+  size_t qenc_nwrite = 0;
+  int qenc_added = 0;
+  size_t i;
+  int rv = 0, rv2;
+
+  if (sveccnt == 0 || veccnt == 0 || maxlen == 0) {
+    return 0;
+  }
+
+  for (i = 0; i < nghttp3_arraylen(uni); ++i) {
+    stream = uni[i];
+    if (stream == NULL || nghttp3_stream_is_blocked(stream)) {
+      continue;
+    }
+
+    if (stream == conn->tx.qdec) {
+      rv = nghttp3_stream_write_qpack_decoder_stream(stream);
+      if (rv != 0) {
+        return rv;
+      }
+    }
+
+    rv = nghttp3_stream_fill_outq(stream);
+    if (rv != 0) {
+      return rv;
+    }
+
+    if (stream->unsent_bytes == 0) {
+      continue;
+    }
+
+    if (stream == qenc) {
+      qenc_nwrite = conn_add_stream_vec(&sv, &vec, &veccnt, &maxlen, qenc);
+      qenc_added = 1;
+    } else {
+      conn_add_stream_vec(&sv, &vec, &veccnt, &maxlen, stream);
+    }
+
+    if (sv == svend || veccnt == 0 || maxlen == 0) {
+      return sv - svec;
+    }
+  }
+
+  /* Each request stream is taken out of the scheduler while it is
+     written so that the next one is picked up.  It is put back with
+     its cycle unchanged afterwards, and the application reschedules
+     it by calling nghttp3_conn_add_write_offset. */
+  for (; sv != svend && veccnt && maxlen;) {
+    stream = nghttp3_conn_get_next_tx_stream(conn);
+    if (stream == NULL || stream_vec_contains(svec, sv, stream->node.id)) {
+      break;
+    }
+
+    ++conn->stats.sched_pops;
+
     nghttp3_conn_unschedule_stream(conn, stream);
+
+    if (!(stream->flags & NGHTTP3_STREAM_FLAG_READ_DATA_BLOCKED)) {
+      rv = conn_fill_outq(conn, stream);
+      if (rv != 0) {
+        break;
+      }
+
+      if (stream->flags & NGHTTP3_STREAM_FLAG_SHUT_WR) {
+        continue;
+      }
+    }
+
+    /* Encoding HEADERS might have produced encoder stream data which
+       should be sent along with the request stream data. */
+    if (qenc && !nghttp3_stream_is_blocked(qenc) &&
+        qenc->unsent_bytes > qenc_nwrite) {
+      if (qenc_added) {
+        rv = conn_restore_stream_schedule(conn, stream);
+        break;
+      }
+
+      qenc_nwrite = conn_add_stream_vec(&sv, &vec, &veccnt, &maxlen, qenc);
+      qenc_added = 1;
+
+      if (sv == svend || veccnt == 0 || maxlen == 0) {
+        rv = conn_restore_stream_schedule(conn, stream);
+        break;
+      }
+    }
+
+    conn_add_stream_vec(&sv, &vec, &veccnt, &maxlen, stream);
+
+    /* We might just want to write stream fin without sending any
+       stream data. */
+    if ((sv - 1)->veccnt == 0 && !(sv - 1)->fin) {
+      --sv;
+      rv = conn_restore_stream_schedule(conn, stream);
+      break;
+    }
   }
 
-  return ncnt;
+  for (i = 0; i < (size_t)(sv - svec); ++i) {
+    if (!nghttp3_client_stream_bidi(svec[i].stream_id)) {
+      continue;
+    }
+
+    stream = nghttp3_conn_find_stream(conn, svec[i].stream_id);
+    assert(stream);
+
+    rv2 = conn_restore_stream_schedule(conn, stream);
+    if (rv2 != 0 && rv == 0) {
+      rv = rv2;
+    }
+  }
+
+  if (rv != 0) {
+    return rv;
+  }
+
+  return sv - svec;
 }
 
 nghttp3_stream *nghttp3_conn_get_next_tx_stream(nghttp3_conn *conn) {
   size_t i;
   nghttp3_tnode *tnode;
-  nghttp3_pq *pq;
+  nghttp3_stream *stream;
+  int64_t stream_id;
+
+  if (conn_has_ext_sched(conn)) {
+    stream_id = conn->ext_sched.ops.next(conn, conn->ext_sched.user_data);
+    if (stream_id < 0 || !nghttp3_client_stream_bidi(stream_id)) {
+      return NULL;
+    }
+
+    stream = nghttp3_conn_find_stream(conn, stream_id);
+    if (stream == NULL || !nghttp3_tnode_is_scheduled(&stream->node)) {
+      return NULL;
+    }
+
+    return stream;
+  }
 
   for (i = 0; i < NGHTTP3_URGENCY_LEVELS; ++i) {
-    pq = &conn->sched[i].spq;
-    if (nghttp3_pq_empty(pq)) {
+    tnode = nghttp3_tnode_queue_top(&conn->sched[i].q);
+    if (tnode == NULL) {
       continue;
     }
 
-    tnode = nghttp3_struct_of(nghttp3_pq_top(pq), nghttp3_tnode, pe);
-
     return nghttp3_struct_of(tnode, nghttp3_stream, node);
   }
 
@@ -2371,7 +2922,10 @@ int nghttp3_conn_add_write_offset(nghttp3_conn *conn, int64_t stream_id,
     return 0;
   }
 
-  if (stream->unscheduled_nwrite < NGHTTP3_STREAM_MIN_WRITELEN) {
+  /* The scheduler installed by application is told about every
+     write. */
+  if (stream->unscheduled_nwrite < NGHTTP3_STREAM_MIN_WRITELEN &&
+      !conn_has_ext_sched(conn)) {
     return 0;
   }
 
@@ -2404,16 +2958,26 @@ int nghttp3_conn_update_ack_offset(nghttp3_conn *conn, int64_t stream_id,
   return nghttp3_stream_update_ack_offset(stream, offset);
 }
 
+/*
+ * conn_submit_headers_data submits HEADERS frame, and DATA frame if
+ * |dfr| is not NULL.  The header fields are either |nva| of length
+ * |nvlen|, which are copied, or |pnva| if it is not NULL.
+ */
 static int conn_submit_headers_data(nghttp3_conn *conn, nghttp3_stream *stream,
                                     const nghttp3_nv *nva, size_t nvlen,
-                                    const nghttp3_data_reader *dr) {
+                                    const nghttp3_prepared_nva *pnva,
+                                    const nghttp3_frame_data *dfr) {
   int rv;
-  nghttp3_nv *nnva;
+  nghttp3_nv *nnva = NULL;
   nghttp3_frame *fr;
 
-  rv = nghttp3_nva_copy(&nnva, nva, nvlen, conn->mem);
-  if (rv != 0) {
-    return rv;
+  if (pnva == NULL) {
+    rv = nghttp3_nva_copy(&nnva, nva, nvlen, conn->mem);
+    if (rv != 0) {
+      return rv;
+    }
+  } else {
+    nvlen = 0;
   }
 
   rv = nghttp3_stream_frq_emplace(stream, &fr);
@@ -2426,18 +2990,16 @@ static int conn_submit_headers_data(nghttp3_conn *conn, nghttp3_stream *stream,
     .type = NGHTTP3_FRAME_HEADERS,
     .nva = nnva,
     .nvlen = nvlen,
+    .pnva = pnva,
   };
 
-  if (dr) {
+  if (dfr) {
     rv = nghttp3_stream_frq_emplace(stream, &fr);
     if (rv != 0) {
       return rv;
     }
 
-    fr->data = (nghttp3_frame_data){
-      .type = NGHTTP3_FRAME_DATA,
-      .dr = *dr,
-    };
+    fr->data = *dfr;
   }
 
   if (nghttp3_stream_require_schedule(stream)) {
@@ -2447,12 +3009,64 @@ static int conn_submit_headers_data(nghttp3_conn *conn, nghttp3_stream *stream,
   return 0;
 }
 
+/*
+ * conn_ext_schedule_stream schedules |stream| with the scheduler
+ * installed by application.  If |stream| has already been scheduled,
+ * the bytes written since the last call are reported instead.
+ *
+ * This function returns 0 if it succeeds, or one of the following
+ * negative error codes:
+ *
+ * NGHTTP3_ERR_CALLBACK_FAILURE
+ *     Callback function failed.
+ */
+static int conn_ext_schedule_stream(nghttp3_conn *conn,
+                                    nghttp3_stream *stream) {
+  nghttp3_tnode *node = stream_get_sched_node(stream);
+  uint64_t nwrite = stream->unscheduled_nwrite;
+  nghttp3_pri pri;
+  int rv;
+
+  stream->unscheduled_nwrite = 0;
+
+  if (!node->scheduled) {
+    pri = node->pri;
+
+    rv = conn->ext_sched.ops.schedule(conn, node->id, &pri,
+                                      conn->ext_sched.user_data);
+    if (rv != 0) {
+      return NGHTTP3_ERR_CALLBACK_FAILURE;
+    }
+
+    node->scheduled = 1;
+    ++conn->ext_sched.nscheduled;
+
+    return 0;
+  }
+
+  if (nwrite == 0 || !conn->ext_sched.ops.on_written) {
+    return 0;
+  }
+
+  rv = conn->ext_sched.ops.on_written(conn, node->id, nwrite,
+                                      conn->ext_sched.user_data);
+  if (rv != 0) {
+    return NGHTTP3_ERR_CALLBACK_FAILURE;
+  }
+
+  return 0;
+}
+
 int nghttp3_conn_schedule_stream(nghttp3_conn *conn, nghttp3_stream *stream) {
   /* Assume that stream stays on the same urgency level */
   nghttp3_tnode *node = stream_get_sched_node(stream);
   int rv;
 
-  rv = nghttp3_tnode_schedule(node, conn_get_sched_pq(conn, node),
+  if (conn_has_ext_sched(conn)) {
+    return conn_ext_schedule_stream(conn, stream);
+  }
+
+  rv = nghttp3_tnode_schedule(node, conn_get_sched_queue(conn, node),
                               stream->unscheduled_nwrite);
   if (rv != 0) {
     return rv;
@@ -2476,13 +3090,109 @@ void nghttp3_conn_unschedule_stream(nghttp3_conn *conn,
                                     nghttp3_stream *stream) {
   nghttp3_tnode *node = stream_get_sched_node(stream);
 
-  nghttp3_tnode_unschedule(node, conn_get_sched_pq(conn, node));
+  if (conn_has_ext_sched(conn)) {
+    if (!node->scheduled) {
+      return;
+    }
+
+    node->scheduled = 0;
+    --conn->ext_sched.nscheduled;
+
+    conn->ext_sched.ops.unschedule(conn, node->id, conn->ext_sched.user_data);
+
+    return;
+  }
+
+  nghttp3_tnode_unschedule(node, conn_get_sched_queue(conn, node));
 }
 
-int nghttp3_conn_submit_request(nghttp3_conn *conn, int64_t stream_id,
-                                const nghttp3_nv *nva, size_t nvlen,
-                                const nghttp3_data_reader *dr,
-                                void *stream_user_data) {
+/*
+ * conn_data_frame_init initializes |dfr| so that body is generated by
+ * |dr| or |dbr|, and returns |dfr|.  If both are NULL, it returns
+ * NULL.
+ */
+static const nghttp3_frame_data *
+conn_data_frame_init(nghttp3_frame_data *dfr, const nghttp3_data_reader *dr,
+                     const nghttp3_data_buf_reader *dbr) {
+  if (dr) {
+    *dfr = (nghttp3_frame_data){
+      .type = NGHTTP3_FRAME_DATA,
+      .dr = *dr,
+    };
+
+    return dfr;
+  }
+
+  if (dbr) {
+    *dfr = (nghttp3_frame_data){
+      .type = NGHTTP3_FRAME_DATA,
+      .read_data_buf = dbr->read_data_buf,
+    };
+
+    return dfr;
+  }
+
+  return NULL;
+}
+
+/*
+ * conn_data_frame_fd_init initializes |dfr| so that body is read from
+ * |dfd|, and returns |dfr|.  If |dfd| is NULL or specifies an empty
+ * range, it returns NULL.
+ */
+static const nghttp3_frame_data *
+conn_data_frame_fd_init(nghttp3_frame_data *dfr, const nghttp3_data_fd *dfd) {
+  if (dfd == NULL || dfd->len == 0) {
+    return NULL;
+  }
+
+  *dfr = (nghttp3_frame_data){
+    .type = NGHTTP3_FRAME_DATA,
+    .fd = *dfd,
+    .use_fd = 1,
+  };
+
+  return dfr;
+}
+
+/*
+ * conn_verify_data_fd returns 0 if |dfd| can be read by
+ * nghttp3_stream_write_data.  Otherwise, it returns one of the
+ * following negative error codes:
+ *
+ * NGHTTP3_ERR_INVALID_ARGUMENT
+ *     The range does not fit in off_t.
+ * NGHTTP3_ERR_INVALID_STATE
+ *     The library is built without pread.
+ */
+static int conn_verify_data_fd(const nghttp3_data_fd *dfd) {
+#ifdef HAVE_PREAD
+  uint64_t end;
+
+  if (dfd == NULL || dfd->len == 0) {
+    return 0;
+  }
+
+  end = dfd->offset + dfd->len;
+
+  if (dfd->fd < 0 || end < dfd->offset || end > (uint64_t)INT64_MAX ||
+      (uint64_t)(off_t)end != end) {
+    return NGHTTP3_ERR_INVALID_ARGUMENT;
+  }
+
+  return 0;
+#else  /* !defined(HAVE_PREAD) */
+  (void)dfd;
+
+  return NGHTTP3_ERR_INVALID_STATE;
+#endif /* !defined(HAVE_PREAD) */
+}
+
+static int conn_submit_request(nghttp3_conn *conn, int64_t stream_id,
+                               const nghttp3_nv *nva, size_t nvlen,
+                               const nghttp3_prepared_nva *pnva,
+                               const nghttp3_frame_data *dfr,
+                               void *stream_user_data) {
   nghttp3_stream *stream;
   int rv;
 
@@ -2511,13 +3221,69 @@ int nghttp3_conn_submit_request(nghttp3_conn *conn, int64_t stream_id,
   stream->user_data = stream_user_data;
   stream->node.pri.inc = 1;
 
-  nghttp3_http_record_request_method(stream, nva, nvlen);
+  if (pnva) {
+    nghttp3_http_record_request_method(stream, pnva->nva, pnva->nvlen);
+  } else {
+    nghttp3_http_record_request_method(stream, nva, nvlen);
+  }
 
-  if (dr == NULL) {
+  if (dfr == NULL) {
     stream->flags |= NGHTTP3_STREAM_FLAG_WRITE_END_STREAM;
   }
 
-  return conn_submit_headers_data(conn, stream, nva, nvlen, dr);
+  return conn_submit_headers_data(conn, stream, nva, nvlen, pnva, dfr);
+}
+
+int nghttp3_conn_submit_request(nghttp3_conn *conn, int64_t stream_id,
+                                const nghttp3_nv *nva, size_t nvlen,
+                                const nghttp3_data_reader *dr,
+                                void *stream_user_data) {
+  nghttp3_frame_data dfr;
+
+  return conn_submit_request(conn, stream_id, nva, nvlen, NULL,
+                             conn_data_frame_init(&dfr, dr, NULL),
+                             stream_user_data);
+}
+
+int nghttp3_conn_submit_request_prepared(nghttp3_conn *conn,
+                                         int64_t stream_id,
+                                         const nghttp3_prepared_nva *pnva,
+                                         const nghttp3_data_reader *dr,
+                                         void *stream_user_data) {
+  nghttp3_frame_data dfr;
+
+  return conn_submit_request(conn, stream_id, NULL, 0, pnva,
+                             conn_data_frame_init(&dfr, dr, NULL),
+                             stream_user_data);
+}
+
+int nghttp3_conn_submit_request_data_buf(nghttp3_conn *conn,
+                                         int64_t stream_id,
+                                         const nghttp3_nv *nva, size_t nvlen,
+                                         const nghttp3_data_buf_reader *dbr,
+                                         void *stream_user_data) {
+  nghttp3_frame_data dfr;
+
+  return conn_submit_request(conn, stream_id, nva, nvlen, NULL,
+                             conn_data_frame_init(&dfr, NULL, dbr),
+                             stream_user_data);
+}
+
+int nghttp3_conn_submit_request_fd(nghttp3_conn *conn, int64_t stream_id,
+                                   const nghttp3_nv *nva, size_t nvlen,
+                                   const nghttp3_data_fd *dfd,
+                                   void *stream_user_data) {
+  nghttp3_frame_data dfr;
+  int rv;
+
+  rv = conn_verify_data_fd(dfd);
+  if (rv != 0) {
+    return rv;
+  }
+
+  return conn_submit_request(conn, stream_id, nva, nvlen, NULL,
+                             conn_data_frame_fd_init(&dfr, dfd),
+                             stream_user_data);
 }
 
 int nghttp3_conn_submit_info(nghttp3_conn *conn, int64_t stream_id,
@@ -2534,12 +3300,13 @@ int nghttp3_conn_submit_info(nghttp3_conn *conn, int64_t stream_id,
     return NGHTTP3_ERR_STREAM_NOT_FOUND;
   }
 
-  return conn_submit_headers_data(conn, stream, nva, nvlen, NULL);
+  return conn_submit_headers_data(conn, stream, nva, nvlen, NULL, NULL);
 }
 
-int nghttp3_conn_submit_response(nghttp3_conn *conn, int64_t stream_id,
-                                 const nghttp3_nv *nva, size_t nvlen,
-                                 const nghttp3_data_reader *dr) {
+static int conn_submit_response(nghttp3_conn *conn, int64_t stream_id,
+                                const nghttp3_nv *nva, size_t nvlen,
+                                const nghttp3_prepared_nva *pnva,
+                                const nghttp3_frame_data *dfr) {
   nghttp3_stream *stream;
 
   /* TODO Verify that it is allowed to send response now. */
@@ -2551,11 +3318,55 @@ int nghttp3_conn_submit_response(nghttp3_conn *conn, int64_t stream_id,
     return NGHTTP3_ERR_STREAM_NOT_FOUND;
   }
 
-  if (dr == NULL) {
+  if (dfr == NULL) {
     stream->flags |= NGHTTP3_STREAM_FLAG_WRITE_END_STREAM;
   }
 
-  return conn_submit_headers_data(conn, stream, nva, nvlen, dr);
+  return conn_submit_headers_data(conn, stream, nva, nvlen, pnva, dfr);
+}
+
+int nghttp3_conn_submit_response(nghttp3_conn *conn, int64_t stream_id,
+                                 const nghttp3_nv *nva, size_t nvlen,
+                                 const nghttp3_data_reader *dr) {
+  nghttp3_frame_data dfr;
+
+  return conn_submit_response(conn, stream_id, nva, nvlen, NULL,
+                              conn_data_frame_init(&dfr, dr, NULL));
+}
+
+int nghttp3_conn_submit_response_prepared(nghttp3_conn *conn,
+                                          int64_t stream_id,
+                                          const nghttp3_prepared_nva *pnva,
+                                          const nghttp3_data_reader *dr) {
+  nghttp3_frame_data dfr;
+
+  return conn_submit_response(conn, stream_id, NULL, 0, pnva,
+                              conn_data_frame_init(&dfr, dr, NULL));
+}
+
+int nghttp3_conn_submit_response_data_buf(nghttp3_conn *conn,
+                                          int64_t stream_id,
+                                          const nghttp3_nv *nva, size_t nvlen,
+                                          const nghttp3_data_buf_reader *dbr) {
+  nghttp3_frame_data dfr;
+
+  return conn_submit_response(conn, stream_id, nva, nvlen, NULL,
+                              conn_data_frame_init(&dfr, NULL, dbr));
+}
+
+int nghttp3_conn_submit_response_fd(nghttp3_conn *conn, int64_t stream_id,
+                                    const nghttp3_nv *nva, size_t nvlen,
+                                    const nghttp3_data_fd *dfd) {
+  nghttp3_frame_data dfr;
+  int rv;
+
+  rv = conn_verify_data_fd(dfd);
+  if (rv != 0) {
+    return rv;
+  }
+
+  return conn_submit_response(conn, stream_id, nva, nvlen, NULL,
+                              conn_data_frame_fd_init(&dfr, dfd));
 }
 
 int nghttp3_conn_submit_trailers(nghttp3_conn *conn, int64_t stream_id,
@@ -2576,7 +3387,7 @@ int nghttp3_conn_submit_trailers(nghttp3_conn *conn, int64_t stream_id,
 
   stream->flags |= NGHTTP3_STREAM_FLAG_WRITE_END_STREAM;
 
-  return conn_submit_headers_data(conn, stream, nva, nvlen, NULL);
+  return conn_submit_headers_data(conn, stream, nva, nvlen, NULL, NULL);
 }
 
 int nghttp3_conn_submit_shutdown_notice(nghttp3_conn *conn) {
@@ -2967,6 +3778,38 @@ int nghttp3_conn_set_server_stream_priority_versioned(nghttp3_conn *conn,
   return conn_update_stream_priority(conn, stream, pri);
 }
 
+int nghttp3_conn_set_scheduler(nghttp3_conn *conn,
+                               const nghttp3_scheduler *sched,
+                               void *sched_user_data) {
+  size_t i;
+
+  if (sched && (!sched->schedule || !sched->unschedule || !sched->next)) {
+    return NGHTTP3_ERR_INVALID_ARGUMENT;
+  }
+
+  if (conn->ext_sched.nscheduled) {
+    return NGHTTP3_ERR_INVALID_STATE;
+  }
+
+  for (i = 0; i < NGHTTP3_URGENCY_LEVELS; ++i) {
+    if (!nghttp3_tnode_queue_empty(&conn->sched[i].q)) {
+      return NGHTTP3_ERR_INVALID_STATE;
+    }
+  }
+
+  if (sched == NULL) {
+    conn->ext_sched.ops = (nghttp3_scheduler){0};
+    conn->ext_sched.user_data = NULL;
+
+    return 0;
+  }
+
+  conn->ext_sched.ops = *sched;
+  conn->ext_sched.user_data = sched_user_data;
+
+  return 0;
+}
+
 int nghttp3_conn_is_drained(nghttp3_conn *conn) {
   return nghttp3_conn_is_drained2(conn);
 }
@@ -2980,6 +3823,128 @@ int nghttp3_conn_is_drained2(const nghttp3_conn *conn) {
          nghttp3_ringbuf_len(&conn->tx.ctrl->frq) == 0;
 }
 
+static int stream_add_queued_bytes(void *data, void *ptr) {
+  nghttp3_stream *stream = data;
+  nghttp3_conn_stats *stats = ptr;
+
+  stats->inq_bytes += nghttp3_stream_get_buffered_datalen(stream);
+  stats->outq_bytes += nghttp3_stream_get_unacked_outq_len(stream);
+
+  return 0;
+}
+
+void nghttp3_conn_get_stats_versioned(const nghttp3_conn *conn,
+                                      int stats_version,
+                                      nghttp3_conn_stats *dest) {
+  const nghttp3_qpack_stats *qenc_stats = &conn->qenc.ctx.stats;
+  const nghttp3_qpack_stats *qdec_stats = &conn->qdec.ctx.stats;
+  (void)stats_version;
+
+  *dest = conn->stats;
+
+  dest->qpack_enc_static_hits = qenc_stats->static_hits;
+  dest->qpack_enc_dynamic_hits = qenc_stats->dynamic_hits;
+  dest->qpack_enc_literals = qenc_stats->literals;
+  dest->qpack_enc_huffman_bytes_saved = qenc_stats->huffman_bytes_saved;
+  dest->qpack_dec_static_hits = qdec_stats->static_hits;
+  dest->qpack_dec_dynamic_hits = qdec_stats->dynamic_hits;
+  dest->qpack_dec_literals = qdec_stats->literals;
+
+  dest->inq_bytes = 0;
+  dest->outq_bytes = 0;
+
+  nghttp3_map_each(&conn->streams, stream_add_queued_bytes, dest);
+}
+
+static int stream_add_mem_usage(void *data, void *ptr) {
+  nghttp3_stream_add_mem_usage(data, ptr);
+
+  return 0;
+}
+
+void nghttp3_conn_get_mem_usage_versioned(const nghttp3_conn *conn,
+                                          int mem_usage_version,
+                                          nghttp3_conn_mem_usage *dest) {
+  const nghttp3_pool *pool;
+
+  (void)mem_usage_version;
+
+  *dest = (nghttp3_conn_mem_usage){
+    .conn = sizeof(*conn),
+    .qpack_encoder_dtable =
+      nghttp3_qpack_encoder_get_dtable_memusage(&conn->qenc),
+    .qpack_decoder_dtable =
+      nghttp3_qpack_decoder_get_dtable_memusage(&conn->qdec),
+    .map = nghttp3_map_get_memusage(&conn->streams) +
+           nghttp3_slots_get_memusage(&conn->bidi_slots) +
+           nghttp3_map_get_memusage(&conn->qenc.streams),
+    .ksl = nghttp3_ksl_get_memusage(&conn->qenc.blocked_streams),
+    .qpack_buf = nghttp3_buf_cap(&conn->tx.qpack.rbuf) +
+                 nghttp3_buf_cap(&conn->tx.qpack.ebuf) +
+                 nghttp3_buf_cap(&conn->qdec.dbuf),
+  };
+
+  if (conn->pool == &conn->local_pool) {
+    pool = &conn->local_pool;
+
+    dest->out_chunk_objalloc =
+      nghttp3_objalloc_get_memusage(&pool->out_chunk_objalloc) +
+      nghttp3_objalloc_get_memusage(&pool->file_chunk_objalloc);
+    dest->stream_objalloc =
+      nghttp3_objalloc_get_memusage(&pool->stream_objalloc);
+    dest->stream_inq =
+      nghttp3_objalloc_get_memusage(&pool->inq_chunk_objalloc);
+  }
+
+  if (conn->tx.data_vec) {
+    dest->conn += conn->local.settings.read_data_veccnt *
+                  (sizeof(nghttp3_vec) + sizeof(nghttp3_data_buf));
+  }
+
+  nghttp3_map_each(&conn->streams, stream_add_mem_usage, dest);
+
+  dest->total = dest->conn + dest->out_chunk_objalloc + dest->stream_objalloc +
+                dest->qpack_encoder_dtable + dest->qpack_decoder_dtable +
+                dest->stream_inq + dest->stream_outq + dest->stream_chunks +
+                dest->map + dest->ksl + dest->qpack_buf;
+}
+
+static int stream_shrink(void *data, void *ptr) {
+  (void)ptr;
+
+  nghttp3_stream_shrink(data);
+
+  return 0;
+}
+
+int nghttp3_conn_shrink(nghttp3_conn *conn) {
+  size_t i;
+
+  assert(0 == nghttp3_buf_len(&conn->tx.qpack.rbuf));
+  assert(0 == nghttp3_buf_len(&conn->tx.qpack.ebuf));
+
+  nghttp3_map_each(&conn->streams, stream_shrink, NULL);
+
+  nghttp3_buf_free(&conn->tx.qpack.rbuf, conn->mem);
+  nghttp3_buf_init(&conn->tx.qpack.rbuf);
+  nghttp3_buf_free(&conn->tx.qpack.ebuf, conn->mem);
+  nghttp3_buf_init(&conn->tx.qpack.ebuf);
+  nghttp3_mem_free(conn->mem, conn->tx.data_vec);
+  conn->tx.data_vec = NULL;
+  conn->tx.data_buf = NULL;
+
+  if (conn->pool == &conn->local_pool) {
+    nghttp3_pool_shrink(&conn->local_pool);
+  }
+  nghttp3_slots_shrink(&conn->bidi_slots);
+
+  for (i = 0; i < NGHTTP3_URGENCY_LEVELS; ++i) {
+    nghttp3_tnode_queue_shrink(&conn->sched[i].q);
+  }
+
+  return nghttp3_map_shrink(&conn->streams);
+}
+
 int nghttp3_conn_is_stream_flushed(const nghttp3_conn *conn,
                                    int64_t stream_id) {
   nghttp3_stream *stream = nghttp3_conn_find_stream(conn, stream_id);
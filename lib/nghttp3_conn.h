@@ -33,11 +33,13 @@
 
 #include "nghttp3_stream.h"
 #include "nghttp3_map.h"
+#include "nghttp3_slots.h"
 #include "nghttp3_qpack.h"
 #include "nghttp3_tnode.h"
 #include "nghttp3_idtr.h"
 #include "nghttp3_gaptr.h"
 #include "nghttp3_ratelim.h"
+#include "nghttp3_pool.h"
 
 /* NGHTTP3_QPACK_ENCODER_MAX_TABLE_CAPACITY is the maximum dynamic
    table size for QPACK encoder. */
@@ -78,19 +80,43 @@ typedef struct nghttp3_chunk {
 nghttp3_objalloc_decl(chunk, nghttp3_chunk, oplent)
 
 struct nghttp3_conn {
-  nghttp3_objalloc out_chunk_objalloc;
-  nghttp3_objalloc stream_objalloc;
+  /* local_pool is the object pool owned by this connection.  It is
+     used unless nghttp3_settings.pool is given. */
+  nghttp3_pool local_pool;
+  /* pool points to the object pool from which streams and chunks are
+     allocated.  It is either &local_pool or nghttp3_settings.pool. */
+  nghttp3_pool *pool;
   nghttp3_callbacks callbacks;
   nghttp3_map streams;
+  /* bidi_slots indexes the client bidirectional streams in streams
+     by stream ID / 4, so that the lookup on the hot paths avoids
+     hashing. */
+  nghttp3_slots bidi_slots;
+  /* nbidi_outliers is the number of client bidirectional streams in
+     streams which do not fit in bidi_slots. */
+  size_t nbidi_outliers;
   nghttp3_qpack_decoder qdec;
   nghttp3_qpack_encoder qenc;
   nghttp3_pq qpack_blocked_streams;
   nghttp3_ratelim glitch_rlim;
   struct {
-    nghttp3_pq spq;
+    nghttp3_tnode_queue q;
   } sched[NGHTTP3_URGENCY_LEVELS];
+  /* ext_sched is the scheduler installed by application.  If
+     ext_sched.ops.next is NULL, the built-in scheduler is used. */
+  struct {
+    nghttp3_scheduler ops;
+    void *user_data;
+    /* nscheduled is the number of streams that are scheduled by
+       ops. */
+    size_t nscheduled;
+  } ext_sched;
   const nghttp3_mem *mem;
   void *user_data;
+  /* stats is the counters of this connection.  The QPACK counters,
+     inq_bytes, and outq_bytes are not maintained here, and they are
+     filled by nghttp3_conn_get_stats_versioned. */
+  nghttp3_conn_stats stats;
   int server;
   uint16_t flags;
 
@@ -130,6 +156,10 @@ struct nghttp3_conn {
 
     int64_t max_stream_id_bidi;
 
+    /* blocked_inq_bytes is the number of bytes buffered in inq of
+       streams which are blocked by QPACK decoder. */
+    size_t blocked_inq_bytes;
+
     union {
       struct {
         /* pri_fieldbuf is a buffer to store incoming Priority Field Value
@@ -172,6 +202,12 @@ struct nghttp3_conn {
     nghttp3_stream *qdec;
     /* goaway_id is the latest ID sent in GOAWAY frame. */
     int64_t goaway_id;
+    /* data_vec and data_buf are the arrays of
+       local.settings.read_data_veccnt elements which are passed to
+       read_data callback.  They share a single allocation pointed by
+       data_vec, and are allocated on first use. */
+    nghttp3_vec *data_vec;
+    nghttp3_data_buf *data_buf;
   } tx;
 };
 
@@ -239,4 +275,12 @@ int nghttp3_conn_reject_stream(nghttp3_conn *conn, nghttp3_stream *stream);
  */
 nghttp3_stream *nghttp3_conn_get_next_tx_stream(nghttp3_conn *conn);
 
+/*
+ * nghttp3_conn_add_frame_sent_stats updates the counters of |conn|
+ * for a frame of type |type| whose payload length is |payloadlen|
+ * which has been serialized for transmission.
+ */
+void nghttp3_conn_add_frame_sent_stats(nghttp3_conn *conn, uint64_t type,
+                                       uint64_t payloadlen);
+
 #endif /* !defined(NGHTTP3_CONN_H) */
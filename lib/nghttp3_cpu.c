@@ -0,0 +1,86 @@
+/*
+ * nghttp3
+ *
+ * Copyright (c) 2026 nghttp3 contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "nghttp3_cpu.h"
+
+#if defined(NGHTTP3_AVX2_DISPATCH) && defined(_MSC_VER)
+#  include <intrin.h>
+#  include <immintrin.h>
+
+static int cpu_supports_avx2(void) {
+  int info[4];
+
+  __cpuid(info, 0);
+  if (info[0] < 7) {
+    return 0;
+  }
+
+  __cpuid(info, 1);
+
+  /* OSXSAVE and AVX */
+  if ((info[2] & 0x18000000) != 0x18000000) {
+    return 0;
+  }
+
+  /* The operating system saves XMM and YMM registers. */
+  if ((_xgetbv(0) & 0x6) != 0x6) {
+    return 0;
+  }
+
+  __cpuidex(info, 7, 0);
+
+  /* AVX2 */
+  return (info[1] & 0x20) != 0;
+}
+#endif /* defined(NGHTTP3_AVX2_DISPATCH) && defined(_MSC_VER) */
+
+uint32_t nghttp3_cpu_get_features(void) {
+  uint32_t features = 0;
+
+#ifdef NGHTTP3_HAVE_SSE2
+  features |= NGHTTP3_CPU_FEATURE_SSE2;
+#endif /* defined(NGHTTP3_HAVE_SSE2) */
+
+#ifdef NGHTTP3_HAVE_NEON
+  features |= NGHTTP3_CPU_FEATURE_NEON;
+#endif /* defined(NGHTTP3_HAVE_NEON) */
+
+#ifndef NGHTTP3_AVX2_DISPATCH
+#  ifdef NGHTTP3_HAVE_AVX2
+  features |= NGHTTP3_CPU_FEATURE_AVX2;
+#  endif /* defined(NGHTTP3_HAVE_AVX2) */
+#elif defined(__GNUC__)
+  __builtin_cpu_init();
+
+  if (__builtin_cpu_supports("avx2")) {
+    features |= NGHTTP3_CPU_FEATURE_AVX2;
+  }
+#else /* !defined(__GNUC__) */
+  if (cpu_supports_avx2()) {
+    features |= NGHTTP3_CPU_FEATURE_AVX2;
+  }
+#endif /* !defined(__GNUC__) */
+
+  return features;
+}
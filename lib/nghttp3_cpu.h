@@ -0,0 +1,103 @@
+/*
+ * nghttp3
+ *
+ * Copyright (c) 2026 nghttp3 contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#ifndef NGHTTP3_CPU_H
+#define NGHTTP3_CPU_H
+
+#ifdef HAVE_CONFIG_H
+#  include <config.h>
+#endif /* defined(HAVE_CONFIG_H) */
+
+#include <nghttp3/nghttp3.h>
+
+/* NGHTTP3_CPU_FEATURE_SSE2 indicates that SSE2 instructions are
+   available. */
+#define NGHTTP3_CPU_FEATURE_SSE2 0x01U
+/* NGHTTP3_CPU_FEATURE_AVX2 indicates that AVX2 instructions are
+   available, and the operating system saves YMM registers. */
+#define NGHTTP3_CPU_FEATURE_AVX2 0x02U
+/* NGHTTP3_CPU_FEATURE_NEON indicates that Advanced SIMD (NEON)
+   instructions are available. */
+#define NGHTTP3_CPU_FEATURE_NEON 0x04U
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) ||            \
+  defined(_M_IX86)
+#  define NGHTTP3_CPU_X86 1
+#endif /* defined(__x86_64__) || defined(__i386__) || defined(_M_X64) ||
+          defined(_M_IX86) */
+
+#if defined(__SSE2__) || defined(_M_X64) ||                                    \
+  (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+/* NGHTTP3_HAVE_SSE2 is defined if SSE2 is part of the baseline
+   instruction set of the build target. */
+#  define NGHTTP3_HAVE_SSE2 1
+#endif /* defined(__SSE2__) || defined(_M_X64) ||
+          (defined(_M_IX86_FP) && _M_IX86_FP >= 2) */
+
+#ifdef __AVX2__
+#  define NGHTTP3_HAVE_AVX2 1
+#  define NGHTTP3_TARGET_AVX2
+#elif defined(NGHTTP3_CPU_X86) && defined(__GNUC__)
+/* AVX2 kernels are compiled with the target attribute, and selected
+   at run time. */
+#  define NGHTTP3_HAVE_AVX2 1
+#  define NGHTTP3_AVX2_DISPATCH 1
+#  define NGHTTP3_TARGET_AVX2 __attribute__((target("avx2")))
+#elif defined(NGHTTP3_CPU_X86) && defined(_MSC_VER)
+/* MSVC allows AVX2 intrinsics without any compiler option. */
+#  define NGHTTP3_HAVE_AVX2 1
+#  define NGHTTP3_AVX2_DISPATCH 1
+#  define NGHTTP3_TARGET_AVX2
+#endif /* defined(NGHTTP3_CPU_X86) && defined(_MSC_VER) */
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+/* NGHTTP3_HAVE_NEON is defined if NEON is part of the baseline
+   instruction set of the build target, which is always the case on
+   AArch64. */
+#  define NGHTTP3_HAVE_NEON 1
+#endif /* defined(__ARM_NEON) || defined(__ARM_NEON__) */
+
+/*
+ * nghttp3_cpu_load_kernel and nghttp3_cpu_store_kernel read and write
+ * a function pointer pointed by |P| which is resolved at the first
+ * use.  Several threads may resolve it at the same time, and they
+ * store the same value.
+ */
+#ifdef __GNUC__
+#  define nghttp3_cpu_load_kernel(P) __atomic_load_n((P), __ATOMIC_RELAXED)
+#  define nghttp3_cpu_store_kernel(P, F)                                       \
+    __atomic_store_n((P), (F), __ATOMIC_RELAXED)
+#else /* !defined(__GNUC__) */
+#  define nghttp3_cpu_load_kernel(P) (*(P))
+#  define nghttp3_cpu_store_kernel(P, F) (*(P) = (F))
+#endif /* !defined(__GNUC__) */
+
+/*
+ * nghttp3_cpu_get_features returns the bitwise OR of zero or more of
+ * NGHTTP3_CPU_FEATURE_* which the running CPU supports.  Only the
+ * features for which the library has compiled kernels are reported.
+ */
+uint32_t nghttp3_cpu_get_features(void);
+
+#endif /* !defined(NGHTTP3_CPU_H) */
@@ -63,12 +63,22 @@ typedef struct nghttp3_frame_data {
   /* dr is set when sending DATA frame.  It is not used on
      reception. */
   nghttp3_data_reader dr;
+  /* read_data_buf, if not NULL, is used instead of dr to generate
+     body.  The buffers it provides are owned by the library. */
+  nghttp3_read_data_buf_callback read_data_buf;
+  /* fd, if use_fd is nonzero, is the file range to read body from.
+     offset and len are advanced as body is read. */
+  nghttp3_data_fd fd;
+  uint8_t use_fd;
 } nghttp3_frame_data;
 
 typedef struct nghttp3_frame_headers {
   uint64_t type;
   nghttp3_nv *nva;
   size_t nvlen;
+  /* pnva, if not NULL, is the prepared header fields to send instead
+     of nva.  It is owned by application. */
+  const nghttp3_prepared_nva *pnva;
 } nghttp3_frame_headers;
 
 #define NGHTTP3_SETTINGS_ID_MAX_FIELD_SECTION_SIZE 0x06U
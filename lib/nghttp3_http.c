@@ -28,11 +28,18 @@
 #include <string.h>
 #include <assert.h>
 
-#ifdef __AVX2__
+#include "nghttp3_cpu.h"
+
+#if defined(NGHTTP3_HAVE_SSE2) || defined(NGHTTP3_HAVE_AVX2)
 #  include <immintrin.h>
-#endif /* __AVX2__ */
+#endif /* defined(NGHTTP3_HAVE_SSE2) || defined(NGHTTP3_HAVE_AVX2) */
+
+#ifdef NGHTTP3_HAVE_NEON
+#  include <arm_neon.h>
+#endif /* defined(NGHTTP3_HAVE_NEON) */
 
 #include "nghttp3_stream.h"
+#include "nghttp3_qpack.h"
 #include "nghttp3_macro.h"
 #include "nghttp3_conv.h"
 #include "nghttp3_unreachable.h"
@@ -316,8 +323,12 @@ static int check_path(const uint8_t *value, size_t len) {
   return 1;
 }
 
+static int http_check_header_value(const nghttp3_qpack_nv *nv,
+                                   uint8_t field_flags);
+
 static int http_request_on_header(nghttp3_http_state *http,
-                                  const nghttp3_qpack_nv *nv, int trailers,
+                                  const nghttp3_qpack_nv *nv,
+                                  uint8_t field_flags, int trailers,
                                   int connect_protocol) {
   nghttp3_pri pri;
 
@@ -380,7 +391,7 @@ static int http_request_on_header(nghttp3_http_state *http,
     break;
   case NGHTTP3_QPACK_TOKEN__PROTOCOL:
     if (!connect_protocol ||
-        !nghttp3_check_header_value(nv->value->base, nv->value->len) ||
+        !http_check_header_value(nv, field_flags) ||
         !check_pseudo_header(http, nv, NGHTTP3_HTTP_FLAG__PROTOCOL)) {
       return NGHTTP3_ERR_MALFORMED_HTTP_HEADER;
     }
@@ -423,7 +434,7 @@ static int http_request_on_header(nghttp3_http_state *http,
     }
     break;
   case NGHTTP3_QPACK_TOKEN_PRIORITY:
-    if (!nghttp3_check_header_value(nv->value->base, nv->value->len)) {
+    if (!http_check_header_value(nv, field_flags)) {
       http->flags &= ~NGHTTP3_HTTP_FLAG_PRIORITY;
       http->flags |= NGHTTP3_HTTP_FLAG_BAD_PRIORITY;
 
@@ -452,7 +463,7 @@ static int http_request_on_header(nghttp3_http_state *http,
       return NGHTTP3_ERR_MALFORMED_HTTP_HEADER;
     }
 
-    if (!nghttp3_check_header_value(nv->value->base, nv->value->len)) {
+    if (!http_check_header_value(nv, field_flags)) {
       return NGHTTP3_ERR_REMOVE_HTTP_HEADER;
     }
   }
@@ -461,7 +472,8 @@ static int http_request_on_header(nghttp3_http_state *http,
 }
 
 static int http_response_on_header(nghttp3_http_state *http,
-                                   const nghttp3_qpack_nv *nv, int trailers) {
+                                   const nghttp3_qpack_nv *nv,
+                                   uint8_t field_flags, int trailers) {
   switch (nv->token) {
   case NGHTTP3_QPACK_TOKEN__STATUS: {
     if (!check_pseudo_header(http, nv, NGHTTP3_HTTP_FLAG__STATUS)) {
@@ -525,7 +537,7 @@ static int http_response_on_header(nghttp3_http_state *http,
       return NGHTTP3_ERR_MALFORMED_HTTP_HEADER;
     }
 
-    if (!nghttp3_check_header_value(nv->value->base, nv->value->len)) {
+    if (!http_check_header_value(nv, field_flags)) {
       return NGHTTP3_ERR_REMOVE_HTTP_HEADER;
     }
   }
@@ -535,8 +547,34 @@ static int http_response_on_header(nghttp3_http_state *http,
 
 static int http_check_nonempty_header_name(const uint8_t *name, size_t len);
 
+/*
+ * http_check_field_name validates the regular header name in |nv|,
+ * and returns the same value as http_check_nonempty_header_name.  If
+ * |field_flags| tells the result, the name is not scanned.
+ */
+static int http_check_field_name(const nghttp3_qpack_nv *nv,
+                                 uint8_t field_flags) {
+  switch (field_flags & (NGHTTP3_QPACK_FIELD_FLAG_NAME_CLASSIFIED |
+                         NGHTTP3_QPACK_FIELD_FLAG_NAME_BAD |
+                         NGHTTP3_QPACK_FIELD_FLAG_NAME_UPPER)) {
+  case NGHTTP3_QPACK_FIELD_FLAG_NAME_CLASSIFIED:
+    return 1;
+  case NGHTTP3_QPACK_FIELD_FLAG_NAME_CLASSIFIED |
+    NGHTTP3_QPACK_FIELD_FLAG_NAME_BAD:
+    return 0;
+  case NGHTTP3_QPACK_FIELD_FLAG_NAME_CLASSIFIED |
+    NGHTTP3_QPACK_FIELD_FLAG_NAME_UPPER:
+    return -1;
+  default:
+    /* Not classified, or the character which comes first decides
+       the result. */
+    return http_check_nonempty_header_name(nv->name->base, nv->name->len);
+  }
+}
+
 int nghttp3_http_on_header(nghttp3_http_state *http, const nghttp3_qpack_nv *nv,
-                           int request, int trailers, int connect_protocol) {
+                           uint8_t field_flags, int request, int trailers,
+                           int connect_protocol) {
   if (nv->name->len == 0) {
     http->flags |= NGHTTP3_HTTP_FLAG_PSEUDO_HEADER_DISALLOWED;
 
@@ -552,7 +590,7 @@ int nghttp3_http_on_header(nghttp3_http_state *http, const nghttp3_qpack_nv *nv,
   } else {
     http->flags |= NGHTTP3_HTTP_FLAG_PSEUDO_HEADER_DISALLOWED;
 
-    switch (http_check_nonempty_header_name(nv->name->base, nv->name->len)) {
+    switch (http_check_field_name(nv, field_flags)) {
     case 0:
       return NGHTTP3_ERR_REMOVE_HTTP_HEADER;
     case -1:
@@ -564,10 +602,11 @@ int nghttp3_http_on_header(nghttp3_http_state *http, const nghttp3_qpack_nv *nv,
   assert(nv->name->len > 0);
 
   if (request) {
-    return http_request_on_header(http, nv, trailers, connect_protocol);
+    return http_request_on_header(http, nv, field_flags, trailers,
+                                  connect_protocol);
   }
 
-  return http_response_on_header(http, nv, trailers);
+  return http_response_on_header(http, nv, field_flags, trailers);
 }
 
 int nghttp3_http_on_request_headers(nghttp3_http_state *http) {
@@ -688,8 +727,278 @@ static const int8_t VALID_HD_NAME_CHARS[256] = {
   ['x'] = 1,  ['y'] = 1,  ['z'] = 1,  ['|'] = 1,  ['~'] = 1,
 };
 
+static int scan_header_name(const uint8_t *first, const uint8_t *last) {
+  int rv;
+
+  for (; first != last; ++first) {
+    rv = VALID_HD_NAME_CHARS[*first];
+    if (rv != 1) {
+      return rv;
+    }
+  }
+
+  return 1;
+}
+
+#if defined(NGHTTP3_HAVE_SSE2) || defined(NGHTTP3_HAVE_AVX2) ||                \
+  defined(NGHTTP3_HAVE_NEON)
+/*
+ * header_name_mask_result returns the result of
+ * nghttp3_http_name_scanner from the masks of a block.  |bad| and
+ * |upper| flag the characters which are not allowed in HTTP field
+ * name, and the ones in [A-Z] respectively, with the same number of
+ * bits per character.  At least one of them must be nonzero.  The
+ * flagged character which comes first decides the result.
+ */
+static int header_name_mask_result(uint64_t bad, uint64_t upper) {
+  uint64_t m = bad | upper;
+
+  assert(m);
+
+  /* Isolate the lowest set bit. */
+  m &= ~m + 1;
+
+  return (bad & m) ? 0 : -1;
+}
+#endif /* defined(NGHTTP3_HAVE_SSE2) || defined(NGHTTP3_HAVE_AVX2) ||
+          defined(NGHTTP3_HAVE_NEON) */
+
+#ifdef NGHTTP3_HAVE_SSE2
+/* sse2_in_range returns a mask of the bytes of |s| in [lo, hi].  hi
+   must be less than 0x7f. */
+#  define sse2_in_range(S, LO, HI)                                             \
+    _mm_and_si128(_mm_cmpgt_epi8((S), _mm_set1_epi8((LO) - 1)),                \
+                  _mm_cmpgt_epi8(_mm_set1_epi8((HI) + 1), (S)))
+
+/*
+ * scan_header_name_block_sse2 validates 16 bytes pointed by |p|, and
+ * returns the same value as nghttp3_http_name_scanner.
+ */
+static int scan_header_name_block_sse2(const uint8_t *p) {
+  __m128i s, lower;
+  uint32_t mlower, mupper;
+
+  s = _mm_loadu_si128((const void *)p);
+
+  lower = _mm_or_si128(
+    _mm_or_si128(
+      _mm_or_si128(_mm_cmpeq_epi8(s, _mm_set1_epi8('!')),
+                   sse2_in_range(s, '#', '\'')),
+      _mm_or_si128(sse2_in_range(s, '*', '+'), sse2_in_range(s, '-', '.'))),
+    _mm_or_si128(
+      _mm_or_si128(sse2_in_range(s, '0', '9'), sse2_in_range(s, '^', 'z')),
+      _mm_or_si128(_mm_cmpeq_epi8(s, _mm_set1_epi8('|')),
+                   _mm_cmpeq_epi8(s, _mm_set1_epi8('~')))));
+
+  mlower = (uint32_t)_mm_movemask_epi8(lower);
+  if (mlower == 0xFFFF) {
+    return 1;
+  }
+
+  mupper = (uint32_t)_mm_movemask_epi8(sse2_in_range(s, 'A', 'Z'));
+
+  return header_name_mask_result(~(mlower | mupper) & 0xFFFF, mupper);
+}
+
+static int scan_header_name_sse2(const uint8_t *first, const uint8_t *last) {
+  int rv;
+
+  if (last - first < 16) {
+    return scan_header_name(first, last);
+  }
+
+  for (; last - first > 16; first += 16) {
+    rv = scan_header_name_block_sse2(first);
+    if (rv != 1) {
+      return rv;
+    }
+  }
+
+  /* The last block may overlap the previous one, whose characters are
+     all valid, so that the first flagged character is still the
+     first one in the name. */
+  return scan_header_name_block_sse2(last - 16);
+}
+#endif /* defined(NGHTTP3_HAVE_SSE2) */
+
+#ifdef NGHTTP3_HAVE_AVX2
+/* avx2_in_range is the AVX2 version of sse2_in_range. */
+#  define avx2_in_range(S, LO, HI)                                             \
+    _mm256_and_si256(_mm256_cmpgt_epi8((S), _mm256_set1_epi8((LO) - 1)),       \
+                     _mm256_cmpgt_epi8(_mm256_set1_epi8((HI) + 1), (S)))
+
+/*
+ * scan_header_name_block_avx2 validates 32 bytes in |s|, and returns
+ * the same value as nghttp3_http_name_scanner.
+ */
+NGHTTP3_TARGET_AVX2
+static int scan_header_name_block_avx2(__m256i s) {
+  __m256i lower;
+  uint32_t mlower, mupper;
+
+  lower = _mm256_or_si256(
+    _mm256_or_si256(
+      _mm256_or_si256(_mm256_cmpeq_epi8(s, _mm256_set1_epi8('!')),
+                      avx2_in_range(s, '#', '\'')),
+      _mm256_or_si256(avx2_in_range(s, '*', '+'), avx2_in_range(s, '-', '.'))),
+    _mm256_or_si256(
+      _mm256_or_si256(avx2_in_range(s, '0', '9'), avx2_in_range(s, '^', 'z')),
+      _mm256_or_si256(_mm256_cmpeq_epi8(s, _mm256_set1_epi8('|')),
+                      _mm256_cmpeq_epi8(s, _mm256_set1_epi8('~')))));
+
+  mlower = (uint32_t)_mm256_movemask_epi8(lower);
+  if (mlower == 0xFFFFFFFFU) {
+    return 1;
+  }
+
+  mupper = (uint32_t)_mm256_movemask_epi8(avx2_in_range(s, 'A', 'Z'));
+
+  return header_name_mask_result(~(mlower | mupper), mupper);
+}
+
+NGHTTP3_TARGET_AVX2
+static int scan_header_name_avx2(const uint8_t *first, const uint8_t *last) {
+  int rv;
+
+  if (last - first < 16) {
+    return scan_header_name(first, last);
+  }
+
+  if (last - first <= 32) {
+    /* The first and the last 16 bytes, which may overlap, are
+       validated in a single block. */
+    return scan_header_name_block_avx2(_mm256_inserti128_si256(
+      _mm256_castsi128_si256(_mm_loadu_si128((const void *)first)),
+      _mm_loadu_si128((const void *)(last - 16)), 1));
+  }
+
+  for (; last - first > 32; first += 32) {
+    rv = scan_header_name_block_avx2(_mm256_loadu_si256((const void *)first));
+    if (rv != 1) {
+      return rv;
+    }
+  }
+
+  /* See scan_header_name_sse2 for the overlapping last block. */
+  return scan_header_name_block_avx2(
+    _mm256_loadu_si256((const void *)(last - 32)));
+}
+#endif /* defined(NGHTTP3_HAVE_AVX2) */
+
+#ifdef NGHTTP3_HAVE_NEON
+/* neon_in_range returns a mask of the bytes of |s| in [lo, hi]. */
+#  define neon_in_range(S, LO, HI)                                             \
+    vandq_u8(vcgeq_u8((S), vdupq_n_u8(LO)), vcleq_u8((S), vdupq_n_u8(HI)))
+
+/* neon_movemask returns 4 bits per byte of |v| whose bytes are either
+   0x00 or 0xff, in the order of the bytes. */
+static uint64_t neon_movemask(uint8x16_t v) {
+  return vget_lane_u64(
+    vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(v), 4)), 0);
+}
+
+/*
+ * scan_header_name_block_neon validates 16 bytes pointed by |p|, and
+ * returns the same value as nghttp3_http_name_scanner.
+ */
+static int scan_header_name_block_neon(const uint8_t *p) {
+  uint8x16_t s, lower;
+  uint64_t mlower, mupper;
+
+  s = vld1q_u8(p);
+
+  lower = vorrq_u8(
+    vorrq_u8(
+      vorrq_u8(vceqq_u8(s, vdupq_n_u8('!')), neon_in_range(s, '#', '\'')),
+      vorrq_u8(neon_in_range(s, '*', '+'), neon_in_range(s, '-', '.'))),
+    vorrq_u8(
+      vorrq_u8(neon_in_range(s, '0', '9'), neon_in_range(s, '^', 'z')),
+      vorrq_u8(vceqq_u8(s, vdupq_n_u8('|')), vceqq_u8(s, vdupq_n_u8('~')))));
+
+  mlower = neon_movemask(lower);
+  if (mlower == UINT64_MAX) {
+    return 1;
+  }
+
+  mupper = neon_movemask(neon_in_range(s, 'A', 'Z'));
+
+  return header_name_mask_result(~(mlower | mupper), mupper);
+}
+
+static int scan_header_name_neon(const uint8_t *first, const uint8_t *last) {
+  int rv;
+
+  if (last - first < 16) {
+    return scan_header_name(first, last);
+  }
+
+  for (; last - first > 16; first += 16) {
+    rv = scan_header_name_block_neon(first);
+    if (rv != 1) {
+      return rv;
+    }
+  }
+
+  /* See scan_header_name_sse2 for the overlapping last block. */
+  return scan_header_name_block_neon(last - 16);
+}
+#endif /* defined(NGHTTP3_HAVE_NEON) */
+
+nghttp3_http_name_scanner nghttp3_http_select_name_scanner(uint32_t features) {
+#ifdef NGHTTP3_HAVE_AVX2
+  if (features & NGHTTP3_CPU_FEATURE_AVX2) {
+    return scan_header_name_avx2;
+  }
+#endif /* defined(NGHTTP3_HAVE_AVX2) */
+
+#ifdef NGHTTP3_HAVE_SSE2
+  if (features & NGHTTP3_CPU_FEATURE_SSE2) {
+    return scan_header_name_sse2;
+  }
+#endif /* defined(NGHTTP3_HAVE_SSE2) */
+
+#ifdef NGHTTP3_HAVE_NEON
+  if (features & NGHTTP3_CPU_FEATURE_NEON) {
+    return scan_header_name_neon;
+  }
+#endif /* defined(NGHTTP3_HAVE_NEON) */
+
+  (void)features;
+
+  return scan_header_name;
+}
+
+static int resolve_name_scanner(const uint8_t *first, const uint8_t *last);
+
+/* name_scanner is the kernel which validates HTTP field name.  It is
+   resolved from the features of the running CPU at the first use. */
+static nghttp3_http_name_scanner name_scanner = resolve_name_scanner;
+
+static int resolve_name_scanner(const uint8_t *first, const uint8_t *last) {
+  nghttp3_http_name_scanner scanner =
+    nghttp3_http_select_name_scanner(nghttp3_cpu_get_features());
+
+  nghttp3_cpu_store_kernel(&name_scanner, scanner);
+
+  return scanner(first, last);
+}
+
+/*
+ * scan_header_name_dispatch validates HTTP field name in [|first|,
+ * |last|), and returns the same value as nghttp3_http_name_scanner.
+ * Most field names are shorter than a block of the kernels, and they
+ * are validated by the scalar loop without calling the kernel.
+ */
+static int scan_header_name_dispatch(const uint8_t *first,
+                                     const uint8_t *last) {
+  if (last - first < NGHTTP3_HTTP_NAME_SCANNER_MIN_LEN) {
+    return scan_header_name(first, last);
+  }
+
+  return nghttp3_cpu_load_kernel(&name_scanner)(first, last);
+}
+
 int nghttp3_check_header_name(const uint8_t *name, size_t len) {
-  const uint8_t *last;
   if (len == 0) {
     return 0;
   }
@@ -700,12 +1009,8 @@ int nghttp3_check_header_name(const uint8_t *name, size_t len) {
     ++name;
     --len;
   }
-  for (last = name + len; name != last; ++name) {
-    if (VALID_HD_NAME_CHARS[*name] != 1) {
-      return 0;
-    }
-  }
-  return 1;
+
+  return scan_header_name_dispatch(name, name + len) == 1;
 }
 
 /* http_check_nonempty_header_name validates regular header name
@@ -713,17 +1018,7 @@ int nghttp3_check_header_name(const uint8_t *name, size_t len) {
    zero.  This function returns 1 if it succeeds, or -1 if the name
    contains a character in [A-Z], otherwise 0. */
 static int http_check_nonempty_header_name(const uint8_t *name, size_t len) {
-  const uint8_t *last;
-  int rv;
-
-  for (last = name + len; name != last; ++name) {
-    rv = VALID_HD_NAME_CHARS[*name];
-    if (rv != 1) {
-      return rv;
-    }
-  }
-
-  return 1;
+  return scan_header_name_dispatch(name, name + len);
 }
 
 static const int8_t VALID_HD_VALUE_CHARS[256] = {
@@ -767,7 +1062,45 @@ static const int8_t VALID_HD_VALUE_CHARS[256] = {
   [0xFE] = 1, [0xFF] = 1,
 };
 
-#ifdef __AVX2__
+static int contains_bad_header_value_char(const uint8_t *first,
+                                          const uint8_t *last) {
+  for (; first != last; ++first) {
+    if (!VALID_HD_VALUE_CHARS[*first]) {
+      return 1;
+    }
+  }
+
+  return 0;
+}
+
+#ifdef NGHTTP3_HAVE_SSE2
+static int contains_bad_header_value_char_sse2(const uint8_t *first,
+                                               const uint8_t *last) {
+  const __m128i ctll = _mm_set1_epi8(0x00 - 1);
+  const __m128i ctlr = _mm_set1_epi8(0x1F + 1);
+  const __m128i ht = _mm_set1_epi8('\t');
+  const __m128i del = _mm_set1_epi8(0x7F);
+  __m128i s, x;
+
+  for (; last - first >= 16; first += 16) {
+    s = _mm_loadu_si128((const void *)first);
+
+    x = _mm_andnot_si128(
+      _mm_cmpeq_epi8(s, ht),
+      _mm_and_si128(_mm_cmpgt_epi8(s, ctll), _mm_cmpgt_epi8(ctlr, s)));
+    x = _mm_or_si128(_mm_cmpeq_epi8(s, del), x);
+
+    if (_mm_movemask_epi8(x)) {
+      return 1;
+    }
+  }
+
+  return contains_bad_header_value_char(first, last);
+}
+#endif /* defined(NGHTTP3_HAVE_SSE2) */
+
+#ifdef NGHTTP3_HAVE_AVX2
+NGHTTP3_TARGET_AVX2
 static int contains_bad_header_value_char_avx2(const uint8_t *first,
                                                const uint8_t *last) {
   const __m256i ctll = _mm256_set1_epi8(0x00 - 1);
@@ -777,8 +1110,8 @@ static int contains_bad_header_value_char_avx2(const uint8_t *first,
   __m256i s, x;
   uint32_t m;
 
-  for (; first != last; first += 32) {
-    s = _mm256_loadu_si256((void *)first);
+  for (; last - first >= 32; first += 32) {
+    s = _mm256_loadu_si256((const void *)first);
 
     x = _mm256_andnot_si256(
       _mm256_cmpeq_epi8(s, ht),
@@ -791,16 +1124,68 @@ static int contains_bad_header_value_char_avx2(const uint8_t *first,
     }
   }
 
-  return 0;
+  return contains_bad_header_value_char(first, last);
 }
-#endif /* __AVX2__ */
+#endif /* defined(NGHTTP3_HAVE_AVX2) */
 
-int nghttp3_check_header_value(const uint8_t *value, size_t len) {
-  const uint8_t *last;
-#ifdef __AVX2__
-  const uint8_t *last32;
-#endif /* __AVX2__ */
+nghttp3_http_value_scanner
+nghttp3_http_select_value_scanner(uint32_t features) {
+#ifdef NGHTTP3_HAVE_AVX2
+  if (features & NGHTTP3_CPU_FEATURE_AVX2) {
+    return contains_bad_header_value_char_avx2;
+  }
+#endif /* defined(NGHTTP3_HAVE_AVX2) */
 
+#ifdef NGHTTP3_HAVE_SSE2
+  if (features & NGHTTP3_CPU_FEATURE_SSE2) {
+    return contains_bad_header_value_char_sse2;
+  }
+#endif /* defined(NGHTTP3_HAVE_SSE2) */
+
+  (void)features;
+
+  return contains_bad_header_value_char;
+}
+
+static int resolve_value_scanner(const uint8_t *first, const uint8_t *last);
+
+/* value_scanner is the kernel which nghttp3_check_header_value uses.
+   It is resolved from the features of the running CPU at the first
+   use. */
+static nghttp3_http_value_scanner value_scanner = resolve_value_scanner;
+
+static int resolve_value_scanner(const uint8_t *first, const uint8_t *last) {
+  nghttp3_http_value_scanner scanner =
+    nghttp3_http_select_value_scanner(nghttp3_cpu_get_features());
+
+  nghttp3_cpu_store_kernel(&value_scanner, scanner);
+
+  return scanner(first, last);
+}
+
+/*
+ * http_check_header_value returns nonzero if the header value in
+ * |nv| is valid.  If |field_flags| has
+ * NGHTTP3_QPACK_FIELD_FLAG_VALUE_CLASSIFIED, only leading and
+ * trailing white spaces are examined.
+ */
+static int http_check_header_value(const nghttp3_qpack_nv *nv,
+                                   uint8_t field_flags) {
+  const uint8_t *value = nv->value->base;
+  size_t len = nv->value->len;
+
+  if (!(field_flags & NGHTTP3_QPACK_FIELD_FLAG_VALUE_CLASSIFIED)) {
+    return nghttp3_check_header_value(value, len);
+  }
+
+  if (field_flags & NGHTTP3_QPACK_FIELD_FLAG_VALUE_BAD) {
+    return 0;
+  }
+
+  return len == 0 || (!is_ws(*value) && !is_ws(*(value + len - 1)));
+}
+
+int nghttp3_check_header_value(const uint8_t *value, size_t len) {
   switch (len) {
   case 0:
     return 1;
@@ -816,25 +1201,7 @@ int nghttp3_check_header_value(const uint8_t *value, size_t len) {
     }
   }
 
-  last = value + len;
-
-#ifdef __AVX2__
-  if (len >= 32) {
-    last32 = value + (len & ~(size_t)0x1FU);
-    if (contains_bad_header_value_char_avx2(value, last32)) {
-      return 0;
-    }
-
-    value = last32;
-  }
-#endif /* __AVX2__ */
-
-  for (; value != last; ++value) {
-    if (!VALID_HD_VALUE_CHARS[*value]) {
-      return 0;
-    }
-  }
-  return 1;
+  return !nghttp3_cpu_load_kernel(&value_scanner)(value, value + len);
 }
 
 int nghttp3_pri_eq(const nghttp3_pri *a, const nghttp3_pri *b) {
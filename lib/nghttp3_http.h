@@ -85,9 +85,13 @@ typedef struct nghttp3_http_state nghttp3_http_state;
 /*
  * This function is called when HTTP header field |nv| received for
  * |http|.  This function will validate |nv| against the current state
- * of stream.  Pass nonzero if this is request headers. Pass nonzero
- * to |trailers| if |nv| is included in trailers.  |connect_protocol|
- * is nonzero if Extended CONNECT Method is enabled.
+ * of stream.  |field_flags| is bitwise OR of zero or more of
+ * NGHTTP3_QPACK_FIELD_FLAG_* which QPACK decoder learned while
+ * decoding |nv|; the characters which have been classified are not
+ * scanned again.  Pass nonzero if this is request headers. Pass
+ * nonzero to |trailers| if |nv| is included in trailers.
+ * |connect_protocol| is nonzero if Extended CONNECT Method is
+ * enabled.
  *
  * This function returns 0 if it succeeds, or one of the following
  * negative error codes:
@@ -99,7 +103,8 @@ typedef struct nghttp3_http_state nghttp3_http_state;
  *     if it was not received because of compatibility reasons.
  */
 int nghttp3_http_on_header(nghttp3_http_state *http, const nghttp3_qpack_nv *nv,
-                           int request, int trailers, int connect_protocol);
+                           uint8_t field_flags, int request, int trailers,
+                           int connect_protocol);
 
 /*
  * This function is called when request header is received.  This
@@ -170,4 +175,47 @@ int nghttp3_http_parse_priority(nghttp3_pri *dest, const uint8_t *value,
 
 int nghttp3_pri_eq(const nghttp3_pri *a, const nghttp3_pri *b);
 
+/*
+ * nghttp3_http_name_scanner is the type of the kernels which validate
+ * the characters of HTTP field name in [|first|, |last|).  They
+ * return 1 if all characters are allowed and not in [A-Z].
+ * Otherwise, they return -1 if the first offending character is in
+ * [A-Z], or 0.  A leading ':' is not allowed.
+ */
+typedef int (*nghttp3_http_name_scanner)(const uint8_t *first,
+                                         const uint8_t *last);
+
+/*
+ * NGHTTP3_HTTP_NAME_SCANNER_MIN_LEN is the length of HTTP field name
+ * from which the SIMD kernels are used.  Shorter names are validated
+ * by the scalar loop.
+ */
+#define NGHTTP3_HTTP_NAME_SCANNER_MIN_LEN 16
+
+/*
+ * nghttp3_http_select_name_scanner returns the fastest
+ * nghttp3_http_name_scanner which only uses the CPU features in
+ * |features|.  See nghttp3_http_select_value_scanner.
+ */
+nghttp3_http_name_scanner nghttp3_http_select_name_scanner(uint32_t features);
+
+/*
+ * nghttp3_http_value_scanner is the type of the kernels which return
+ * nonzero if the bytes in [|first|, |last|) contain a character which
+ * is not allowed in HTTP field value.  Leading and trailing white
+ * spaces are not checked.
+ */
+typedef int (*nghttp3_http_value_scanner)(const uint8_t *first,
+                                          const uint8_t *last);
+
+/*
+ * nghttp3_http_select_value_scanner returns the fastest
+ * nghttp3_http_value_scanner which only uses the CPU features in
+ * |features|, the bitwise OR of zero or more of
+ * NGHTTP3_CPU_FEATURE_*.  A scalar kernel is returned if |features|
+ * is 0.
+ */
+nghttp3_http_value_scanner
+nghttp3_http_select_value_scanner(uint32_t features);
+
 #endif /* !defined(NGHTTP3_HTTP_H) */
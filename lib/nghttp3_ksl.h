@@ -275,6 +275,14 @@ nghttp3_ksl_it nghttp3_ksl_end(const nghttp3_ksl *ksl);
  */
 size_t nghttp3_ksl_len(const nghttp3_ksl *ksl);
 
+/*
+ * nghttp3_ksl_get_memusage returns the number of bytes allocated for
+ * the blocks of |ksl|.  See nghttp3_objalloc_get_memusage.
+ */
+static inline size_t nghttp3_ksl_get_memusage(const nghttp3_ksl *ksl) {
+  return nghttp3_objalloc_get_memusage(&ksl->blkalloc);
+}
+
 /*
  * nghttp3_ksl_clear removes all elements stored in |ksl|.
  */
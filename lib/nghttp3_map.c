@@ -360,3 +360,46 @@ void nghttp3_map_clear(nghttp3_map *map) {
 }
 
 size_t nghttp3_map_size(const nghttp3_map *map) { return map->size; }
+
+int nghttp3_map_shrink(nghttp3_map *map) {
+  size_t hashbits = NGHTTP3_INITIAL_HASHBITS;
+  size_t tablelen;
+
+  if (map->keys == NULL) {
+    return 0;
+  }
+
+  if (map->size == 0) {
+    nghttp3_mem_free(map->mem, map->keys);
+    map->keys = NULL;
+    map->data = NULL;
+    map->psl = NULL;
+    map->hashbits = 0;
+
+    return 0;
+  }
+
+  /* Choose the table which can accept one more entry without
+     resizing.  See nghttp3_map_insert. */
+  for (;; ++hashbits) {
+    tablelen = (size_t)1 << hashbits;
+    if (map->size + 1 < tablelen - (tablelen >> 3)) {
+      break;
+    }
+  }
+
+  if (hashbits >= map->hashbits) {
+    return 0;
+  }
+
+  return map_resize(map, hashbits);
+}
+
+size_t nghttp3_map_get_memusage(const nghttp3_map *map) {
+  if (map->keys == NULL) {
+    return 0;
+  }
+
+  return ((size_t)1 << map->hashbits) *
+         (sizeof(nghttp3_map_key_type) + sizeof(void *) + sizeof(uint8_t));
+}
@@ -108,6 +108,25 @@ void nghttp3_map_clear(nghttp3_map *map);
  */
 size_t nghttp3_map_size(const nghttp3_map *map);
 
+/*
+ * nghttp3_map_shrink shrinks the hash table of |map| to the smallest
+ * size that holds the current entries without exceeding the load
+ * factor.  If |map| is empty, the hash table is freed.
+ *
+ * This function returns 0 if it succeeds, or one of the following
+ * negative error codes:
+ *
+ * NGHTTP3_ERR_NOMEM
+ *     Out of memory.  |map| is left unchanged.
+ */
+int nghttp3_map_shrink(nghttp3_map *map);
+
+/*
+ * nghttp3_map_get_memusage returns the number of bytes allocated for
+ * the hash table of |map|.
+ */
+size_t nghttp3_map_get_memusage(const nghttp3_map *map);
+
 /*
  * nghttp3_map_each applies the function |func| to each entry in the
  * |map| with the optional user supplied pointer |ptr|.
@@ -39,3 +39,76 @@ void nghttp3_objalloc_clear(nghttp3_objalloc *objalloc) {
   nghttp3_opl_clear(&objalloc->opl);
   nghttp3_balloc_clear(&objalloc->balloc);
 }
+
+#ifndef NOMEMPOOL
+static int opl_entry_in_range(const nghttp3_opl_entry *ent, uintptr_t begin,
+                              uintptr_t end) {
+  return (uintptr_t)ent >= begin && (uintptr_t)ent < end;
+}
+
+void nghttp3_objalloc_shrink(nghttp3_objalloc *objalloc, size_t objlen) {
+  nghttp3_balloc *balloc = &objalloc->balloc;
+  nghttp3_memblock_hd **phd, *hd;
+  nghttp3_opl_entry **pent, *ent;
+  uint8_t *p;
+  uintptr_t begin, end;
+  size_t nused, nfree;
+  int current;
+
+  objlen = (objlen + 0xFU) & ~(size_t)0xFU;
+
+  for (phd = &balloc->head; *phd;) {
+    hd = *phd;
+    p = nghttp3_memblock_begin(hd);
+    current = p == balloc->buf.begin;
+
+    begin = (uintptr_t)p;
+
+    /* The current block is only used up to balloc->buf.last.  The
+       other blocks are filled with as many objects as they can
+       hold. */
+    if (current) {
+      end = (uintptr_t)balloc->buf.last;
+    } else {
+      end = begin + balloc->blklen - balloc->blklen % objlen;
+    }
+
+    nused = (size_t)(end - begin) / objlen;
+    nfree = 0;
+
+    for (ent = objalloc->opl.head; ent && nfree < nused; ent = ent->next) {
+      if (opl_entry_in_range(ent, begin, end)) {
+        ++nfree;
+      }
+    }
+
+    if (nfree < nused) {
+      phd = &hd->next;
+      continue;
+    }
+
+    for (pent = &objalloc->opl.head; *pent;) {
+      ent = *pent;
+
+      if (opl_entry_in_range(ent, begin, end)) {
+        *pent = ent->next;
+        continue;
+      }
+
+      pent = &ent->next;
+    }
+
+    if (current) {
+      nghttp3_buf_wrap_init(&balloc->buf, (void *)"", 0);
+    }
+
+    *phd = hd->next;
+    nghttp3_mem_free(balloc->mem, hd);
+  }
+}
+#else  /* defined(NOMEMPOOL) */
+void nghttp3_objalloc_shrink(nghttp3_objalloc *objalloc, size_t objlen) {
+  (void)objalloc;
+  (void)objlen;
+}
+#endif /* defined(NOMEMPOOL) */
@@ -65,6 +65,28 @@ void nghttp3_objalloc_free(nghttp3_objalloc *objalloc);
  */
 void nghttp3_objalloc_clear(nghttp3_objalloc *objalloc);
 
+/*
+ * nghttp3_objalloc_shrink releases the memory blocks of |objalloc|
+ * which only contain the objects in the free list.  |objlen| is the
+ * size of objects allocated by |objalloc|, and all objects must be of
+ * the same size.  The cost of this function is proportional to the
+ * product of the number of memory blocks and the number of objects
+ * in the free list.  If NOMEMPOOL is defined, this function does
+ * nothing.
+ */
+void nghttp3_objalloc_shrink(nghttp3_objalloc *objalloc, size_t objlen);
+
+/*
+ * nghttp3_objalloc_get_memusage returns the number of bytes allocated
+ * for memory blocks by |objalloc|.  Objects in the free list are
+ * included.  If NOMEMPOOL is defined, objects are allocated
+ * individually, and this function returns 0.
+ */
+static inline size_t
+nghttp3_objalloc_get_memusage(const nghttp3_objalloc *objalloc) {
+  return nghttp3_balloc_get_memusage(&objalloc->balloc);
+}
+
 #ifndef NOMEMPOOL
 #  define nghttp3_objalloc_decl(NAME, TYPE, OPLENTFIELD)                       \
     inline static void nghttp3_objalloc_##NAME##_init(                         \
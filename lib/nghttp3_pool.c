@@ -0,0 +1,84 @@
+/*
+ * nghttp3
+ *
+ * Copyright (c) 2026 nghttp3 contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "nghttp3_pool.h"
+#include "nghttp3_stream.h"
+
+void nghttp3_pool_init(nghttp3_pool *pool, const nghttp3_mem *mem) {
+  pool->mem = mem;
+
+  nghttp3_objalloc_init(&pool->out_chunk_objalloc,
+                        NGHTTP3_STREAM_MIN_CHUNK_SIZE * 16, mem);
+  nghttp3_objalloc_init(&pool->file_chunk_objalloc,
+                        NGHTTP3_STREAM_FILE_CHUNK_SIZE * 4, mem);
+  nghttp3_objalloc_init(&pool->inq_chunk_objalloc,
+                        NGHTTP3_STREAM_INQ_CHUNK_SIZE * 4, mem);
+  nghttp3_objalloc_stream_init(&pool->stream_objalloc, 8, mem);
+}
+
+void nghttp3_pool_free(nghttp3_pool *pool) {
+  nghttp3_objalloc_free(&pool->stream_objalloc);
+  nghttp3_objalloc_free(&pool->out_chunk_objalloc);
+  nghttp3_objalloc_free(&pool->file_chunk_objalloc);
+  nghttp3_objalloc_free(&pool->inq_chunk_objalloc);
+}
+
+int nghttp3_pool_new(nghttp3_pool **ppool, const nghttp3_mem *mem) {
+  nghttp3_pool *pool;
+
+  if (mem == NULL) {
+    mem = nghttp3_mem_default();
+  }
+
+  pool = nghttp3_mem_malloc(mem, sizeof(nghttp3_pool));
+  if (pool == NULL) {
+    return NGHTTP3_ERR_NOMEM;
+  }
+
+  nghttp3_pool_init(pool, mem);
+
+  *ppool = pool;
+
+  return 0;
+}
+
+void nghttp3_pool_del(nghttp3_pool *pool) {
+  if (pool == NULL) {
+    return;
+  }
+
+  nghttp3_pool_free(pool);
+
+  nghttp3_mem_free(pool->mem, pool);
+}
+
+void nghttp3_pool_shrink(nghttp3_pool *pool) {
+  nghttp3_objalloc_shrink(&pool->out_chunk_objalloc,
+                          NGHTTP3_STREAM_MIN_CHUNK_SIZE);
+  nghttp3_objalloc_shrink(&pool->file_chunk_objalloc,
+                          NGHTTP3_STREAM_FILE_CHUNK_SIZE);
+  nghttp3_objalloc_shrink(&pool->inq_chunk_objalloc,
+                          NGHTTP3_STREAM_INQ_CHUNK_SIZE);
+  nghttp3_objalloc_shrink(&pool->stream_objalloc, sizeof(nghttp3_stream));
+}
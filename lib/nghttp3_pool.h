@@ -0,0 +1,65 @@
+/*
+ * nghttp3
+ *
+ * Copyright (c) 2026 nghttp3 contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#ifndef NGHTTP3_POOL_H
+#define NGHTTP3_POOL_H
+
+#ifdef HAVE_CONFIG_H
+#  include <config.h>
+#endif /* defined(HAVE_CONFIG_H) */
+
+#include <nghttp3/nghttp3.h>
+
+#include "nghttp3_objalloc.h"
+
+struct nghttp3_pool {
+  const nghttp3_mem *mem;
+  /* out_chunk_objalloc allocates the chunks of
+     NGHTTP3_STREAM_MIN_CHUNK_SIZE bytes which buffer outgoing
+     frames. */
+  nghttp3_objalloc out_chunk_objalloc;
+  /* file_chunk_objalloc allocates the buffers of
+     NGHTTP3_STREAM_FILE_CHUNK_SIZE bytes which hold body read from a
+     file descriptor. */
+  nghttp3_objalloc file_chunk_objalloc;
+  /* inq_chunk_objalloc allocates the buffers of
+     NGHTTP3_STREAM_INQ_CHUNK_SIZE bytes which hold stream data
+     received while the stream is blocked by QPACK decoder. */
+  nghttp3_objalloc inq_chunk_objalloc;
+  /* stream_objalloc allocates nghttp3_stream. */
+  nghttp3_objalloc stream_objalloc;
+};
+
+/*
+ * nghttp3_pool_init initializes |pool|.
+ */
+void nghttp3_pool_init(nghttp3_pool *pool, const nghttp3_mem *mem);
+
+/*
+ * nghttp3_pool_free frees resources allocated for |pool|.  All
+ * objects borrowed from |pool| must have been returned.
+ */
+void nghttp3_pool_free(nghttp3_pool *pool);
+
+#endif /* !defined(NGHTTP3_POOL_H) */
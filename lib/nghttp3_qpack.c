@@ -339,7 +339,7 @@ static int memeq(const void *s1, const void *s2, size_t n) {
 }
 
 /* Generated by genlibtokenlookup.py */
-static int32_t qpack_lookup_token(const uint8_t *name, size_t namelen) {
+int32_t nghttp3_qpack_lookup_token(const uint8_t *name, size_t namelen) {
   switch (namelen) {
   case 2:
     switch (name[1]) {
@@ -748,37 +748,210 @@ static int qpack_nv_value_eq(const nghttp3_qpack_nv *a, const nghttp3_nv *b) {
          memeq(a->value->base, b->value, b->valuelen);
 }
 
-static void qpack_map_init(nghttp3_qpack_map *map) {
-  *map = (nghttp3_qpack_map){0};
+static uint32_t qpack_hash_name(const nghttp3_nv *nv) {
+  /* 32 bit FNV-1a: http://isthe.com/chongo/tech/comp/fnv/ */
+  uint32_t h = 2166136261U;
+  size_t i;
+
+  for (i = 0; i < nv->namelen; ++i) {
+    h ^= nv->name[i];
+    h += (h << 1) + (h << 4) + (h << 7) + (h << 8) + (h << 24);
+  }
+
+  return h;
+}
+
+/*
+ * qpack_hash_nv returns the hash value of a field whose name hash is
+ * |hash|, and whose value is |value| of length |valuelen|.  Values
+ * can be long, so they are consumed 8 bytes at a time.
+ */
+static uint32_t qpack_hash_nv(uint32_t hash, const uint8_t *value,
+                              size_t valuelen) {
+  uint64_t h = ((uint64_t)hash << 32) ^ valuelen;
+  uint64_t w;
+
+  for (; valuelen >= sizeof(w); value += sizeof(w), valuelen -= sizeof(w)) {
+    memcpy(&w, value, sizeof(w));
+    h = (h ^ w) * 0x9E3779B97F4A7C15ULL;
+    h ^= h >> 32;
+  }
+
+  if (valuelen) {
+    w = 0;
+    memcpy(&w, value, valuelen);
+    h = (h ^ w) * 0x9E3779B97F4A7C15ULL;
+    h ^= h >> 32;
+  }
+
+  return (uint32_t)h;
+}
+
+/*
+ * qpack_hash_value returns the hash value of the name and value of
+ * |nv|.  |hash| is the hash value of nv->name.
+ */
+static uint32_t qpack_hash_value(uint32_t hash, const nghttp3_nv *nv) {
+  return qpack_hash_nv(hash, nv->value, nv->valuelen);
+}
+
+static void qpack_map_init(nghttp3_qpack_map *map, const nghttp3_mem *mem) {
+  *map = (nghttp3_qpack_map){
+    .mem = mem,
+  };
+}
+
+static void qpack_map_free(nghttp3_qpack_map *map) {
+  nghttp3_mem_free(map->mem, map->table);
+}
+
+static nghttp3_qpack_entry **qpack_map_bucket(const nghttp3_qpack_map *map,
+                                              uint32_t hash) {
+  return &map->table[hash & ((1U << map->hashbits) - 1)];
 }
 
+static nghttp3_qpack_entry **
+qpack_map_nvbucket(const nghttp3_qpack_map *map, uint32_t nvhash) {
+  return &map->nvtable[nvhash & ((1U << map->hashbits) - 1)];
+}
+
+/*
+ * qpack_map_reserve makes sure that one more entry can be inserted
+ * into |map| without exceeding the load factor of 1.  It doubles the
+ * number of buckets if necessary.
+ *
+ * This function returns 0 if it succeeds, or one of the following
+ * negative error codes:
+ *
+ * NGHTTP3_ERR_NOMEM
+ *     Out of memory.
+ */
+static int qpack_map_reserve(nghttp3_qpack_map *map) {
+  nghttp3_qpack_entry **table, **nvtable, *ent, *next, *lotail, *hitail;
+  nghttp3_qpack_entry **lo, **hi;
+  size_t i, hashbits, oldlen, len;
+
+  if (map->table == NULL) {
+    hashbits = NGHTTP3_QPACK_MAP_MIN_HASHBITS;
+  } else if (map->size < (1U << map->hashbits)) {
+    return 0;
+  } else {
+    hashbits = map->hashbits + 1;
+  }
+
+  len = (size_t)1 << hashbits;
+
+  table = nghttp3_mem_calloc(map->mem, len * 2, sizeof(nghttp3_qpack_entry *));
+  if (table == NULL) {
+    return NGHTTP3_ERR_NOMEM;
+  }
+
+  nvtable = table + len;
+
+  if (map->table) {
+    oldlen = 1U << map->hashbits;
+
+    /* Each bucket is split into 2.  Appending entries to the tail
+       keeps larger absidx near the root. */
+    for (i = 0; i < oldlen; ++i) {
+      lo = &table[i];
+      hi = &table[i + oldlen];
+      lotail = hitail = NULL;
+
+      for (ent = map->table[i]; ent; ent = next) {
+        next = ent->map_next;
+        ent->map_next = NULL;
+
+        if (ent->hash & oldlen) {
+          ent->map_prev = hitail;
+          *hi = hitail = ent;
+          hi = &ent->map_next;
+        } else {
+          ent->map_prev = lotail;
+          *lo = lotail = ent;
+          lo = &ent->map_next;
+        }
+      }
+
+      lo = &nvtable[i];
+      hi = &nvtable[i + oldlen];
+
+      for (ent = map->nvtable[i]; ent; ent = next) {
+        next = ent->nvmap_next;
+        ent->nvmap_next = NULL;
+
+        if (ent->nvhash & oldlen) {
+          *hi = ent;
+          hi = &ent->nvmap_next;
+        } else {
+          *lo = ent;
+          lo = &ent->nvmap_next;
+        }
+      }
+    }
+
+    nghttp3_mem_free(map->mem, map->table);
+  }
+
+  map->table = table;
+  map->nvtable = nvtable;
+  map->hashbits = hashbits;
+
+  return 0;
+}
+
+/*
+ * qpack_map_insert inserts |ent| into |map|.  qpack_map_reserve must
+ * be called before calling this function.
+ */
 static void qpack_map_insert(nghttp3_qpack_map *map, nghttp3_qpack_entry *ent) {
   nghttp3_qpack_entry **bucket;
 
-  bucket = &map->table[ent->hash & (NGHTTP3_QPACK_MAP_SIZE - 1)];
+  assert(map->size < (1U << map->hashbits));
 
-  if (*bucket == NULL) {
-    *bucket = ent;
-    return;
-  }
+  ++map->size;
 
   /* larger absidx is linked near the root */
+  bucket = qpack_map_bucket(map, ent->hash);
+
+  ent->map_prev = NULL;
   ent->map_next = *bucket;
+  if (*bucket) {
+    (*bucket)->map_prev = ent;
+  }
+  *bucket = ent;
+
+  bucket = qpack_map_nvbucket(map, ent->nvhash);
+
+  ent->nvmap_next = *bucket;
   *bucket = ent;
 }
 
 static void qpack_map_remove(nghttp3_qpack_map *map, nghttp3_qpack_entry *ent) {
   nghttp3_qpack_entry **dst;
 
-  dst = &map->table[ent->hash & (NGHTTP3_QPACK_MAP_SIZE - 1)];
+  if (ent->map_prev) {
+    ent->map_prev->map_next = ent->map_next;
+  } else {
+    *qpack_map_bucket(map, ent->hash) = ent->map_next;
+  }
+
+  if (ent->map_next) {
+    ent->map_next->map_prev = ent->map_prev;
+  }
+
+  ent->map_next = ent->map_prev = NULL;
+  --map->size;
 
-  for (; *dst; dst = &(*dst)->map_next) {
+  dst = qpack_map_nvbucket(map, ent->nvhash);
+
+  for (; *dst; dst = &(*dst)->nvmap_next) {
     if (*dst != ent) {
       continue;
     }
 
-    *dst = ent->map_next;
-    ent->map_next = NULL;
+    *dst = ent->nvmap_next;
+    ent->nvmap_next = NULL;
     return;
   }
 }
@@ -804,32 +977,47 @@ static void encoder_qpack_map_find(nghttp3_qpack_encoder *encoder,
                                    uint32_t hash, uint64_t krcnt,
                                    int allow_blocking, int name_only) {
   nghttp3_qpack_entry *p;
+  uint32_t nvhash;
 
   *exact_match = 0;
   *pmatch = NULL;
   *ppb_match = NULL;
 
-  for (p = encoder->dtable_map.table[hash & (NGHTTP3_QPACK_MAP_SIZE - 1)]; p;
-       p = p->map_next) {
+  if (encoder->dtable_map.table == NULL) {
+    return;
+  }
+
+  if (!name_only) {
+    nvhash = qpack_hash_value(hash, nv);
+
+    for (p = *qpack_map_nvbucket(&encoder->dtable_map, nvhash); p;
+         p = p->nvmap_next) {
+      if (nvhash != p->nvhash || token != p->nv.token ||
+          (token == -1 && !qpack_nv_name_eq(&p->nv, nv)) ||
+          !qpack_nv_value_eq(&p->nv, nv) ||
+          !qpack_context_can_reference(&encoder->ctx, p->absidx)) {
+        continue;
+      }
+      if (allow_blocking || p->absidx + 1 <= krcnt) {
+        *pmatch = p;
+        *exact_match = 1;
+        return;
+      }
+      if (!*ppb_match) {
+        *ppb_match = p;
+      }
+    }
+  }
+
+  for (p = *qpack_map_bucket(&encoder->dtable_map, hash); p; p = p->map_next) {
     if (token != p->nv.token ||
         (token == -1 && (hash != p->hash || !qpack_nv_name_eq(&p->nv, nv))) ||
         !qpack_context_can_reference(&encoder->ctx, p->absidx)) {
       continue;
     }
     if (allow_blocking || p->absidx + 1 <= krcnt) {
-      if (!*pmatch) {
-        *pmatch = p;
-        if (name_only) {
-          return;
-        }
-      }
-      if (qpack_nv_value_eq(&p->nv, nv)) {
-        *pmatch = p;
-        *exact_match = 1;
-        return;
-      }
-    } else if (!*ppb_match && qpack_nv_value_eq(&p->nv, nv)) {
-      *ppb_match = p;
+      *pmatch = p;
+      return;
     }
   }
 }
@@ -857,6 +1045,7 @@ static void qpack_context_init(nghttp3_qpack_context *ctx,
   ctx->max_dtable_capacity = 0;
   ctx->max_blocked_streams = max_blocked_streams;
   ctx->next_absidx = 0;
+  ctx->stats = (nghttp3_qpack_stats){0};
   ctx->bad = 0;
 }
 
@@ -872,6 +1061,32 @@ static void qpack_context_free(nghttp3_qpack_context *ctx) {
   nghttp3_ringbuf_free(&ctx->dtable);
 }
 
+static size_t qpack_rcbuf_get_memusage(const nghttp3_rcbuf *rcbuf) {
+  if (nghttp3_rcbuf_is_static(rcbuf)) {
+    return 0;
+  }
+
+  assert(rcbuf->ref > 0);
+
+  return (sizeof(nghttp3_rcbuf) + rcbuf->len + 1) / (size_t)rcbuf->ref;
+}
+
+static size_t
+qpack_context_get_dtable_memusage(const nghttp3_qpack_context *ctx) {
+  const nghttp3_qpack_entry *ent;
+  size_t i, len = nghttp3_ringbuf_len(&ctx->dtable);
+  size_t n = nghttp3_ringbuf_get_memusage(&ctx->dtable);
+
+  for (i = 0; i < len; ++i) {
+    ent = *(nghttp3_qpack_entry **)nghttp3_ringbuf_get(
+      (nghttp3_ringbuf *)&ctx->dtable, i);
+    n += sizeof(nghttp3_qpack_entry) + qpack_rcbuf_get_memusage(ent->nv.name) +
+         qpack_rcbuf_get_memusage(ent->nv.value);
+  }
+
+  return n;
+}
+
 static int ref_min_cnt_less(const nghttp3_pq_entry *lhsx,
                             const nghttp3_pq_entry *rhsx) {
   nghttp3_qpack_header_block_ref *lhs =
@@ -907,7 +1122,7 @@ void nghttp3_qpack_encoder_init(nghttp3_qpack_encoder *encoder,
                    ksl_max_cnt_greater_search,
                    sizeof(nghttp3_blocked_streams_key), mem);
 
-  qpack_map_init(&encoder->dtable_map);
+  qpack_map_init(&encoder->dtable_map, mem);
   nghttp3_pq_init(&encoder->min_cnts, ref_min_cnt_less, mem);
 
   encoder->krcnt = 0;
@@ -935,6 +1150,7 @@ void nghttp3_qpack_encoder_free(nghttp3_qpack_encoder *encoder) {
   nghttp3_map_each(&encoder->streams, map_stream_free,
                    (void *)encoder->ctx.mem);
   nghttp3_map_free(&encoder->streams);
+  qpack_map_free(&encoder->dtable_map);
   qpack_context_free(&encoder->ctx);
 }
 
@@ -975,6 +1191,18 @@ nghttp3_qpack_encoder_get_min_cnt(const nghttp3_qpack_encoder *encoder) {
     ->min_cnt;
 }
 
+size_t nghttp3_qpack_encoder_get_dtable_memusage(
+  const nghttp3_qpack_encoder *encoder) {
+  size_t n = qpack_context_get_dtable_memusage(&encoder->ctx);
+
+  if (encoder->dtable_map.table) {
+    n += ((size_t)2 << encoder->dtable_map.hashbits) *
+         sizeof(nghttp3_qpack_entry *);
+  }
+
+  return n;
+}
+
 void nghttp3_qpack_encoder_shrink_dtable(nghttp3_qpack_encoder *encoder) {
   nghttp3_ringbuf *dtable = &encoder->ctx.dtable;
   const nghttp3_mem *mem = encoder->ctx.mem;
@@ -1136,10 +1364,25 @@ static int reserve_buf(nghttp3_buf *buf, size_t extra_size,
   return nghttp3_buf_reserve(buf, n, mem);
 }
 
-int nghttp3_qpack_encoder_encode(nghttp3_qpack_encoder *encoder,
-                                 nghttp3_buf *pbuf, nghttp3_buf *rbuf,
-                                 nghttp3_buf *ebuf, int64_t stream_id,
-                                 const nghttp3_nv *nva, size_t nvlen) {
+static int qpack_encoder_encode_field(nghttp3_qpack_encoder *encoder,
+                                      uint64_t *pmax_cnt, uint64_t *pmin_cnt,
+                                      nghttp3_buf *rbuf, nghttp3_buf *ebuf,
+                                      const nghttp3_nv *nv,
+                                      const nghttp3_qpack_field *f,
+                                      uint64_t base, int allow_blocking);
+
+/*
+ * qpack_encoder_encode encodes |nva| of length |nvlen|.  |fields|, if
+ * not NULL, is an array of the encoder independent state of each
+ * field in |nva|.  See nghttp3_qpack_encoder_encode for the other
+ * parameters.
+ */
+static int qpack_encoder_encode(nghttp3_qpack_encoder *encoder,
+                                nghttp3_buf *pbuf, nghttp3_buf *rbuf,
+                                nghttp3_buf *ebuf, int64_t stream_id,
+                                const nghttp3_nv *nva,
+                                const nghttp3_qpack_field *fields,
+                                size_t nvlen) {
   size_t i;
   uint64_t max_cnt = 0, min_cnt = UINT64_MAX;
   uint64_t base;
@@ -1173,8 +1416,14 @@ int nghttp3_qpack_encoder_encode(nghttp3_qpack_encoder *encoder,
          blocked_stream, allow_blocking);
 
   for (i = 0; i < nvlen; ++i) {
-    rv = nghttp3_qpack_encoder_encode_nv(encoder, &max_cnt, &min_cnt, rbuf,
-                                         ebuf, &nva[i], base, allow_blocking);
+    if (fields) {
+      rv = qpack_encoder_encode_field(encoder, &max_cnt, &min_cnt, rbuf, ebuf,
+                                      &nva[i], &fields[i], base,
+                                      allow_blocking);
+    } else {
+      rv = nghttp3_qpack_encoder_encode_nv(encoder, &max_cnt, &min_cnt, rbuf,
+                                           ebuf, &nva[i], base, allow_blocking);
+    }
     if (rv != 0) {
       goto fail;
     }
@@ -1203,6 +1452,22 @@ fail:
   return rv;
 }
 
+int nghttp3_qpack_encoder_encode(nghttp3_qpack_encoder *encoder,
+                                 nghttp3_buf *pbuf, nghttp3_buf *rbuf,
+                                 nghttp3_buf *ebuf, int64_t stream_id,
+                                 const nghttp3_nv *nva, size_t nvlen) {
+  return qpack_encoder_encode(encoder, pbuf, rbuf, ebuf, stream_id, nva, NULL,
+                              nvlen);
+}
+
+int nghttp3_qpack_encoder_encode_prepared(nghttp3_qpack_encoder *encoder,
+                                          nghttp3_buf *pbuf, nghttp3_buf *rbuf,
+                                          nghttp3_buf *ebuf, int64_t stream_id,
+                                          const nghttp3_prepared_nva *pnva) {
+  return qpack_encoder_encode(encoder, pbuf, rbuf, ebuf, stream_id, pnva->nva,
+                              pnva->fields, pnva->nvlen);
+}
+
 /*
  * qpack_write_number writes variable integer to |rbuf|.  |num| is an
  * integer to write.  |prefix| is a prefix of variable integer
@@ -1286,27 +1551,15 @@ int nghttp3_qpack_encoder_stream_is_blocked(
   return stream && encoder->krcnt < nghttp3_qpack_stream_get_max_cnt(stream);
 }
 
-static uint32_t qpack_hash_name(const nghttp3_nv *nv) {
-  /* 32 bit FNV-1a: http://isthe.com/chongo/tech/comp/fnv/ */
-  uint32_t h = 2166136261U;
-  size_t i;
-
-  for (i = 0; i < nv->namelen; ++i) {
-    h ^= nv->name[i];
-    h += (h << 1) + (h << 4) + (h << 7) + (h << 8) + (h << 24);
-  }
-
-  return h;
-}
-
 /*
- * qpack_encoder_decide_indexing_mode determines and returns indexing
- * mode for header field |nv|.  |token| is a token of header field
- * name.
+ * qpack_decide_indexing_mode determines and returns indexing mode for
+ * header field |nv| under indexing strategy |strat|.  |token| is a
+ * token of header field name.  It does not take the dynamic table
+ * capacity into account.
  */
 static nghttp3_qpack_indexing_mode
-qpack_encoder_decide_indexing_mode(const nghttp3_qpack_encoder *encoder,
-                                   const nghttp3_nv *nv, int32_t token) {
+qpack_decide_indexing_mode(const nghttp3_nv *nv, int32_t token,
+                           nghttp3_qpack_indexing_strat strat) {
   if (nv->flags & NGHTTP3_NV_FLAG_NEVER_INDEX) {
     return NGHTTP3_QPACK_INDEXING_MODE_NEVER;
   }
@@ -1320,7 +1573,7 @@ qpack_encoder_decide_indexing_mode(const nghttp3_qpack_encoder *encoder,
     }
     break;
   case -1:
-    switch (encoder->indexing_strat) {
+    switch (strat) {
     case NGHTTP3_QPACK_INDEXING_STRAT_EAGER:
       break;
     case NGHTTP3_QPACK_INDEXING_STRAT_NONE:
@@ -1362,12 +1615,76 @@ qpack_encoder_decide_indexing_mode(const nghttp3_qpack_encoder *encoder,
     }
   }
 
-  if (table_space(nv->namelen, nv->valuelen) >
-      encoder->ctx.max_dtable_capacity * 3 / 4) {
+  return NGHTTP3_QPACK_INDEXING_MODE_STORE;
+}
+
+/*
+ * qpack_encoder_decide_indexing_mode determines and returns indexing
+ * mode for header field |nv|.  |f| is the encoder independent state
+ * of |nv|.
+ */
+static nghttp3_qpack_indexing_mode
+qpack_encoder_decide_indexing_mode(const nghttp3_qpack_encoder *encoder,
+                                   const nghttp3_nv *nv,
+                                   const nghttp3_qpack_field *f) {
+  nghttp3_qpack_indexing_mode indexing_mode =
+    f->indexing_mode[encoder->indexing_strat];
+
+  if (indexing_mode == NGHTTP3_QPACK_INDEXING_MODE_STORE &&
+      table_space(nv->namelen, nv->valuelen) >
+        encoder->ctx.max_dtable_capacity * 3 / 4) {
     return NGHTTP3_QPACK_INDEXING_MODE_LITERAL;
   }
 
-  return NGHTTP3_QPACK_INDEXING_MODE_STORE;
+  return indexing_mode;
+}
+
+/*
+ * qpack_field_init computes the encoder independent state of header
+ * field |nv|, and stores it in |f|.  Of f->indexing_mode, only the
+ * one for |strat| is computed.  f->rep, f->replen, and f->hsaved are
+ * left untouched.
+ */
+static void qpack_field_init(nghttp3_qpack_field *f, const nghttp3_nv *nv,
+                             nghttp3_qpack_indexing_strat strat) {
+  int32_t token = nghttp3_qpack_lookup_token(nv->name, nv->namelen);
+  int static_entry =
+    token != -1 && (size_t)token < nghttp3_arraylen(token_stable);
+
+  f->token = token;
+  f->indexing_mode[strat] = qpack_decide_indexing_mode(nv, token, strat);
+
+  if (static_entry) {
+    /* The static table lookup only distinguishes
+       NGHTTP3_QPACK_INDEXING_MODE_NEVER, which does not depend on
+       indexing strategy. */
+    f->sres = nghttp3_qpack_lookup_stable(nv, token, f->indexing_mode[strat]);
+    f->hash = token_stable[token].hash;
+
+    return;
+  }
+
+  f->sres = (nghttp3_qpack_lookup_result){
+    .index = -1,
+    .pb_index = -1,
+  };
+
+  switch (token) {
+  case NGHTTP3_QPACK_TOKEN_HOST:
+    f->hash = 2952701295U;
+    break;
+  case NGHTTP3_QPACK_TOKEN_TE:
+    f->hash = 1011170994U;
+    break;
+  case NGHTTP3_QPACK_TOKEN__PROTOCOL:
+    f->hash = 1128642621U;
+    break;
+  case NGHTTP3_QPACK_TOKEN_PRIORITY:
+    f->hash = 2498028297U;
+    break;
+  default:
+    f->hash = qpack_hash_name(nv);
+  }
 }
 
 /*
@@ -1452,60 +1769,70 @@ static int qpack_context_check_draining(nghttp3_qpack_context *ctx,
   return ctx->dtable_sum - ent->sum > safe;
 }
 
-int nghttp3_qpack_encoder_encode_nv(nghttp3_qpack_encoder *encoder,
-                                    uint64_t *pmax_cnt, uint64_t *pmin_cnt,
-                                    nghttp3_buf *rbuf, nghttp3_buf *ebuf,
-                                    const nghttp3_nv *nv, uint64_t base,
-                                    int allow_blocking) {
-  uint32_t hash = 0;
-  int32_t token;
+/*
+ * qpack_encoder_write_field_rep writes the precomputed field line
+ * representation f->rep to |rbuf|.
+ *
+ * This function returns 0 if it succeeds, or one of the following
+ * negative error codes:
+ *
+ * NGHTTP3_ERR_NOMEM
+ *     Out of memory.
+ */
+static int qpack_encoder_write_field_rep(nghttp3_qpack_encoder *encoder,
+                                         nghttp3_buf *rbuf,
+                                         const nghttp3_qpack_field *f) {
+  int rv;
+
+  DEBUGF("qpack::encode: Prepared Field Line\n");
+
+  if (f->sres.index != -1) {
+    ++encoder->ctx.stats.static_hits;
+  } else {
+    ++encoder->ctx.stats.literals;
+  }
+
+  encoder->ctx.stats.huffman_bytes_saved += f->hsaved;
+
+  rv = reserve_buf(rbuf, f->replen, encoder->ctx.mem);
+  if (rv != 0) {
+    return rv;
+  }
+
+  rbuf->last = nghttp3_cpymem(rbuf->last, f->rep, f->replen);
+
+  return 0;
+}
+
+/*
+ * qpack_encoder_encode_field encodes |nv| whose encoder independent
+ * state is |f|.  See nghttp3_qpack_encoder_encode_nv for the other
+ * parameters.
+ */
+static int qpack_encoder_encode_field(nghttp3_qpack_encoder *encoder,
+                                      uint64_t *pmax_cnt, uint64_t *pmin_cnt,
+                                      nghttp3_buf *rbuf, nghttp3_buf *ebuf,
+                                      const nghttp3_nv *nv,
+                                      const nghttp3_qpack_field *f,
+                                      uint64_t base, int allow_blocking) {
+  uint32_t hash = f->hash;
+  int32_t token = f->token;
   nghttp3_qpack_indexing_mode indexing_mode;
-  nghttp3_qpack_lookup_result sres = {
-    .index = -1,
-    .pb_index = -1,
-  };
+  nghttp3_qpack_lookup_result sres = f->sres;
   nghttp3_qpack_lookup_result dres = {
     .index = -1,
     .pb_index = -1,
   };
   nghttp3_qpack_entry *new_ent = NULL;
-  int static_entry;
   int just_index = 0;
   int rv;
 
-  token = qpack_lookup_token(nv->name, nv->namelen);
-  static_entry = token != -1 && (size_t)token < nghttp3_arraylen(token_stable);
-
-  indexing_mode = qpack_encoder_decide_indexing_mode(encoder, nv, token);
-
-  if (static_entry) {
-    sres = nghttp3_qpack_lookup_stable(nv, token, indexing_mode);
-    if (sres.index != -1 && sres.name_value_match) {
-      return nghttp3_qpack_encoder_write_static_indexed(encoder, rbuf,
-                                                        (size_t)sres.index);
-    }
+  if (sres.index != -1 && sres.name_value_match) {
+    return nghttp3_qpack_encoder_write_static_indexed(encoder, rbuf,
+                                                      (size_t)sres.index);
   }
 
-  if (static_entry) {
-    hash = token_stable[token].hash;
-  } else {
-    switch (token) {
-    case NGHTTP3_QPACK_TOKEN_HOST:
-      hash = 2952701295U;
-      break;
-    case NGHTTP3_QPACK_TOKEN_TE:
-      hash = 1011170994U;
-      break;
-    case NGHTTP3_QPACK_TOKEN__PROTOCOL:
-      hash = 1128642621U;
-      break;
-    case NGHTTP3_QPACK_TOKEN_PRIORITY:
-      hash = 2498028297U;
-      break;
-    default:
-      hash = qpack_hash_name(nv);
-    }
-  }
+  indexing_mode = qpack_encoder_decide_indexing_mode(encoder, nv, f);
 
   if (nghttp3_map_size(&encoder->streams) < NGHTTP3_QPACK_MAX_QPACK_STREAMS) {
     dres = nghttp3_qpack_encoder_lookup_dtable(
@@ -1562,6 +1889,10 @@ int nghttp3_qpack_encoder_encode_nv(nghttp3_qpack_encoder *encoder,
       }
     }
 
+    if (f->rep) {
+      return qpack_encoder_write_field_rep(encoder, rbuf, f);
+    }
+
     return nghttp3_qpack_encoder_write_static_indexed_name(
       encoder, rbuf, (size_t)sres.index, nv);
   }
@@ -1624,9 +1955,27 @@ int nghttp3_qpack_encoder_encode_nv(nghttp3_qpack_encoder *encoder,
     }
   }
 
+  if (f->rep) {
+    return qpack_encoder_write_field_rep(encoder, rbuf, f);
+  }
+
   return nghttp3_qpack_encoder_write_literal(encoder, rbuf, nv);
 }
 
+int nghttp3_qpack_encoder_encode_nv(nghttp3_qpack_encoder *encoder,
+                                    uint64_t *pmax_cnt, uint64_t *pmin_cnt,
+                                    nghttp3_buf *rbuf, nghttp3_buf *ebuf,
+                                    const nghttp3_nv *nv, uint64_t base,
+                                    int allow_blocking) {
+  nghttp3_qpack_field f;
+
+  qpack_field_init(&f, nv, encoder->indexing_strat);
+  f.rep = NULL;
+
+  return qpack_encoder_encode_field(encoder, pmax_cnt, pmin_cnt, rbuf, ebuf,
+                                    nv, &f, base, allow_blocking);
+}
+
 nghttp3_qpack_lookup_result
 nghttp3_qpack_lookup_stable(const nghttp3_nv *nv, int32_t token,
                             nghttp3_qpack_indexing_mode indexing_mode) {
@@ -1814,20 +2163,27 @@ void nghttp3_qpack_stream_pop_ref(nghttp3_qpack_stream *stream) {
   nghttp3_ringbuf_pop_front(&stream->refs);
 }
 
-int nghttp3_qpack_encoder_write_static_indexed(
-  const nghttp3_qpack_encoder *encoder, nghttp3_buf *rbuf, uint64_t absidx) {
+int nghttp3_qpack_encoder_write_static_indexed(nghttp3_qpack_encoder *encoder,
+                                                nghttp3_buf *rbuf,
+                                                uint64_t absidx) {
   DEBUGF("qpack::encode: Indexed Field Line (static) absidx=%" PRIu64 "\n",
          absidx);
+
+  ++encoder->ctx.stats.static_hits;
+
   return qpack_write_number(rbuf, 0xC0U, absidx, 6, encoder->ctx.mem);
 }
 
-int nghttp3_qpack_encoder_write_dynamic_indexed(
-  const nghttp3_qpack_encoder *encoder, nghttp3_buf *rbuf, uint64_t absidx,
-  uint64_t base) {
+int nghttp3_qpack_encoder_write_dynamic_indexed(nghttp3_qpack_encoder *encoder,
+                                                 nghttp3_buf *rbuf,
+                                                 uint64_t absidx,
+                                                 uint64_t base) {
   DEBUGF("qpack::encode: Indexed Field Line (dynamic) absidx=%" PRIu64
          " base=%" PRIu64 "\n",
          absidx, base);
 
+  ++encoder->ctx.stats.dynamic_hits;
+
   if (absidx < base) {
     return qpack_write_number(rbuf, 0x80U, base - absidx - 1, 6,
                               encoder->ctx.mem);
@@ -1836,6 +2192,66 @@ int nghttp3_qpack_encoder_write_dynamic_indexed(
   return qpack_write_number(rbuf, 0x10U, absidx - base, 4, encoder->ctx.mem);
 }
 
+/*
+ * qpack_put_string writes string literal |s| of length |slen| to
+ * |p|.  The length is encoded as variable integer with |prefix| bits
+ * of prefix, and the bit just above the prefix is set if the string
+ * is huffman encoded.  Huffman encoding is used only if it makes the
+ * string shorter.  The bits above the huffman bit in |*p| are
+ * preserved.  The buffer pointed by |p| must have at least
+ * nghttp3_qpack_put_varint_len(|slen|, |prefix|) + |slen| bytes.
+ *
+ * This function returns the pointer to the one beyond the last byte
+ * written.
+ */
+static uint8_t *qpack_put_string(uint8_t *p, const uint8_t *s, size_t slen,
+                                 size_t prefix) {
+  size_t lenlen = nghttp3_qpack_put_varint_len(slen, prefix);
+  size_t hlen, hlenlen;
+  uint8_t *end;
+
+  /* Encode into the space reserved for the raw string, and move it
+     down if its length prefix turns out to be shorter. */
+  end = nghttp3_qpack_huffman_encode_shorter(p + lenlen, s, slen);
+  if (end) {
+    hlen = (size_t)(end - p) - lenlen;
+    hlenlen = nghttp3_qpack_put_varint_len(hlen, prefix);
+
+    *p |= (uint8_t)(1 << prefix);
+    nghttp3_qpack_put_varint(p, hlen, prefix);
+
+    if (hlenlen < lenlen) {
+      memmove(p + hlenlen, p + lenlen, hlen);
+    }
+
+    return p + hlenlen + hlen;
+  }
+
+  *p &= (uint8_t)~(1 << prefix);
+  p = nghttp3_qpack_put_varint(p, slen, prefix);
+  if (slen) {
+    p = nghttp3_cpymem(p, s, slen);
+  }
+
+  return p;
+}
+
+/*
+ * qpack_encoder_put_string works like qpack_put_string, and adds the
+ * number of bytes saved by Huffman encoding to the counter of
+ * |encoder|.
+ */
+static uint8_t *qpack_encoder_put_string(nghttp3_qpack_encoder *encoder,
+                                         uint8_t *p, const uint8_t *s,
+                                         size_t slen, size_t prefix) {
+  uint8_t *end = qpack_put_string(p, s, slen, prefix);
+
+  encoder->ctx.stats.huffman_bytes_saved +=
+    nghttp3_qpack_put_varint_len(slen, prefix) + slen - (size_t)(end - p);
+
+  return end;
+}
+
 /*
  * qpack_encoder_write_indexed_name writes generic indexed name.  |fb|
  * is the first byte.  |nameidx| is an index of referenced name.
@@ -1848,23 +2264,14 @@ int nghttp3_qpack_encoder_write_dynamic_indexed(
  * NGHTTP3_ERR_NOMEM
  *     Out of memory.
  */
-static int
-qpack_encoder_write_indexed_name(const nghttp3_qpack_encoder *encoder,
-                                 nghttp3_buf *buf, uint8_t fb, uint64_t nameidx,
-                                 size_t prefix, const nghttp3_nv *nv) {
+static int qpack_encoder_write_indexed_name(nghttp3_qpack_encoder *encoder,
+                                            nghttp3_buf *buf, uint8_t fb,
+                                            uint64_t nameidx, size_t prefix,
+                                            const nghttp3_nv *nv) {
   int rv;
-  size_t len = nghttp3_qpack_put_varint_len(nameidx, prefix);
+  size_t len = nghttp3_qpack_put_varint_len(nameidx, prefix) +
+               nghttp3_qpack_put_varint_len(nv->valuelen, 7) + nv->valuelen;
   uint8_t *p;
-  size_t hlen;
-  int h = 0;
-
-  hlen = nghttp3_qpack_huffman_encode_count(nv->value, nv->valuelen);
-  if (hlen < nv->valuelen) {
-    h = 1;
-    len += nghttp3_qpack_put_varint_len(hlen, 7) + hlen;
-  } else {
-    len += nghttp3_qpack_put_varint_len(nv->valuelen, 7) + nv->valuelen;
-  }
 
   rv = reserve_buf(buf, len, encoder->ctx.mem);
   if (rv != 0) {
@@ -1876,19 +2283,10 @@ qpack_encoder_write_indexed_name(const nghttp3_qpack_encoder *encoder,
   *p = fb;
   p = nghttp3_qpack_put_varint(p, nameidx, prefix);
 
-  if (h) {
-    *p = 0x80U;
-    p = nghttp3_qpack_put_varint(p, hlen, 7);
-    p = nghttp3_qpack_huffman_encode(p, nv->value, nv->valuelen);
-  } else {
-    *p = 0;
-    p = nghttp3_qpack_put_varint(p, nv->valuelen, 7);
-    if (nv->valuelen) {
-      p = nghttp3_cpymem(p, nv->value, nv->valuelen);
-    }
-  }
+  *p = 0;
+  p = qpack_encoder_put_string(encoder, p, nv->value, nv->valuelen, 7);
 
-  assert((size_t)(p - buf->last) == len);
+  assert((size_t)(p - buf->last) <= len);
 
   buf->last = p;
 
@@ -1896,7 +2294,7 @@ qpack_encoder_write_indexed_name(const nghttp3_qpack_encoder *encoder,
 }
 
 int nghttp3_qpack_encoder_write_static_indexed_name(
-  const nghttp3_qpack_encoder *encoder, nghttp3_buf *rbuf, uint64_t absidx,
+  nghttp3_qpack_encoder *encoder, nghttp3_buf *rbuf, uint64_t absidx,
   const nghttp3_nv *nv) {
   uint8_t fb =
     (uint8_t)(0x50U |
@@ -1905,11 +2303,14 @@ int nghttp3_qpack_encoder_write_static_indexed_name(
   DEBUGF("qpack::encode: Literal Field Line With Name Reference (static) "
          "absidx=%" PRIu64 " never=%d\n",
          absidx, (nv->flags & NGHTTP3_NV_FLAG_NEVER_INDEX) != 0);
+
+  ++encoder->ctx.stats.static_hits;
+
   return qpack_encoder_write_indexed_name(encoder, rbuf, fb, absidx, 4, nv);
 }
 
 int nghttp3_qpack_encoder_write_dynamic_indexed_name(
-  const nghttp3_qpack_encoder *encoder, nghttp3_buf *rbuf, uint64_t absidx,
+  nghttp3_qpack_encoder *encoder, nghttp3_buf *rbuf, uint64_t absidx,
   uint64_t base, const nghttp3_nv *nv) {
   uint8_t fb;
 
@@ -1917,6 +2318,8 @@ int nghttp3_qpack_encoder_write_dynamic_indexed_name(
          "absidx=%" PRIu64 " base=%" PRIu64 " never=%d\n",
          absidx, base, (nv->flags & NGHTTP3_NV_FLAG_NEVER_INDEX) != 0);
 
+  ++encoder->ctx.stats.dynamic_hits;
+
   if (absidx < base) {
     fb = (uint8_t)(0x40U |
                    ((nv->flags & NGHTTP3_NV_FLAG_NEVER_INDEX) ? 0x20U : 0x00U));
@@ -1941,30 +2344,14 @@ int nghttp3_qpack_encoder_write_dynamic_indexed_name(
  * NGHTTP3_ERR_NOMEM
  *     Out of memory.
  */
-static int qpack_encoder_write_literal(const nghttp3_qpack_encoder *encoder,
+static int qpack_encoder_write_literal(nghttp3_qpack_encoder *encoder,
                                        nghttp3_buf *buf, uint8_t fb,
                                        size_t prefix, const nghttp3_nv *nv) {
   int rv;
-  size_t len;
+  size_t len = nghttp3_qpack_put_varint_len(nv->namelen, prefix) +
+               nv->namelen + nghttp3_qpack_put_varint_len(nv->valuelen, 7) +
+               nv->valuelen;
   uint8_t *p;
-  size_t nhlen, vhlen;
-  int nh = 0, vh = 0;
-
-  nhlen = nghttp3_qpack_huffman_encode_count(nv->name, nv->namelen);
-  if (nhlen < nv->namelen) {
-    nh = 1;
-    len = nghttp3_qpack_put_varint_len(nhlen, prefix) + nhlen;
-  } else {
-    len = nghttp3_qpack_put_varint_len(nv->namelen, prefix) + nv->namelen;
-  }
-
-  vhlen = nghttp3_qpack_huffman_encode_count(nv->value, nv->valuelen);
-  if (vhlen < nv->valuelen) {
-    vh = 1;
-    len += nghttp3_qpack_put_varint_len(vhlen, 7) + vhlen;
-  } else {
-    len += nghttp3_qpack_put_varint_len(nv->valuelen, 7) + nv->valuelen;
-  }
 
   rv = reserve_buf(buf, len, encoder->ctx.mem);
   if (rv != 0) {
@@ -1974,38 +2361,19 @@ static int qpack_encoder_write_literal(const nghttp3_qpack_encoder *encoder,
   p = buf->last;
 
   *p = fb;
-  if (nh) {
-    *p |= (uint8_t)(1 << prefix);
-    p = nghttp3_qpack_put_varint(p, nhlen, prefix);
-    p = nghttp3_qpack_huffman_encode(p, nv->name, nv->namelen);
-  } else {
-    p = nghttp3_qpack_put_varint(p, nv->namelen, prefix);
-    if (nv->namelen) {
-      p = nghttp3_cpymem(p, nv->name, nv->namelen);
-    }
-  }
+  p = qpack_encoder_put_string(encoder, p, nv->name, nv->namelen, prefix);
 
   *p = 0;
+  p = qpack_encoder_put_string(encoder, p, nv->value, nv->valuelen, 7);
 
-  if (vh) {
-    *p |= 0x80U;
-    p = nghttp3_qpack_put_varint(p, vhlen, 7);
-    p = nghttp3_qpack_huffman_encode(p, nv->value, nv->valuelen);
-  } else {
-    p = nghttp3_qpack_put_varint(p, nv->valuelen, 7);
-    if (nv->valuelen) {
-      p = nghttp3_cpymem(p, nv->value, nv->valuelen);
-    }
-  }
-
-  assert((size_t)(p - buf->last) == len);
+  assert((size_t)(p - buf->last) <= len);
 
   buf->last = p;
 
   return 0;
 }
 
-int nghttp3_qpack_encoder_write_literal(const nghttp3_qpack_encoder *encoder,
+int nghttp3_qpack_encoder_write_literal(nghttp3_qpack_encoder *encoder,
                                         nghttp3_buf *rbuf,
                                         const nghttp3_nv *nv) {
   uint8_t fb =
@@ -2013,11 +2381,13 @@ int nghttp3_qpack_encoder_write_literal(const nghttp3_qpack_encoder *encoder,
               ((nv->flags & NGHTTP3_NV_FLAG_NEVER_INDEX) ? 0x10U : 0x0U));
 
   DEBUGF("qpack::encode: Literal Field Line With Literal Name\n");
+
+  ++encoder->ctx.stats.literals;
   return qpack_encoder_write_literal(encoder, rbuf, fb, 3, nv);
 }
 
 int nghttp3_qpack_encoder_write_static_insert(
-  const nghttp3_qpack_encoder *encoder, nghttp3_buf *ebuf, uint64_t absidx,
+  nghttp3_qpack_encoder *encoder, nghttp3_buf *ebuf, uint64_t absidx,
   const nghttp3_nv *nv) {
   DEBUGF("qpack::encode: Insert With Name Reference (static) absidx=%" PRIu64
          "\n",
@@ -2026,7 +2396,7 @@ int nghttp3_qpack_encoder_write_static_insert(
 }
 
 int nghttp3_qpack_encoder_write_dynamic_insert(
-  const nghttp3_qpack_encoder *encoder, nghttp3_buf *ebuf, uint64_t absidx,
+  nghttp3_qpack_encoder *encoder, nghttp3_buf *ebuf, uint64_t absidx,
   const nghttp3_nv *nv) {
   DEBUGF("qpack::encode: Insert With Name Reference (dynamic) absidx=%" PRIu64
          "\n",
@@ -2061,9 +2431,9 @@ int nghttp3_qpack_encoder_write_duplicate_insert(
   return 0;
 }
 
-int nghttp3_qpack_encoder_write_literal_insert(
-  const nghttp3_qpack_encoder *encoder, nghttp3_buf *ebuf,
-  const nghttp3_nv *nv) {
+int nghttp3_qpack_encoder_write_literal_insert(nghttp3_qpack_encoder *encoder,
+                                               nghttp3_buf *ebuf,
+                                               const nghttp3_nv *nv) {
   DEBUGF("qpack::encode: Insert With Literal Name\n");
   return qpack_encoder_write_literal(encoder, ebuf, 0x40U, 5, nv);
 }
@@ -2106,6 +2476,15 @@ int nghttp3_qpack_context_dtable_add(nghttp3_qpack_context *ctx,
   nghttp3_qpack_entry_init(new_ent, qnv, ctx->dtable_sum, ctx->next_absidx++,
                            hash);
 
+  if (dtable_map) {
+    new_ent->nvhash = qpack_hash_nv(hash, qnv->value->base, qnv->value->len);
+
+    rv = qpack_map_reserve(dtable_map);
+    if (rv != 0) {
+      goto fail;
+    }
+  }
+
   if (nghttp3_ringbuf_full(&ctx->dtable)) {
     rv = nghttp3_ringbuf_reserve(
       &ctx->dtable, nghttp3_max(128, nghttp3_ringbuf_len(&ctx->dtable) * 2));
@@ -2267,9 +2646,12 @@ void nghttp3_qpack_entry_init(nghttp3_qpack_entry *ent, nghttp3_qpack_nv *qnv,
                               size_t sum, uint64_t absidx, uint32_t hash) {
   ent->nv = *qnv;
   ent->map_next = NULL;
+  ent->map_prev = NULL;
+  ent->nvmap_next = NULL;
   ent->sum = sum;
   ent->absidx = absidx;
   ent->hash = hash;
+  ent->nvhash = 0;
 
   nghttp3_rcbuf_incref(ent->nv.name);
   nghttp3_rcbuf_incref(ent->nv.value);
@@ -2712,6 +3094,7 @@ void nghttp3_qpack_decoder_init(nghttp3_qpack_decoder *decoder,
   decoder->written_icnt = 0;
   decoder->max_concurrent_streams = 0;
   decoder->uninterrupted_encoderlen = 0;
+  decoder->borrow_literals = 0;
 
   nghttp3_qpack_read_state_reset(&decoder->rstate);
   nghttp3_buf_init(&decoder->dbuf);
@@ -3279,7 +3662,7 @@ int nghttp3_qpack_decoder_dtable_literal_add(nghttp3_qpack_decoder *decoder) {
 
   qnv.name = decoder->rstate.name;
   qnv.value = decoder->rstate.value;
-  qnv.token = qpack_lookup_token(qnv.name->base, qnv.name->len);
+  qnv.token = nghttp3_qpack_lookup_token(qnv.name->base, qnv.name->len);
   qnv.flags = NGHTTP3_NV_FLAG_NONE;
 
   rv = nghttp3_qpack_context_dtable_add(&decoder->ctx, &qnv, NULL, 0);
@@ -3298,6 +3681,11 @@ void nghttp3_qpack_decoder_set_max_concurrent_streams(
     nghttp3_max(decoder->max_concurrent_streams, max_concurrent_streams);
 }
 
+void nghttp3_qpack_decoder_set_borrow_literals(nghttp3_qpack_decoder *decoder,
+                                               int borrow) {
+  decoder->borrow_literals = borrow;
+}
+
 void nghttp3_qpack_stream_context_init(nghttp3_qpack_stream_context *sctx,
                                        int64_t stream_id,
                                        const nghttp3_mem *mem) {
@@ -3311,6 +3699,7 @@ void nghttp3_qpack_stream_context_init(nghttp3_qpack_stream_context *sctx,
   sctx->ricnt = 0;
   sctx->dbase_sign = 0;
   sctx->base = 0;
+  sctx->field_flags = NGHTTP3_QPACK_FIELD_FLAG_NONE;
 }
 
 void nghttp3_qpack_stream_context_free(nghttp3_qpack_stream_context *sctx) {
@@ -3331,6 +3720,106 @@ uint64_t nghttp3_qpack_stream_context_get_ricnt2(
   return sctx->ricnt;
 }
 
+/*
+ * qpack_decoder_emit_field_line emits the field line which has just
+ * been decoded from request stream into |nv|.
+ */
+static int qpack_decoder_emit_field_line(nghttp3_qpack_decoder *decoder,
+                                         nghttp3_qpack_stream_context *sctx,
+                                         nghttp3_qpack_nv *nv) {
+  switch (sctx->opcode) {
+  case NGHTTP3_QPACK_RS_OPCODE_INDEXED_NAME:
+  case NGHTTP3_QPACK_RS_OPCODE_INDEXED_NAME_PB:
+    return nghttp3_qpack_decoder_emit_indexed_name(decoder, sctx, nv);
+  case NGHTTP3_QPACK_RS_OPCODE_LITERAL:
+    nghttp3_qpack_decoder_emit_literal(decoder, sctx, nv);
+    return 0;
+  default:
+    nghttp3_unreachable();
+  }
+}
+
+/*
+ * qpack_static_name_field_flags returns NGHTTP3_QPACK_FIELD_FLAG_*
+ * for the name of the static table entry at |absidx|.  The static
+ * table only contains lower-cased names without any invalid
+ * character.
+ */
+static uint8_t qpack_static_name_field_flags(uint64_t absidx) {
+  if (stable[absidx].name.base[0] == ':') {
+    return NGHTTP3_QPACK_FIELD_FLAG_NONE;
+  }
+
+  return NGHTTP3_QPACK_FIELD_FLAG_NAME_CLASSIFIED;
+}
+
+/*
+ * qpack_huffman_name_field_flags returns NGHTTP3_QPACK_FIELD_FLAG_*
+ * for the field |name| which has just been decoded with |ctx|.
+ */
+static uint8_t
+qpack_huffman_name_field_flags(const nghttp3_qpack_huffman_decode_context *ctx,
+                               const nghttp3_rcbuf *name) {
+  uint8_t flags;
+
+  if (name->len && name->base[0] == ':') {
+    return NGHTTP3_QPACK_FIELD_FLAG_NONE;
+  }
+
+  flags = NGHTTP3_QPACK_FIELD_FLAG_NAME_CLASSIFIED;
+
+  if (ctx->cls & NGHTTP3_QPACK_HUFFMAN_CLASS_NAME_BAD) {
+    flags |= NGHTTP3_QPACK_FIELD_FLAG_NAME_BAD;
+  }
+
+  if (ctx->cls & NGHTTP3_QPACK_HUFFMAN_CLASS_NAME_UPPER) {
+    flags |= NGHTTP3_QPACK_FIELD_FLAG_NAME_UPPER;
+  }
+
+  return flags;
+}
+
+/*
+ * qpack_huffman_value_field_flags returns NGHTTP3_QPACK_FIELD_FLAG_*
+ * for the field value which has just been decoded with |ctx|.
+ */
+static uint8_t qpack_huffman_value_field_flags(
+  const nghttp3_qpack_huffman_decode_context *ctx) {
+  if (ctx->cls & NGHTTP3_QPACK_HUFFMAN_CLASS_VALUE_BAD) {
+    return NGHTTP3_QPACK_FIELD_FLAG_VALUE_CLASSIFIED |
+           NGHTTP3_QPACK_FIELD_FLAG_VALUE_BAD;
+  }
+
+  return NGHTTP3_QPACK_FIELD_FLAG_VALUE_CLASSIFIED;
+}
+
+/*
+ * qpack_literal_name_borrowable returns nonzero if the field name of
+ * length |namelen| starting at |p|, and the field value which follows
+ * it are entirely contained in [p, end).
+ */
+static int qpack_literal_name_borrowable(const uint8_t *p, const uint8_t *end,
+                                         uint64_t namelen) {
+  nghttp3_qpack_read_state rstate = {
+    .prefix = 7,
+  };
+  nghttp3_ssize nread;
+  int rfin;
+
+  if (namelen >= (uint64_t)(end - p)) {
+    return 0;
+  }
+
+  p += namelen;
+
+  nread = qpack_read_varint(&rfin, &rstate, p, end);
+  if (nread < 0 || !rfin) {
+    return 0;
+  }
+
+  return rstate.left <= (uint64_t)(end - p - nread);
+}
+
 nghttp3_ssize
 nghttp3_qpack_decoder_read_request(nghttp3_qpack_decoder *decoder,
                                    nghttp3_qpack_stream_context *sctx,
@@ -3425,6 +3914,7 @@ nghttp3_qpack_decoder_read_request(nghttp3_qpack_decoder *decoder,
     case NGHTTP3_QPACK_RS_STATE_OPCODE:
       assert(sctx->rstate.left == 0);
       assert(sctx->rstate.shift == 0);
+      sctx->field_flags = NGHTTP3_QPACK_FIELD_FLAG_NONE;
       switch ((*p) & 0xF0U) {
       case 0x80U:
       case 0x90U:
@@ -3501,6 +3991,12 @@ nghttp3_qpack_decoder_read_request(nghttp3_qpack_decoder *decoder,
           goto fail;
         }
         nghttp3_qpack_decoder_emit_indexed(decoder, sctx, nv);
+        if (!sctx->rstate.dynamic) {
+          /* Static table does not contain any invalid value. */
+          sctx->field_flags =
+            (uint8_t)(qpack_static_name_field_flags(sctx->rstate.absidx) |
+                      NGHTTP3_QPACK_FIELD_FLAG_VALUE_CLASSIFIED);
+        }
         *pflags |= NGHTTP3_QPACK_DECODE_FLAG_EMIT;
 
         sctx->state = NGHTTP3_QPACK_RS_STATE_OPCODE;
@@ -3524,6 +4020,10 @@ nghttp3_qpack_decoder_read_request(nghttp3_qpack_decoder *decoder,
         if (rv != 0) {
           goto fail;
         }
+        if (!sctx->rstate.dynamic) {
+          sctx->field_flags =
+            qpack_static_name_field_flags(sctx->rstate.absidx);
+        }
         sctx->rstate.prefix = 7;
         sctx->state = NGHTTP3_QPACK_RS_STATE_CHECK_VALUE_HUFFMAN;
         break;
@@ -3564,6 +4064,19 @@ nghttp3_qpack_decoder_read_request(nghttp3_qpack_decoder *decoder,
         goto fail;
       }
 
+      if (decoder->borrow_literals && !sctx->rstate.huffman_encoded &&
+          qpack_literal_name_borrowable(p, end, sctx->rstate.left)) {
+        nghttp3_rcbuf_borrow_init(&sctx->borrowed_name, p,
+                                  (size_t)sctx->rstate.left);
+        sctx->rstate.name = &sctx->borrowed_name;
+        p += sctx->rstate.left;
+        sctx->rstate.left = 0;
+
+        sctx->state = NGHTTP3_QPACK_RS_STATE_CHECK_VALUE_HUFFMAN;
+        sctx->rstate.prefix = 7;
+        break;
+      }
+
       if (sctx->rstate.huffman_encoded) {
         sctx->state = NGHTTP3_QPACK_RS_STATE_READ_NAME_HUFFMAN;
         nghttp3_qpack_huffman_decode_context_init(&sctx->rstate.huffman_ctx);
@@ -3601,6 +4114,9 @@ nghttp3_qpack_decoder_read_request(nghttp3_qpack_decoder *decoder,
 
       qpack_read_state_terminate_name(&sctx->rstate);
 
+      sctx->field_flags |= qpack_huffman_name_field_flags(
+        &sctx->rstate.huffman_ctx, sctx->rstate.name);
+
       sctx->state = NGHTTP3_QPACK_RS_STATE_CHECK_VALUE_HUFFMAN;
       sctx->rstate.prefix = 7;
       break;
@@ -3647,6 +4163,17 @@ nghttp3_qpack_decoder_read_request(nghttp3_qpack_decoder *decoder,
         goto fail;
       }
 
+      if (decoder->borrow_literals && !sctx->rstate.huffman_encoded &&
+          sctx->rstate.left <= (uint64_t)(end - p)) {
+        nghttp3_rcbuf_borrow_init(&sctx->borrowed_value, p,
+                                  (size_t)sctx->rstate.left);
+        sctx->rstate.value = &sctx->borrowed_value;
+        p += sctx->rstate.left;
+        sctx->rstate.left = 0;
+
+        goto emit;
+      }
+
       if (sctx->rstate.huffman_encoded) {
         sctx->state = NGHTTP3_QPACK_RS_STATE_READ_VALUE_HUFFMAN;
         nghttp3_qpack_huffman_decode_context_init(&sctx->rstate.huffman_ctx);
@@ -3687,28 +4214,10 @@ nghttp3_qpack_decoder_read_request(nghttp3_qpack_decoder *decoder,
 
       qpack_read_state_terminate_value(&sctx->rstate);
 
-      switch (sctx->opcode) {
-      case NGHTTP3_QPACK_RS_OPCODE_INDEXED_NAME:
-      case NGHTTP3_QPACK_RS_OPCODE_INDEXED_NAME_PB:
-        rv = nghttp3_qpack_decoder_emit_indexed_name(decoder, sctx, nv);
-        if (rv != 0) {
-          goto fail;
-        }
-
-        break;
-      case NGHTTP3_QPACK_RS_OPCODE_LITERAL:
-        nghttp3_qpack_decoder_emit_literal(decoder, sctx, nv);
-        break;
-      default:
-        nghttp3_unreachable();
-      }
+      sctx->field_flags |=
+        qpack_huffman_value_field_flags(&sctx->rstate.huffman_ctx);
 
-      *pflags |= NGHTTP3_QPACK_DECODE_FLAG_EMIT;
-
-      sctx->state = NGHTTP3_QPACK_RS_STATE_OPCODE;
-      nghttp3_qpack_read_state_reset(&sctx->rstate);
-
-      return p - src;
+      goto emit;
     case NGHTTP3_QPACK_RS_STATE_READ_VALUE:
       nread = qpack_read_string(&sctx->rstate, &sctx->rstate.valuebuf, p, end);
       if (nread < 0) {
@@ -3724,20 +4233,10 @@ nghttp3_qpack_decoder_read_request(nghttp3_qpack_decoder *decoder,
 
       qpack_read_state_terminate_value(&sctx->rstate);
 
-      switch (sctx->opcode) {
-      case NGHTTP3_QPACK_RS_OPCODE_INDEXED_NAME:
-      case NGHTTP3_QPACK_RS_OPCODE_INDEXED_NAME_PB:
-        rv = nghttp3_qpack_decoder_emit_indexed_name(decoder, sctx, nv);
-        if (rv != 0) {
-          goto fail;
-        }
-
-        break;
-      case NGHTTP3_QPACK_RS_OPCODE_LITERAL:
-        nghttp3_qpack_decoder_emit_literal(decoder, sctx, nv);
-        break;
-      default:
-        nghttp3_unreachable();
+    emit:
+      rv = qpack_decoder_emit_field_line(decoder, sctx, nv);
+      if (rv != 0) {
+        goto fail;
       }
 
       *pflags |= NGHTTP3_QPACK_DECODE_FLAG_EMIT;
@@ -4029,8 +4528,10 @@ void nghttp3_qpack_decoder_emit_indexed(
          sctx->rstate.dynamic ? "dynamic" : "static", sctx->rstate.absidx);
 
   if (sctx->rstate.dynamic) {
+    ++decoder->ctx.stats.dynamic_hits;
     qpack_decoder_emit_dynamic_indexed(decoder, sctx, nv);
   } else {
+    ++decoder->ctx.stats.static_hits;
     qpack_decoder_emit_static_indexed(decoder, sctx, nv);
   }
 }
@@ -4081,33 +4582,33 @@ qpack_decoder_emit_dynamic_indexed_name(nghttp3_qpack_decoder *decoder,
 int nghttp3_qpack_decoder_emit_indexed_name(nghttp3_qpack_decoder *decoder,
                                             nghttp3_qpack_stream_context *sctx,
                                             nghttp3_qpack_nv *nv) {
-  (void)decoder;
-
-  DEBUGF("qpack::decode: Indexed name (%s) absidx=%" PRIu64 " value=%*s\n",
+  DEBUGF("qpack::decode: Indexed name (%s) absidx=%" PRIu64 " value=%.*s\n",
          sctx->rstate.dynamic ? "dynamic" : "static", sctx->rstate.absidx,
          (int)sctx->rstate.value->len, sctx->rstate.value->base);
 
   if (sctx->rstate.dynamic) {
+    ++decoder->ctx.stats.dynamic_hits;
     return qpack_decoder_emit_dynamic_indexed_name(decoder, sctx, nv);
   }
 
+  ++decoder->ctx.stats.static_hits;
   qpack_decoder_emit_static_indexed_name(decoder, sctx, nv);
 
   return 0;
 }
 
-void nghttp3_qpack_decoder_emit_literal(const nghttp3_qpack_decoder *decoder,
+void nghttp3_qpack_decoder_emit_literal(nghttp3_qpack_decoder *decoder,
                                         nghttp3_qpack_stream_context *sctx,
                                         nghttp3_qpack_nv *nv) {
-  (void)decoder;
-
-  DEBUGF("qpack::decode: Emit literal name=%*s value=%*s\n",
+  DEBUGF("qpack::decode: Emit literal name=%.*s value=%.*s\n",
          (int)sctx->rstate.name->len, sctx->rstate.name->base,
          (int)sctx->rstate.value->len, sctx->rstate.value->base);
 
+  ++decoder->ctx.stats.literals;
+
   nv->name = sctx->rstate.name;
   nv->value = sctx->rstate.value;
-  nv->token = qpack_lookup_token(nv->name->base, nv->name->len);
+  nv->token = nghttp3_qpack_lookup_token(nv->name->base, nv->name->len);
   nv->flags =
     sctx->rstate.never ? NGHTTP3_NV_FLAG_NEVER_INDEX : NGHTTP3_NV_FLAG_NONE;
 
@@ -4151,6 +4652,167 @@ void nghttp3_qpack_encoder_del(nghttp3_qpack_encoder *encoder) {
   nghttp3_mem_free(mem, encoder);
 }
 
+/*
+ * qpack_put_field_rep writes the field line representation of |nv|
+ * which does not reference dynamic table to |p|.  |f| is the encoder
+ * independent state of |nv|.  The output is the same as
+ * nghttp3_qpack_encoder_write_static_indexed_name if f->sres.index is
+ * not -1, and nghttp3_qpack_encoder_write_literal otherwise.
+ *
+ * This function returns the pointer to the one beyond the last byte
+ * written.
+ */
+static uint8_t *qpack_put_field_rep(uint8_t *p, const nghttp3_nv *nv,
+                                    const nghttp3_qpack_field *f) {
+  int never = (nv->flags & NGHTTP3_NV_FLAG_NEVER_INDEX) != 0;
+
+  if (f->sres.index != -1) {
+    *p = (uint8_t)(0x50U | (never ? 0x20U : 0x00U));
+    p = nghttp3_qpack_put_varint(p, (uint64_t)f->sres.index, 4);
+  } else {
+    *p = (uint8_t)(0x20U | (never ? 0x10U : 0x00U));
+    p = qpack_put_string(p, nv->name, nv->namelen, 3);
+  }
+
+  *p = 0;
+
+  return qpack_put_string(p, nv->value, nv->valuelen, 7);
+}
+
+/*
+ * qpack_field_rep_rawlen returns the length of the field line
+ * representation of |nv| written by qpack_put_field_rep if Huffman
+ * encoding is not used.
+ */
+static size_t qpack_field_rep_rawlen(const nghttp3_nv *nv,
+                                     const nghttp3_qpack_field *f) {
+  size_t len;
+
+  if (f->sres.index != -1) {
+    len = nghttp3_qpack_put_varint_len((uint64_t)f->sres.index, 4);
+  } else {
+    len = nghttp3_qpack_put_varint_len(nv->namelen, 3) + nv->namelen;
+  }
+
+  return len + nghttp3_qpack_put_varint_len(nv->valuelen, 7) + nv->valuelen;
+}
+
+/*
+ * qpack_size_add adds |n| to |*plen|.  It returns 0 if it succeeds,
+ * or -1 if the sum does not fit in size_t.
+ */
+static int qpack_size_add(size_t *plen, size_t n) {
+  if (SIZE_MAX - *plen < n) {
+    return -1;
+  }
+
+  *plen += n;
+
+  return 0;
+}
+
+int nghttp3_prepared_nva_new(nghttp3_prepared_nva **ppnva,
+                             const nghttp3_nv *nva, size_t nvlen,
+                             const nghttp3_mem *mem) {
+  nghttp3_prepared_nva *pnva;
+  nghttp3_qpack_field *f;
+  nghttp3_nv *nv;
+  size_t i, len, buflen = 0;
+  uint8_t *p;
+
+  if (mem == NULL) {
+    mem = nghttp3_mem_default();
+  }
+
+  for (i = 0; i < nvlen; ++i) {
+    /* + 2 for null-termination of name and value, and the upper
+       bound of the field line representation.  A static table index
+       takes at most 2 bytes with 4 bit prefix. */
+    if (qpack_size_add(&buflen, nva[i].namelen) != 0 ||
+        qpack_size_add(&buflen, nva[i].valuelen) != 0 ||
+        qpack_size_add(&buflen, 2) != 0 ||
+        qpack_size_add(&buflen, nghttp3_max(2, nghttp3_qpack_put_varint_len(
+                                                 nva[i].namelen, 3))) != 0 ||
+        qpack_size_add(&buflen, nva[i].namelen) != 0 ||
+        qpack_size_add(&buflen,
+                       nghttp3_qpack_put_varint_len(nva[i].valuelen, 7)) !=
+          0 ||
+        qpack_size_add(&buflen, nva[i].valuelen) != 0) {
+      return NGHTTP3_ERR_NOMEM;
+    }
+  }
+
+  if (nvlen > (SIZE_MAX - sizeof(*pnva)) /
+                (sizeof(nghttp3_nv) + sizeof(nghttp3_qpack_field))) {
+    return NGHTTP3_ERR_NOMEM;
+  }
+
+  len = sizeof(*pnva) +
+        (sizeof(nghttp3_nv) + sizeof(nghttp3_qpack_field)) * nvlen;
+
+  if (qpack_size_add(&len, buflen) != 0) {
+    return NGHTTP3_ERR_NOMEM;
+  }
+
+  pnva = nghttp3_mem_malloc(mem, len);
+  if (pnva == NULL) {
+    return NGHTTP3_ERR_NOMEM;
+  }
+
+  pnva->mem = mem;
+  pnva->nva = (nghttp3_nv *)(void *)(pnva + 1);
+  pnva->fields = (nghttp3_qpack_field *)(void *)(pnva->nva + nvlen);
+  pnva->nvlen = nvlen;
+
+  p = (uint8_t *)(pnva->fields + nvlen);
+
+  for (i = 0; i < nvlen; ++i) {
+    nv = &pnva->nva[i];
+    f = &pnva->fields[i];
+
+    nv->flags = nva[i].flags & (uint8_t)~(NGHTTP3_NV_FLAG_NO_COPY_NAME |
+                                          NGHTTP3_NV_FLAG_NO_COPY_VALUE);
+
+    nv->name = p;
+    nv->namelen = nva[i].namelen;
+    if (nv->namelen) {
+      memcpy(p, nva[i].name, nv->namelen);
+      nghttp3_downcase(p, nv->namelen);
+      p += nv->namelen;
+    }
+    *p++ = '\0';
+
+    nv->value = p;
+    nv->valuelen = nva[i].valuelen;
+    if (nv->valuelen) {
+      p = nghttp3_cpymem(p, nva[i].value, nv->valuelen);
+    }
+    *p++ = '\0';
+
+    qpack_field_init(f, nv, NGHTTP3_QPACK_INDEXING_STRAT_NONE);
+    f->indexing_mode[NGHTTP3_QPACK_INDEXING_STRAT_EAGER] =
+      qpack_decide_indexing_mode(nv, f->token,
+                                 NGHTTP3_QPACK_INDEXING_STRAT_EAGER);
+
+    f->rep = p;
+    p = qpack_put_field_rep(p, nv, f);
+    f->replen = (size_t)(p - f->rep);
+    f->hsaved = qpack_field_rep_rawlen(nv, f) - f->replen;
+  }
+
+  *ppnva = pnva;
+
+  return 0;
+}
+
+void nghttp3_prepared_nva_del(nghttp3_prepared_nva *pnva) {
+  if (pnva == NULL) {
+    return;
+  }
+
+  nghttp3_mem_free(pnva->mem, pnva);
+}
+
 int nghttp3_qpack_stream_context_new(nghttp3_qpack_stream_context **psctx,
                                      int64_t stream_id,
                                      const nghttp3_mem *mem) {
@@ -4216,6 +4878,11 @@ void nghttp3_qpack_decoder_del(nghttp3_qpack_decoder *decoder) {
   nghttp3_mem_free(mem, decoder);
 }
 
+size_t nghttp3_qpack_decoder_get_dtable_memusage(
+  const nghttp3_qpack_decoder *decoder) {
+  return qpack_context_get_dtable_memusage(&decoder->ctx);
+}
+
 uint64_t nghttp3_qpack_decoder_get_icnt(const nghttp3_qpack_decoder *decoder) {
   return decoder->ctx.next_absidx;
 }
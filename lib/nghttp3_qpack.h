@@ -76,9 +76,16 @@ typedef struct nghttp3_qpack_entry nghttp3_qpack_entry;
 struct nghttp3_qpack_entry {
   /* The header field name/value pair */
   nghttp3_qpack_nv nv;
-  /* map_next points to the entry which shares same bucket in hash
-     table. */
+  /* map_next points to the entry which shares same bucket in the
+     name index of hash table. */
   nghttp3_qpack_entry *map_next;
+  /* map_prev points to the entry which precedes this entry in the
+     bucket of the name index.  It is NULL if this entry is the first
+     one in the bucket. */
+  nghttp3_qpack_entry *map_prev;
+  /* nvmap_next points to the entry which shares same bucket in the
+     name/value index of hash table. */
+  nghttp3_qpack_entry *nvmap_next;
   /* sum is the sum of all entries inserted up to this entry.  This
      value does not contain the space required for this entry. */
   size_t sum;
@@ -86,6 +93,9 @@ struct nghttp3_qpack_entry {
   uint64_t absidx;
   /* The hash value for header name (nv.name). */
   uint32_t hash;
+  /* nvhash is the hash value for header name and value.  It is only
+     used by encoder. */
+  uint32_t nvhash;
 };
 
 /* The entry used for static table. */
@@ -152,6 +162,23 @@ void nghttp3_qpack_stream_pop_ref(nghttp3_qpack_stream *stream);
 
 #define NGHTTP3_QPACK_ENTRY_OVERHEAD 32
 
+/*
+ * nghttp3_qpack_stats is the counters of QPACK encoder or decoder.
+ */
+typedef struct nghttp3_qpack_stats {
+  /* static_hits is the number of field lines which reference static
+     table. */
+  uint64_t static_hits;
+  /* dynamic_hits is the number of field lines which reference
+     dynamic table. */
+  uint64_t dynamic_hits;
+  /* literals is the number of field lines with literal name. */
+  uint64_t literals;
+  /* huffman_bytes_saved is the number of bytes saved by Huffman
+     encoding.  Only encoder updates this field. */
+  uint64_t huffman_bytes_saved;
+} nghttp3_qpack_stats;
+
 typedef struct nghttp3_qpack_context {
   /* dtable is a dynamic table */
   nghttp3_ringbuf dtable;
@@ -174,6 +201,8 @@ typedef struct nghttp3_qpack_context {
   /* next_absidx is the next absolute index for nghttp3_qpack_entry.
      It is equivalent to insert count. */
   uint64_t next_absidx;
+  /* stats is the counters of this encoder or decoder. */
+  nghttp3_qpack_stats stats;
   /* If inflate/deflate error occurred, this value is set to 1 and
      further invocation of inflate/deflate will fail with
      NGHTTP3_ERR_QPACK_FATAL. */
@@ -199,10 +228,38 @@ void nghttp3_qpack_read_state_free(nghttp3_qpack_read_state *rstate);
 
 void nghttp3_qpack_read_state_reset(nghttp3_qpack_read_state *rstate);
 
-#define NGHTTP3_QPACK_MAP_SIZE 64
-
+/*
+ * nghttp3_qpack_lookup_token returns nghttp3_qpack_token for the
+ * field name |name| of length |namelen|, or -1 if the name does not
+ * have a token.  It is generated by genlibtokenlookup.py, and
+ * switches on |namelen| and the last byte of |name|.
+ */
+int32_t nghttp3_qpack_lookup_token(const uint8_t *name, size_t namelen);
+
+/* NGHTTP3_QPACK_MAP_MIN_HASHBITS is the binary logarithm of the
+   initial number of buckets in nghttp3_qpack_map. */
+#define NGHTTP3_QPACK_MAP_MIN_HASHBITS 6
+
+/* nghttp3_qpack_map is a chained hash table of dynamic table entries.
+   It has 2 indexes: one is keyed by name/value hash to find an exact
+   match, and the other is keyed by name hash to find a name match.
+   Many entries which share a name, but differ in value, only
+   lengthen a chain in the name index, and an entry is unlinked from
+   it without walking the chain.  The number of buckets doubles when
+   the number of entries exceeds it, so that chains stay short with
+   large dynamic table capacity. */
 typedef struct nghttp3_qpack_map {
-  nghttp3_qpack_entry *table[NGHTTP3_QPACK_MAP_SIZE];
+  /* table is an array of 1 << hashbits buckets of the name index.
+     It is allocated when the first entry is inserted. */
+  nghttp3_qpack_entry **table;
+  /* nvtable is an array of 1 << hashbits buckets of the name/value
+     index.  It shares the allocation with table. */
+  nghttp3_qpack_entry **nvtable;
+  const nghttp3_mem *mem;
+  /* size is the number of entries in this map. */
+  size_t size;
+  /* hashbits is the binary logarithm of the number of buckets. */
+  size_t hashbits;
 } nghttp3_qpack_map;
 
 /* nghttp3_qpack_decoder_stream_state is a set of states when decoding
@@ -316,6 +373,44 @@ typedef struct nghttp3_qpack_lookup_result {
   nghttp3_ssize pb_index;
 } nghttp3_qpack_lookup_result;
 
+/* nghttp3_qpack_field is a header field with the encoder independent
+   part of encoding computed. */
+typedef struct nghttp3_qpack_field {
+  /* sres is the result of static table lookup.  sres.index is -1 if
+     the name is not in static table. */
+  nghttp3_qpack_lookup_result sres;
+  /* rep, if not NULL, is the encoded field line representation which
+     does not reference dynamic table.  It is either Literal Field
+     Line With Name Reference to static table or Literal Field Line
+     With Literal Name. */
+  const uint8_t *rep;
+  /* replen is the length of rep. */
+  size_t replen;
+  /* hsaved is the number of bytes that Huffman encoding saved in
+     rep. */
+  size_t hsaved;
+  /* token is a token of the name.  It is -1 if there is no
+     corresponding token defined. */
+  int32_t token;
+  /* hash is a hash value of the name. */
+  uint32_t hash;
+  /* indexing_mode is the indexing mode for each
+     nghttp3_qpack_indexing_strat, before the dynamic table capacity
+     is taken into account. */
+  nghttp3_qpack_indexing_mode indexing_mode[2];
+} nghttp3_qpack_field;
+
+struct nghttp3_prepared_nva {
+  const nghttp3_mem *mem;
+  /* nva is the copy of header fields. */
+  nghttp3_nv *nva;
+  /* fields is the precomputed encoding state of each field in
+     nva. */
+  nghttp3_qpack_field *fields;
+  /* nvlen is the number of fields. */
+  size_t nvlen;
+};
+
 /*
  * nghttp3_qpack_lookup_stable searches |nv| in static table.  |token|
  * is a token of nv->name and it is -1 if there is no corresponding
@@ -363,8 +458,9 @@ int nghttp3_qpack_encoder_write_field_section_prefix(
  * NGHTTP3_ERR_NOMEM
  *     Out of memory.
  */
-int nghttp3_qpack_encoder_write_static_indexed(
-  const nghttp3_qpack_encoder *encoder, nghttp3_buf *rbuf, uint64_t absidx);
+int nghttp3_qpack_encoder_write_static_indexed(nghttp3_qpack_encoder *encoder,
+                                                nghttp3_buf *rbuf,
+                                                uint64_t absidx);
 
 /*
  * nghttp3_qpack_encoder_write_dynamic_indexed writes Indexed Header
@@ -377,9 +473,10 @@ int nghttp3_qpack_encoder_write_static_indexed(
  * NGHTTP3_ERR_NOMEM
  *     Out of memory.
  */
-int nghttp3_qpack_encoder_write_dynamic_indexed(
-  const nghttp3_qpack_encoder *encoder, nghttp3_buf *rbuf, uint64_t absidx,
-  uint64_t base);
+int nghttp3_qpack_encoder_write_dynamic_indexed(nghttp3_qpack_encoder *encoder,
+                                                 nghttp3_buf *rbuf,
+                                                 uint64_t absidx,
+                                                 uint64_t base);
 
 /*
  * nghttp3_qpack_encoder_write_static_indexed writes Literal Header
@@ -394,7 +491,7 @@ int nghttp3_qpack_encoder_write_dynamic_indexed(
  *     Out of memory.
  */
 int nghttp3_qpack_encoder_write_static_indexed_name(
-  const nghttp3_qpack_encoder *encoder, nghttp3_buf *rbuf, uint64_t absidx,
+  nghttp3_qpack_encoder *encoder, nghttp3_buf *rbuf, uint64_t absidx,
   const nghttp3_nv *nv);
 
 /*
@@ -410,7 +507,7 @@ int nghttp3_qpack_encoder_write_static_indexed_name(
  *     Out of memory.
  */
 int nghttp3_qpack_encoder_write_dynamic_indexed_name(
-  const nghttp3_qpack_encoder *encoder, nghttp3_buf *rbuf, uint64_t absidx,
+  nghttp3_qpack_encoder *encoder, nghttp3_buf *rbuf, uint64_t absidx,
   uint64_t base, const nghttp3_nv *nv);
 
 /*
@@ -423,7 +520,7 @@ int nghttp3_qpack_encoder_write_dynamic_indexed_name(
  * NGHTTP3_ERR_NOMEM
  *     Out of memory.
  */
-int nghttp3_qpack_encoder_write_literal(const nghttp3_qpack_encoder *encoder,
+int nghttp3_qpack_encoder_write_literal(nghttp3_qpack_encoder *encoder,
                                         nghttp3_buf *rbuf,
                                         const nghttp3_nv *nv);
 
@@ -439,7 +536,7 @@ int nghttp3_qpack_encoder_write_literal(const nghttp3_qpack_encoder *encoder,
  *     Out of memory.
  */
 int nghttp3_qpack_encoder_write_static_insert(
-  const nghttp3_qpack_encoder *encoder, nghttp3_buf *ebuf, uint64_t absidx,
+  nghttp3_qpack_encoder *encoder, nghttp3_buf *ebuf, uint64_t absidx,
   const nghttp3_nv *nv);
 
 /*
@@ -454,7 +551,7 @@ int nghttp3_qpack_encoder_write_static_insert(
  *     Out of memory.
  */
 int nghttp3_qpack_encoder_write_dynamic_insert(
-  const nghttp3_qpack_encoder *encoder, nghttp3_buf *ebuf, uint64_t absidx,
+  nghttp3_qpack_encoder *encoder, nghttp3_buf *ebuf, uint64_t absidx,
   const nghttp3_nv *nv);
 
 /*
@@ -481,9 +578,9 @@ int nghttp3_qpack_encoder_write_duplicate_insert(
  * NGHTTP3_ERR_NOMEM
  *     Out of memory.
  */
-int nghttp3_qpack_encoder_write_literal_insert(
-  const nghttp3_qpack_encoder *encoder, nghttp3_buf *ebuf,
-  const nghttp3_nv *nv);
+int nghttp3_qpack_encoder_write_literal_insert(nghttp3_qpack_encoder *encoder,
+                                               nghttp3_buf *ebuf,
+                                               const nghttp3_nv *nv);
 
 int nghttp3_qpack_encoder_stream_is_blocked(
   const nghttp3_qpack_encoder *encoder, const nghttp3_qpack_stream *stream);
@@ -525,6 +622,16 @@ nghttp3_qpack_encoder_find_stream(const nghttp3_qpack_encoder *encoder,
 uint64_t
 nghttp3_qpack_encoder_get_min_cnt(const nghttp3_qpack_encoder *encoder);
 
+/*
+ * nghttp3_qpack_encoder_get_dtable_memusage returns the number of
+ * bytes allocated for the dynamic table of |encoder|, including its
+ * entries, their name/value buffers, and the hash table to look them
+ * up.  A name or value buffer which is shared by several owners is
+ * attributed to each of them in proportion to its reference count.
+ */
+size_t nghttp3_qpack_encoder_get_dtable_memusage(
+  const nghttp3_qpack_encoder *encoder);
+
 /*
  * nghttp3_qpack_encoder_shrink_dtable shrinks dynamic table so that
  * the dynamic table size is less than or equal to maximum size.
@@ -788,6 +895,9 @@ struct nghttp3_qpack_decoder {
   /* uninterrupted_encoderlen is the number of bytes read from encoder
      stream without completing a single field section. */
   size_t uninterrupted_encoderlen;
+  /* borrow_literals, if nonzero, emits string literals on request
+     stream as borrowed views into the input buffer where possible. */
+  int borrow_literals;
 };
 
 /*
@@ -882,6 +992,33 @@ int nghttp3_qpack_decoder_dtable_duplicate_add(nghttp3_qpack_decoder *decoder);
  */
 int nghttp3_qpack_decoder_dtable_literal_add(nghttp3_qpack_decoder *decoder);
 
+/* QPACK field flags */
+
+/* NGHTTP3_QPACK_FIELD_FLAG_NONE indicates that nothing is known
+   about the characters of the field line. */
+#define NGHTTP3_QPACK_FIELD_FLAG_NONE 0x00U
+/* NGHTTP3_QPACK_FIELD_FLAG_NAME_CLASSIFIED indicates that the
+   characters of the field name have been classified while it was
+   decoded, and NGHTTP3_QPACK_FIELD_FLAG_NAME_BAD and
+   NGHTTP3_QPACK_FIELD_FLAG_NAME_UPPER are valid.  It is never set for
+   a name which begins with ':'. */
+#define NGHTTP3_QPACK_FIELD_FLAG_NAME_CLASSIFIED 0x01U
+/* NGHTTP3_QPACK_FIELD_FLAG_NAME_BAD indicates that the field name
+   contains a character which is neither allowed in HTTP field name
+   nor in [A-Z]. */
+#define NGHTTP3_QPACK_FIELD_FLAG_NAME_BAD 0x02U
+/* NGHTTP3_QPACK_FIELD_FLAG_NAME_UPPER indicates that the field name
+   contains a character in [A-Z]. */
+#define NGHTTP3_QPACK_FIELD_FLAG_NAME_UPPER 0x04U
+/* NGHTTP3_QPACK_FIELD_FLAG_VALUE_CLASSIFIED indicates that the
+   characters of the field value have been classified while it was
+   decoded, and NGHTTP3_QPACK_FIELD_FLAG_VALUE_BAD is valid.  Leading
+   and trailing white spaces are not taken into account. */
+#define NGHTTP3_QPACK_FIELD_FLAG_VALUE_CLASSIFIED 0x08U
+/* NGHTTP3_QPACK_FIELD_FLAG_VALUE_BAD indicates that the field value
+   contains a character which is not allowed in HTTP field value. */
+#define NGHTTP3_QPACK_FIELD_FLAG_VALUE_BAD 0x10U
+
 struct nghttp3_qpack_stream_context {
   /* rstate is a set of intermediate state which are used to process
      request stream. */
@@ -898,6 +1035,17 @@ struct nghttp3_qpack_stream_context {
   nghttp3_qpack_request_stream_opcode opcode;
   /* dbase_sign is the delta base sign in Header Block Prefix. */
   int dbase_sign;
+  /* borrowed_name and borrowed_value are the storage of borrowed
+     views which are emitted if decoder->borrow_literals is nonzero.
+     They point into the input buffer, and are not NULL-terminated. */
+  nghttp3_rcbuf borrowed_name;
+  nghttp3_rcbuf borrowed_value;
+  /* field_flags is bitwise OR of zero or more of
+     NGHTTP3_QPACK_FIELD_FLAG_* of the field line being decoded.  It
+     is valid for the field line which has just been emitted by
+     nghttp3_qpack_decoder_read_request until the next call of the
+     function. */
+  uint8_t field_flags;
 };
 
 /*
@@ -977,10 +1125,20 @@ int nghttp3_qpack_decoder_emit_indexed_name(nghttp3_qpack_decoder *decoder,
                                             nghttp3_qpack_stream_context *sctx,
                                             nghttp3_qpack_nv *nv);
 
-void nghttp3_qpack_decoder_emit_literal(const nghttp3_qpack_decoder *decoder,
+void nghttp3_qpack_decoder_emit_literal(nghttp3_qpack_decoder *decoder,
                                         nghttp3_qpack_stream_context *sctx,
                                         nghttp3_qpack_nv *nv);
 
+/*
+ * nghttp3_qpack_decoder_get_dtable_memusage returns the number of
+ * bytes allocated for the dynamic table of |decoder|, including its
+ * entries and their name/value buffers.  Buffers shared with
+ * emitted header fields are attributed as described in
+ * nghttp3_qpack_encoder_get_dtable_memusage.
+ */
+size_t nghttp3_qpack_decoder_get_dtable_memusage(
+  const nghttp3_qpack_decoder *decoder);
+
 /*
  * nghttp3_qpack_decoder_write_section_ack writes Section
  * Acknowledgement to decoder stream.
@@ -77,11 +77,81 @@ uint8_t *nghttp3_qpack_huffman_encode(uint8_t *dest, const uint8_t *src,
   return dest;
 }
 
+uint8_t *nghttp3_qpack_huffman_encode_shorter(uint8_t *dest,
+                                              const uint8_t *src,
+                                              size_t srclen) {
+  const nghttp3_qpack_huffman_sym *sym;
+  const uint8_t *end = src + srclen;
+  /* The encoded string must be strictly shorter than srclen. */
+  const uint8_t *dest_end = dest + srclen;
+  uint64_t code = 0;
+  size_t nbits = 0;
+  uint32_t x;
+
+  for (; src != end;) {
+    sym = &huffman_sym_table[*src++];
+    code |= (uint64_t)sym->code << (32 - nbits);
+    nbits += sym->nbits;
+    if (nbits < 32) {
+      continue;
+    }
+    if (dest_end - dest <= 4) {
+      return NULL;
+    }
+    x = htonl((uint32_t)(code >> 32));
+    memcpy(dest, &x, 4);
+    dest += 4;
+    code <<= 32;
+    nbits -= 32;
+  }
+
+  if ((size_t)(dest_end - dest) <= (nbits + 7) / 8) {
+    return NULL;
+  }
+
+  for (; nbits >= 8;) {
+    *dest++ = (uint8_t)(code >> 56);
+    code <<= 8;
+    nbits -= 8;
+  }
+
+  if (nbits) {
+    *dest++ = (uint8_t)((uint8_t)(code >> 56) | ((1 << (8 - nbits)) - 1));
+  }
+
+  return dest;
+}
+
+/* huffman_sym_class is the bitwise OR of
+   NGHTTP3_QPACK_HUFFMAN_CLASS_* of each octet. */
+static const uint8_t huffman_sym_class[256] = {
+  0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x01, 0x05, 0x05,
+  0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+  0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x01, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x05, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01,
+};
+
 void nghttp3_qpack_huffman_decode_context_init(
   nghttp3_qpack_huffman_decode_context *ctx) {
-  *ctx = (nghttp3_qpack_huffman_decode_context){
-    .flags = NGHTTP3_QPACK_HUFFMAN_FLAG_ACCEPTED,
-  };
+  *ctx = (nghttp3_qpack_huffman_decode_context){0};
 }
 
 nghttp3_ssize
@@ -90,33 +160,121 @@ nghttp3_qpack_huffman_decode(nghttp3_qpack_huffman_decode_context *ctx,
                              int fin) {
   uint8_t *p = dest;
   const uint8_t *end = src + srclen;
-  nghttp3_qpack_huffman_decode_node t = {
-    .fstate = ctx->fstate,
-    .flags = ctx->flags,
-  };
-  uint8_t c;
-
-  /* We use the decoding algorithm described in
-      - http://graphics.ics.uci.edu/pub/Prefix.pdf [!!! NO LONGER VALID !!!]
-      - https://ics.uci.edu/~dan/pubs/Prefix.pdf
-      - https://github.com/nghttp2/nghttp2/files/15141264/Prefix.pdf */
-  for (; src != end;) {
-    c = *src++;
-    t = qpack_huffman_decode_table[t.fstate][c >> 4];
-    if (t.flags & NGHTTP3_QPACK_HUFFMAN_FLAG_SYM) {
-      *p++ = t.sym;
+  const nghttp3_qpack_huffman_decode_entry *ent;
+  uint64_t bits = ctx->bits;
+  size_t nbits = ctx->nbits;
+  uint64_t x;
+  uint32_t code;
+  size_t len;
+  uint16_t sym;
+  uint8_t cls = ctx->cls;
+
+  if (ctx->flags & NGHTTP3_QPACK_HUFFMAN_DECODE_FLAG_FAILURE) {
+    return fin ? NGHTTP3_ERR_QPACK_FATAL : 0;
+  }
+
+  /* Look up NGHTTP3_QPACK_HUFFMAN_DECODE_BITS bits at a time, which
+     yields up to 2 symbols.  If nbits is less than that, the missing
+     bits are 0, and a symbol is emitted only if its code is entirely
+     available.  A longer code is decoded by canonical Huffman
+     decoding. */
+  for (;;) {
+    if (end - src >= 8) {
+      /* The bits beyond nbits are filled with the bytes that are not
+         consumed yet.  They are ORed with the same value later. */
+      memcpy(&x, src, sizeof(x));
+      bits |= nghttp3_ntohl64(x) >> nbits;
+      src += (63 - nbits) >> 3;
+      nbits |= 56;
+    } else {
+      for (; nbits <= 56 && src != end; nbits += 8) {
+        bits |= (uint64_t)*src++ << (56 - nbits);
+      }
+    }
+
+    if (nbits == 0) {
+      break;
+    }
+
+    ent = &qpack_huffman_decode_table[bits >>
+                                      (64 - NGHTTP3_QPACK_HUFFMAN_DECODE_BITS)];
+    if (ent->nbits1) {
+      if ((size_t)ent->nbits + 5 <= nbits) {
+        /* At least 5 more bits of this string remain, so the buffer
+           sized by nghttp3_qpack_huffman_estimate_decode_length has
+           room for sym[1] even if this entry yields 1 symbol. */
+        p[0] = ent->sym[0];
+        p[1] = ent->sym[1];
+        p += 1 + (ent->nbits != ent->nbits1);
+        /* sym[1] equals to sym[0] if this entry yields 1 symbol. */
+        cls |=
+          huffman_sym_class[ent->sym[0]] | huffman_sym_class[ent->sym[1]];
+
+        bits <<= ent->nbits;
+        nbits -= ent->nbits;
+
+        continue;
+      }
+
+      if (ent->nbits <= nbits) {
+        *p++ = ent->sym[0];
+        if (ent->nbits != ent->nbits1) {
+          *p++ = ent->sym[1];
+        }
+        cls |=
+          huffman_sym_class[ent->sym[0]] | huffman_sym_class[ent->sym[1]];
+
+        bits <<= ent->nbits;
+        nbits -= ent->nbits;
+
+        continue;
+      }
+
+      if (ent->nbits1 > nbits) {
+        break;
+      }
+
+      *p++ = ent->sym[0];
+      cls |= huffman_sym_class[ent->sym[0]];
+      bits <<= ent->nbits1;
+      nbits -= ent->nbits1;
+
+      continue;
     }
 
-    t = qpack_huffman_decode_table[t.fstate][c & 0xFU];
-    if (t.flags & NGHTTP3_QPACK_HUFFMAN_FLAG_SYM) {
-      *p++ = t.sym;
+    code = (uint32_t)(bits >> 32);
+
+    for (len = NGHTTP3_QPACK_HUFFMAN_DECODE_BITS + 1;
+         code > qpack_huffman_decode_limit[len]; ++len)
+      ;
+
+    if (len > nbits) {
+      break;
     }
+
+    sym = qpack_huffman_decode_sym[(uint32_t)(code >> (32 - len)) +
+                                   qpack_huffman_decode_offset[len]];
+    if (sym == 256) {
+      /* EOS must not appear in the encoded string. */
+      ctx->flags |= NGHTTP3_QPACK_HUFFMAN_DECODE_FLAG_FAILURE;
+
+      return fin ? NGHTTP3_ERR_QPACK_FATAL : p - dest;
+    }
+
+    *p++ = (uint8_t)sym;
+    cls |= huffman_sym_class[sym];
+    bits <<= len;
+    nbits -= len;
   }
 
-  ctx->fstate = t.fstate;
-  ctx->flags = t.flags;
+  ctx->bits = bits;
+  ctx->nbits = (uint8_t)nbits;
+  ctx->cls = cls;
 
-  if (fin && !(ctx->flags & NGHTTP3_QPACK_HUFFMAN_FLAG_ACCEPTED)) {
+  /* The remaining bits must be the padding which is the most
+     significant bits of EOS, and is strictly less than 8 bits. */
+  if (fin && nbits &&
+      (nbits > 7 || (bits >> (64 - nbits)) != (1U << nbits) - 1)) {
     return NGHTTP3_ERR_QPACK_FATAL;
   }
 
@@ -125,5 +283,5 @@ nghttp3_qpack_huffman_decode(nghttp3_qpack_huffman_decode_context *ctx,
 
 int nghttp3_qpack_huffman_decode_failure_state(
   const nghttp3_qpack_huffman_decode_context *ctx) {
-  return ctx->fstate == 0x100U;
+  return (ctx->flags & NGHTTP3_QPACK_HUFFMAN_DECODE_FLAG_FAILURE) != 0;
 }
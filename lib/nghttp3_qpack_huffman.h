@@ -46,34 +46,83 @@ size_t nghttp3_qpack_huffman_encode_count(const uint8_t *src, size_t len);
 uint8_t *nghttp3_qpack_huffman_encode(uint8_t *dest, const uint8_t *src,
                                       size_t srclen);
 
-/* NGHTTP3_QPACK_HUFFMAN_FLAG_ACCEPTED indicates that FSA accepts this
-   state as the end of huffman encoding sequence. */
-#define NGHTTP3_QPACK_HUFFMAN_FLAG_ACCEPTED 0x01U
-/* NGHTTP3_QPACK_HUFFMAN_FLAG_SYM indicates that this state emits
-   symbol */
-#define NGHTTP3_QPACK_HUFFMAN_FLAG_SYM 0x02U
-
-typedef struct nghttp3_qpack_huffman_decode_node {
-  /* fstate is the current huffman decoding state, which is actually
-     the node ID of internal huffman tree with
-     NGHTTP3_QPACK_HUFFMAN_FLAG_* flags OR-ed.  We have 257 leaf
-     nodes, but they are identical to root node other than emitting a
-     symbol, so we have 256 internal nodes [1..256], inclusive.  The
-     node ID 256 is a special node and it is a terminal state that
-     means decoding failed. */
-  uint16_t fstate;
-  uint8_t flags;
-  /* symbol if NGHTTP3_QPACK_HUFFMAN_FLAG_SYM flag set */
-  uint8_t sym;
-} nghttp3_qpack_huffman_decode_node;
+/*
+ * nghttp3_qpack_huffman_encode_shorter encodes |src| of length
+ * |srclen| in huffman code and writes it to |dest| if, and only if,
+ * the encoded string is shorter than |srclen| bytes.  It computes
+ * the length and emits the code in a single pass, and gives up as
+ * soon as the output reaches |srclen| bytes.  |dest| must have at
+ * least |srclen| bytes of space; its contents are unspecified if
+ * this function returns NULL.
+ *
+ * This function returns the pointer to the one beyond the last byte
+ * written, or NULL if huffman encoding does not make |src| shorter.
+ */
+uint8_t *nghttp3_qpack_huffman_encode_shorter(uint8_t *dest,
+                                              const uint8_t *src,
+                                              size_t srclen);
+
+/* NGHTTP3_QPACK_HUFFMAN_DECODE_BITS is the number of bits that
+   qpack_huffman_decode_table is indexed by. */
+#define NGHTTP3_QPACK_HUFFMAN_DECODE_BITS 12
+
+typedef struct nghttp3_qpack_huffman_decode_entry {
+  /* sym contains up to 2 symbols decoded from
+     NGHTTP3_QPACK_HUFFMAN_DECODE_BITS bits of input. */
+  uint8_t sym[2];
+  /* nbits1 is the length of the code of sym[0].  If it is 0, the
+     input starts with a code which is longer than
+     NGHTTP3_QPACK_HUFFMAN_DECODE_BITS bits. */
+  uint8_t nbits1;
+  /* nbits is the total length of the codes of the symbols in sym.
+     If nbits == nbits1, only sym[0] is decoded, and sym[1] is equal
+     to sym[0]. */
+  uint8_t nbits;
+} nghttp3_qpack_huffman_decode_entry;
+
+/* NGHTTP3_QPACK_HUFFMAN_DECODE_FLAG_FAILURE indicates that EOS has
+   been decoded, and decoding failed. */
+#define NGHTTP3_QPACK_HUFFMAN_DECODE_FLAG_FAILURE 0x01U
+
+/* NGHTTP3_QPACK_HUFFMAN_CLASS_NAME_BAD indicates that a decoded
+   symbol is neither allowed in HTTP field name nor in [A-Z]. */
+#define NGHTTP3_QPACK_HUFFMAN_CLASS_NAME_BAD 0x01U
+/* NGHTTP3_QPACK_HUFFMAN_CLASS_NAME_UPPER indicates that a decoded
+   symbol is in [A-Z]. */
+#define NGHTTP3_QPACK_HUFFMAN_CLASS_NAME_UPPER 0x02U
+/* NGHTTP3_QPACK_HUFFMAN_CLASS_VALUE_BAD indicates that a decoded
+   symbol is not allowed in HTTP field value. */
+#define NGHTTP3_QPACK_HUFFMAN_CLASS_VALUE_BAD 0x04U
 
 typedef struct nghttp3_qpack_huffman_decode_context {
-  /* fstate is the current huffman decoding state. */
-  uint16_t fstate;
+  /* bits contains the input bits which have not been decoded yet.
+     They are aligned to MSB, and the other bits are 0. */
+  uint64_t bits;
+  /* nbits is the number of bits in bits. */
+  uint8_t nbits;
+  /* flags is bitwise OR of zero or more of
+     NGHTTP3_QPACK_HUFFMAN_DECODE_FLAG_*. */
   uint8_t flags;
+  /* cls is bitwise OR of zero or more of
+     NGHTTP3_QPACK_HUFFMAN_CLASS_* of the symbols decoded so far.  It
+     lets HTTP field validation skip scanning the decoded string
+     again. */
+  uint8_t cls;
 } nghttp3_qpack_huffman_decode_context;
 
-extern const nghttp3_qpack_huffman_decode_node qpack_huffman_decode_table[][16];
+extern const nghttp3_qpack_huffman_decode_entry qpack_huffman_decode_table[];
+
+/* qpack_huffman_decode_limit[n] is the largest 32 bit value which
+   begins with a code of length n or shorter.  It is used to decode a
+   code which is longer than NGHTTP3_QPACK_HUFFMAN_DECODE_BITS. */
+extern const uint32_t qpack_huffman_decode_limit[];
+
+/* qpack_huffman_decode_offset[n] is added (modulo 2**32) to a code of
+   length n to get the index to qpack_huffman_decode_sym. */
+extern const uint32_t qpack_huffman_decode_offset[];
+
+/* qpack_huffman_decode_sym contains symbols sorted by their codes. */
+extern const uint16_t qpack_huffman_decode_sym[];
 
 void nghttp3_qpack_huffman_decode_context_init(
   nghttp3_qpack_huffman_decode_context *ctx);
@@ -86,7 +135,12 @@ void nghttp3_qpack_huffman_decode_context_init(
  * substring.  |fin| must be nonzero if |src| contains the last chunk
  * of huffman string.  The decoded string is written to the buffer
  * pointed by |dest|.  This function assumes that the buffer pointed
- * by |dest| contains enough memory to store decoded byte string.
+ * by |dest| contains enough memory to store decoded byte string.  The
+ * buffer allocated for a whole string must be at least
+ * nghttp3_qpack_huffman_estimate_decode_length bytes long because
+ * this function may write a scratch byte past the decoded string
+ * within that bound.  The classes of the decoded symbols are
+ * accumulated in ctx->cls while they are written.
  *
  * This function returns the number of bytes written to |dest|, or one
  * of the following negative error codes:
@@ -95,4888 +95,1430 @@ const nghttp3_qpack_huffman_sym huffman_sym_table[] = {
   {30, 0xFFFFFFFCU},
 };
 
-const nghttp3_qpack_huffman_decode_node qpack_huffman_decode_table[][16] = {
-  /* 0 */
-  {
-    {0x04, 0x00, 0x00},
-    {0x05, 0x00, 0x00},
-    {0x07, 0x00, 0x00},
-    {0x08, 0x00, 0x00},
-    {0x0B, 0x00, 0x00},
-    {0x0C, 0x00, 0x00},
-    {0x10, 0x00, 0x00},
-    {0x13, 0x00, 0x00},
-    {0x19, 0x00, 0x00},
-    {0x1C, 0x00, 0x00},
-    {0x20, 0x00, 0x00},
-    {0x23, 0x00, 0x00},
-    {0x2A, 0x00, 0x00},
-    {0x31, 0x00, 0x00},
-    {0x39, 0x00, 0x00},
-    {0x40, 0x01, 0x00},
-  },
-  /* 1 */
-  {
-    {0x00, 0x03, 0x30},
-    {0x00, 0x03, 0x31},
-    {0x00, 0x03, 0x32},
-    {0x00, 0x03, 0x61},
-    {0x00, 0x03, 0x63},
-    {0x00, 0x03, 0x65},
-    {0x00, 0x03, 0x69},
-    {0x00, 0x03, 0x6F},
-    {0x00, 0x03, 0x73},
-    {0x00, 0x03, 0x74},
-    {0x0D, 0x00, 0x00},
-    {0x0E, 0x00, 0x00},
-    {0x11, 0x00, 0x00},
-    {0x12, 0x00, 0x00},
-    {0x14, 0x00, 0x00},
-    {0x15, 0x00, 0x00},
-  },
-  /* 2 */
-  {
-    {0x01, 0x02, 0x30},
-    {0x16, 0x03, 0x30},
-    {0x01, 0x02, 0x31},
-    {0x16, 0x03, 0x31},
-    {0x01, 0x02, 0x32},
-    {0x16, 0x03, 0x32},
-    {0x01, 0x02, 0x61},
-    {0x16, 0x03, 0x61},
-    {0x01, 0x02, 0x63},
-    {0x16, 0x03, 0x63},
-    {0x01, 0x02, 0x65},
-    {0x16, 0x03, 0x65},
-    {0x01, 0x02, 0x69},
-    {0x16, 0x03, 0x69},
-    {0x01, 0x02, 0x6F},
-    {0x16, 0x03, 0x6F},
-  },
-  /* 3 */
-  {
-    {0x02, 0x02, 0x30},
-    {0x09, 0x02, 0x30},
-    {0x17, 0x02, 0x30},
-    {0x28, 0x03, 0x30},
-    {0x02, 0x02, 0x31},
-    {0x09, 0x02, 0x31},
-    {0x17, 0x02, 0x31},
-    {0x28, 0x03, 0x31},
-    {0x02, 0x02, 0x32},
-    {0x09, 0x02, 0x32},
-    {0x17, 0x02, 0x32},
-    {0x28, 0x03, 0x32},
-    {0x02, 0x02, 0x61},
-    {0x09, 0x02, 0x61},
-    {0x17, 0x02, 0x61},
-    {0x28, 0x03, 0x61},
-  },
-  /* 4 */
-  {
-    {0x03, 0x02, 0x30},
-    {0x06, 0x02, 0x30},
-    {0x0A, 0x02, 0x30},
-    {0x0F, 0x02, 0x30},
-    {0x18, 0x02, 0x30},
-    {0x1F, 0x02, 0x30},
-    {0x29, 0x02, 0x30},
-    {0x38, 0x03, 0x30},
-    {0x03, 0x02, 0x31},
-    {0x06, 0x02, 0x31},
-    {0x0A, 0x02, 0x31},
-    {0x0F, 0x02, 0x31},
-    {0x18, 0x02, 0x31},
-    {0x1F, 0x02, 0x31},
-    {0x29, 0x02, 0x31},
-    {0x38, 0x03, 0x31},
-  },
-  /* 5 */
-  {
-    {0x03, 0x02, 0x32},
-    {0x06, 0x02, 0x32},
-    {0x0A, 0x02, 0x32},
-    {0x0F, 0x02, 0x32},
-    {0x18, 0x02, 0x32},
-    {0x1F, 0x02, 0x32},
-    {0x29, 0x02, 0x32},
-    {0x38, 0x03, 0x32},
-    {0x03, 0x02, 0x61},
-    {0x06, 0x02, 0x61},
-    {0x0A, 0x02, 0x61},
-    {0x0F, 0x02, 0x61},
-    {0x18, 0x02, 0x61},
-    {0x1F, 0x02, 0x61},
-    {0x29, 0x02, 0x61},
-    {0x38, 0x03, 0x61},
-  },
-  /* 6 */
-  {
-    {0x02, 0x02, 0x63},
-    {0x09, 0x02, 0x63},
-    {0x17, 0x02, 0x63},
-    {0x28, 0x03, 0x63},
-    {0x02, 0x02, 0x65},
-    {0x09, 0x02, 0x65},
-    {0x17, 0x02, 0x65},
-    {0x28, 0x03, 0x65},
-    {0x02, 0x02, 0x69},
-    {0x09, 0x02, 0x69},
-    {0x17, 0x02, 0x69},
-    {0x28, 0x03, 0x69},
-    {0x02, 0x02, 0x6F},
-    {0x09, 0x02, 0x6F},
-    {0x17, 0x02, 0x6F},
-    {0x28, 0x03, 0x6F},
-  },
-  /* 7 */
-  {
-    {0x03, 0x02, 0x63},
-    {0x06, 0x02, 0x63},
-    {0x0A, 0x02, 0x63},
-    {0x0F, 0x02, 0x63},
-    {0x18, 0x02, 0x63},
-    {0x1F, 0x02, 0x63},
-    {0x29, 0x02, 0x63},
-    {0x38, 0x03, 0x63},
-    {0x03, 0x02, 0x65},
-    {0x06, 0x02, 0x65},
-    {0x0A, 0x02, 0x65},
-    {0x0F, 0x02, 0x65},
-    {0x18, 0x02, 0x65},
-    {0x1F, 0x02, 0x65},
-    {0x29, 0x02, 0x65},
-    {0x38, 0x03, 0x65},
-  },
-  /* 8 */
-  {
-    {0x03, 0x02, 0x69},
-    {0x06, 0x02, 0x69},
-    {0x0A, 0x02, 0x69},
-    {0x0F, 0x02, 0x69},
-    {0x18, 0x02, 0x69},
-    {0x1F, 0x02, 0x69},
-    {0x29, 0x02, 0x69},
-    {0x38, 0x03, 0x69},
-    {0x03, 0x02, 0x6F},
-    {0x06, 0x02, 0x6F},
-    {0x0A, 0x02, 0x6F},
-    {0x0F, 0x02, 0x6F},
-    {0x18, 0x02, 0x6F},
-    {0x1F, 0x02, 0x6F},
-    {0x29, 0x02, 0x6F},
-    {0x38, 0x03, 0x6F},
-  },
-  /* 9 */
-  {
-    {0x01, 0x02, 0x73},
-    {0x16, 0x03, 0x73},
-    {0x01, 0x02, 0x74},
-    {0x16, 0x03, 0x74},
-    {0x00, 0x03, 0x20},
-    {0x00, 0x03, 0x25},
-    {0x00, 0x03, 0x2D},
-    {0x00, 0x03, 0x2E},
-    {0x00, 0x03, 0x2F},
-    {0x00, 0x03, 0x33},
-    {0x00, 0x03, 0x34},
-    {0x00, 0x03, 0x35},
-    {0x00, 0x03, 0x36},
-    {0x00, 0x03, 0x37},
-    {0x00, 0x03, 0x38},
-    {0x00, 0x03, 0x39},
-  },
-  /* 10 */
-  {
-    {0x02, 0x02, 0x73},
-    {0x09, 0x02, 0x73},
-    {0x17, 0x02, 0x73},
-    {0x28, 0x03, 0x73},
-    {0x02, 0x02, 0x74},
-    {0x09, 0x02, 0x74},
-    {0x17, 0x02, 0x74},
-    {0x28, 0x03, 0x74},
-    {0x01, 0x02, 0x20},
-    {0x16, 0x03, 0x20},
-    {0x01, 0x02, 0x25},
-    {0x16, 0x03, 0x25},
-    {0x01, 0x02, 0x2D},
-    {0x16, 0x03, 0x2D},
-    {0x01, 0x02, 0x2E},
-    {0x16, 0x03, 0x2E},
-  },
-  /* 11 */
-  {
-    {0x03, 0x02, 0x73},
-    {0x06, 0x02, 0x73},
-    {0x0A, 0x02, 0x73},
-    {0x0F, 0x02, 0x73},
-    {0x18, 0x02, 0x73},
-    {0x1F, 0x02, 0x73},
-    {0x29, 0x02, 0x73},
-    {0x38, 0x03, 0x73},
-    {0x03, 0x02, 0x74},
-    {0x06, 0x02, 0x74},
-    {0x0A, 0x02, 0x74},
-    {0x0F, 0x02, 0x74},
-    {0x18, 0x02, 0x74},
-    {0x1F, 0x02, 0x74},
-    {0x29, 0x02, 0x74},
-    {0x38, 0x03, 0x74},
-  },
-  /* 12 */
-  {
-    {0x02, 0x02, 0x20},
-    {0x09, 0x02, 0x20},
-    {0x17, 0x02, 0x20},
-    {0x28, 0x03, 0x20},
-    {0x02, 0x02, 0x25},
-    {0x09, 0x02, 0x25},
-    {0x17, 0x02, 0x25},
-    {0x28, 0x03, 0x25},
-    {0x02, 0x02, 0x2D},
-    {0x09, 0x02, 0x2D},
-    {0x17, 0x02, 0x2D},
-    {0x28, 0x03, 0x2D},
-    {0x02, 0x02, 0x2E},
-    {0x09, 0x02, 0x2E},
-    {0x17, 0x02, 0x2E},
-    {0x28, 0x03, 0x2E},
-  },
-  /* 13 */
-  {
-    {0x03, 0x02, 0x20},
-    {0x06, 0x02, 0x20},
-    {0x0A, 0x02, 0x20},
-    {0x0F, 0x02, 0x20},
-    {0x18, 0x02, 0x20},
-    {0x1F, 0x02, 0x20},
-    {0x29, 0x02, 0x20},
-    {0x38, 0x03, 0x20},
-    {0x03, 0x02, 0x25},
-    {0x06, 0x02, 0x25},
-    {0x0A, 0x02, 0x25},
-    {0x0F, 0x02, 0x25},
-    {0x18, 0x02, 0x25},
-    {0x1F, 0x02, 0x25},
-    {0x29, 0x02, 0x25},
-    {0x38, 0x03, 0x25},
-  },
-  /* 14 */
-  {
-    {0x03, 0x02, 0x2D},
-    {0x06, 0x02, 0x2D},
-    {0x0A, 0x02, 0x2D},
-    {0x0F, 0x02, 0x2D},
-    {0x18, 0x02, 0x2D},
-    {0x1F, 0x02, 0x2D},
-    {0x29, 0x02, 0x2D},
-    {0x38, 0x03, 0x2D},
-    {0x03, 0x02, 0x2E},
-    {0x06, 0x02, 0x2E},
-    {0x0A, 0x02, 0x2E},
-    {0x0F, 0x02, 0x2E},
-    {0x18, 0x02, 0x2E},
-    {0x1F, 0x02, 0x2E},
-    {0x29, 0x02, 0x2E},
-    {0x38, 0x03, 0x2E},
-  },
-  /* 15 */
-  {
-    {0x01, 0x02, 0x2F},
-    {0x16, 0x03, 0x2F},
-    {0x01, 0x02, 0x33},
-    {0x16, 0x03, 0x33},
-    {0x01, 0x02, 0x34},
-    {0x16, 0x03, 0x34},
-    {0x01, 0x02, 0x35},
-    {0x16, 0x03, 0x35},
-    {0x01, 0x02, 0x36},
-    {0x16, 0x03, 0x36},
-    {0x01, 0x02, 0x37},
-    {0x16, 0x03, 0x37},
-    {0x01, 0x02, 0x38},
-    {0x16, 0x03, 0x38},
-    {0x01, 0x02, 0x39},
-    {0x16, 0x03, 0x39},
-  },
-  /* 16 */
-  {
-    {0x02, 0x02, 0x2F},
-    {0x09, 0x02, 0x2F},
-    {0x17, 0x02, 0x2F},
-    {0x28, 0x03, 0x2F},
-    {0x02, 0x02, 0x33},
-    {0x09, 0x02, 0x33},
-    {0x17, 0x02, 0x33},
-    {0x28, 0x03, 0x33},
-    {0x02, 0x02, 0x34},
-    {0x09, 0x02, 0x34},
-    {0x17, 0x02, 0x34},
-    {0x28, 0x03, 0x34},
-    {0x02, 0x02, 0x35},
-    {0x09, 0x02, 0x35},
-    {0x17, 0x02, 0x35},
-    {0x28, 0x03, 0x35},
-  },
-  /* 17 */
-  {
-    {0x03, 0x02, 0x2F},
-    {0x06, 0x02, 0x2F},
-    {0x0A, 0x02, 0x2F},
-    {0x0F, 0x02, 0x2F},
-    {0x18, 0x02, 0x2F},
-    {0x1F, 0x02, 0x2F},
-    {0x29, 0x02, 0x2F},
-    {0x38, 0x03, 0x2F},
-    {0x03, 0x02, 0x33},
-    {0x06, 0x02, 0x33},
-    {0x0A, 0x02, 0x33},
-    {0x0F, 0x02, 0x33},
-    {0x18, 0x02, 0x33},
-    {0x1F, 0x02, 0x33},
-    {0x29, 0x02, 0x33},
-    {0x38, 0x03, 0x33},
-  },
-  /* 18 */
-  {
-    {0x03, 0x02, 0x34},
-    {0x06, 0x02, 0x34},
-    {0x0A, 0x02, 0x34},
-    {0x0F, 0x02, 0x34},
-    {0x18, 0x02, 0x34},
-    {0x1F, 0x02, 0x34},
-    {0x29, 0x02, 0x34},
-    {0x38, 0x03, 0x34},
-    {0x03, 0x02, 0x35},
-    {0x06, 0x02, 0x35},
-    {0x0A, 0x02, 0x35},
-    {0x0F, 0x02, 0x35},
-    {0x18, 0x02, 0x35},
-    {0x1F, 0x02, 0x35},
-    {0x29, 0x02, 0x35},
-    {0x38, 0x03, 0x35},
-  },
-  /* 19 */
-  {
-    {0x02, 0x02, 0x36},
-    {0x09, 0x02, 0x36},
-    {0x17, 0x02, 0x36},
-    {0x28, 0x03, 0x36},
-    {0x02, 0x02, 0x37},
-    {0x09, 0x02, 0x37},
-    {0x17, 0x02, 0x37},
-    {0x28, 0x03, 0x37},
-    {0x02, 0x02, 0x38},
-    {0x09, 0x02, 0x38},
-    {0x17, 0x02, 0x38},
-    {0x28, 0x03, 0x38},
-    {0x02, 0x02, 0x39},
-    {0x09, 0x02, 0x39},
-    {0x17, 0x02, 0x39},
-    {0x28, 0x03, 0x39},
-  },
-  /* 20 */
-  {
-    {0x03, 0x02, 0x36},
-    {0x06, 0x02, 0x36},
-    {0x0A, 0x02, 0x36},
-    {0x0F, 0x02, 0x36},
-    {0x18, 0x02, 0x36},
-    {0x1F, 0x02, 0x36},
-    {0x29, 0x02, 0x36},
-    {0x38, 0x03, 0x36},
-    {0x03, 0x02, 0x37},
-    {0x06, 0x02, 0x37},
-    {0x0A, 0x02, 0x37},
-    {0x0F, 0x02, 0x37},
-    {0x18, 0x02, 0x37},
-    {0x1F, 0x02, 0x37},
-    {0x29, 0x02, 0x37},
-    {0x38, 0x03, 0x37},
-  },
-  /* 21 */
-  {
-    {0x03, 0x02, 0x38},
-    {0x06, 0x02, 0x38},
-    {0x0A, 0x02, 0x38},
-    {0x0F, 0x02, 0x38},
-    {0x18, 0x02, 0x38},
-    {0x1F, 0x02, 0x38},
-    {0x29, 0x02, 0x38},
-    {0x38, 0x03, 0x38},
-    {0x03, 0x02, 0x39},
-    {0x06, 0x02, 0x39},
-    {0x0A, 0x02, 0x39},
-    {0x0F, 0x02, 0x39},
-    {0x18, 0x02, 0x39},
-    {0x1F, 0x02, 0x39},
-    {0x29, 0x02, 0x39},
-    {0x38, 0x03, 0x39},
-  },
-  /* 22 */
-  {
-    {0x1A, 0x00, 0x00},
-    {0x1B, 0x00, 0x00},
-    {0x1D, 0x00, 0x00},
-    {0x1E, 0x00, 0x00},
-    {0x21, 0x00, 0x00},
-    {0x22, 0x00, 0x00},
-    {0x24, 0x00, 0x00},
-    {0x25, 0x00, 0x00},
-    {0x2B, 0x00, 0x00},
-    {0x2E, 0x00, 0x00},
-    {0x32, 0x00, 0x00},
-    {0x35, 0x00, 0x00},
-    {0x3A, 0x00, 0x00},
-    {0x3D, 0x00, 0x00},
-    {0x41, 0x00, 0x00},
-    {0x44, 0x01, 0x00},
-  },
-  /* 23 */
-  {
-    {0x00, 0x03, 0x3D},
-    {0x00, 0x03, 0x41},
-    {0x00, 0x03, 0x5F},
-    {0x00, 0x03, 0x62},
-    {0x00, 0x03, 0x64},
-    {0x00, 0x03, 0x66},
-    {0x00, 0x03, 0x67},
-    {0x00, 0x03, 0x68},
-    {0x00, 0x03, 0x6C},
-    {0x00, 0x03, 0x6D},
-    {0x00, 0x03, 0x6E},
-    {0x00, 0x03, 0x70},
-    {0x00, 0x03, 0x72},
-    {0x00, 0x03, 0x75},
-    {0x26, 0x00, 0x00},
-    {0x27, 0x00, 0x00},
-  },
-  /* 24 */
-  {
-    {0x01, 0x02, 0x3D},
-    {0x16, 0x03, 0x3D},
-    {0x01, 0x02, 0x41},
-    {0x16, 0x03, 0x41},
-    {0x01, 0x02, 0x5F},
-    {0x16, 0x03, 0x5F},
-    {0x01, 0x02, 0x62},
-    {0x16, 0x03, 0x62},
-    {0x01, 0x02, 0x64},
-    {0x16, 0x03, 0x64},
-    {0x01, 0x02, 0x66},
-    {0x16, 0x03, 0x66},
-    {0x01, 0x02, 0x67},
-    {0x16, 0x03, 0x67},
-    {0x01, 0x02, 0x68},
-    {0x16, 0x03, 0x68},
-  },
-  /* 25 */
-  {
-    {0x02, 0x02, 0x3D},
-    {0x09, 0x02, 0x3D},
-    {0x17, 0x02, 0x3D},
-    {0x28, 0x03, 0x3D},
-    {0x02, 0x02, 0x41},
-    {0x09, 0x02, 0x41},
-    {0x17, 0x02, 0x41},
-    {0x28, 0x03, 0x41},
-    {0x02, 0x02, 0x5F},
-    {0x09, 0x02, 0x5F},
-    {0x17, 0x02, 0x5F},
-    {0x28, 0x03, 0x5F},
-    {0x02, 0x02, 0x62},
-    {0x09, 0x02, 0x62},
-    {0x17, 0x02, 0x62},
-    {0x28, 0x03, 0x62},
-  },
-  /* 26 */
-  {
-    {0x03, 0x02, 0x3D},
-    {0x06, 0x02, 0x3D},
-    {0x0A, 0x02, 0x3D},
-    {0x0F, 0x02, 0x3D},
-    {0x18, 0x02, 0x3D},
-    {0x1F, 0x02, 0x3D},
-    {0x29, 0x02, 0x3D},
-    {0x38, 0x03, 0x3D},
-    {0x03, 0x02, 0x41},
-    {0x06, 0x02, 0x41},
-    {0x0A, 0x02, 0x41},
-    {0x0F, 0x02, 0x41},
-    {0x18, 0x02, 0x41},
-    {0x1F, 0x02, 0x41},
-    {0x29, 0x02, 0x41},
-    {0x38, 0x03, 0x41},
-  },
-  /* 27 */
-  {
-    {0x03, 0x02, 0x5F},
-    {0x06, 0x02, 0x5F},
-    {0x0A, 0x02, 0x5F},
-    {0x0F, 0x02, 0x5F},
-    {0x18, 0x02, 0x5F},
-    {0x1F, 0x02, 0x5F},
-    {0x29, 0x02, 0x5F},
-    {0x38, 0x03, 0x5F},
-    {0x03, 0x02, 0x62},
-    {0x06, 0x02, 0x62},
-    {0x0A, 0x02, 0x62},
-    {0x0F, 0x02, 0x62},
-    {0x18, 0x02, 0x62},
-    {0x1F, 0x02, 0x62},
-    {0x29, 0x02, 0x62},
-    {0x38, 0x03, 0x62},
-  },
-  /* 28 */
-  {
-    {0x02, 0x02, 0x64},
-    {0x09, 0x02, 0x64},
-    {0x17, 0x02, 0x64},
-    {0x28, 0x03, 0x64},
-    {0x02, 0x02, 0x66},
-    {0x09, 0x02, 0x66},
-    {0x17, 0x02, 0x66},
-    {0x28, 0x03, 0x66},
-    {0x02, 0x02, 0x67},
-    {0x09, 0x02, 0x67},
-    {0x17, 0x02, 0x67},
-    {0x28, 0x03, 0x67},
-    {0x02, 0x02, 0x68},
-    {0x09, 0x02, 0x68},
-    {0x17, 0x02, 0x68},
-    {0x28, 0x03, 0x68},
-  },
-  /* 29 */
-  {
-    {0x03, 0x02, 0x64},
-    {0x06, 0x02, 0x64},
-    {0x0A, 0x02, 0x64},
-    {0x0F, 0x02, 0x64},
-    {0x18, 0x02, 0x64},
-    {0x1F, 0x02, 0x64},
-    {0x29, 0x02, 0x64},
-    {0x38, 0x03, 0x64},
-    {0x03, 0x02, 0x66},
-    {0x06, 0x02, 0x66},
-    {0x0A, 0x02, 0x66},
-    {0x0F, 0x02, 0x66},
-    {0x18, 0x02, 0x66},
-    {0x1F, 0x02, 0x66},
-    {0x29, 0x02, 0x66},
-    {0x38, 0x03, 0x66},
-  },
-  /* 30 */
-  {
-    {0x03, 0x02, 0x67},
-    {0x06, 0x02, 0x67},
-    {0x0A, 0x02, 0x67},
-    {0x0F, 0x02, 0x67},
-    {0x18, 0x02, 0x67},
-    {0x1F, 0x02, 0x67},
-    {0x29, 0x02, 0x67},
-    {0x38, 0x03, 0x67},
-    {0x03, 0x02, 0x68},
-    {0x06, 0x02, 0x68},
-    {0x0A, 0x02, 0x68},
-    {0x0F, 0x02, 0x68},
-    {0x18, 0x02, 0x68},
-    {0x1F, 0x02, 0x68},
-    {0x29, 0x02, 0x68},
-    {0x38, 0x03, 0x68},
-  },
-  /* 31 */
-  {
-    {0x01, 0x02, 0x6C},
-    {0x16, 0x03, 0x6C},
-    {0x01, 0x02, 0x6D},
-    {0x16, 0x03, 0x6D},
-    {0x01, 0x02, 0x6E},
-    {0x16, 0x03, 0x6E},
-    {0x01, 0x02, 0x70},
-    {0x16, 0x03, 0x70},
-    {0x01, 0x02, 0x72},
-    {0x16, 0x03, 0x72},
-    {0x01, 0x02, 0x75},
-    {0x16, 0x03, 0x75},
-    {0x00, 0x03, 0x3A},
-    {0x00, 0x03, 0x42},
-    {0x00, 0x03, 0x43},
-    {0x00, 0x03, 0x44},
-  },
-  /* 32 */
-  {
-    {0x02, 0x02, 0x6C},
-    {0x09, 0x02, 0x6C},
-    {0x17, 0x02, 0x6C},
-    {0x28, 0x03, 0x6C},
-    {0x02, 0x02, 0x6D},
-    {0x09, 0x02, 0x6D},
-    {0x17, 0x02, 0x6D},
-    {0x28, 0x03, 0x6D},
-    {0x02, 0x02, 0x6E},
-    {0x09, 0x02, 0x6E},
-    {0x17, 0x02, 0x6E},
-    {0x28, 0x03, 0x6E},
-    {0x02, 0x02, 0x70},
-    {0x09, 0x02, 0x70},
-    {0x17, 0x02, 0x70},
-    {0x28, 0x03, 0x70},
-  },
-  /* 33 */
-  {
-    {0x03, 0x02, 0x6C},
-    {0x06, 0x02, 0x6C},
-    {0x0A, 0x02, 0x6C},
-    {0x0F, 0x02, 0x6C},
-    {0x18, 0x02, 0x6C},
-    {0x1F, 0x02, 0x6C},
-    {0x29, 0x02, 0x6C},
-    {0x38, 0x03, 0x6C},
-    {0x03, 0x02, 0x6D},
-    {0x06, 0x02, 0x6D},
-    {0x0A, 0x02, 0x6D},
-    {0x0F, 0x02, 0x6D},
-    {0x18, 0x02, 0x6D},
-    {0x1F, 0x02, 0x6D},
-    {0x29, 0x02, 0x6D},
-    {0x38, 0x03, 0x6D},
-  },
-  /* 34 */
-  {
-    {0x03, 0x02, 0x6E},
-    {0x06, 0x02, 0x6E},
-    {0x0A, 0x02, 0x6E},
-    {0x0F, 0x02, 0x6E},
-    {0x18, 0x02, 0x6E},
-    {0x1F, 0x02, 0x6E},
-    {0x29, 0x02, 0x6E},
-    {0x38, 0x03, 0x6E},
-    {0x03, 0x02, 0x70},
-    {0x06, 0x02, 0x70},
-    {0x0A, 0x02, 0x70},
-    {0x0F, 0x02, 0x70},
-    {0x18, 0x02, 0x70},
-    {0x1F, 0x02, 0x70},
-    {0x29, 0x02, 0x70},
-    {0x38, 0x03, 0x70},
-  },
-  /* 35 */
-  {
-    {0x02, 0x02, 0x72},
-    {0x09, 0x02, 0x72},
-    {0x17, 0x02, 0x72},
-    {0x28, 0x03, 0x72},
-    {0x02, 0x02, 0x75},
-    {0x09, 0x02, 0x75},
-    {0x17, 0x02, 0x75},
-    {0x28, 0x03, 0x75},
-    {0x01, 0x02, 0x3A},
-    {0x16, 0x03, 0x3A},
-    {0x01, 0x02, 0x42},
-    {0x16, 0x03, 0x42},
-    {0x01, 0x02, 0x43},
-    {0x16, 0x03, 0x43},
-    {0x01, 0x02, 0x44},
-    {0x16, 0x03, 0x44},
-  },
-  /* 36 */
-  {
-    {0x03, 0x02, 0x72},
-    {0x06, 0x02, 0x72},
-    {0x0A, 0x02, 0x72},
-    {0x0F, 0x02, 0x72},
-    {0x18, 0x02, 0x72},
-    {0x1F, 0x02, 0x72},
-    {0x29, 0x02, 0x72},
-    {0x38, 0x03, 0x72},
-    {0x03, 0x02, 0x75},
-    {0x06, 0x02, 0x75},
-    {0x0A, 0x02, 0x75},
-    {0x0F, 0x02, 0x75},
-    {0x18, 0x02, 0x75},
-    {0x1F, 0x02, 0x75},
-    {0x29, 0x02, 0x75},
-    {0x38, 0x03, 0x75},
-  },
-  /* 37 */
-  {
-    {0x02, 0x02, 0x3A},
-    {0x09, 0x02, 0x3A},
-    {0x17, 0x02, 0x3A},
-    {0x28, 0x03, 0x3A},
-    {0x02, 0x02, 0x42},
-    {0x09, 0x02, 0x42},
-    {0x17, 0x02, 0x42},
-    {0x28, 0x03, 0x42},
-    {0x02, 0x02, 0x43},
-    {0x09, 0x02, 0x43},
-    {0x17, 0x02, 0x43},
-    {0x28, 0x03, 0x43},
-    {0x02, 0x02, 0x44},
-    {0x09, 0x02, 0x44},
-    {0x17, 0x02, 0x44},
-    {0x28, 0x03, 0x44},
-  },
-  /* 38 */
-  {
-    {0x03, 0x02, 0x3A},
-    {0x06, 0x02, 0x3A},
-    {0x0A, 0x02, 0x3A},
-    {0x0F, 0x02, 0x3A},
-    {0x18, 0x02, 0x3A},
-    {0x1F, 0x02, 0x3A},
-    {0x29, 0x02, 0x3A},
-    {0x38, 0x03, 0x3A},
-    {0x03, 0x02, 0x42},
-    {0x06, 0x02, 0x42},
-    {0x0A, 0x02, 0x42},
-    {0x0F, 0x02, 0x42},
-    {0x18, 0x02, 0x42},
-    {0x1F, 0x02, 0x42},
-    {0x29, 0x02, 0x42},
-    {0x38, 0x03, 0x42},
-  },
-  /* 39 */
-  {
-    {0x03, 0x02, 0x43},
-    {0x06, 0x02, 0x43},
-    {0x0A, 0x02, 0x43},
-    {0x0F, 0x02, 0x43},
-    {0x18, 0x02, 0x43},
-    {0x1F, 0x02, 0x43},
-    {0x29, 0x02, 0x43},
-    {0x38, 0x03, 0x43},
-    {0x03, 0x02, 0x44},
-    {0x06, 0x02, 0x44},
-    {0x0A, 0x02, 0x44},
-    {0x0F, 0x02, 0x44},
-    {0x18, 0x02, 0x44},
-    {0x1F, 0x02, 0x44},
-    {0x29, 0x02, 0x44},
-    {0x38, 0x03, 0x44},
-  },
-  /* 40 */
-  {
-    {0x2C, 0x00, 0x00},
-    {0x2D, 0x00, 0x00},
-    {0x2F, 0x00, 0x00},
-    {0x30, 0x00, 0x00},
-    {0x33, 0x00, 0x00},
-    {0x34, 0x00, 0x00},
-    {0x36, 0x00, 0x00},
-    {0x37, 0x00, 0x00},
-    {0x3B, 0x00, 0x00},
-    {0x3C, 0x00, 0x00},
-    {0x3E, 0x00, 0x00},
-    {0x3F, 0x00, 0x00},
-    {0x42, 0x00, 0x00},
-    {0x43, 0x00, 0x00},
-    {0x45, 0x00, 0x00},
-    {0x48, 0x01, 0x00},
-  },
-  /* 41 */
-  {
-    {0x00, 0x03, 0x45},
-    {0x00, 0x03, 0x46},
-    {0x00, 0x03, 0x47},
-    {0x00, 0x03, 0x48},
-    {0x00, 0x03, 0x49},
-    {0x00, 0x03, 0x4A},
-    {0x00, 0x03, 0x4B},
-    {0x00, 0x03, 0x4C},
-    {0x00, 0x03, 0x4D},
-    {0x00, 0x03, 0x4E},
-    {0x00, 0x03, 0x4F},
-    {0x00, 0x03, 0x50},
-    {0x00, 0x03, 0x51},
-    {0x00, 0x03, 0x52},
-    {0x00, 0x03, 0x53},
-    {0x00, 0x03, 0x54},
-  },
-  /* 42 */
-  {
-    {0x01, 0x02, 0x45},
-    {0x16, 0x03, 0x45},
-    {0x01, 0x02, 0x46},
-    {0x16, 0x03, 0x46},
-    {0x01, 0x02, 0x47},
-    {0x16, 0x03, 0x47},
-    {0x01, 0x02, 0x48},
-    {0x16, 0x03, 0x48},
-    {0x01, 0x02, 0x49},
-    {0x16, 0x03, 0x49},
-    {0x01, 0x02, 0x4A},
-    {0x16, 0x03, 0x4A},
-    {0x01, 0x02, 0x4B},
-    {0x16, 0x03, 0x4B},
-    {0x01, 0x02, 0x4C},
-    {0x16, 0x03, 0x4C},
-  },
-  /* 43 */
-  {
-    {0x02, 0x02, 0x45},
-    {0x09, 0x02, 0x45},
-    {0x17, 0x02, 0x45},
-    {0x28, 0x03, 0x45},
-    {0x02, 0x02, 0x46},
-    {0x09, 0x02, 0x46},
-    {0x17, 0x02, 0x46},
-    {0x28, 0x03, 0x46},
-    {0x02, 0x02, 0x47},
-    {0x09, 0x02, 0x47},
-    {0x17, 0x02, 0x47},
-    {0x28, 0x03, 0x47},
-    {0x02, 0x02, 0x48},
-    {0x09, 0x02, 0x48},
-    {0x17, 0x02, 0x48},
-    {0x28, 0x03, 0x48},
-  },
-  /* 44 */
-  {
-    {0x03, 0x02, 0x45},
-    {0x06, 0x02, 0x45},
-    {0x0A, 0x02, 0x45},
-    {0x0F, 0x02, 0x45},
-    {0x18, 0x02, 0x45},
-    {0x1F, 0x02, 0x45},
-    {0x29, 0x02, 0x45},
-    {0x38, 0x03, 0x45},
-    {0x03, 0x02, 0x46},
-    {0x06, 0x02, 0x46},
-    {0x0A, 0x02, 0x46},
-    {0x0F, 0x02, 0x46},
-    {0x18, 0x02, 0x46},
-    {0x1F, 0x02, 0x46},
-    {0x29, 0x02, 0x46},
-    {0x38, 0x03, 0x46},
-  },
-  /* 45 */
-  {
-    {0x03, 0x02, 0x47},
-    {0x06, 0x02, 0x47},
-    {0x0A, 0x02, 0x47},
-    {0x0F, 0x02, 0x47},
-    {0x18, 0x02, 0x47},
-    {0x1F, 0x02, 0x47},
-    {0x29, 0x02, 0x47},
-    {0x38, 0x03, 0x47},
-    {0x03, 0x02, 0x48},
-    {0x06, 0x02, 0x48},
-    {0x0A, 0x02, 0x48},
-    {0x0F, 0x02, 0x48},
-    {0x18, 0x02, 0x48},
-    {0x1F, 0x02, 0x48},
-    {0x29, 0x02, 0x48},
-    {0x38, 0x03, 0x48},
-  },
-  /* 46 */
-  {
-    {0x02, 0x02, 0x49},
-    {0x09, 0x02, 0x49},
-    {0x17, 0x02, 0x49},
-    {0x28, 0x03, 0x49},
-    {0x02, 0x02, 0x4A},
-    {0x09, 0x02, 0x4A},
-    {0x17, 0x02, 0x4A},
-    {0x28, 0x03, 0x4A},
-    {0x02, 0x02, 0x4B},
-    {0x09, 0x02, 0x4B},
-    {0x17, 0x02, 0x4B},
-    {0x28, 0x03, 0x4B},
-    {0x02, 0x02, 0x4C},
-    {0x09, 0x02, 0x4C},
-    {0x17, 0x02, 0x4C},
-    {0x28, 0x03, 0x4C},
-  },
-  /* 47 */
-  {
-    {0x03, 0x02, 0x49},
-    {0x06, 0x02, 0x49},
-    {0x0A, 0x02, 0x49},
-    {0x0F, 0x02, 0x49},
-    {0x18, 0x02, 0x49},
-    {0x1F, 0x02, 0x49},
-    {0x29, 0x02, 0x49},
-    {0x38, 0x03, 0x49},
-    {0x03, 0x02, 0x4A},
-    {0x06, 0x02, 0x4A},
-    {0x0A, 0x02, 0x4A},
-    {0x0F, 0x02, 0x4A},
-    {0x18, 0x02, 0x4A},
-    {0x1F, 0x02, 0x4A},
-    {0x29, 0x02, 0x4A},
-    {0x38, 0x03, 0x4A},
-  },
-  /* 48 */
-  {
-    {0x03, 0x02, 0x4B},
-    {0x06, 0x02, 0x4B},
-    {0x0A, 0x02, 0x4B},
-    {0x0F, 0x02, 0x4B},
-    {0x18, 0x02, 0x4B},
-    {0x1F, 0x02, 0x4B},
-    {0x29, 0x02, 0x4B},
-    {0x38, 0x03, 0x4B},
-    {0x03, 0x02, 0x4C},
-    {0x06, 0x02, 0x4C},
-    {0x0A, 0x02, 0x4C},
-    {0x0F, 0x02, 0x4C},
-    {0x18, 0x02, 0x4C},
-    {0x1F, 0x02, 0x4C},
-    {0x29, 0x02, 0x4C},
-    {0x38, 0x03, 0x4C},
-  },
-  /* 49 */
-  {
-    {0x01, 0x02, 0x4D},
-    {0x16, 0x03, 0x4D},
-    {0x01, 0x02, 0x4E},
-    {0x16, 0x03, 0x4E},
-    {0x01, 0x02, 0x4F},
-    {0x16, 0x03, 0x4F},
-    {0x01, 0x02, 0x50},
-    {0x16, 0x03, 0x50},
-    {0x01, 0x02, 0x51},
-    {0x16, 0x03, 0x51},
-    {0x01, 0x02, 0x52},
-    {0x16, 0x03, 0x52},
-    {0x01, 0x02, 0x53},
-    {0x16, 0x03, 0x53},
-    {0x01, 0x02, 0x54},
-    {0x16, 0x03, 0x54},
-  },
-  /* 50 */
-  {
-    {0x02, 0x02, 0x4D},
-    {0x09, 0x02, 0x4D},
-    {0x17, 0x02, 0x4D},
-    {0x28, 0x03, 0x4D},
-    {0x02, 0x02, 0x4E},
-    {0x09, 0x02, 0x4E},
-    {0x17, 0x02, 0x4E},
-    {0x28, 0x03, 0x4E},
-    {0x02, 0x02, 0x4F},
-    {0x09, 0x02, 0x4F},
-    {0x17, 0x02, 0x4F},
-    {0x28, 0x03, 0x4F},
-    {0x02, 0x02, 0x50},
-    {0x09, 0x02, 0x50},
-    {0x17, 0x02, 0x50},
-    {0x28, 0x03, 0x50},
-  },
-  /* 51 */
-  {
-    {0x03, 0x02, 0x4D},
-    {0x06, 0x02, 0x4D},
-    {0x0A, 0x02, 0x4D},
-    {0x0F, 0x02, 0x4D},
-    {0x18, 0x02, 0x4D},
-    {0x1F, 0x02, 0x4D},
-    {0x29, 0x02, 0x4D},
-    {0x38, 0x03, 0x4D},
-    {0x03, 0x02, 0x4E},
-    {0x06, 0x02, 0x4E},
-    {0x0A, 0x02, 0x4E},
-    {0x0F, 0x02, 0x4E},
-    {0x18, 0x02, 0x4E},
-    {0x1F, 0x02, 0x4E},
-    {0x29, 0x02, 0x4E},
-    {0x38, 0x03, 0x4E},
-  },
-  /* 52 */
-  {
-    {0x03, 0x02, 0x4F},
-    {0x06, 0x02, 0x4F},
-    {0x0A, 0x02, 0x4F},
-    {0x0F, 0x02, 0x4F},
-    {0x18, 0x02, 0x4F},
-    {0x1F, 0x02, 0x4F},
-    {0x29, 0x02, 0x4F},
-    {0x38, 0x03, 0x4F},
-    {0x03, 0x02, 0x50},
-    {0x06, 0x02, 0x50},
-    {0x0A, 0x02, 0x50},
-    {0x0F, 0x02, 0x50},
-    {0x18, 0x02, 0x50},
-    {0x1F, 0x02, 0x50},
-    {0x29, 0x02, 0x50},
-    {0x38, 0x03, 0x50},
-  },
-  /* 53 */
-  {
-    {0x02, 0x02, 0x51},
-    {0x09, 0x02, 0x51},
-    {0x17, 0x02, 0x51},
-    {0x28, 0x03, 0x51},
-    {0x02, 0x02, 0x52},
-    {0x09, 0x02, 0x52},
-    {0x17, 0x02, 0x52},
-    {0x28, 0x03, 0x52},
-    {0x02, 0x02, 0x53},
-    {0x09, 0x02, 0x53},
-    {0x17, 0x02, 0x53},
-    {0x28, 0x03, 0x53},
-    {0x02, 0x02, 0x54},
-    {0x09, 0x02, 0x54},
-    {0x17, 0x02, 0x54},
-    {0x28, 0x03, 0x54},
-  },
-  /* 54 */
-  {
-    {0x03, 0x02, 0x51},
-    {0x06, 0x02, 0x51},
-    {0x0A, 0x02, 0x51},
-    {0x0F, 0x02, 0x51},
-    {0x18, 0x02, 0x51},
-    {0x1F, 0x02, 0x51},
-    {0x29, 0x02, 0x51},
-    {0x38, 0x03, 0x51},
-    {0x03, 0x02, 0x52},
-    {0x06, 0x02, 0x52},
-    {0x0A, 0x02, 0x52},
-    {0x0F, 0x02, 0x52},
-    {0x18, 0x02, 0x52},
-    {0x1F, 0x02, 0x52},
-    {0x29, 0x02, 0x52},
-    {0x38, 0x03, 0x52},
-  },
-  /* 55 */
-  {
-    {0x03, 0x02, 0x53},
-    {0x06, 0x02, 0x53},
-    {0x0A, 0x02, 0x53},
-    {0x0F, 0x02, 0x53},
-    {0x18, 0x02, 0x53},
-    {0x1F, 0x02, 0x53},
-    {0x29, 0x02, 0x53},
-    {0x38, 0x03, 0x53},
-    {0x03, 0x02, 0x54},
-    {0x06, 0x02, 0x54},
-    {0x0A, 0x02, 0x54},
-    {0x0F, 0x02, 0x54},
-    {0x18, 0x02, 0x54},
-    {0x1F, 0x02, 0x54},
-    {0x29, 0x02, 0x54},
-    {0x38, 0x03, 0x54},
-  },
-  /* 56 */
-  {
-    {0x00, 0x03, 0x55},
-    {0x00, 0x03, 0x56},
-    {0x00, 0x03, 0x57},
-    {0x00, 0x03, 0x59},
-    {0x00, 0x03, 0x6A},
-    {0x00, 0x03, 0x6B},
-    {0x00, 0x03, 0x71},
-    {0x00, 0x03, 0x76},
-    {0x00, 0x03, 0x77},
-    {0x00, 0x03, 0x78},
-    {0x00, 0x03, 0x79},
-    {0x00, 0x03, 0x7A},
-    {0x46, 0x00, 0x00},
-    {0x47, 0x00, 0x00},
-    {0x49, 0x00, 0x00},
-    {0x4A, 0x01, 0x00},
-  },
-  /* 57 */
-  {
-    {0x01, 0x02, 0x55},
-    {0x16, 0x03, 0x55},
-    {0x01, 0x02, 0x56},
-    {0x16, 0x03, 0x56},
-    {0x01, 0x02, 0x57},
-    {0x16, 0x03, 0x57},
-    {0x01, 0x02, 0x59},
-    {0x16, 0x03, 0x59},
-    {0x01, 0x02, 0x6A},
-    {0x16, 0x03, 0x6A},
-    {0x01, 0x02, 0x6B},
-    {0x16, 0x03, 0x6B},
-    {0x01, 0x02, 0x71},
-    {0x16, 0x03, 0x71},
-    {0x01, 0x02, 0x76},
-    {0x16, 0x03, 0x76},
-  },
-  /* 58 */
-  {
-    {0x02, 0x02, 0x55},
-    {0x09, 0x02, 0x55},
-    {0x17, 0x02, 0x55},
-    {0x28, 0x03, 0x55},
-    {0x02, 0x02, 0x56},
-    {0x09, 0x02, 0x56},
-    {0x17, 0x02, 0x56},
-    {0x28, 0x03, 0x56},
-    {0x02, 0x02, 0x57},
-    {0x09, 0x02, 0x57},
-    {0x17, 0x02, 0x57},
-    {0x28, 0x03, 0x57},
-    {0x02, 0x02, 0x59},
-    {0x09, 0x02, 0x59},
-    {0x17, 0x02, 0x59},
-    {0x28, 0x03, 0x59},
-  },
-  /* 59 */
-  {
-    {0x03, 0x02, 0x55},
-    {0x06, 0x02, 0x55},
-    {0x0A, 0x02, 0x55},
-    {0x0F, 0x02, 0x55},
-    {0x18, 0x02, 0x55},
-    {0x1F, 0x02, 0x55},
-    {0x29, 0x02, 0x55},
-    {0x38, 0x03, 0x55},
-    {0x03, 0x02, 0x56},
-    {0x06, 0x02, 0x56},
-    {0x0A, 0x02, 0x56},
-    {0x0F, 0x02, 0x56},
-    {0x18, 0x02, 0x56},
-    {0x1F, 0x02, 0x56},
-    {0x29, 0x02, 0x56},
-    {0x38, 0x03, 0x56},
-  },
-  /* 60 */
-  {
-    {0x03, 0x02, 0x57},
-    {0x06, 0x02, 0x57},
-    {0x0A, 0x02, 0x57},
-    {0x0F, 0x02, 0x57},
-    {0x18, 0x02, 0x57},
-    {0x1F, 0x02, 0x57},
-    {0x29, 0x02, 0x57},
-    {0x38, 0x03, 0x57},
-    {0x03, 0x02, 0x59},
-    {0x06, 0x02, 0x59},
-    {0x0A, 0x02, 0x59},
-    {0x0F, 0x02, 0x59},
-    {0x18, 0x02, 0x59},
-    {0x1F, 0x02, 0x59},
-    {0x29, 0x02, 0x59},
-    {0x38, 0x03, 0x59},
-  },
-  /* 61 */
-  {
-    {0x02, 0x02, 0x6A},
-    {0x09, 0x02, 0x6A},
-    {0x17, 0x02, 0x6A},
-    {0x28, 0x03, 0x6A},
-    {0x02, 0x02, 0x6B},
-    {0x09, 0x02, 0x6B},
-    {0x17, 0x02, 0x6B},
-    {0x28, 0x03, 0x6B},
-    {0x02, 0x02, 0x71},
-    {0x09, 0x02, 0x71},
-    {0x17, 0x02, 0x71},
-    {0x28, 0x03, 0x71},
-    {0x02, 0x02, 0x76},
-    {0x09, 0x02, 0x76},
-    {0x17, 0x02, 0x76},
-    {0x28, 0x03, 0x76},
-  },
-  /* 62 */
-  {
-    {0x03, 0x02, 0x6A},
-    {0x06, 0x02, 0x6A},
-    {0x0A, 0x02, 0x6A},
-    {0x0F, 0x02, 0x6A},
-    {0x18, 0x02, 0x6A},
-    {0x1F, 0x02, 0x6A},
-    {0x29, 0x02, 0x6A},
-    {0x38, 0x03, 0x6A},
-    {0x03, 0x02, 0x6B},
-    {0x06, 0x02, 0x6B},
-    {0x0A, 0x02, 0x6B},
-    {0x0F, 0x02, 0x6B},
-    {0x18, 0x02, 0x6B},
-    {0x1F, 0x02, 0x6B},
-    {0x29, 0x02, 0x6B},
-    {0x38, 0x03, 0x6B},
-  },
-  /* 63 */
-  {
-    {0x03, 0x02, 0x71},
-    {0x06, 0x02, 0x71},
-    {0x0A, 0x02, 0x71},
-    {0x0F, 0x02, 0x71},
-    {0x18, 0x02, 0x71},
-    {0x1F, 0x02, 0x71},
-    {0x29, 0x02, 0x71},
-    {0x38, 0x03, 0x71},
-    {0x03, 0x02, 0x76},
-    {0x06, 0x02, 0x76},
-    {0x0A, 0x02, 0x76},
-    {0x0F, 0x02, 0x76},
-    {0x18, 0x02, 0x76},
-    {0x1F, 0x02, 0x76},
-    {0x29, 0x02, 0x76},
-    {0x38, 0x03, 0x76},
-  },
-  /* 64 */
-  {
-    {0x01, 0x02, 0x77},
-    {0x16, 0x03, 0x77},
-    {0x01, 0x02, 0x78},
-    {0x16, 0x03, 0x78},
-    {0x01, 0x02, 0x79},
-    {0x16, 0x03, 0x79},
-    {0x01, 0x02, 0x7A},
-    {0x16, 0x03, 0x7A},
-    {0x00, 0x03, 0x26},
-    {0x00, 0x03, 0x2A},
-    {0x00, 0x03, 0x2C},
-    {0x00, 0x03, 0x3B},
-    {0x00, 0x03, 0x58},
-    {0x00, 0x03, 0x5A},
-    {0x4B, 0x00, 0x00},
-    {0x4E, 0x00, 0x00},
-  },
-  /* 65 */
-  {
-    {0x02, 0x02, 0x77},
-    {0x09, 0x02, 0x77},
-    {0x17, 0x02, 0x77},
-    {0x28, 0x03, 0x77},
-    {0x02, 0x02, 0x78},
-    {0x09, 0x02, 0x78},
-    {0x17, 0x02, 0x78},
-    {0x28, 0x03, 0x78},
-    {0x02, 0x02, 0x79},
-    {0x09, 0x02, 0x79},
-    {0x17, 0x02, 0x79},
-    {0x28, 0x03, 0x79},
-    {0x02, 0x02, 0x7A},
-    {0x09, 0x02, 0x7A},
-    {0x17, 0x02, 0x7A},
-    {0x28, 0x03, 0x7A},
-  },
-  /* 66 */
-  {
-    {0x03, 0x02, 0x77},
-    {0x06, 0x02, 0x77},
-    {0x0A, 0x02, 0x77},
-    {0x0F, 0x02, 0x77},
-    {0x18, 0x02, 0x77},
-    {0x1F, 0x02, 0x77},
-    {0x29, 0x02, 0x77},
-    {0x38, 0x03, 0x77},
-    {0x03, 0x02, 0x78},
-    {0x06, 0x02, 0x78},
-    {0x0A, 0x02, 0x78},
-    {0x0F, 0x02, 0x78},
-    {0x18, 0x02, 0x78},
-    {0x1F, 0x02, 0x78},
-    {0x29, 0x02, 0x78},
-    {0x38, 0x03, 0x78},
-  },
-  /* 67 */
-  {
-    {0x03, 0x02, 0x79},
-    {0x06, 0x02, 0x79},
-    {0x0A, 0x02, 0x79},
-    {0x0F, 0x02, 0x79},
-    {0x18, 0x02, 0x79},
-    {0x1F, 0x02, 0x79},
-    {0x29, 0x02, 0x79},
-    {0x38, 0x03, 0x79},
-    {0x03, 0x02, 0x7A},
-    {0x06, 0x02, 0x7A},
-    {0x0A, 0x02, 0x7A},
-    {0x0F, 0x02, 0x7A},
-    {0x18, 0x02, 0x7A},
-    {0x1F, 0x02, 0x7A},
-    {0x29, 0x02, 0x7A},
-    {0x38, 0x03, 0x7A},
-  },
-  /* 68 */
-  {
-    {0x01, 0x02, 0x26},
-    {0x16, 0x03, 0x26},
-    {0x01, 0x02, 0x2A},
-    {0x16, 0x03, 0x2A},
-    {0x01, 0x02, 0x2C},
-    {0x16, 0x03, 0x2C},
-    {0x01, 0x02, 0x3B},
-    {0x16, 0x03, 0x3B},
-    {0x01, 0x02, 0x58},
-    {0x16, 0x03, 0x58},
-    {0x01, 0x02, 0x5A},
-    {0x16, 0x03, 0x5A},
-    {0x4C, 0x00, 0x00},
-    {0x4D, 0x00, 0x00},
-    {0x4F, 0x00, 0x00},
-    {0x51, 0x00, 0x00},
-  },
-  /* 69 */
-  {
-    {0x02, 0x02, 0x26},
-    {0x09, 0x02, 0x26},
-    {0x17, 0x02, 0x26},
-    {0x28, 0x03, 0x26},
-    {0x02, 0x02, 0x2A},
-    {0x09, 0x02, 0x2A},
-    {0x17, 0x02, 0x2A},
-    {0x28, 0x03, 0x2A},
-    {0x02, 0x02, 0x2C},
-    {0x09, 0x02, 0x2C},
-    {0x17, 0x02, 0x2C},
-    {0x28, 0x03, 0x2C},
-    {0x02, 0x02, 0x3B},
-    {0x09, 0x02, 0x3B},
-    {0x17, 0x02, 0x3B},
-    {0x28, 0x03, 0x3B},
-  },
-  /* 70 */
-  {
-    {0x03, 0x02, 0x26},
-    {0x06, 0x02, 0x26},
-    {0x0A, 0x02, 0x26},
-    {0x0F, 0x02, 0x26},
-    {0x18, 0x02, 0x26},
-    {0x1F, 0x02, 0x26},
-    {0x29, 0x02, 0x26},
-    {0x38, 0x03, 0x26},
-    {0x03, 0x02, 0x2A},
-    {0x06, 0x02, 0x2A},
-    {0x0A, 0x02, 0x2A},
-    {0x0F, 0x02, 0x2A},
-    {0x18, 0x02, 0x2A},
-    {0x1F, 0x02, 0x2A},
-    {0x29, 0x02, 0x2A},
-    {0x38, 0x03, 0x2A},
-  },
-  /* 71 */
-  {
-    {0x03, 0x02, 0x2C},
-    {0x06, 0x02, 0x2C},
-    {0x0A, 0x02, 0x2C},
-    {0x0F, 0x02, 0x2C},
-    {0x18, 0x02, 0x2C},
-    {0x1F, 0x02, 0x2C},
-    {0x29, 0x02, 0x2C},
-    {0x38, 0x03, 0x2C},
-    {0x03, 0x02, 0x3B},
-    {0x06, 0x02, 0x3B},
-    {0x0A, 0x02, 0x3B},
-    {0x0F, 0x02, 0x3B},
-    {0x18, 0x02, 0x3B},
-    {0x1F, 0x02, 0x3B},
-    {0x29, 0x02, 0x3B},
-    {0x38, 0x03, 0x3B},
-  },
-  /* 72 */
-  {
-    {0x02, 0x02, 0x58},
-    {0x09, 0x02, 0x58},
-    {0x17, 0x02, 0x58},
-    {0x28, 0x03, 0x58},
-    {0x02, 0x02, 0x5A},
-    {0x09, 0x02, 0x5A},
-    {0x17, 0x02, 0x5A},
-    {0x28, 0x03, 0x5A},
-    {0x00, 0x03, 0x21},
-    {0x00, 0x03, 0x22},
-    {0x00, 0x03, 0x28},
-    {0x00, 0x03, 0x29},
-    {0x00, 0x03, 0x3F},
-    {0x50, 0x00, 0x00},
-    {0x52, 0x00, 0x00},
-    {0x54, 0x00, 0x00},
-  },
-  /* 73 */
-  {
-    {0x03, 0x02, 0x58},
-    {0x06, 0x02, 0x58},
-    {0x0A, 0x02, 0x58},
-    {0x0F, 0x02, 0x58},
-    {0x18, 0x02, 0x58},
-    {0x1F, 0x02, 0x58},
-    {0x29, 0x02, 0x58},
-    {0x38, 0x03, 0x58},
-    {0x03, 0x02, 0x5A},
-    {0x06, 0x02, 0x5A},
-    {0x0A, 0x02, 0x5A},
-    {0x0F, 0x02, 0x5A},
-    {0x18, 0x02, 0x5A},
-    {0x1F, 0x02, 0x5A},
-    {0x29, 0x02, 0x5A},
-    {0x38, 0x03, 0x5A},
-  },
-  /* 74 */
-  {
-    {0x01, 0x02, 0x21},
-    {0x16, 0x03, 0x21},
-    {0x01, 0x02, 0x22},
-    {0x16, 0x03, 0x22},
-    {0x01, 0x02, 0x28},
-    {0x16, 0x03, 0x28},
-    {0x01, 0x02, 0x29},
-    {0x16, 0x03, 0x29},
-    {0x01, 0x02, 0x3F},
-    {0x16, 0x03, 0x3F},
-    {0x00, 0x03, 0x27},
-    {0x00, 0x03, 0x2B},
-    {0x00, 0x03, 0x7C},
-    {0x53, 0x00, 0x00},
-    {0x55, 0x00, 0x00},
-    {0x58, 0x00, 0x00},
-  },
-  /* 75 */
-  {
-    {0x02, 0x02, 0x21},
-    {0x09, 0x02, 0x21},
-    {0x17, 0x02, 0x21},
-    {0x28, 0x03, 0x21},
-    {0x02, 0x02, 0x22},
-    {0x09, 0x02, 0x22},
-    {0x17, 0x02, 0x22},
-    {0x28, 0x03, 0x22},
-    {0x02, 0x02, 0x28},
-    {0x09, 0x02, 0x28},
-    {0x17, 0x02, 0x28},
-    {0x28, 0x03, 0x28},
-    {0x02, 0x02, 0x29},
-    {0x09, 0x02, 0x29},
-    {0x17, 0x02, 0x29},
-    {0x28, 0x03, 0x29},
-  },
-  /* 76 */
-  {
-    {0x03, 0x02, 0x21},
-    {0x06, 0x02, 0x21},
-    {0x0A, 0x02, 0x21},
-    {0x0F, 0x02, 0x21},
-    {0x18, 0x02, 0x21},
-    {0x1F, 0x02, 0x21},
-    {0x29, 0x02, 0x21},
-    {0x38, 0x03, 0x21},
-    {0x03, 0x02, 0x22},
-    {0x06, 0x02, 0x22},
-    {0x0A, 0x02, 0x22},
-    {0x0F, 0x02, 0x22},
-    {0x18, 0x02, 0x22},
-    {0x1F, 0x02, 0x22},
-    {0x29, 0x02, 0x22},
-    {0x38, 0x03, 0x22},
-  },
-  /* 77 */
-  {
-    {0x03, 0x02, 0x28},
-    {0x06, 0x02, 0x28},
-    {0x0A, 0x02, 0x28},
-    {0x0F, 0x02, 0x28},
-    {0x18, 0x02, 0x28},
-    {0x1F, 0x02, 0x28},
-    {0x29, 0x02, 0x28},
-    {0x38, 0x03, 0x28},
-    {0x03, 0x02, 0x29},
-    {0x06, 0x02, 0x29},
-    {0x0A, 0x02, 0x29},
-    {0x0F, 0x02, 0x29},
-    {0x18, 0x02, 0x29},
-    {0x1F, 0x02, 0x29},
-    {0x29, 0x02, 0x29},
-    {0x38, 0x03, 0x29},
-  },
-  /* 78 */
-  {
-    {0x02, 0x02, 0x3F},
-    {0x09, 0x02, 0x3F},
-    {0x17, 0x02, 0x3F},
-    {0x28, 0x03, 0x3F},
-    {0x01, 0x02, 0x27},
-    {0x16, 0x03, 0x27},
-    {0x01, 0x02, 0x2B},
-    {0x16, 0x03, 0x2B},
-    {0x01, 0x02, 0x7C},
-    {0x16, 0x03, 0x7C},
-    {0x00, 0x03, 0x23},
-    {0x00, 0x03, 0x3E},
-    {0x56, 0x00, 0x00},
-    {0x57, 0x00, 0x00},
-    {0x59, 0x00, 0x00},
-    {0x5A, 0x00, 0x00},
-  },
-  /* 79 */
-  {
-    {0x03, 0x02, 0x3F},
-    {0x06, 0x02, 0x3F},
-    {0x0A, 0x02, 0x3F},
-    {0x0F, 0x02, 0x3F},
-    {0x18, 0x02, 0x3F},
-    {0x1F, 0x02, 0x3F},
-    {0x29, 0x02, 0x3F},
-    {0x38, 0x03, 0x3F},
-    {0x02, 0x02, 0x27},
-    {0x09, 0x02, 0x27},
-    {0x17, 0x02, 0x27},
-    {0x28, 0x03, 0x27},
-    {0x02, 0x02, 0x2B},
-    {0x09, 0x02, 0x2B},
-    {0x17, 0x02, 0x2B},
-    {0x28, 0x03, 0x2B},
-  },
-  /* 80 */
-  {
-    {0x03, 0x02, 0x27},
-    {0x06, 0x02, 0x27},
-    {0x0A, 0x02, 0x27},
-    {0x0F, 0x02, 0x27},
-    {0x18, 0x02, 0x27},
-    {0x1F, 0x02, 0x27},
-    {0x29, 0x02, 0x27},
-    {0x38, 0x03, 0x27},
-    {0x03, 0x02, 0x2B},
-    {0x06, 0x02, 0x2B},
-    {0x0A, 0x02, 0x2B},
-    {0x0F, 0x02, 0x2B},
-    {0x18, 0x02, 0x2B},
-    {0x1F, 0x02, 0x2B},
-    {0x29, 0x02, 0x2B},
-    {0x38, 0x03, 0x2B},
-  },
-  /* 81 */
-  {
-    {0x02, 0x02, 0x7C},
-    {0x09, 0x02, 0x7C},
-    {0x17, 0x02, 0x7C},
-    {0x28, 0x03, 0x7C},
-    {0x01, 0x02, 0x23},
-    {0x16, 0x03, 0x23},
-    {0x01, 0x02, 0x3E},
-    {0x16, 0x03, 0x3E},
-    {0x00, 0x03, 0x00},
-    {0x00, 0x03, 0x24},
-    {0x00, 0x03, 0x40},
-    {0x00, 0x03, 0x5B},
-    {0x00, 0x03, 0x5D},
-    {0x00, 0x03, 0x7E},
-    {0x5B, 0x00, 0x00},
-    {0x5C, 0x00, 0x00},
-  },
-  /* 82 */
-  {
-    {0x03, 0x02, 0x7C},
-    {0x06, 0x02, 0x7C},
-    {0x0A, 0x02, 0x7C},
-    {0x0F, 0x02, 0x7C},
-    {0x18, 0x02, 0x7C},
-    {0x1F, 0x02, 0x7C},
-    {0x29, 0x02, 0x7C},
-    {0x38, 0x03, 0x7C},
-    {0x02, 0x02, 0x23},
-    {0x09, 0x02, 0x23},
-    {0x17, 0x02, 0x23},
-    {0x28, 0x03, 0x23},
-    {0x02, 0x02, 0x3E},
-    {0x09, 0x02, 0x3E},
-    {0x17, 0x02, 0x3E},
-    {0x28, 0x03, 0x3E},
-  },
-  /* 83 */
-  {
-    {0x03, 0x02, 0x23},
-    {0x06, 0x02, 0x23},
-    {0x0A, 0x02, 0x23},
-    {0x0F, 0x02, 0x23},
-    {0x18, 0x02, 0x23},
-    {0x1F, 0x02, 0x23},
-    {0x29, 0x02, 0x23},
-    {0x38, 0x03, 0x23},
-    {0x03, 0x02, 0x3E},
-    {0x06, 0x02, 0x3E},
-    {0x0A, 0x02, 0x3E},
-    {0x0F, 0x02, 0x3E},
-    {0x18, 0x02, 0x3E},
-    {0x1F, 0x02, 0x3E},
-    {0x29, 0x02, 0x3E},
-    {0x38, 0x03, 0x3E},
-  },
-  /* 84 */
-  {
-    {0x01, 0x02, 0x00},
-    {0x16, 0x03, 0x00},
-    {0x01, 0x02, 0x24},
-    {0x16, 0x03, 0x24},
-    {0x01, 0x02, 0x40},
-    {0x16, 0x03, 0x40},
-    {0x01, 0x02, 0x5B},
-    {0x16, 0x03, 0x5B},
-    {0x01, 0x02, 0x5D},
-    {0x16, 0x03, 0x5D},
-    {0x01, 0x02, 0x7E},
-    {0x16, 0x03, 0x7E},
-    {0x00, 0x03, 0x5E},
-    {0x00, 0x03, 0x7D},
-    {0x5D, 0x00, 0x00},
-    {0x5E, 0x00, 0x00},
-  },
-  /* 85 */
-  {
-    {0x02, 0x02, 0x00},
-    {0x09, 0x02, 0x00},
-    {0x17, 0x02, 0x00},
-    {0x28, 0x03, 0x00},
-    {0x02, 0x02, 0x24},
-    {0x09, 0x02, 0x24},
-    {0x17, 0x02, 0x24},
-    {0x28, 0x03, 0x24},
-    {0x02, 0x02, 0x40},
-    {0x09, 0x02, 0x40},
-    {0x17, 0x02, 0x40},
-    {0x28, 0x03, 0x40},
-    {0x02, 0x02, 0x5B},
-    {0x09, 0x02, 0x5B},
-    {0x17, 0x02, 0x5B},
-    {0x28, 0x03, 0x5B},
-  },
-  /* 86 */
-  {
-    {0x03, 0x02, 0x00},
-    {0x06, 0x02, 0x00},
-    {0x0A, 0x02, 0x00},
-    {0x0F, 0x02, 0x00},
-    {0x18, 0x02, 0x00},
-    {0x1F, 0x02, 0x00},
-    {0x29, 0x02, 0x00},
-    {0x38, 0x03, 0x00},
-    {0x03, 0x02, 0x24},
-    {0x06, 0x02, 0x24},
-    {0x0A, 0x02, 0x24},
-    {0x0F, 0x02, 0x24},
-    {0x18, 0x02, 0x24},
-    {0x1F, 0x02, 0x24},
-    {0x29, 0x02, 0x24},
-    {0x38, 0x03, 0x24},
-  },
-  /* 87 */
-  {
-    {0x03, 0x02, 0x40},
-    {0x06, 0x02, 0x40},
-    {0x0A, 0x02, 0x40},
-    {0x0F, 0x02, 0x40},
-    {0x18, 0x02, 0x40},
-    {0x1F, 0x02, 0x40},
-    {0x29, 0x02, 0x40},
-    {0x38, 0x03, 0x40},
-    {0x03, 0x02, 0x5B},
-    {0x06, 0x02, 0x5B},
-    {0x0A, 0x02, 0x5B},
-    {0x0F, 0x02, 0x5B},
-    {0x18, 0x02, 0x5B},
-    {0x1F, 0x02, 0x5B},
-    {0x29, 0x02, 0x5B},
-    {0x38, 0x03, 0x5B},
-  },
-  /* 88 */
-  {
-    {0x02, 0x02, 0x5D},
-    {0x09, 0x02, 0x5D},
-    {0x17, 0x02, 0x5D},
-    {0x28, 0x03, 0x5D},
-    {0x02, 0x02, 0x7E},
-    {0x09, 0x02, 0x7E},
-    {0x17, 0x02, 0x7E},
-    {0x28, 0x03, 0x7E},
-    {0x01, 0x02, 0x5E},
-    {0x16, 0x03, 0x5E},
-    {0x01, 0x02, 0x7D},
-    {0x16, 0x03, 0x7D},
-    {0x00, 0x03, 0x3C},
-    {0x00, 0x03, 0x60},
-    {0x00, 0x03, 0x7B},
-    {0x5F, 0x00, 0x00},
-  },
-  /* 89 */
-  {
-    {0x03, 0x02, 0x5D},
-    {0x06, 0x02, 0x5D},
-    {0x0A, 0x02, 0x5D},
-    {0x0F, 0x02, 0x5D},
-    {0x18, 0x02, 0x5D},
-    {0x1F, 0x02, 0x5D},
-    {0x29, 0x02, 0x5D},
-    {0x38, 0x03, 0x5D},
-    {0x03, 0x02, 0x7E},
-    {0x06, 0x02, 0x7E},
-    {0x0A, 0x02, 0x7E},
-    {0x0F, 0x02, 0x7E},
-    {0x18, 0x02, 0x7E},
-    {0x1F, 0x02, 0x7E},
-    {0x29, 0x02, 0x7E},
-    {0x38, 0x03, 0x7E},
-  },
-  /* 90 */
-  {
-    {0x02, 0x02, 0x5E},
-    {0x09, 0x02, 0x5E},
-    {0x17, 0x02, 0x5E},
-    {0x28, 0x03, 0x5E},
-    {0x02, 0x02, 0x7D},
-    {0x09, 0x02, 0x7D},
-    {0x17, 0x02, 0x7D},
-    {0x28, 0x03, 0x7D},
-    {0x01, 0x02, 0x3C},
-    {0x16, 0x03, 0x3C},
-    {0x01, 0x02, 0x60},
-    {0x16, 0x03, 0x60},
-    {0x01, 0x02, 0x7B},
-    {0x16, 0x03, 0x7B},
-    {0x60, 0x00, 0x00},
-    {0x6E, 0x00, 0x00},
-  },
-  /* 91 */
-  {
-    {0x03, 0x02, 0x5E},
-    {0x06, 0x02, 0x5E},
-    {0x0A, 0x02, 0x5E},
-    {0x0F, 0x02, 0x5E},
-    {0x18, 0x02, 0x5E},
-    {0x1F, 0x02, 0x5E},
-    {0x29, 0x02, 0x5E},
-    {0x38, 0x03, 0x5E},
-    {0x03, 0x02, 0x7D},
-    {0x06, 0x02, 0x7D},
-    {0x0A, 0x02, 0x7D},
-    {0x0F, 0x02, 0x7D},
-    {0x18, 0x02, 0x7D},
-    {0x1F, 0x02, 0x7D},
-    {0x29, 0x02, 0x7D},
-    {0x38, 0x03, 0x7D},
-  },
-  /* 92 */
-  {
-    {0x02, 0x02, 0x3C},
-    {0x09, 0x02, 0x3C},
-    {0x17, 0x02, 0x3C},
-    {0x28, 0x03, 0x3C},
-    {0x02, 0x02, 0x60},
-    {0x09, 0x02, 0x60},
-    {0x17, 0x02, 0x60},
-    {0x28, 0x03, 0x60},
-    {0x02, 0x02, 0x7B},
-    {0x09, 0x02, 0x7B},
-    {0x17, 0x02, 0x7B},
-    {0x28, 0x03, 0x7B},
-    {0x61, 0x00, 0x00},
-    {0x65, 0x00, 0x00},
-    {0x6F, 0x00, 0x00},
-    {0x85, 0x00, 0x00},
-  },
-  /* 93 */
-  {
-    {0x03, 0x02, 0x3C},
-    {0x06, 0x02, 0x3C},
-    {0x0A, 0x02, 0x3C},
-    {0x0F, 0x02, 0x3C},
-    {0x18, 0x02, 0x3C},
-    {0x1F, 0x02, 0x3C},
-    {0x29, 0x02, 0x3C},
-    {0x38, 0x03, 0x3C},
-    {0x03, 0x02, 0x60},
-    {0x06, 0x02, 0x60},
-    {0x0A, 0x02, 0x60},
-    {0x0F, 0x02, 0x60},
-    {0x18, 0x02, 0x60},
-    {0x1F, 0x02, 0x60},
-    {0x29, 0x02, 0x60},
-    {0x38, 0x03, 0x60},
-  },
-  /* 94 */
-  {
-    {0x03, 0x02, 0x7B},
-    {0x06, 0x02, 0x7B},
-    {0x0A, 0x02, 0x7B},
-    {0x0F, 0x02, 0x7B},
-    {0x18, 0x02, 0x7B},
-    {0x1F, 0x02, 0x7B},
-    {0x29, 0x02, 0x7B},
-    {0x38, 0x03, 0x7B},
-    {0x62, 0x00, 0x00},
-    {0x63, 0x00, 0x00},
-    {0x66, 0x00, 0x00},
-    {0x69, 0x00, 0x00},
-    {0x70, 0x00, 0x00},
-    {0x77, 0x00, 0x00},
-    {0x86, 0x00, 0x00},
-    {0x99, 0x00, 0x00},
-  },
-  /* 95 */
-  {
-    {0x00, 0x03, 0x5C},
-    {0x00, 0x03, 0xC3},
-    {0x00, 0x03, 0xD0},
-    {0x64, 0x00, 0x00},
-    {0x67, 0x00, 0x00},
-    {0x68, 0x00, 0x00},
-    {0x6A, 0x00, 0x00},
-    {0x6B, 0x00, 0x00},
-    {0x71, 0x00, 0x00},
-    {0x74, 0x00, 0x00},
-    {0x78, 0x00, 0x00},
-    {0x7E, 0x00, 0x00},
-    {0x87, 0x00, 0x00},
-    {0x8E, 0x00, 0x00},
-    {0x9A, 0x00, 0x00},
-    {0xA9, 0x00, 0x00},
-  },
-  /* 96 */
-  {
-    {0x01, 0x02, 0x5C},
-    {0x16, 0x03, 0x5C},
-    {0x01, 0x02, 0xC3},
-    {0x16, 0x03, 0xC3},
-    {0x01, 0x02, 0xD0},
-    {0x16, 0x03, 0xD0},
-    {0x00, 0x03, 0x80},
-    {0x00, 0x03, 0x82},
-    {0x00, 0x03, 0x83},
-    {0x00, 0x03, 0xA2},
-    {0x00, 0x03, 0xB8},
-    {0x00, 0x03, 0xC2},
-    {0x00, 0x03, 0xE0},
-    {0x00, 0x03, 0xE2},
-    {0x6C, 0x00, 0x00},
-    {0x6D, 0x00, 0x00},
-  },
-  /* 97 */
-  {
-    {0x02, 0x02, 0x5C},
-    {0x09, 0x02, 0x5C},
-    {0x17, 0x02, 0x5C},
-    {0x28, 0x03, 0x5C},
-    {0x02, 0x02, 0xC3},
-    {0x09, 0x02, 0xC3},
-    {0x17, 0x02, 0xC3},
-    {0x28, 0x03, 0xC3},
-    {0x02, 0x02, 0xD0},
-    {0x09, 0x02, 0xD0},
-    {0x17, 0x02, 0xD0},
-    {0x28, 0x03, 0xD0},
-    {0x01, 0x02, 0x80},
-    {0x16, 0x03, 0x80},
-    {0x01, 0x02, 0x82},
-    {0x16, 0x03, 0x82},
-  },
-  /* 98 */
-  {
-    {0x03, 0x02, 0x5C},
-    {0x06, 0x02, 0x5C},
-    {0x0A, 0x02, 0x5C},
-    {0x0F, 0x02, 0x5C},
-    {0x18, 0x02, 0x5C},
-    {0x1F, 0x02, 0x5C},
-    {0x29, 0x02, 0x5C},
-    {0x38, 0x03, 0x5C},
-    {0x03, 0x02, 0xC3},
-    {0x06, 0x02, 0xC3},
-    {0x0A, 0x02, 0xC3},
-    {0x0F, 0x02, 0xC3},
-    {0x18, 0x02, 0xC3},
-    {0x1F, 0x02, 0xC3},
-    {0x29, 0x02, 0xC3},
-    {0x38, 0x03, 0xC3},
-  },
-  /* 99 */
-  {
-    {0x03, 0x02, 0xD0},
-    {0x06, 0x02, 0xD0},
-    {0x0A, 0x02, 0xD0},
-    {0x0F, 0x02, 0xD0},
-    {0x18, 0x02, 0xD0},
-    {0x1F, 0x02, 0xD0},
-    {0x29, 0x02, 0xD0},
-    {0x38, 0x03, 0xD0},
-    {0x02, 0x02, 0x80},
-    {0x09, 0x02, 0x80},
-    {0x17, 0x02, 0x80},
-    {0x28, 0x03, 0x80},
-    {0x02, 0x02, 0x82},
-    {0x09, 0x02, 0x82},
-    {0x17, 0x02, 0x82},
-    {0x28, 0x03, 0x82},
-  },
-  /* 100 */
-  {
-    {0x03, 0x02, 0x80},
-    {0x06, 0x02, 0x80},
-    {0x0A, 0x02, 0x80},
-    {0x0F, 0x02, 0x80},
-    {0x18, 0x02, 0x80},
-    {0x1F, 0x02, 0x80},
-    {0x29, 0x02, 0x80},
-    {0x38, 0x03, 0x80},
-    {0x03, 0x02, 0x82},
-    {0x06, 0x02, 0x82},
-    {0x0A, 0x02, 0x82},
-    {0x0F, 0x02, 0x82},
-    {0x18, 0x02, 0x82},
-    {0x1F, 0x02, 0x82},
-    {0x29, 0x02, 0x82},
-    {0x38, 0x03, 0x82},
-  },
-  /* 101 */
-  {
-    {0x01, 0x02, 0x83},
-    {0x16, 0x03, 0x83},
-    {0x01, 0x02, 0xA2},
-    {0x16, 0x03, 0xA2},
-    {0x01, 0x02, 0xB8},
-    {0x16, 0x03, 0xB8},
-    {0x01, 0x02, 0xC2},
-    {0x16, 0x03, 0xC2},
-    {0x01, 0x02, 0xE0},
-    {0x16, 0x03, 0xE0},
-    {0x01, 0x02, 0xE2},
-    {0x16, 0x03, 0xE2},
-    {0x00, 0x03, 0x99},
-    {0x00, 0x03, 0xA1},
-    {0x00, 0x03, 0xA7},
-    {0x00, 0x03, 0xAC},
-  },
-  /* 102 */
-  {
-    {0x02, 0x02, 0x83},
-    {0x09, 0x02, 0x83},
-    {0x17, 0x02, 0x83},
-    {0x28, 0x03, 0x83},
-    {0x02, 0x02, 0xA2},
-    {0x09, 0x02, 0xA2},
-    {0x17, 0x02, 0xA2},
-    {0x28, 0x03, 0xA2},
-    {0x02, 0x02, 0xB8},
-    {0x09, 0x02, 0xB8},
-    {0x17, 0x02, 0xB8},
-    {0x28, 0x03, 0xB8},
-    {0x02, 0x02, 0xC2},
-    {0x09, 0x02, 0xC2},
-    {0x17, 0x02, 0xC2},
-    {0x28, 0x03, 0xC2},
-  },
-  /* 103 */
-  {
-    {0x03, 0x02, 0x83},
-    {0x06, 0x02, 0x83},
-    {0x0A, 0x02, 0x83},
-    {0x0F, 0x02, 0x83},
-    {0x18, 0x02, 0x83},
-    {0x1F, 0x02, 0x83},
-    {0x29, 0x02, 0x83},
-    {0x38, 0x03, 0x83},
-    {0x03, 0x02, 0xA2},
-    {0x06, 0x02, 0xA2},
-    {0x0A, 0x02, 0xA2},
-    {0x0F, 0x02, 0xA2},
-    {0x18, 0x02, 0xA2},
-    {0x1F, 0x02, 0xA2},
-    {0x29, 0x02, 0xA2},
-    {0x38, 0x03, 0xA2},
-  },
-  /* 104 */
-  {
-    {0x03, 0x02, 0xB8},
-    {0x06, 0x02, 0xB8},
-    {0x0A, 0x02, 0xB8},
-    {0x0F, 0x02, 0xB8},
-    {0x18, 0x02, 0xB8},
-    {0x1F, 0x02, 0xB8},
-    {0x29, 0x02, 0xB8},
-    {0x38, 0x03, 0xB8},
-    {0x03, 0x02, 0xC2},
-    {0x06, 0x02, 0xC2},
-    {0x0A, 0x02, 0xC2},
-    {0x0F, 0x02, 0xC2},
-    {0x18, 0x02, 0xC2},
-    {0x1F, 0x02, 0xC2},
-    {0x29, 0x02, 0xC2},
-    {0x38, 0x03, 0xC2},
-  },
-  /* 105 */
-  {
-    {0x02, 0x02, 0xE0},
-    {0x09, 0x02, 0xE0},
-    {0x17, 0x02, 0xE0},
-    {0x28, 0x03, 0xE0},
-    {0x02, 0x02, 0xE2},
-    {0x09, 0x02, 0xE2},
-    {0x17, 0x02, 0xE2},
-    {0x28, 0x03, 0xE2},
-    {0x01, 0x02, 0x99},
-    {0x16, 0x03, 0x99},
-    {0x01, 0x02, 0xA1},
-    {0x16, 0x03, 0xA1},
-    {0x01, 0x02, 0xA7},
-    {0x16, 0x03, 0xA7},
-    {0x01, 0x02, 0xAC},
-    {0x16, 0x03, 0xAC},
-  },
-  /* 106 */
-  {
-    {0x03, 0x02, 0xE0},
-    {0x06, 0x02, 0xE0},
-    {0x0A, 0x02, 0xE0},
-    {0x0F, 0x02, 0xE0},
-    {0x18, 0x02, 0xE0},
-    {0x1F, 0x02, 0xE0},
-    {0x29, 0x02, 0xE0},
-    {0x38, 0x03, 0xE0},
-    {0x03, 0x02, 0xE2},
-    {0x06, 0x02, 0xE2},
-    {0x0A, 0x02, 0xE2},
-    {0x0F, 0x02, 0xE2},
-    {0x18, 0x02, 0xE2},
-    {0x1F, 0x02, 0xE2},
-    {0x29, 0x02, 0xE2},
-    {0x38, 0x03, 0xE2},
-  },
-  /* 107 */
-  {
-    {0x02, 0x02, 0x99},
-    {0x09, 0x02, 0x99},
-    {0x17, 0x02, 0x99},
-    {0x28, 0x03, 0x99},
-    {0x02, 0x02, 0xA1},
-    {0x09, 0x02, 0xA1},
-    {0x17, 0x02, 0xA1},
-    {0x28, 0x03, 0xA1},
-    {0x02, 0x02, 0xA7},
-    {0x09, 0x02, 0xA7},
-    {0x17, 0x02, 0xA7},
-    {0x28, 0x03, 0xA7},
-    {0x02, 0x02, 0xAC},
-    {0x09, 0x02, 0xAC},
-    {0x17, 0x02, 0xAC},
-    {0x28, 0x03, 0xAC},
-  },
-  /* 108 */
-  {
-    {0x03, 0x02, 0x99},
-    {0x06, 0x02, 0x99},
-    {0x0A, 0x02, 0x99},
-    {0x0F, 0x02, 0x99},
-    {0x18, 0x02, 0x99},
-    {0x1F, 0x02, 0x99},
-    {0x29, 0x02, 0x99},
-    {0x38, 0x03, 0x99},
-    {0x03, 0x02, 0xA1},
-    {0x06, 0x02, 0xA1},
-    {0x0A, 0x02, 0xA1},
-    {0x0F, 0x02, 0xA1},
-    {0x18, 0x02, 0xA1},
-    {0x1F, 0x02, 0xA1},
-    {0x29, 0x02, 0xA1},
-    {0x38, 0x03, 0xA1},
-  },
-  /* 109 */
-  {
-    {0x03, 0x02, 0xA7},
-    {0x06, 0x02, 0xA7},
-    {0x0A, 0x02, 0xA7},
-    {0x0F, 0x02, 0xA7},
-    {0x18, 0x02, 0xA7},
-    {0x1F, 0x02, 0xA7},
-    {0x29, 0x02, 0xA7},
-    {0x38, 0x03, 0xA7},
-    {0x03, 0x02, 0xAC},
-    {0x06, 0x02, 0xAC},
-    {0x0A, 0x02, 0xAC},
-    {0x0F, 0x02, 0xAC},
-    {0x18, 0x02, 0xAC},
-    {0x1F, 0x02, 0xAC},
-    {0x29, 0x02, 0xAC},
-    {0x38, 0x03, 0xAC},
-  },
-  /* 110 */
-  {
-    {0x72, 0x00, 0x00},
-    {0x73, 0x00, 0x00},
-    {0x75, 0x00, 0x00},
-    {0x76, 0x00, 0x00},
-    {0x79, 0x00, 0x00},
-    {0x7B, 0x00, 0x00},
-    {0x7F, 0x00, 0x00},
-    {0x82, 0x00, 0x00},
-    {0x88, 0x00, 0x00},
-    {0x8B, 0x00, 0x00},
-    {0x8F, 0x00, 0x00},
-    {0x92, 0x00, 0x00},
-    {0x9B, 0x00, 0x00},
-    {0xA2, 0x00, 0x00},
-    {0xAA, 0x00, 0x00},
-    {0xB4, 0x00, 0x00},
-  },
-  /* 111 */
-  {
-    {0x00, 0x03, 0xB0},
-    {0x00, 0x03, 0xB1},
-    {0x00, 0x03, 0xB3},
-    {0x00, 0x03, 0xD1},
-    {0x00, 0x03, 0xD8},
-    {0x00, 0x03, 0xD9},
-    {0x00, 0x03, 0xE3},
-    {0x00, 0x03, 0xE5},
-    {0x00, 0x03, 0xE6},
-    {0x7A, 0x00, 0x00},
-    {0x7C, 0x00, 0x00},
-    {0x7D, 0x00, 0x00},
-    {0x80, 0x00, 0x00},
-    {0x81, 0x00, 0x00},
-    {0x83, 0x00, 0x00},
-    {0x84, 0x00, 0x00},
-  },
-  /* 112 */
-  {
-    {0x01, 0x02, 0xB0},
-    {0x16, 0x03, 0xB0},
-    {0x01, 0x02, 0xB1},
-    {0x16, 0x03, 0xB1},
-    {0x01, 0x02, 0xB3},
-    {0x16, 0x03, 0xB3},
-    {0x01, 0x02, 0xD1},
-    {0x16, 0x03, 0xD1},
-    {0x01, 0x02, 0xD8},
-    {0x16, 0x03, 0xD8},
-    {0x01, 0x02, 0xD9},
-    {0x16, 0x03, 0xD9},
-    {0x01, 0x02, 0xE3},
-    {0x16, 0x03, 0xE3},
-    {0x01, 0x02, 0xE5},
-    {0x16, 0x03, 0xE5},
-  },
-  /* 113 */
-  {
-    {0x02, 0x02, 0xB0},
-    {0x09, 0x02, 0xB0},
-    {0x17, 0x02, 0xB0},
-    {0x28, 0x03, 0xB0},
-    {0x02, 0x02, 0xB1},
-    {0x09, 0x02, 0xB1},
-    {0x17, 0x02, 0xB1},
-    {0x28, 0x03, 0xB1},
-    {0x02, 0x02, 0xB3},
-    {0x09, 0x02, 0xB3},
-    {0x17, 0x02, 0xB3},
-    {0x28, 0x03, 0xB3},
-    {0x02, 0x02, 0xD1},
-    {0x09, 0x02, 0xD1},
-    {0x17, 0x02, 0xD1},
-    {0x28, 0x03, 0xD1},
-  },
-  /* 114 */
-  {
-    {0x03, 0x02, 0xB0},
-    {0x06, 0x02, 0xB0},
-    {0x0A, 0x02, 0xB0},
-    {0x0F, 0x02, 0xB0},
-    {0x18, 0x02, 0xB0},
-    {0x1F, 0x02, 0xB0},
-    {0x29, 0x02, 0xB0},
-    {0x38, 0x03, 0xB0},
-    {0x03, 0x02, 0xB1},
-    {0x06, 0x02, 0xB1},
-    {0x0A, 0x02, 0xB1},
-    {0x0F, 0x02, 0xB1},
-    {0x18, 0x02, 0xB1},
-    {0x1F, 0x02, 0xB1},
-    {0x29, 0x02, 0xB1},
-    {0x38, 0x03, 0xB1},
-  },
-  /* 115 */
-  {
-    {0x03, 0x02, 0xB3},
-    {0x06, 0x02, 0xB3},
-    {0x0A, 0x02, 0xB3},
-    {0x0F, 0x02, 0xB3},
-    {0x18, 0x02, 0xB3},
-    {0x1F, 0x02, 0xB3},
-    {0x29, 0x02, 0xB3},
-    {0x38, 0x03, 0xB3},
-    {0x03, 0x02, 0xD1},
-    {0x06, 0x02, 0xD1},
-    {0x0A, 0x02, 0xD1},
-    {0x0F, 0x02, 0xD1},
-    {0x18, 0x02, 0xD1},
-    {0x1F, 0x02, 0xD1},
-    {0x29, 0x02, 0xD1},
-    {0x38, 0x03, 0xD1},
-  },
-  /* 116 */
-  {
-    {0x02, 0x02, 0xD8},
-    {0x09, 0x02, 0xD8},
-    {0x17, 0x02, 0xD8},
-    {0x28, 0x03, 0xD8},
-    {0x02, 0x02, 0xD9},
-    {0x09, 0x02, 0xD9},
-    {0x17, 0x02, 0xD9},
-    {0x28, 0x03, 0xD9},
-    {0x02, 0x02, 0xE3},
-    {0x09, 0x02, 0xE3},
-    {0x17, 0x02, 0xE3},
-    {0x28, 0x03, 0xE3},
-    {0x02, 0x02, 0xE5},
-    {0x09, 0x02, 0xE5},
-    {0x17, 0x02, 0xE5},
-    {0x28, 0x03, 0xE5},
-  },
-  /* 117 */
-  {
-    {0x03, 0x02, 0xD8},
-    {0x06, 0x02, 0xD8},
-    {0x0A, 0x02, 0xD8},
-    {0x0F, 0x02, 0xD8},
-    {0x18, 0x02, 0xD8},
-    {0x1F, 0x02, 0xD8},
-    {0x29, 0x02, 0xD8},
-    {0x38, 0x03, 0xD8},
-    {0x03, 0x02, 0xD9},
-    {0x06, 0x02, 0xD9},
-    {0x0A, 0x02, 0xD9},
-    {0x0F, 0x02, 0xD9},
-    {0x18, 0x02, 0xD9},
-    {0x1F, 0x02, 0xD9},
-    {0x29, 0x02, 0xD9},
-    {0x38, 0x03, 0xD9},
-  },
-  /* 118 */
-  {
-    {0x03, 0x02, 0xE3},
-    {0x06, 0x02, 0xE3},
-    {0x0A, 0x02, 0xE3},
-    {0x0F, 0x02, 0xE3},
-    {0x18, 0x02, 0xE3},
-    {0x1F, 0x02, 0xE3},
-    {0x29, 0x02, 0xE3},
-    {0x38, 0x03, 0xE3},
-    {0x03, 0x02, 0xE5},
-    {0x06, 0x02, 0xE5},
-    {0x0A, 0x02, 0xE5},
-    {0x0F, 0x02, 0xE5},
-    {0x18, 0x02, 0xE5},
-    {0x1F, 0x02, 0xE5},
-    {0x29, 0x02, 0xE5},
-    {0x38, 0x03, 0xE5},
-  },
-  /* 119 */
-  {
-    {0x01, 0x02, 0xE6},
-    {0x16, 0x03, 0xE6},
-    {0x00, 0x03, 0x81},
-    {0x00, 0x03, 0x84},
-    {0x00, 0x03, 0x85},
-    {0x00, 0x03, 0x86},
-    {0x00, 0x03, 0x88},
-    {0x00, 0x03, 0x92},
-    {0x00, 0x03, 0x9A},
-    {0x00, 0x03, 0x9C},
-    {0x00, 0x03, 0xA0},
-    {0x00, 0x03, 0xA3},
-    {0x00, 0x03, 0xA4},
-    {0x00, 0x03, 0xA9},
-    {0x00, 0x03, 0xAA},
-    {0x00, 0x03, 0xAD},
-  },
-  /* 120 */
-  {
-    {0x02, 0x02, 0xE6},
-    {0x09, 0x02, 0xE6},
-    {0x17, 0x02, 0xE6},
-    {0x28, 0x03, 0xE6},
-    {0x01, 0x02, 0x81},
-    {0x16, 0x03, 0x81},
-    {0x01, 0x02, 0x84},
-    {0x16, 0x03, 0x84},
-    {0x01, 0x02, 0x85},
-    {0x16, 0x03, 0x85},
-    {0x01, 0x02, 0x86},
-    {0x16, 0x03, 0x86},
-    {0x01, 0x02, 0x88},
-    {0x16, 0x03, 0x88},
-    {0x01, 0x02, 0x92},
-    {0x16, 0x03, 0x92},
-  },
-  /* 121 */
-  {
-    {0x03, 0x02, 0xE6},
-    {0x06, 0x02, 0xE6},
-    {0x0A, 0x02, 0xE6},
-    {0x0F, 0x02, 0xE6},
-    {0x18, 0x02, 0xE6},
-    {0x1F, 0x02, 0xE6},
-    {0x29, 0x02, 0xE6},
-    {0x38, 0x03, 0xE6},
-    {0x02, 0x02, 0x81},
-    {0x09, 0x02, 0x81},
-    {0x17, 0x02, 0x81},
-    {0x28, 0x03, 0x81},
-    {0x02, 0x02, 0x84},
-    {0x09, 0x02, 0x84},
-    {0x17, 0x02, 0x84},
-    {0x28, 0x03, 0x84},
-  },
-  /* 122 */
-  {
-    {0x03, 0x02, 0x81},
-    {0x06, 0x02, 0x81},
-    {0x0A, 0x02, 0x81},
-    {0x0F, 0x02, 0x81},
-    {0x18, 0x02, 0x81},
-    {0x1F, 0x02, 0x81},
-    {0x29, 0x02, 0x81},
-    {0x38, 0x03, 0x81},
-    {0x03, 0x02, 0x84},
-    {0x06, 0x02, 0x84},
-    {0x0A, 0x02, 0x84},
-    {0x0F, 0x02, 0x84},
-    {0x18, 0x02, 0x84},
-    {0x1F, 0x02, 0x84},
-    {0x29, 0x02, 0x84},
-    {0x38, 0x03, 0x84},
-  },
-  /* 123 */
-  {
-    {0x02, 0x02, 0x85},
-    {0x09, 0x02, 0x85},
-    {0x17, 0x02, 0x85},
-    {0x28, 0x03, 0x85},
-    {0x02, 0x02, 0x86},
-    {0x09, 0x02, 0x86},
-    {0x17, 0x02, 0x86},
-    {0x28, 0x03, 0x86},
-    {0x02, 0x02, 0x88},
-    {0x09, 0x02, 0x88},
-    {0x17, 0x02, 0x88},
-    {0x28, 0x03, 0x88},
-    {0x02, 0x02, 0x92},
-    {0x09, 0x02, 0x92},
-    {0x17, 0x02, 0x92},
-    {0x28, 0x03, 0x92},
-  },
-  /* 124 */
-  {
-    {0x03, 0x02, 0x85},
-    {0x06, 0x02, 0x85},
-    {0x0A, 0x02, 0x85},
-    {0x0F, 0x02, 0x85},
-    {0x18, 0x02, 0x85},
-    {0x1F, 0x02, 0x85},
-    {0x29, 0x02, 0x85},
-    {0x38, 0x03, 0x85},
-    {0x03, 0x02, 0x86},
-    {0x06, 0x02, 0x86},
-    {0x0A, 0x02, 0x86},
-    {0x0F, 0x02, 0x86},
-    {0x18, 0x02, 0x86},
-    {0x1F, 0x02, 0x86},
-    {0x29, 0x02, 0x86},
-    {0x38, 0x03, 0x86},
-  },
-  /* 125 */
-  {
-    {0x03, 0x02, 0x88},
-    {0x06, 0x02, 0x88},
-    {0x0A, 0x02, 0x88},
-    {0x0F, 0x02, 0x88},
-    {0x18, 0x02, 0x88},
-    {0x1F, 0x02, 0x88},
-    {0x29, 0x02, 0x88},
-    {0x38, 0x03, 0x88},
-    {0x03, 0x02, 0x92},
-    {0x06, 0x02, 0x92},
-    {0x0A, 0x02, 0x92},
-    {0x0F, 0x02, 0x92},
-    {0x18, 0x02, 0x92},
-    {0x1F, 0x02, 0x92},
-    {0x29, 0x02, 0x92},
-    {0x38, 0x03, 0x92},
-  },
-  /* 126 */
-  {
-    {0x01, 0x02, 0x9A},
-    {0x16, 0x03, 0x9A},
-    {0x01, 0x02, 0x9C},
-    {0x16, 0x03, 0x9C},
-    {0x01, 0x02, 0xA0},
-    {0x16, 0x03, 0xA0},
-    {0x01, 0x02, 0xA3},
-    {0x16, 0x03, 0xA3},
-    {0x01, 0x02, 0xA4},
-    {0x16, 0x03, 0xA4},
-    {0x01, 0x02, 0xA9},
-    {0x16, 0x03, 0xA9},
-    {0x01, 0x02, 0xAA},
-    {0x16, 0x03, 0xAA},
-    {0x01, 0x02, 0xAD},
-    {0x16, 0x03, 0xAD},
-  },
-  /* 127 */
-  {
-    {0x02, 0x02, 0x9A},
-    {0x09, 0x02, 0x9A},
-    {0x17, 0x02, 0x9A},
-    {0x28, 0x03, 0x9A},
-    {0x02, 0x02, 0x9C},
-    {0x09, 0x02, 0x9C},
-    {0x17, 0x02, 0x9C},
-    {0x28, 0x03, 0x9C},
-    {0x02, 0x02, 0xA0},
-    {0x09, 0x02, 0xA0},
-    {0x17, 0x02, 0xA0},
-    {0x28, 0x03, 0xA0},
-    {0x02, 0x02, 0xA3},
-    {0x09, 0x02, 0xA3},
-    {0x17, 0x02, 0xA3},
-    {0x28, 0x03, 0xA3},
-  },
-  /* 128 */
-  {
-    {0x03, 0x02, 0x9A},
-    {0x06, 0x02, 0x9A},
-    {0x0A, 0x02, 0x9A},
-    {0x0F, 0x02, 0x9A},
-    {0x18, 0x02, 0x9A},
-    {0x1F, 0x02, 0x9A},
-    {0x29, 0x02, 0x9A},
-    {0x38, 0x03, 0x9A},
-    {0x03, 0x02, 0x9C},
-    {0x06, 0x02, 0x9C},
-    {0x0A, 0x02, 0x9C},
-    {0x0F, 0x02, 0x9C},
-    {0x18, 0x02, 0x9C},
-    {0x1F, 0x02, 0x9C},
-    {0x29, 0x02, 0x9C},
-    {0x38, 0x03, 0x9C},
-  },
-  /* 129 */
-  {
-    {0x03, 0x02, 0xA0},
-    {0x06, 0x02, 0xA0},
-    {0x0A, 0x02, 0xA0},
-    {0x0F, 0x02, 0xA0},
-    {0x18, 0x02, 0xA0},
-    {0x1F, 0x02, 0xA0},
-    {0x29, 0x02, 0xA0},
-    {0x38, 0x03, 0xA0},
-    {0x03, 0x02, 0xA3},
-    {0x06, 0x02, 0xA3},
-    {0x0A, 0x02, 0xA3},
-    {0x0F, 0x02, 0xA3},
-    {0x18, 0x02, 0xA3},
-    {0x1F, 0x02, 0xA3},
-    {0x29, 0x02, 0xA3},
-    {0x38, 0x03, 0xA3},
-  },
-  /* 130 */
-  {
-    {0x02, 0x02, 0xA4},
-    {0x09, 0x02, 0xA4},
-    {0x17, 0x02, 0xA4},
-    {0x28, 0x03, 0xA4},
-    {0x02, 0x02, 0xA9},
-    {0x09, 0x02, 0xA9},
-    {0x17, 0x02, 0xA9},
-    {0x28, 0x03, 0xA9},
-    {0x02, 0x02, 0xAA},
-    {0x09, 0x02, 0xAA},
-    {0x17, 0x02, 0xAA},
-    {0x28, 0x03, 0xAA},
-    {0x02, 0x02, 0xAD},
-    {0x09, 0x02, 0xAD},
-    {0x17, 0x02, 0xAD},
-    {0x28, 0x03, 0xAD},
-  },
-  /* 131 */
-  {
-    {0x03, 0x02, 0xA4},
-    {0x06, 0x02, 0xA4},
-    {0x0A, 0x02, 0xA4},
-    {0x0F, 0x02, 0xA4},
-    {0x18, 0x02, 0xA4},
-    {0x1F, 0x02, 0xA4},
-    {0x29, 0x02, 0xA4},
-    {0x38, 0x03, 0xA4},
-    {0x03, 0x02, 0xA9},
-    {0x06, 0x02, 0xA9},
-    {0x0A, 0x02, 0xA9},
-    {0x0F, 0x02, 0xA9},
-    {0x18, 0x02, 0xA9},
-    {0x1F, 0x02, 0xA9},
-    {0x29, 0x02, 0xA9},
-    {0x38, 0x03, 0xA9},
-  },
-  /* 132 */
-  {
-    {0x03, 0x02, 0xAA},
-    {0x06, 0x02, 0xAA},
-    {0x0A, 0x02, 0xAA},
-    {0x0F, 0x02, 0xAA},
-    {0x18, 0x02, 0xAA},
-    {0x1F, 0x02, 0xAA},
-    {0x29, 0x02, 0xAA},
-    {0x38, 0x03, 0xAA},
-    {0x03, 0x02, 0xAD},
-    {0x06, 0x02, 0xAD},
-    {0x0A, 0x02, 0xAD},
-    {0x0F, 0x02, 0xAD},
-    {0x18, 0x02, 0xAD},
-    {0x1F, 0x02, 0xAD},
-    {0x29, 0x02, 0xAD},
-    {0x38, 0x03, 0xAD},
-  },
-  /* 133 */
-  {
-    {0x89, 0x00, 0x00},
-    {0x8A, 0x00, 0x00},
-    {0x8C, 0x00, 0x00},
-    {0x8D, 0x00, 0x00},
-    {0x90, 0x00, 0x00},
-    {0x91, 0x00, 0x00},
-    {0x93, 0x00, 0x00},
-    {0x96, 0x00, 0x00},
-    {0x9C, 0x00, 0x00},
-    {0x9F, 0x00, 0x00},
-    {0xA3, 0x00, 0x00},
-    {0xA6, 0x00, 0x00},
-    {0xAB, 0x00, 0x00},
-    {0xAE, 0x00, 0x00},
-    {0xB5, 0x00, 0x00},
-    {0xBE, 0x00, 0x00},
-  },
-  /* 134 */
-  {
-    {0x00, 0x03, 0xB2},
-    {0x00, 0x03, 0xB5},
-    {0x00, 0x03, 0xB9},
-    {0x00, 0x03, 0xBA},
-    {0x00, 0x03, 0xBB},
-    {0x00, 0x03, 0xBD},
-    {0x00, 0x03, 0xBE},
-    {0x00, 0x03, 0xC4},
-    {0x00, 0x03, 0xC6},
-    {0x00, 0x03, 0xE4},
-    {0x00, 0x03, 0xE8},
-    {0x00, 0x03, 0xE9},
-    {0x94, 0x00, 0x00},
-    {0x95, 0x00, 0x00},
-    {0x97, 0x00, 0x00},
-    {0x98, 0x00, 0x00},
-  },
-  /* 135 */
-  {
-    {0x01, 0x02, 0xB2},
-    {0x16, 0x03, 0xB2},
-    {0x01, 0x02, 0xB5},
-    {0x16, 0x03, 0xB5},
-    {0x01, 0x02, 0xB9},
-    {0x16, 0x03, 0xB9},
-    {0x01, 0x02, 0xBA},
-    {0x16, 0x03, 0xBA},
-    {0x01, 0x02, 0xBB},
-    {0x16, 0x03, 0xBB},
-    {0x01, 0x02, 0xBD},
-    {0x16, 0x03, 0xBD},
-    {0x01, 0x02, 0xBE},
-    {0x16, 0x03, 0xBE},
-    {0x01, 0x02, 0xC4},
-    {0x16, 0x03, 0xC4},
-  },
-  /* 136 */
-  {
-    {0x02, 0x02, 0xB2},
-    {0x09, 0x02, 0xB2},
-    {0x17, 0x02, 0xB2},
-    {0x28, 0x03, 0xB2},
-    {0x02, 0x02, 0xB5},
-    {0x09, 0x02, 0xB5},
-    {0x17, 0x02, 0xB5},
-    {0x28, 0x03, 0xB5},
-    {0x02, 0x02, 0xB9},
-    {0x09, 0x02, 0xB9},
-    {0x17, 0x02, 0xB9},
-    {0x28, 0x03, 0xB9},
-    {0x02, 0x02, 0xBA},
-    {0x09, 0x02, 0xBA},
-    {0x17, 0x02, 0xBA},
-    {0x28, 0x03, 0xBA},
-  },
-  /* 137 */
-  {
-    {0x03, 0x02, 0xB2},
-    {0x06, 0x02, 0xB2},
-    {0x0A, 0x02, 0xB2},
-    {0x0F, 0x02, 0xB2},
-    {0x18, 0x02, 0xB2},
-    {0x1F, 0x02, 0xB2},
-    {0x29, 0x02, 0xB2},
-    {0x38, 0x03, 0xB2},
-    {0x03, 0x02, 0xB5},
-    {0x06, 0x02, 0xB5},
-    {0x0A, 0x02, 0xB5},
-    {0x0F, 0x02, 0xB5},
-    {0x18, 0x02, 0xB5},
-    {0x1F, 0x02, 0xB5},
-    {0x29, 0x02, 0xB5},
-    {0x38, 0x03, 0xB5},
-  },
-  /* 138 */
-  {
-    {0x03, 0x02, 0xB9},
-    {0x06, 0x02, 0xB9},
-    {0x0A, 0x02, 0xB9},
-    {0x0F, 0x02, 0xB9},
-    {0x18, 0x02, 0xB9},
-    {0x1F, 0x02, 0xB9},
-    {0x29, 0x02, 0xB9},
-    {0x38, 0x03, 0xB9},
-    {0x03, 0x02, 0xBA},
-    {0x06, 0x02, 0xBA},
-    {0x0A, 0x02, 0xBA},
-    {0x0F, 0x02, 0xBA},
-    {0x18, 0x02, 0xBA},
-    {0x1F, 0x02, 0xBA},
-    {0x29, 0x02, 0xBA},
-    {0x38, 0x03, 0xBA},
-  },
-  /* 139 */
-  {
-    {0x02, 0x02, 0xBB},
-    {0x09, 0x02, 0xBB},
-    {0x17, 0x02, 0xBB},
-    {0x28, 0x03, 0xBB},
-    {0x02, 0x02, 0xBD},
-    {0x09, 0x02, 0xBD},
-    {0x17, 0x02, 0xBD},
-    {0x28, 0x03, 0xBD},
-    {0x02, 0x02, 0xBE},
-    {0x09, 0x02, 0xBE},
-    {0x17, 0x02, 0xBE},
-    {0x28, 0x03, 0xBE},
-    {0x02, 0x02, 0xC4},
-    {0x09, 0x02, 0xC4},
-    {0x17, 0x02, 0xC4},
-    {0x28, 0x03, 0xC4},
-  },
-  /* 140 */
-  {
-    {0x03, 0x02, 0xBB},
-    {0x06, 0x02, 0xBB},
-    {0x0A, 0x02, 0xBB},
-    {0x0F, 0x02, 0xBB},
-    {0x18, 0x02, 0xBB},
-    {0x1F, 0x02, 0xBB},
-    {0x29, 0x02, 0xBB},
-    {0x38, 0x03, 0xBB},
-    {0x03, 0x02, 0xBD},
-    {0x06, 0x02, 0xBD},
-    {0x0A, 0x02, 0xBD},
-    {0x0F, 0x02, 0xBD},
-    {0x18, 0x02, 0xBD},
-    {0x1F, 0x02, 0xBD},
-    {0x29, 0x02, 0xBD},
-    {0x38, 0x03, 0xBD},
-  },
-  /* 141 */
-  {
-    {0x03, 0x02, 0xBE},
-    {0x06, 0x02, 0xBE},
-    {0x0A, 0x02, 0xBE},
-    {0x0F, 0x02, 0xBE},
-    {0x18, 0x02, 0xBE},
-    {0x1F, 0x02, 0xBE},
-    {0x29, 0x02, 0xBE},
-    {0x38, 0x03, 0xBE},
-    {0x03, 0x02, 0xC4},
-    {0x06, 0x02, 0xC4},
-    {0x0A, 0x02, 0xC4},
-    {0x0F, 0x02, 0xC4},
-    {0x18, 0x02, 0xC4},
-    {0x1F, 0x02, 0xC4},
-    {0x29, 0x02, 0xC4},
-    {0x38, 0x03, 0xC4},
-  },
-  /* 142 */
-  {
-    {0x01, 0x02, 0xC6},
-    {0x16, 0x03, 0xC6},
-    {0x01, 0x02, 0xE4},
-    {0x16, 0x03, 0xE4},
-    {0x01, 0x02, 0xE8},
-    {0x16, 0x03, 0xE8},
-    {0x01, 0x02, 0xE9},
-    {0x16, 0x03, 0xE9},
-    {0x00, 0x03, 0x01},
-    {0x00, 0x03, 0x87},
-    {0x00, 0x03, 0x89},
-    {0x00, 0x03, 0x8A},
-    {0x00, 0x03, 0x8B},
-    {0x00, 0x03, 0x8C},
-    {0x00, 0x03, 0x8D},
-    {0x00, 0x03, 0x8F},
-  },
-  /* 143 */
-  {
-    {0x02, 0x02, 0xC6},
-    {0x09, 0x02, 0xC6},
-    {0x17, 0x02, 0xC6},
-    {0x28, 0x03, 0xC6},
-    {0x02, 0x02, 0xE4},
-    {0x09, 0x02, 0xE4},
-    {0x17, 0x02, 0xE4},
-    {0x28, 0x03, 0xE4},
-    {0x02, 0x02, 0xE8},
-    {0x09, 0x02, 0xE8},
-    {0x17, 0x02, 0xE8},
-    {0x28, 0x03, 0xE8},
-    {0x02, 0x02, 0xE9},
-    {0x09, 0x02, 0xE9},
-    {0x17, 0x02, 0xE9},
-    {0x28, 0x03, 0xE9},
-  },
-  /* 144 */
-  {
-    {0x03, 0x02, 0xC6},
-    {0x06, 0x02, 0xC6},
-    {0x0A, 0x02, 0xC6},
-    {0x0F, 0x02, 0xC6},
-    {0x18, 0x02, 0xC6},
-    {0x1F, 0x02, 0xC6},
-    {0x29, 0x02, 0xC6},
-    {0x38, 0x03, 0xC6},
-    {0x03, 0x02, 0xE4},
-    {0x06, 0x02, 0xE4},
-    {0x0A, 0x02, 0xE4},
-    {0x0F, 0x02, 0xE4},
-    {0x18, 0x02, 0xE4},
-    {0x1F, 0x02, 0xE4},
-    {0x29, 0x02, 0xE4},
-    {0x38, 0x03, 0xE4},
-  },
-  /* 145 */
-  {
-    {0x03, 0x02, 0xE8},
-    {0x06, 0x02, 0xE8},
-    {0x0A, 0x02, 0xE8},
-    {0x0F, 0x02, 0xE8},
-    {0x18, 0x02, 0xE8},
-    {0x1F, 0x02, 0xE8},
-    {0x29, 0x02, 0xE8},
-    {0x38, 0x03, 0xE8},
-    {0x03, 0x02, 0xE9},
-    {0x06, 0x02, 0xE9},
-    {0x0A, 0x02, 0xE9},
-    {0x0F, 0x02, 0xE9},
-    {0x18, 0x02, 0xE9},
-    {0x1F, 0x02, 0xE9},
-    {0x29, 0x02, 0xE9},
-    {0x38, 0x03, 0xE9},
-  },
-  /* 146 */
-  {
-    {0x01, 0x02, 0x01},
-    {0x16, 0x03, 0x01},
-    {0x01, 0x02, 0x87},
-    {0x16, 0x03, 0x87},
-    {0x01, 0x02, 0x89},
-    {0x16, 0x03, 0x89},
-    {0x01, 0x02, 0x8A},
-    {0x16, 0x03, 0x8A},
-    {0x01, 0x02, 0x8B},
-    {0x16, 0x03, 0x8B},
-    {0x01, 0x02, 0x8C},
-    {0x16, 0x03, 0x8C},
-    {0x01, 0x02, 0x8D},
-    {0x16, 0x03, 0x8D},
-    {0x01, 0x02, 0x8F},
-    {0x16, 0x03, 0x8F},
-  },
-  /* 147 */
-  {
-    {0x02, 0x02, 0x01},
-    {0x09, 0x02, 0x01},
-    {0x17, 0x02, 0x01},
-    {0x28, 0x03, 0x01},
-    {0x02, 0x02, 0x87},
-    {0x09, 0x02, 0x87},
-    {0x17, 0x02, 0x87},
-    {0x28, 0x03, 0x87},
-    {0x02, 0x02, 0x89},
-    {0x09, 0x02, 0x89},
-    {0x17, 0x02, 0x89},
-    {0x28, 0x03, 0x89},
-    {0x02, 0x02, 0x8A},
-    {0x09, 0x02, 0x8A},
-    {0x17, 0x02, 0x8A},
-    {0x28, 0x03, 0x8A},
-  },
-  /* 148 */
-  {
-    {0x03, 0x02, 0x01},
-    {0x06, 0x02, 0x01},
-    {0x0A, 0x02, 0x01},
-    {0x0F, 0x02, 0x01},
-    {0x18, 0x02, 0x01},
-    {0x1F, 0x02, 0x01},
-    {0x29, 0x02, 0x01},
-    {0x38, 0x03, 0x01},
-    {0x03, 0x02, 0x87},
-    {0x06, 0x02, 0x87},
-    {0x0A, 0x02, 0x87},
-    {0x0F, 0x02, 0x87},
-    {0x18, 0x02, 0x87},
-    {0x1F, 0x02, 0x87},
-    {0x29, 0x02, 0x87},
-    {0x38, 0x03, 0x87},
-  },
-  /* 149 */
-  {
-    {0x03, 0x02, 0x89},
-    {0x06, 0x02, 0x89},
-    {0x0A, 0x02, 0x89},
-    {0x0F, 0x02, 0x89},
-    {0x18, 0x02, 0x89},
-    {0x1F, 0x02, 0x89},
-    {0x29, 0x02, 0x89},
-    {0x38, 0x03, 0x89},
-    {0x03, 0x02, 0x8A},
-    {0x06, 0x02, 0x8A},
-    {0x0A, 0x02, 0x8A},
-    {0x0F, 0x02, 0x8A},
-    {0x18, 0x02, 0x8A},
-    {0x1F, 0x02, 0x8A},
-    {0x29, 0x02, 0x8A},
-    {0x38, 0x03, 0x8A},
-  },
-  /* 150 */
-  {
-    {0x02, 0x02, 0x8B},
-    {0x09, 0x02, 0x8B},
-    {0x17, 0x02, 0x8B},
-    {0x28, 0x03, 0x8B},
-    {0x02, 0x02, 0x8C},
-    {0x09, 0x02, 0x8C},
-    {0x17, 0x02, 0x8C},
-    {0x28, 0x03, 0x8C},
-    {0x02, 0x02, 0x8D},
-    {0x09, 0x02, 0x8D},
-    {0x17, 0x02, 0x8D},
-    {0x28, 0x03, 0x8D},
-    {0x02, 0x02, 0x8F},
-    {0x09, 0x02, 0x8F},
-    {0x17, 0x02, 0x8F},
-    {0x28, 0x03, 0x8F},
-  },
-  /* 151 */
-  {
-    {0x03, 0x02, 0x8B},
-    {0x06, 0x02, 0x8B},
-    {0x0A, 0x02, 0x8B},
-    {0x0F, 0x02, 0x8B},
-    {0x18, 0x02, 0x8B},
-    {0x1F, 0x02, 0x8B},
-    {0x29, 0x02, 0x8B},
-    {0x38, 0x03, 0x8B},
-    {0x03, 0x02, 0x8C},
-    {0x06, 0x02, 0x8C},
-    {0x0A, 0x02, 0x8C},
-    {0x0F, 0x02, 0x8C},
-    {0x18, 0x02, 0x8C},
-    {0x1F, 0x02, 0x8C},
-    {0x29, 0x02, 0x8C},
-    {0x38, 0x03, 0x8C},
-  },
-  /* 152 */
-  {
-    {0x03, 0x02, 0x8D},
-    {0x06, 0x02, 0x8D},
-    {0x0A, 0x02, 0x8D},
-    {0x0F, 0x02, 0x8D},
-    {0x18, 0x02, 0x8D},
-    {0x1F, 0x02, 0x8D},
-    {0x29, 0x02, 0x8D},
-    {0x38, 0x03, 0x8D},
-    {0x03, 0x02, 0x8F},
-    {0x06, 0x02, 0x8F},
-    {0x0A, 0x02, 0x8F},
-    {0x0F, 0x02, 0x8F},
-    {0x18, 0x02, 0x8F},
-    {0x1F, 0x02, 0x8F},
-    {0x29, 0x02, 0x8F},
-    {0x38, 0x03, 0x8F},
-  },
-  /* 153 */
-  {
-    {0x9D, 0x00, 0x00},
-    {0x9E, 0x00, 0x00},
-    {0xA0, 0x00, 0x00},
-    {0xA1, 0x00, 0x00},
-    {0xA4, 0x00, 0x00},
-    {0xA5, 0x00, 0x00},
-    {0xA7, 0x00, 0x00},
-    {0xA8, 0x00, 0x00},
-    {0xAC, 0x00, 0x00},
-    {0xAD, 0x00, 0x00},
-    {0xAF, 0x00, 0x00},
-    {0xB1, 0x00, 0x00},
-    {0xB6, 0x00, 0x00},
-    {0xB9, 0x00, 0x00},
-    {0xBF, 0x00, 0x00},
-    {0xCF, 0x00, 0x00},
-  },
-  /* 154 */
-  {
-    {0x00, 0x03, 0x93},
-    {0x00, 0x03, 0x95},
-    {0x00, 0x03, 0x96},
-    {0x00, 0x03, 0x97},
-    {0x00, 0x03, 0x98},
-    {0x00, 0x03, 0x9B},
-    {0x00, 0x03, 0x9D},
-    {0x00, 0x03, 0x9E},
-    {0x00, 0x03, 0xA5},
-    {0x00, 0x03, 0xA6},
-    {0x00, 0x03, 0xA8},
-    {0x00, 0x03, 0xAE},
-    {0x00, 0x03, 0xAF},
-    {0x00, 0x03, 0xB4},
-    {0x00, 0x03, 0xB6},
-    {0x00, 0x03, 0xB7},
-  },
-  /* 155 */
-  {
-    {0x01, 0x02, 0x93},
-    {0x16, 0x03, 0x93},
-    {0x01, 0x02, 0x95},
-    {0x16, 0x03, 0x95},
-    {0x01, 0x02, 0x96},
-    {0x16, 0x03, 0x96},
-    {0x01, 0x02, 0x97},
-    {0x16, 0x03, 0x97},
-    {0x01, 0x02, 0x98},
-    {0x16, 0x03, 0x98},
-    {0x01, 0x02, 0x9B},
-    {0x16, 0x03, 0x9B},
-    {0x01, 0x02, 0x9D},
-    {0x16, 0x03, 0x9D},
-    {0x01, 0x02, 0x9E},
-    {0x16, 0x03, 0x9E},
-  },
-  /* 156 */
-  {
-    {0x02, 0x02, 0x93},
-    {0x09, 0x02, 0x93},
-    {0x17, 0x02, 0x93},
-    {0x28, 0x03, 0x93},
-    {0x02, 0x02, 0x95},
-    {0x09, 0x02, 0x95},
-    {0x17, 0x02, 0x95},
-    {0x28, 0x03, 0x95},
-    {0x02, 0x02, 0x96},
-    {0x09, 0x02, 0x96},
-    {0x17, 0x02, 0x96},
-    {0x28, 0x03, 0x96},
-    {0x02, 0x02, 0x97},
-    {0x09, 0x02, 0x97},
-    {0x17, 0x02, 0x97},
-    {0x28, 0x03, 0x97},
-  },
-  /* 157 */
-  {
-    {0x03, 0x02, 0x93},
-    {0x06, 0x02, 0x93},
-    {0x0A, 0x02, 0x93},
-    {0x0F, 0x02, 0x93},
-    {0x18, 0x02, 0x93},
-    {0x1F, 0x02, 0x93},
-    {0x29, 0x02, 0x93},
-    {0x38, 0x03, 0x93},
-    {0x03, 0x02, 0x95},
-    {0x06, 0x02, 0x95},
-    {0x0A, 0x02, 0x95},
-    {0x0F, 0x02, 0x95},
-    {0x18, 0x02, 0x95},
-    {0x1F, 0x02, 0x95},
-    {0x29, 0x02, 0x95},
-    {0x38, 0x03, 0x95},
-  },
-  /* 158 */
-  {
-    {0x03, 0x02, 0x96},
-    {0x06, 0x02, 0x96},
-    {0x0A, 0x02, 0x96},
-    {0x0F, 0x02, 0x96},
-    {0x18, 0x02, 0x96},
-    {0x1F, 0x02, 0x96},
-    {0x29, 0x02, 0x96},
-    {0x38, 0x03, 0x96},
-    {0x03, 0x02, 0x97},
-    {0x06, 0x02, 0x97},
-    {0x0A, 0x02, 0x97},
-    {0x0F, 0x02, 0x97},
-    {0x18, 0x02, 0x97},
-    {0x1F, 0x02, 0x97},
-    {0x29, 0x02, 0x97},
-    {0x38, 0x03, 0x97},
-  },
-  /* 159 */
-  {
-    {0x02, 0x02, 0x98},
-    {0x09, 0x02, 0x98},
-    {0x17, 0x02, 0x98},
-    {0x28, 0x03, 0x98},
-    {0x02, 0x02, 0x9B},
-    {0x09, 0x02, 0x9B},
-    {0x17, 0x02, 0x9B},
-    {0x28, 0x03, 0x9B},
-    {0x02, 0x02, 0x9D},
-    {0x09, 0x02, 0x9D},
-    {0x17, 0x02, 0x9D},
-    {0x28, 0x03, 0x9D},
-    {0x02, 0x02, 0x9E},
-    {0x09, 0x02, 0x9E},
-    {0x17, 0x02, 0x9E},
-    {0x28, 0x03, 0x9E},
-  },
-  /* 160 */
-  {
-    {0x03, 0x02, 0x98},
-    {0x06, 0x02, 0x98},
-    {0x0A, 0x02, 0x98},
-    {0x0F, 0x02, 0x98},
-    {0x18, 0x02, 0x98},
-    {0x1F, 0x02, 0x98},
-    {0x29, 0x02, 0x98},
-    {0x38, 0x03, 0x98},
-    {0x03, 0x02, 0x9B},
-    {0x06, 0x02, 0x9B},
-    {0x0A, 0x02, 0x9B},
-    {0x0F, 0x02, 0x9B},
-    {0x18, 0x02, 0x9B},
-    {0x1F, 0x02, 0x9B},
-    {0x29, 0x02, 0x9B},
-    {0x38, 0x03, 0x9B},
-  },
-  /* 161 */
-  {
-    {0x03, 0x02, 0x9D},
-    {0x06, 0x02, 0x9D},
-    {0x0A, 0x02, 0x9D},
-    {0x0F, 0x02, 0x9D},
-    {0x18, 0x02, 0x9D},
-    {0x1F, 0x02, 0x9D},
-    {0x29, 0x02, 0x9D},
-    {0x38, 0x03, 0x9D},
-    {0x03, 0x02, 0x9E},
-    {0x06, 0x02, 0x9E},
-    {0x0A, 0x02, 0x9E},
-    {0x0F, 0x02, 0x9E},
-    {0x18, 0x02, 0x9E},
-    {0x1F, 0x02, 0x9E},
-    {0x29, 0x02, 0x9E},
-    {0x38, 0x03, 0x9E},
-  },
-  /* 162 */
-  {
-    {0x01, 0x02, 0xA5},
-    {0x16, 0x03, 0xA5},
-    {0x01, 0x02, 0xA6},
-    {0x16, 0x03, 0xA6},
-    {0x01, 0x02, 0xA8},
-    {0x16, 0x03, 0xA8},
-    {0x01, 0x02, 0xAE},
-    {0x16, 0x03, 0xAE},
-    {0x01, 0x02, 0xAF},
-    {0x16, 0x03, 0xAF},
-    {0x01, 0x02, 0xB4},
-    {0x16, 0x03, 0xB4},
-    {0x01, 0x02, 0xB6},
-    {0x16, 0x03, 0xB6},
-    {0x01, 0x02, 0xB7},
-    {0x16, 0x03, 0xB7},
-  },
-  /* 163 */
-  {
-    {0x02, 0x02, 0xA5},
-    {0x09, 0x02, 0xA5},
-    {0x17, 0x02, 0xA5},
-    {0x28, 0x03, 0xA5},
-    {0x02, 0x02, 0xA6},
-    {0x09, 0x02, 0xA6},
-    {0x17, 0x02, 0xA6},
-    {0x28, 0x03, 0xA6},
-    {0x02, 0x02, 0xA8},
-    {0x09, 0x02, 0xA8},
-    {0x17, 0x02, 0xA8},
-    {0x28, 0x03, 0xA8},
-    {0x02, 0x02, 0xAE},
-    {0x09, 0x02, 0xAE},
-    {0x17, 0x02, 0xAE},
-    {0x28, 0x03, 0xAE},
-  },
-  /* 164 */
-  {
-    {0x03, 0x02, 0xA5},
-    {0x06, 0x02, 0xA5},
-    {0x0A, 0x02, 0xA5},
-    {0x0F, 0x02, 0xA5},
-    {0x18, 0x02, 0xA5},
-    {0x1F, 0x02, 0xA5},
-    {0x29, 0x02, 0xA5},
-    {0x38, 0x03, 0xA5},
-    {0x03, 0x02, 0xA6},
-    {0x06, 0x02, 0xA6},
-    {0x0A, 0x02, 0xA6},
-    {0x0F, 0x02, 0xA6},
-    {0x18, 0x02, 0xA6},
-    {0x1F, 0x02, 0xA6},
-    {0x29, 0x02, 0xA6},
-    {0x38, 0x03, 0xA6},
-  },
-  /* 165 */
-  {
-    {0x03, 0x02, 0xA8},
-    {0x06, 0x02, 0xA8},
-    {0x0A, 0x02, 0xA8},
-    {0x0F, 0x02, 0xA8},
-    {0x18, 0x02, 0xA8},
-    {0x1F, 0x02, 0xA8},
-    {0x29, 0x02, 0xA8},
-    {0x38, 0x03, 0xA8},
-    {0x03, 0x02, 0xAE},
-    {0x06, 0x02, 0xAE},
-    {0x0A, 0x02, 0xAE},
-    {0x0F, 0x02, 0xAE},
-    {0x18, 0x02, 0xAE},
-    {0x1F, 0x02, 0xAE},
-    {0x29, 0x02, 0xAE},
-    {0x38, 0x03, 0xAE},
-  },
-  /* 166 */
-  {
-    {0x02, 0x02, 0xAF},
-    {0x09, 0x02, 0xAF},
-    {0x17, 0x02, 0xAF},
-    {0x28, 0x03, 0xAF},
-    {0x02, 0x02, 0xB4},
-    {0x09, 0x02, 0xB4},
-    {0x17, 0x02, 0xB4},
-    {0x28, 0x03, 0xB4},
-    {0x02, 0x02, 0xB6},
-    {0x09, 0x02, 0xB6},
-    {0x17, 0x02, 0xB6},
-    {0x28, 0x03, 0xB6},
-    {0x02, 0x02, 0xB7},
-    {0x09, 0x02, 0xB7},
-    {0x17, 0x02, 0xB7},
-    {0x28, 0x03, 0xB7},
-  },
-  /* 167 */
-  {
-    {0x03, 0x02, 0xAF},
-    {0x06, 0x02, 0xAF},
-    {0x0A, 0x02, 0xAF},
-    {0x0F, 0x02, 0xAF},
-    {0x18, 0x02, 0xAF},
-    {0x1F, 0x02, 0xAF},
-    {0x29, 0x02, 0xAF},
-    {0x38, 0x03, 0xAF},
-    {0x03, 0x02, 0xB4},
-    {0x06, 0x02, 0xB4},
-    {0x0A, 0x02, 0xB4},
-    {0x0F, 0x02, 0xB4},
-    {0x18, 0x02, 0xB4},
-    {0x1F, 0x02, 0xB4},
-    {0x29, 0x02, 0xB4},
-    {0x38, 0x03, 0xB4},
-  },
-  /* 168 */
-  {
-    {0x03, 0x02, 0xB6},
-    {0x06, 0x02, 0xB6},
-    {0x0A, 0x02, 0xB6},
-    {0x0F, 0x02, 0xB6},
-    {0x18, 0x02, 0xB6},
-    {0x1F, 0x02, 0xB6},
-    {0x29, 0x02, 0xB6},
-    {0x38, 0x03, 0xB6},
-    {0x03, 0x02, 0xB7},
-    {0x06, 0x02, 0xB7},
-    {0x0A, 0x02, 0xB7},
-    {0x0F, 0x02, 0xB7},
-    {0x18, 0x02, 0xB7},
-    {0x1F, 0x02, 0xB7},
-    {0x29, 0x02, 0xB7},
-    {0x38, 0x03, 0xB7},
-  },
-  /* 169 */
-  {
-    {0x00, 0x03, 0xBC},
-    {0x00, 0x03, 0xBF},
-    {0x00, 0x03, 0xC5},
-    {0x00, 0x03, 0xE7},
-    {0x00, 0x03, 0xEF},
-    {0xB0, 0x00, 0x00},
-    {0xB2, 0x00, 0x00},
-    {0xB3, 0x00, 0x00},
-    {0xB7, 0x00, 0x00},
-    {0xB8, 0x00, 0x00},
-    {0xBA, 0x00, 0x00},
-    {0xBB, 0x00, 0x00},
-    {0xC0, 0x00, 0x00},
-    {0xC7, 0x00, 0x00},
-    {0xD0, 0x00, 0x00},
-    {0xDF, 0x00, 0x00},
-  },
-  /* 170 */
-  {
-    {0x01, 0x02, 0xBC},
-    {0x16, 0x03, 0xBC},
-    {0x01, 0x02, 0xBF},
-    {0x16, 0x03, 0xBF},
-    {0x01, 0x02, 0xC5},
-    {0x16, 0x03, 0xC5},
-    {0x01, 0x02, 0xE7},
-    {0x16, 0x03, 0xE7},
-    {0x01, 0x02, 0xEF},
-    {0x16, 0x03, 0xEF},
-    {0x00, 0x03, 0x09},
-    {0x00, 0x03, 0x8E},
-    {0x00, 0x03, 0x90},
-    {0x00, 0x03, 0x91},
-    {0x00, 0x03, 0x94},
-    {0x00, 0x03, 0x9F},
-  },
-  /* 171 */
-  {
-    {0x02, 0x02, 0xBC},
-    {0x09, 0x02, 0xBC},
-    {0x17, 0x02, 0xBC},
-    {0x28, 0x03, 0xBC},
-    {0x02, 0x02, 0xBF},
-    {0x09, 0x02, 0xBF},
-    {0x17, 0x02, 0xBF},
-    {0x28, 0x03, 0xBF},
-    {0x02, 0x02, 0xC5},
-    {0x09, 0x02, 0xC5},
-    {0x17, 0x02, 0xC5},
-    {0x28, 0x03, 0xC5},
-    {0x02, 0x02, 0xE7},
-    {0x09, 0x02, 0xE7},
-    {0x17, 0x02, 0xE7},
-    {0x28, 0x03, 0xE7},
-  },
-  /* 172 */
-  {
-    {0x03, 0x02, 0xBC},
-    {0x06, 0x02, 0xBC},
-    {0x0A, 0x02, 0xBC},
-    {0x0F, 0x02, 0xBC},
-    {0x18, 0x02, 0xBC},
-    {0x1F, 0x02, 0xBC},
-    {0x29, 0x02, 0xBC},
-    {0x38, 0x03, 0xBC},
-    {0x03, 0x02, 0xBF},
-    {0x06, 0x02, 0xBF},
-    {0x0A, 0x02, 0xBF},
-    {0x0F, 0x02, 0xBF},
-    {0x18, 0x02, 0xBF},
-    {0x1F, 0x02, 0xBF},
-    {0x29, 0x02, 0xBF},
-    {0x38, 0x03, 0xBF},
-  },
-  /* 173 */
-  {
-    {0x03, 0x02, 0xC5},
-    {0x06, 0x02, 0xC5},
-    {0x0A, 0x02, 0xC5},
-    {0x0F, 0x02, 0xC5},
-    {0x18, 0x02, 0xC5},
-    {0x1F, 0x02, 0xC5},
-    {0x29, 0x02, 0xC5},
-    {0x38, 0x03, 0xC5},
-    {0x03, 0x02, 0xE7},
-    {0x06, 0x02, 0xE7},
-    {0x0A, 0x02, 0xE7},
-    {0x0F, 0x02, 0xE7},
-    {0x18, 0x02, 0xE7},
-    {0x1F, 0x02, 0xE7},
-    {0x29, 0x02, 0xE7},
-    {0x38, 0x03, 0xE7},
-  },
-  /* 174 */
-  {
-    {0x02, 0x02, 0xEF},
-    {0x09, 0x02, 0xEF},
-    {0x17, 0x02, 0xEF},
-    {0x28, 0x03, 0xEF},
-    {0x01, 0x02, 0x09},
-    {0x16, 0x03, 0x09},
-    {0x01, 0x02, 0x8E},
-    {0x16, 0x03, 0x8E},
-    {0x01, 0x02, 0x90},
-    {0x16, 0x03, 0x90},
-    {0x01, 0x02, 0x91},
-    {0x16, 0x03, 0x91},
-    {0x01, 0x02, 0x94},
-    {0x16, 0x03, 0x94},
-    {0x01, 0x02, 0x9F},
-    {0x16, 0x03, 0x9F},
-  },
-  /* 175 */
-  {
-    {0x03, 0x02, 0xEF},
-    {0x06, 0x02, 0xEF},
-    {0x0A, 0x02, 0xEF},
-    {0x0F, 0x02, 0xEF},
-    {0x18, 0x02, 0xEF},
-    {0x1F, 0x02, 0xEF},
-    {0x29, 0x02, 0xEF},
-    {0x38, 0x03, 0xEF},
-    {0x02, 0x02, 0x09},
-    {0x09, 0x02, 0x09},
-    {0x17, 0x02, 0x09},
-    {0x28, 0x03, 0x09},
-    {0x02, 0x02, 0x8E},
-    {0x09, 0x02, 0x8E},
-    {0x17, 0x02, 0x8E},
-    {0x28, 0x03, 0x8E},
-  },
-  /* 176 */
-  {
-    {0x03, 0x02, 0x09},
-    {0x06, 0x02, 0x09},
-    {0x0A, 0x02, 0x09},
-    {0x0F, 0x02, 0x09},
-    {0x18, 0x02, 0x09},
-    {0x1F, 0x02, 0x09},
-    {0x29, 0x02, 0x09},
-    {0x38, 0x03, 0x09},
-    {0x03, 0x02, 0x8E},
-    {0x06, 0x02, 0x8E},
-    {0x0A, 0x02, 0x8E},
-    {0x0F, 0x02, 0x8E},
-    {0x18, 0x02, 0x8E},
-    {0x1F, 0x02, 0x8E},
-    {0x29, 0x02, 0x8E},
-    {0x38, 0x03, 0x8E},
-  },
-  /* 177 */
-  {
-    {0x02, 0x02, 0x90},
-    {0x09, 0x02, 0x90},
-    {0x17, 0x02, 0x90},
-    {0x28, 0x03, 0x90},
-    {0x02, 0x02, 0x91},
-    {0x09, 0x02, 0x91},
-    {0x17, 0x02, 0x91},
-    {0x28, 0x03, 0x91},
-    {0x02, 0x02, 0x94},
-    {0x09, 0x02, 0x94},
-    {0x17, 0x02, 0x94},
-    {0x28, 0x03, 0x94},
-    {0x02, 0x02, 0x9F},
-    {0x09, 0x02, 0x9F},
-    {0x17, 0x02, 0x9F},
-    {0x28, 0x03, 0x9F},
-  },
-  /* 178 */
-  {
-    {0x03, 0x02, 0x90},
-    {0x06, 0x02, 0x90},
-    {0x0A, 0x02, 0x90},
-    {0x0F, 0x02, 0x90},
-    {0x18, 0x02, 0x90},
-    {0x1F, 0x02, 0x90},
-    {0x29, 0x02, 0x90},
-    {0x38, 0x03, 0x90},
-    {0x03, 0x02, 0x91},
-    {0x06, 0x02, 0x91},
-    {0x0A, 0x02, 0x91},
-    {0x0F, 0x02, 0x91},
-    {0x18, 0x02, 0x91},
-    {0x1F, 0x02, 0x91},
-    {0x29, 0x02, 0x91},
-    {0x38, 0x03, 0x91},
-  },
-  /* 179 */
-  {
-    {0x03, 0x02, 0x94},
-    {0x06, 0x02, 0x94},
-    {0x0A, 0x02, 0x94},
-    {0x0F, 0x02, 0x94},
-    {0x18, 0x02, 0x94},
-    {0x1F, 0x02, 0x94},
-    {0x29, 0x02, 0x94},
-    {0x38, 0x03, 0x94},
-    {0x03, 0x02, 0x9F},
-    {0x06, 0x02, 0x9F},
-    {0x0A, 0x02, 0x9F},
-    {0x0F, 0x02, 0x9F},
-    {0x18, 0x02, 0x9F},
-    {0x1F, 0x02, 0x9F},
-    {0x29, 0x02, 0x9F},
-    {0x38, 0x03, 0x9F},
-  },
-  /* 180 */
-  {
-    {0x00, 0x03, 0xAB},
-    {0x00, 0x03, 0xCE},
-    {0x00, 0x03, 0xD7},
-    {0x00, 0x03, 0xE1},
-    {0x00, 0x03, 0xEC},
-    {0x00, 0x03, 0xED},
-    {0xBC, 0x00, 0x00},
-    {0xBD, 0x00, 0x00},
-    {0xC1, 0x00, 0x00},
-    {0xC4, 0x00, 0x00},
-    {0xC8, 0x00, 0x00},
-    {0xCB, 0x00, 0x00},
-    {0xD1, 0x00, 0x00},
-    {0xD8, 0x00, 0x00},
-    {0xE0, 0x00, 0x00},
-    {0xEE, 0x00, 0x00},
-  },
-  /* 181 */
-  {
-    {0x01, 0x02, 0xAB},
-    {0x16, 0x03, 0xAB},
-    {0x01, 0x02, 0xCE},
-    {0x16, 0x03, 0xCE},
-    {0x01, 0x02, 0xD7},
-    {0x16, 0x03, 0xD7},
-    {0x01, 0x02, 0xE1},
-    {0x16, 0x03, 0xE1},
-    {0x01, 0x02, 0xEC},
-    {0x16, 0x03, 0xEC},
-    {0x01, 0x02, 0xED},
-    {0x16, 0x03, 0xED},
-    {0x00, 0x03, 0xC7},
-    {0x00, 0x03, 0xCF},
-    {0x00, 0x03, 0xEA},
-    {0x00, 0x03, 0xEB},
-  },
-  /* 182 */
-  {
-    {0x02, 0x02, 0xAB},
-    {0x09, 0x02, 0xAB},
-    {0x17, 0x02, 0xAB},
-    {0x28, 0x03, 0xAB},
-    {0x02, 0x02, 0xCE},
-    {0x09, 0x02, 0xCE},
-    {0x17, 0x02, 0xCE},
-    {0x28, 0x03, 0xCE},
-    {0x02, 0x02, 0xD7},
-    {0x09, 0x02, 0xD7},
-    {0x17, 0x02, 0xD7},
-    {0x28, 0x03, 0xD7},
-    {0x02, 0x02, 0xE1},
-    {0x09, 0x02, 0xE1},
-    {0x17, 0x02, 0xE1},
-    {0x28, 0x03, 0xE1},
-  },
-  /* 183 */
-  {
-    {0x03, 0x02, 0xAB},
-    {0x06, 0x02, 0xAB},
-    {0x0A, 0x02, 0xAB},
-    {0x0F, 0x02, 0xAB},
-    {0x18, 0x02, 0xAB},
-    {0x1F, 0x02, 0xAB},
-    {0x29, 0x02, 0xAB},
-    {0x38, 0x03, 0xAB},
-    {0x03, 0x02, 0xCE},
-    {0x06, 0x02, 0xCE},
-    {0x0A, 0x02, 0xCE},
-    {0x0F, 0x02, 0xCE},
-    {0x18, 0x02, 0xCE},
-    {0x1F, 0x02, 0xCE},
-    {0x29, 0x02, 0xCE},
-    {0x38, 0x03, 0xCE},
-  },
-  /* 184 */
-  {
-    {0x03, 0x02, 0xD7},
-    {0x06, 0x02, 0xD7},
-    {0x0A, 0x02, 0xD7},
-    {0x0F, 0x02, 0xD7},
-    {0x18, 0x02, 0xD7},
-    {0x1F, 0x02, 0xD7},
-    {0x29, 0x02, 0xD7},
-    {0x38, 0x03, 0xD7},
-    {0x03, 0x02, 0xE1},
-    {0x06, 0x02, 0xE1},
-    {0x0A, 0x02, 0xE1},
-    {0x0F, 0x02, 0xE1},
-    {0x18, 0x02, 0xE1},
-    {0x1F, 0x02, 0xE1},
-    {0x29, 0x02, 0xE1},
-    {0x38, 0x03, 0xE1},
-  },
-  /* 185 */
-  {
-    {0x02, 0x02, 0xEC},
-    {0x09, 0x02, 0xEC},
-    {0x17, 0x02, 0xEC},
-    {0x28, 0x03, 0xEC},
-    {0x02, 0x02, 0xED},
-    {0x09, 0x02, 0xED},
-    {0x17, 0x02, 0xED},
-    {0x28, 0x03, 0xED},
-    {0x01, 0x02, 0xC7},
-    {0x16, 0x03, 0xC7},
-    {0x01, 0x02, 0xCF},
-    {0x16, 0x03, 0xCF},
-    {0x01, 0x02, 0xEA},
-    {0x16, 0x03, 0xEA},
-    {0x01, 0x02, 0xEB},
-    {0x16, 0x03, 0xEB},
-  },
-  /* 186 */
-  {
-    {0x03, 0x02, 0xEC},
-    {0x06, 0x02, 0xEC},
-    {0x0A, 0x02, 0xEC},
-    {0x0F, 0x02, 0xEC},
-    {0x18, 0x02, 0xEC},
-    {0x1F, 0x02, 0xEC},
-    {0x29, 0x02, 0xEC},
-    {0x38, 0x03, 0xEC},
-    {0x03, 0x02, 0xED},
-    {0x06, 0x02, 0xED},
-    {0x0A, 0x02, 0xED},
-    {0x0F, 0x02, 0xED},
-    {0x18, 0x02, 0xED},
-    {0x1F, 0x02, 0xED},
-    {0x29, 0x02, 0xED},
-    {0x38, 0x03, 0xED},
-  },
-  /* 187 */
-  {
-    {0x02, 0x02, 0xC7},
-    {0x09, 0x02, 0xC7},
-    {0x17, 0x02, 0xC7},
-    {0x28, 0x03, 0xC7},
-    {0x02, 0x02, 0xCF},
-    {0x09, 0x02, 0xCF},
-    {0x17, 0x02, 0xCF},
-    {0x28, 0x03, 0xCF},
-    {0x02, 0x02, 0xEA},
-    {0x09, 0x02, 0xEA},
-    {0x17, 0x02, 0xEA},
-    {0x28, 0x03, 0xEA},
-    {0x02, 0x02, 0xEB},
-    {0x09, 0x02, 0xEB},
-    {0x17, 0x02, 0xEB},
-    {0x28, 0x03, 0xEB},
-  },
-  /* 188 */
-  {
-    {0x03, 0x02, 0xC7},
-    {0x06, 0x02, 0xC7},
-    {0x0A, 0x02, 0xC7},
-    {0x0F, 0x02, 0xC7},
-    {0x18, 0x02, 0xC7},
-    {0x1F, 0x02, 0xC7},
-    {0x29, 0x02, 0xC7},
-    {0x38, 0x03, 0xC7},
-    {0x03, 0x02, 0xCF},
-    {0x06, 0x02, 0xCF},
-    {0x0A, 0x02, 0xCF},
-    {0x0F, 0x02, 0xCF},
-    {0x18, 0x02, 0xCF},
-    {0x1F, 0x02, 0xCF},
-    {0x29, 0x02, 0xCF},
-    {0x38, 0x03, 0xCF},
-  },
-  /* 189 */
-  {
-    {0x03, 0x02, 0xEA},
-    {0x06, 0x02, 0xEA},
-    {0x0A, 0x02, 0xEA},
-    {0x0F, 0x02, 0xEA},
-    {0x18, 0x02, 0xEA},
-    {0x1F, 0x02, 0xEA},
-    {0x29, 0x02, 0xEA},
-    {0x38, 0x03, 0xEA},
-    {0x03, 0x02, 0xEB},
-    {0x06, 0x02, 0xEB},
-    {0x0A, 0x02, 0xEB},
-    {0x0F, 0x02, 0xEB},
-    {0x18, 0x02, 0xEB},
-    {0x1F, 0x02, 0xEB},
-    {0x29, 0x02, 0xEB},
-    {0x38, 0x03, 0xEB},
-  },
-  /* 190 */
-  {
-    {0xC2, 0x00, 0x00},
-    {0xC3, 0x00, 0x00},
-    {0xC5, 0x00, 0x00},
-    {0xC6, 0x00, 0x00},
-    {0xC9, 0x00, 0x00},
-    {0xCA, 0x00, 0x00},
-    {0xCC, 0x00, 0x00},
-    {0xCD, 0x00, 0x00},
-    {0xD2, 0x00, 0x00},
-    {0xD5, 0x00, 0x00},
-    {0xD9, 0x00, 0x00},
-    {0xDC, 0x00, 0x00},
-    {0xE1, 0x00, 0x00},
-    {0xE7, 0x00, 0x00},
-    {0xEF, 0x00, 0x00},
-    {0xF6, 0x00, 0x00},
-  },
-  /* 191 */
-  {
-    {0x00, 0x03, 0xC0},
-    {0x00, 0x03, 0xC1},
-    {0x00, 0x03, 0xC8},
-    {0x00, 0x03, 0xC9},
-    {0x00, 0x03, 0xCA},
-    {0x00, 0x03, 0xCD},
-    {0x00, 0x03, 0xD2},
-    {0x00, 0x03, 0xD5},
-    {0x00, 0x03, 0xDA},
-    {0x00, 0x03, 0xDB},
-    {0x00, 0x03, 0xEE},
-    {0x00, 0x03, 0xF0},
-    {0x00, 0x03, 0xF2},
-    {0x00, 0x03, 0xF3},
-    {0x00, 0x03, 0xFF},
-    {0xCE, 0x00, 0x00},
-  },
-  /* 192 */
-  {
-    {0x01, 0x02, 0xC0},
-    {0x16, 0x03, 0xC0},
-    {0x01, 0x02, 0xC1},
-    {0x16, 0x03, 0xC1},
-    {0x01, 0x02, 0xC8},
-    {0x16, 0x03, 0xC8},
-    {0x01, 0x02, 0xC9},
-    {0x16, 0x03, 0xC9},
-    {0x01, 0x02, 0xCA},
-    {0x16, 0x03, 0xCA},
-    {0x01, 0x02, 0xCD},
-    {0x16, 0x03, 0xCD},
-    {0x01, 0x02, 0xD2},
-    {0x16, 0x03, 0xD2},
-    {0x01, 0x02, 0xD5},
-    {0x16, 0x03, 0xD5},
-  },
-  /* 193 */
-  {
-    {0x02, 0x02, 0xC0},
-    {0x09, 0x02, 0xC0},
-    {0x17, 0x02, 0xC0},
-    {0x28, 0x03, 0xC0},
-    {0x02, 0x02, 0xC1},
-    {0x09, 0x02, 0xC1},
-    {0x17, 0x02, 0xC1},
-    {0x28, 0x03, 0xC1},
-    {0x02, 0x02, 0xC8},
-    {0x09, 0x02, 0xC8},
-    {0x17, 0x02, 0xC8},
-    {0x28, 0x03, 0xC8},
-    {0x02, 0x02, 0xC9},
-    {0x09, 0x02, 0xC9},
-    {0x17, 0x02, 0xC9},
-    {0x28, 0x03, 0xC9},
-  },
-  /* 194 */
-  {
-    {0x03, 0x02, 0xC0},
-    {0x06, 0x02, 0xC0},
-    {0x0A, 0x02, 0xC0},
-    {0x0F, 0x02, 0xC0},
-    {0x18, 0x02, 0xC0},
-    {0x1F, 0x02, 0xC0},
-    {0x29, 0x02, 0xC0},
-    {0x38, 0x03, 0xC0},
-    {0x03, 0x02, 0xC1},
-    {0x06, 0x02, 0xC1},
-    {0x0A, 0x02, 0xC1},
-    {0x0F, 0x02, 0xC1},
-    {0x18, 0x02, 0xC1},
-    {0x1F, 0x02, 0xC1},
-    {0x29, 0x02, 0xC1},
-    {0x38, 0x03, 0xC1},
-  },
-  /* 195 */
-  {
-    {0x03, 0x02, 0xC8},
-    {0x06, 0x02, 0xC8},
-    {0x0A, 0x02, 0xC8},
-    {0x0F, 0x02, 0xC8},
-    {0x18, 0x02, 0xC8},
-    {0x1F, 0x02, 0xC8},
-    {0x29, 0x02, 0xC8},
-    {0x38, 0x03, 0xC8},
-    {0x03, 0x02, 0xC9},
-    {0x06, 0x02, 0xC9},
-    {0x0A, 0x02, 0xC9},
-    {0x0F, 0x02, 0xC9},
-    {0x18, 0x02, 0xC9},
-    {0x1F, 0x02, 0xC9},
-    {0x29, 0x02, 0xC9},
-    {0x38, 0x03, 0xC9},
-  },
-  /* 196 */
-  {
-    {0x02, 0x02, 0xCA},
-    {0x09, 0x02, 0xCA},
-    {0x17, 0x02, 0xCA},
-    {0x28, 0x03, 0xCA},
-    {0x02, 0x02, 0xCD},
-    {0x09, 0x02, 0xCD},
-    {0x17, 0x02, 0xCD},
-    {0x28, 0x03, 0xCD},
-    {0x02, 0x02, 0xD2},
-    {0x09, 0x02, 0xD2},
-    {0x17, 0x02, 0xD2},
-    {0x28, 0x03, 0xD2},
-    {0x02, 0x02, 0xD5},
-    {0x09, 0x02, 0xD5},
-    {0x17, 0x02, 0xD5},
-    {0x28, 0x03, 0xD5},
-  },
-  /* 197 */
-  {
-    {0x03, 0x02, 0xCA},
-    {0x06, 0x02, 0xCA},
-    {0x0A, 0x02, 0xCA},
-    {0x0F, 0x02, 0xCA},
-    {0x18, 0x02, 0xCA},
-    {0x1F, 0x02, 0xCA},
-    {0x29, 0x02, 0xCA},
-    {0x38, 0x03, 0xCA},
-    {0x03, 0x02, 0xCD},
-    {0x06, 0x02, 0xCD},
-    {0x0A, 0x02, 0xCD},
-    {0x0F, 0x02, 0xCD},
-    {0x18, 0x02, 0xCD},
-    {0x1F, 0x02, 0xCD},
-    {0x29, 0x02, 0xCD},
-    {0x38, 0x03, 0xCD},
-  },
-  /* 198 */
-  {
-    {0x03, 0x02, 0xD2},
-    {0x06, 0x02, 0xD2},
-    {0x0A, 0x02, 0xD2},
-    {0x0F, 0x02, 0xD2},
-    {0x18, 0x02, 0xD2},
-    {0x1F, 0x02, 0xD2},
-    {0x29, 0x02, 0xD2},
-    {0x38, 0x03, 0xD2},
-    {0x03, 0x02, 0xD5},
-    {0x06, 0x02, 0xD5},
-    {0x0A, 0x02, 0xD5},
-    {0x0F, 0x02, 0xD5},
-    {0x18, 0x02, 0xD5},
-    {0x1F, 0x02, 0xD5},
-    {0x29, 0x02, 0xD5},
-    {0x38, 0x03, 0xD5},
-  },
-  /* 199 */
-  {
-    {0x01, 0x02, 0xDA},
-    {0x16, 0x03, 0xDA},
-    {0x01, 0x02, 0xDB},
-    {0x16, 0x03, 0xDB},
-    {0x01, 0x02, 0xEE},
-    {0x16, 0x03, 0xEE},
-    {0x01, 0x02, 0xF0},
-    {0x16, 0x03, 0xF0},
-    {0x01, 0x02, 0xF2},
-    {0x16, 0x03, 0xF2},
-    {0x01, 0x02, 0xF3},
-    {0x16, 0x03, 0xF3},
-    {0x01, 0x02, 0xFF},
-    {0x16, 0x03, 0xFF},
-    {0x00, 0x03, 0xCB},
-    {0x00, 0x03, 0xCC},
-  },
-  /* 200 */
-  {
-    {0x02, 0x02, 0xDA},
-    {0x09, 0x02, 0xDA},
-    {0x17, 0x02, 0xDA},
-    {0x28, 0x03, 0xDA},
-    {0x02, 0x02, 0xDB},
-    {0x09, 0x02, 0xDB},
-    {0x17, 0x02, 0xDB},
-    {0x28, 0x03, 0xDB},
-    {0x02, 0x02, 0xEE},
-    {0x09, 0x02, 0xEE},
-    {0x17, 0x02, 0xEE},
-    {0x28, 0x03, 0xEE},
-    {0x02, 0x02, 0xF0},
-    {0x09, 0x02, 0xF0},
-    {0x17, 0x02, 0xF0},
-    {0x28, 0x03, 0xF0},
-  },
-  /* 201 */
-  {
-    {0x03, 0x02, 0xDA},
-    {0x06, 0x02, 0xDA},
-    {0x0A, 0x02, 0xDA},
-    {0x0F, 0x02, 0xDA},
-    {0x18, 0x02, 0xDA},
-    {0x1F, 0x02, 0xDA},
-    {0x29, 0x02, 0xDA},
-    {0x38, 0x03, 0xDA},
-    {0x03, 0x02, 0xDB},
-    {0x06, 0x02, 0xDB},
-    {0x0A, 0x02, 0xDB},
-    {0x0F, 0x02, 0xDB},
-    {0x18, 0x02, 0xDB},
-    {0x1F, 0x02, 0xDB},
-    {0x29, 0x02, 0xDB},
-    {0x38, 0x03, 0xDB},
-  },
-  /* 202 */
-  {
-    {0x03, 0x02, 0xEE},
-    {0x06, 0x02, 0xEE},
-    {0x0A, 0x02, 0xEE},
-    {0x0F, 0x02, 0xEE},
-    {0x18, 0x02, 0xEE},
-    {0x1F, 0x02, 0xEE},
-    {0x29, 0x02, 0xEE},
-    {0x38, 0x03, 0xEE},
-    {0x03, 0x02, 0xF0},
-    {0x06, 0x02, 0xF0},
-    {0x0A, 0x02, 0xF0},
-    {0x0F, 0x02, 0xF0},
-    {0x18, 0x02, 0xF0},
-    {0x1F, 0x02, 0xF0},
-    {0x29, 0x02, 0xF0},
-    {0x38, 0x03, 0xF0},
-  },
-  /* 203 */
-  {
-    {0x02, 0x02, 0xF2},
-    {0x09, 0x02, 0xF2},
-    {0x17, 0x02, 0xF2},
-    {0x28, 0x03, 0xF2},
-    {0x02, 0x02, 0xF3},
-    {0x09, 0x02, 0xF3},
-    {0x17, 0x02, 0xF3},
-    {0x28, 0x03, 0xF3},
-    {0x02, 0x02, 0xFF},
-    {0x09, 0x02, 0xFF},
-    {0x17, 0x02, 0xFF},
-    {0x28, 0x03, 0xFF},
-    {0x01, 0x02, 0xCB},
-    {0x16, 0x03, 0xCB},
-    {0x01, 0x02, 0xCC},
-    {0x16, 0x03, 0xCC},
-  },
-  /* 204 */
-  {
-    {0x03, 0x02, 0xF2},
-    {0x06, 0x02, 0xF2},
-    {0x0A, 0x02, 0xF2},
-    {0x0F, 0x02, 0xF2},
-    {0x18, 0x02, 0xF2},
-    {0x1F, 0x02, 0xF2},
-    {0x29, 0x02, 0xF2},
-    {0x38, 0x03, 0xF2},
-    {0x03, 0x02, 0xF3},
-    {0x06, 0x02, 0xF3},
-    {0x0A, 0x02, 0xF3},
-    {0x0F, 0x02, 0xF3},
-    {0x18, 0x02, 0xF3},
-    {0x1F, 0x02, 0xF3},
-    {0x29, 0x02, 0xF3},
-    {0x38, 0x03, 0xF3},
-  },
-  /* 205 */
-  {
-    {0x03, 0x02, 0xFF},
-    {0x06, 0x02, 0xFF},
-    {0x0A, 0x02, 0xFF},
-    {0x0F, 0x02, 0xFF},
-    {0x18, 0x02, 0xFF},
-    {0x1F, 0x02, 0xFF},
-    {0x29, 0x02, 0xFF},
-    {0x38, 0x03, 0xFF},
-    {0x02, 0x02, 0xCB},
-    {0x09, 0x02, 0xCB},
-    {0x17, 0x02, 0xCB},
-    {0x28, 0x03, 0xCB},
-    {0x02, 0x02, 0xCC},
-    {0x09, 0x02, 0xCC},
-    {0x17, 0x02, 0xCC},
-    {0x28, 0x03, 0xCC},
-  },
-  /* 206 */
-  {
-    {0x03, 0x02, 0xCB},
-    {0x06, 0x02, 0xCB},
-    {0x0A, 0x02, 0xCB},
-    {0x0F, 0x02, 0xCB},
-    {0x18, 0x02, 0xCB},
-    {0x1F, 0x02, 0xCB},
-    {0x29, 0x02, 0xCB},
-    {0x38, 0x03, 0xCB},
-    {0x03, 0x02, 0xCC},
-    {0x06, 0x02, 0xCC},
-    {0x0A, 0x02, 0xCC},
-    {0x0F, 0x02, 0xCC},
-    {0x18, 0x02, 0xCC},
-    {0x1F, 0x02, 0xCC},
-    {0x29, 0x02, 0xCC},
-    {0x38, 0x03, 0xCC},
-  },
-  /* 207 */
-  {
-    {0xD3, 0x00, 0x00},
-    {0xD4, 0x00, 0x00},
-    {0xD6, 0x00, 0x00},
-    {0xD7, 0x00, 0x00},
-    {0xDA, 0x00, 0x00},
-    {0xDB, 0x00, 0x00},
-    {0xDD, 0x00, 0x00},
-    {0xDE, 0x00, 0x00},
-    {0xE2, 0x00, 0x00},
-    {0xE4, 0x00, 0x00},
-    {0xE8, 0x00, 0x00},
-    {0xEB, 0x00, 0x00},
-    {0xF0, 0x00, 0x00},
-    {0xF3, 0x00, 0x00},
-    {0xF7, 0x00, 0x00},
-    {0xFA, 0x00, 0x00},
-  },
-  /* 208 */
-  {
-    {0x00, 0x03, 0xD3},
-    {0x00, 0x03, 0xD4},
-    {0x00, 0x03, 0xD6},
-    {0x00, 0x03, 0xDD},
-    {0x00, 0x03, 0xDE},
-    {0x00, 0x03, 0xDF},
-    {0x00, 0x03, 0xF1},
-    {0x00, 0x03, 0xF4},
-    {0x00, 0x03, 0xF5},
-    {0x00, 0x03, 0xF6},
-    {0x00, 0x03, 0xF7},
-    {0x00, 0x03, 0xF8},
-    {0x00, 0x03, 0xFA},
-    {0x00, 0x03, 0xFB},
-    {0x00, 0x03, 0xFC},
-    {0x00, 0x03, 0xFD},
-  },
-  /* 209 */
-  {
-    {0x01, 0x02, 0xD3},
-    {0x16, 0x03, 0xD3},
-    {0x01, 0x02, 0xD4},
-    {0x16, 0x03, 0xD4},
-    {0x01, 0x02, 0xD6},
-    {0x16, 0x03, 0xD6},
-    {0x01, 0x02, 0xDD},
-    {0x16, 0x03, 0xDD},
-    {0x01, 0x02, 0xDE},
-    {0x16, 0x03, 0xDE},
-    {0x01, 0x02, 0xDF},
-    {0x16, 0x03, 0xDF},
-    {0x01, 0x02, 0xF1},
-    {0x16, 0x03, 0xF1},
-    {0x01, 0x02, 0xF4},
-    {0x16, 0x03, 0xF4},
-  },
-  /* 210 */
-  {
-    {0x02, 0x02, 0xD3},
-    {0x09, 0x02, 0xD3},
-    {0x17, 0x02, 0xD3},
-    {0x28, 0x03, 0xD3},
-    {0x02, 0x02, 0xD4},
-    {0x09, 0x02, 0xD4},
-    {0x17, 0x02, 0xD4},
-    {0x28, 0x03, 0xD4},
-    {0x02, 0x02, 0xD6},
-    {0x09, 0x02, 0xD6},
-    {0x17, 0x02, 0xD6},
-    {0x28, 0x03, 0xD6},
-    {0x02, 0x02, 0xDD},
-    {0x09, 0x02, 0xDD},
-    {0x17, 0x02, 0xDD},
-    {0x28, 0x03, 0xDD},
-  },
-  /* 211 */
-  {
-    {0x03, 0x02, 0xD3},
-    {0x06, 0x02, 0xD3},
-    {0x0A, 0x02, 0xD3},
-    {0x0F, 0x02, 0xD3},
-    {0x18, 0x02, 0xD3},
-    {0x1F, 0x02, 0xD3},
-    {0x29, 0x02, 0xD3},
-    {0x38, 0x03, 0xD3},
-    {0x03, 0x02, 0xD4},
-    {0x06, 0x02, 0xD4},
-    {0x0A, 0x02, 0xD4},
-    {0x0F, 0x02, 0xD4},
-    {0x18, 0x02, 0xD4},
-    {0x1F, 0x02, 0xD4},
-    {0x29, 0x02, 0xD4},
-    {0x38, 0x03, 0xD4},
-  },
-  /* 212 */
-  {
-    {0x03, 0x02, 0xD6},
-    {0x06, 0x02, 0xD6},
-    {0x0A, 0x02, 0xD6},
-    {0x0F, 0x02, 0xD6},
-    {0x18, 0x02, 0xD6},
-    {0x1F, 0x02, 0xD6},
-    {0x29, 0x02, 0xD6},
-    {0x38, 0x03, 0xD6},
-    {0x03, 0x02, 0xDD},
-    {0x06, 0x02, 0xDD},
-    {0x0A, 0x02, 0xDD},
-    {0x0F, 0x02, 0xDD},
-    {0x18, 0x02, 0xDD},
-    {0x1F, 0x02, 0xDD},
-    {0x29, 0x02, 0xDD},
-    {0x38, 0x03, 0xDD},
-  },
-  /* 213 */
-  {
-    {0x02, 0x02, 0xDE},
-    {0x09, 0x02, 0xDE},
-    {0x17, 0x02, 0xDE},
-    {0x28, 0x03, 0xDE},
-    {0x02, 0x02, 0xDF},
-    {0x09, 0x02, 0xDF},
-    {0x17, 0x02, 0xDF},
-    {0x28, 0x03, 0xDF},
-    {0x02, 0x02, 0xF1},
-    {0x09, 0x02, 0xF1},
-    {0x17, 0x02, 0xF1},
-    {0x28, 0x03, 0xF1},
-    {0x02, 0x02, 0xF4},
-    {0x09, 0x02, 0xF4},
-    {0x17, 0x02, 0xF4},
-    {0x28, 0x03, 0xF4},
-  },
-  /* 214 */
-  {
-    {0x03, 0x02, 0xDE},
-    {0x06, 0x02, 0xDE},
-    {0x0A, 0x02, 0xDE},
-    {0x0F, 0x02, 0xDE},
-    {0x18, 0x02, 0xDE},
-    {0x1F, 0x02, 0xDE},
-    {0x29, 0x02, 0xDE},
-    {0x38, 0x03, 0xDE},
-    {0x03, 0x02, 0xDF},
-    {0x06, 0x02, 0xDF},
-    {0x0A, 0x02, 0xDF},
-    {0x0F, 0x02, 0xDF},
-    {0x18, 0x02, 0xDF},
-    {0x1F, 0x02, 0xDF},
-    {0x29, 0x02, 0xDF},
-    {0x38, 0x03, 0xDF},
-  },
-  /* 215 */
-  {
-    {0x03, 0x02, 0xF1},
-    {0x06, 0x02, 0xF1},
-    {0x0A, 0x02, 0xF1},
-    {0x0F, 0x02, 0xF1},
-    {0x18, 0x02, 0xF1},
-    {0x1F, 0x02, 0xF1},
-    {0x29, 0x02, 0xF1},
-    {0x38, 0x03, 0xF1},
-    {0x03, 0x02, 0xF4},
-    {0x06, 0x02, 0xF4},
-    {0x0A, 0x02, 0xF4},
-    {0x0F, 0x02, 0xF4},
-    {0x18, 0x02, 0xF4},
-    {0x1F, 0x02, 0xF4},
-    {0x29, 0x02, 0xF4},
-    {0x38, 0x03, 0xF4},
-  },
-  /* 216 */
-  {
-    {0x01, 0x02, 0xF5},
-    {0x16, 0x03, 0xF5},
-    {0x01, 0x02, 0xF6},
-    {0x16, 0x03, 0xF6},
-    {0x01, 0x02, 0xF7},
-    {0x16, 0x03, 0xF7},
-    {0x01, 0x02, 0xF8},
-    {0x16, 0x03, 0xF8},
-    {0x01, 0x02, 0xFA},
-    {0x16, 0x03, 0xFA},
-    {0x01, 0x02, 0xFB},
-    {0x16, 0x03, 0xFB},
-    {0x01, 0x02, 0xFC},
-    {0x16, 0x03, 0xFC},
-    {0x01, 0x02, 0xFD},
-    {0x16, 0x03, 0xFD},
-  },
-  /* 217 */
-  {
-    {0x02, 0x02, 0xF5},
-    {0x09, 0x02, 0xF5},
-    {0x17, 0x02, 0xF5},
-    {0x28, 0x03, 0xF5},
-    {0x02, 0x02, 0xF6},
-    {0x09, 0x02, 0xF6},
-    {0x17, 0x02, 0xF6},
-    {0x28, 0x03, 0xF6},
-    {0x02, 0x02, 0xF7},
-    {0x09, 0x02, 0xF7},
-    {0x17, 0x02, 0xF7},
-    {0x28, 0x03, 0xF7},
-    {0x02, 0x02, 0xF8},
-    {0x09, 0x02, 0xF8},
-    {0x17, 0x02, 0xF8},
-    {0x28, 0x03, 0xF8},
-  },
-  /* 218 */
-  {
-    {0x03, 0x02, 0xF5},
-    {0x06, 0x02, 0xF5},
-    {0x0A, 0x02, 0xF5},
-    {0x0F, 0x02, 0xF5},
-    {0x18, 0x02, 0xF5},
-    {0x1F, 0x02, 0xF5},
-    {0x29, 0x02, 0xF5},
-    {0x38, 0x03, 0xF5},
-    {0x03, 0x02, 0xF6},
-    {0x06, 0x02, 0xF6},
-    {0x0A, 0x02, 0xF6},
-    {0x0F, 0x02, 0xF6},
-    {0x18, 0x02, 0xF6},
-    {0x1F, 0x02, 0xF6},
-    {0x29, 0x02, 0xF6},
-    {0x38, 0x03, 0xF6},
-  },
-  /* 219 */
-  {
-    {0x03, 0x02, 0xF7},
-    {0x06, 0x02, 0xF7},
-    {0x0A, 0x02, 0xF7},
-    {0x0F, 0x02, 0xF7},
-    {0x18, 0x02, 0xF7},
-    {0x1F, 0x02, 0xF7},
-    {0x29, 0x02, 0xF7},
-    {0x38, 0x03, 0xF7},
-    {0x03, 0x02, 0xF8},
-    {0x06, 0x02, 0xF8},
-    {0x0A, 0x02, 0xF8},
-    {0x0F, 0x02, 0xF8},
-    {0x18, 0x02, 0xF8},
-    {0x1F, 0x02, 0xF8},
-    {0x29, 0x02, 0xF8},
-    {0x38, 0x03, 0xF8},
-  },
-  /* 220 */
-  {
-    {0x02, 0x02, 0xFA},
-    {0x09, 0x02, 0xFA},
-    {0x17, 0x02, 0xFA},
-    {0x28, 0x03, 0xFA},
-    {0x02, 0x02, 0xFB},
-    {0x09, 0x02, 0xFB},
-    {0x17, 0x02, 0xFB},
-    {0x28, 0x03, 0xFB},
-    {0x02, 0x02, 0xFC},
-    {0x09, 0x02, 0xFC},
-    {0x17, 0x02, 0xFC},
-    {0x28, 0x03, 0xFC},
-    {0x02, 0x02, 0xFD},
-    {0x09, 0x02, 0xFD},
-    {0x17, 0x02, 0xFD},
-    {0x28, 0x03, 0xFD},
-  },
-  /* 221 */
-  {
-    {0x03, 0x02, 0xFA},
-    {0x06, 0x02, 0xFA},
-    {0x0A, 0x02, 0xFA},
-    {0x0F, 0x02, 0xFA},
-    {0x18, 0x02, 0xFA},
-    {0x1F, 0x02, 0xFA},
-    {0x29, 0x02, 0xFA},
-    {0x38, 0x03, 0xFA},
-    {0x03, 0x02, 0xFB},
-    {0x06, 0x02, 0xFB},
-    {0x0A, 0x02, 0xFB},
-    {0x0F, 0x02, 0xFB},
-    {0x18, 0x02, 0xFB},
-    {0x1F, 0x02, 0xFB},
-    {0x29, 0x02, 0xFB},
-    {0x38, 0x03, 0xFB},
-  },
-  /* 222 */
-  {
-    {0x03, 0x02, 0xFC},
-    {0x06, 0x02, 0xFC},
-    {0x0A, 0x02, 0xFC},
-    {0x0F, 0x02, 0xFC},
-    {0x18, 0x02, 0xFC},
-    {0x1F, 0x02, 0xFC},
-    {0x29, 0x02, 0xFC},
-    {0x38, 0x03, 0xFC},
-    {0x03, 0x02, 0xFD},
-    {0x06, 0x02, 0xFD},
-    {0x0A, 0x02, 0xFD},
-    {0x0F, 0x02, 0xFD},
-    {0x18, 0x02, 0xFD},
-    {0x1F, 0x02, 0xFD},
-    {0x29, 0x02, 0xFD},
-    {0x38, 0x03, 0xFD},
-  },
-  /* 223 */
-  {
-    {0x00, 0x03, 0xFE},
-    {0xE3, 0x00, 0x00},
-    {0xE5, 0x00, 0x00},
-    {0xE6, 0x00, 0x00},
-    {0xE9, 0x00, 0x00},
-    {0xEA, 0x00, 0x00},
-    {0xEC, 0x00, 0x00},
-    {0xED, 0x00, 0x00},
-    {0xF1, 0x00, 0x00},
-    {0xF2, 0x00, 0x00},
-    {0xF4, 0x00, 0x00},
-    {0xF5, 0x00, 0x00},
-    {0xF8, 0x00, 0x00},
-    {0xF9, 0x00, 0x00},
-    {0xFB, 0x00, 0x00},
-    {0xFC, 0x00, 0x00},
-  },
-  /* 224 */
-  {
-    {0x01, 0x02, 0xFE},
-    {0x16, 0x03, 0xFE},
-    {0x00, 0x03, 0x02},
-    {0x00, 0x03, 0x03},
-    {0x00, 0x03, 0x04},
-    {0x00, 0x03, 0x05},
-    {0x00, 0x03, 0x06},
-    {0x00, 0x03, 0x07},
-    {0x00, 0x03, 0x08},
-    {0x00, 0x03, 0x0B},
-    {0x00, 0x03, 0x0C},
-    {0x00, 0x03, 0x0E},
-    {0x00, 0x03, 0x0F},
-    {0x00, 0x03, 0x10},
-    {0x00, 0x03, 0x11},
-    {0x00, 0x03, 0x12},
-  },
-  /* 225 */
-  {
-    {0x02, 0x02, 0xFE},
-    {0x09, 0x02, 0xFE},
-    {0x17, 0x02, 0xFE},
-    {0x28, 0x03, 0xFE},
-    {0x01, 0x02, 0x02},
-    {0x16, 0x03, 0x02},
-    {0x01, 0x02, 0x03},
-    {0x16, 0x03, 0x03},
-    {0x01, 0x02, 0x04},
-    {0x16, 0x03, 0x04},
-    {0x01, 0x02, 0x05},
-    {0x16, 0x03, 0x05},
-    {0x01, 0x02, 0x06},
-    {0x16, 0x03, 0x06},
-    {0x01, 0x02, 0x07},
-    {0x16, 0x03, 0x07},
-  },
-  /* 226 */
-  {
-    {0x03, 0x02, 0xFE},
-    {0x06, 0x02, 0xFE},
-    {0x0A, 0x02, 0xFE},
-    {0x0F, 0x02, 0xFE},
-    {0x18, 0x02, 0xFE},
-    {0x1F, 0x02, 0xFE},
-    {0x29, 0x02, 0xFE},
-    {0x38, 0x03, 0xFE},
-    {0x02, 0x02, 0x02},
-    {0x09, 0x02, 0x02},
-    {0x17, 0x02, 0x02},
-    {0x28, 0x03, 0x02},
-    {0x02, 0x02, 0x03},
-    {0x09, 0x02, 0x03},
-    {0x17, 0x02, 0x03},
-    {0x28, 0x03, 0x03},
-  },
-  /* 227 */
-  {
-    {0x03, 0x02, 0x02},
-    {0x06, 0x02, 0x02},
-    {0x0A, 0x02, 0x02},
-    {0x0F, 0x02, 0x02},
-    {0x18, 0x02, 0x02},
-    {0x1F, 0x02, 0x02},
-    {0x29, 0x02, 0x02},
-    {0x38, 0x03, 0x02},
-    {0x03, 0x02, 0x03},
-    {0x06, 0x02, 0x03},
-    {0x0A, 0x02, 0x03},
-    {0x0F, 0x02, 0x03},
-    {0x18, 0x02, 0x03},
-    {0x1F, 0x02, 0x03},
-    {0x29, 0x02, 0x03},
-    {0x38, 0x03, 0x03},
-  },
-  /* 228 */
-  {
-    {0x02, 0x02, 0x04},
-    {0x09, 0x02, 0x04},
-    {0x17, 0x02, 0x04},
-    {0x28, 0x03, 0x04},
-    {0x02, 0x02, 0x05},
-    {0x09, 0x02, 0x05},
-    {0x17, 0x02, 0x05},
-    {0x28, 0x03, 0x05},
-    {0x02, 0x02, 0x06},
-    {0x09, 0x02, 0x06},
-    {0x17, 0x02, 0x06},
-    {0x28, 0x03, 0x06},
-    {0x02, 0x02, 0x07},
-    {0x09, 0x02, 0x07},
-    {0x17, 0x02, 0x07},
-    {0x28, 0x03, 0x07},
-  },
-  /* 229 */
-  {
-    {0x03, 0x02, 0x04},
-    {0x06, 0x02, 0x04},
-    {0x0A, 0x02, 0x04},
-    {0x0F, 0x02, 0x04},
-    {0x18, 0x02, 0x04},
-    {0x1F, 0x02, 0x04},
-    {0x29, 0x02, 0x04},
-    {0x38, 0x03, 0x04},
-    {0x03, 0x02, 0x05},
-    {0x06, 0x02, 0x05},
-    {0x0A, 0x02, 0x05},
-    {0x0F, 0x02, 0x05},
-    {0x18, 0x02, 0x05},
-    {0x1F, 0x02, 0x05},
-    {0x29, 0x02, 0x05},
-    {0x38, 0x03, 0x05},
-  },
-  /* 230 */
-  {
-    {0x03, 0x02, 0x06},
-    {0x06, 0x02, 0x06},
-    {0x0A, 0x02, 0x06},
-    {0x0F, 0x02, 0x06},
-    {0x18, 0x02, 0x06},
-    {0x1F, 0x02, 0x06},
-    {0x29, 0x02, 0x06},
-    {0x38, 0x03, 0x06},
-    {0x03, 0x02, 0x07},
-    {0x06, 0x02, 0x07},
-    {0x0A, 0x02, 0x07},
-    {0x0F, 0x02, 0x07},
-    {0x18, 0x02, 0x07},
-    {0x1F, 0x02, 0x07},
-    {0x29, 0x02, 0x07},
-    {0x38, 0x03, 0x07},
-  },
-  /* 231 */
-  {
-    {0x01, 0x02, 0x08},
-    {0x16, 0x03, 0x08},
-    {0x01, 0x02, 0x0B},
-    {0x16, 0x03, 0x0B},
-    {0x01, 0x02, 0x0C},
-    {0x16, 0x03, 0x0C},
-    {0x01, 0x02, 0x0E},
-    {0x16, 0x03, 0x0E},
-    {0x01, 0x02, 0x0F},
-    {0x16, 0x03, 0x0F},
-    {0x01, 0x02, 0x10},
-    {0x16, 0x03, 0x10},
-    {0x01, 0x02, 0x11},
-    {0x16, 0x03, 0x11},
-    {0x01, 0x02, 0x12},
-    {0x16, 0x03, 0x12},
-  },
-  /* 232 */
-  {
-    {0x02, 0x02, 0x08},
-    {0x09, 0x02, 0x08},
-    {0x17, 0x02, 0x08},
-    {0x28, 0x03, 0x08},
-    {0x02, 0x02, 0x0B},
-    {0x09, 0x02, 0x0B},
-    {0x17, 0x02, 0x0B},
-    {0x28, 0x03, 0x0B},
-    {0x02, 0x02, 0x0C},
-    {0x09, 0x02, 0x0C},
-    {0x17, 0x02, 0x0C},
-    {0x28, 0x03, 0x0C},
-    {0x02, 0x02, 0x0E},
-    {0x09, 0x02, 0x0E},
-    {0x17, 0x02, 0x0E},
-    {0x28, 0x03, 0x0E},
-  },
-  /* 233 */
-  {
-    {0x03, 0x02, 0x08},
-    {0x06, 0x02, 0x08},
-    {0x0A, 0x02, 0x08},
-    {0x0F, 0x02, 0x08},
-    {0x18, 0x02, 0x08},
-    {0x1F, 0x02, 0x08},
-    {0x29, 0x02, 0x08},
-    {0x38, 0x03, 0x08},
-    {0x03, 0x02, 0x0B},
-    {0x06, 0x02, 0x0B},
-    {0x0A, 0x02, 0x0B},
-    {0x0F, 0x02, 0x0B},
-    {0x18, 0x02, 0x0B},
-    {0x1F, 0x02, 0x0B},
-    {0x29, 0x02, 0x0B},
-    {0x38, 0x03, 0x0B},
-  },
-  /* 234 */
-  {
-    {0x03, 0x02, 0x0C},
-    {0x06, 0x02, 0x0C},
-    {0x0A, 0x02, 0x0C},
-    {0x0F, 0x02, 0x0C},
-    {0x18, 0x02, 0x0C},
-    {0x1F, 0x02, 0x0C},
-    {0x29, 0x02, 0x0C},
-    {0x38, 0x03, 0x0C},
-    {0x03, 0x02, 0x0E},
-    {0x06, 0x02, 0x0E},
-    {0x0A, 0x02, 0x0E},
-    {0x0F, 0x02, 0x0E},
-    {0x18, 0x02, 0x0E},
-    {0x1F, 0x02, 0x0E},
-    {0x29, 0x02, 0x0E},
-    {0x38, 0x03, 0x0E},
-  },
-  /* 235 */
-  {
-    {0x02, 0x02, 0x0F},
-    {0x09, 0x02, 0x0F},
-    {0x17, 0x02, 0x0F},
-    {0x28, 0x03, 0x0F},
-    {0x02, 0x02, 0x10},
-    {0x09, 0x02, 0x10},
-    {0x17, 0x02, 0x10},
-    {0x28, 0x03, 0x10},
-    {0x02, 0x02, 0x11},
-    {0x09, 0x02, 0x11},
-    {0x17, 0x02, 0x11},
-    {0x28, 0x03, 0x11},
-    {0x02, 0x02, 0x12},
-    {0x09, 0x02, 0x12},
-    {0x17, 0x02, 0x12},
-    {0x28, 0x03, 0x12},
-  },
-  /* 236 */
-  {
-    {0x03, 0x02, 0x0F},
-    {0x06, 0x02, 0x0F},
-    {0x0A, 0x02, 0x0F},
-    {0x0F, 0x02, 0x0F},
-    {0x18, 0x02, 0x0F},
-    {0x1F, 0x02, 0x0F},
-    {0x29, 0x02, 0x0F},
-    {0x38, 0x03, 0x0F},
-    {0x03, 0x02, 0x10},
-    {0x06, 0x02, 0x10},
-    {0x0A, 0x02, 0x10},
-    {0x0F, 0x02, 0x10},
-    {0x18, 0x02, 0x10},
-    {0x1F, 0x02, 0x10},
-    {0x29, 0x02, 0x10},
-    {0x38, 0x03, 0x10},
-  },
-  /* 237 */
-  {
-    {0x03, 0x02, 0x11},
-    {0x06, 0x02, 0x11},
-    {0x0A, 0x02, 0x11},
-    {0x0F, 0x02, 0x11},
-    {0x18, 0x02, 0x11},
-    {0x1F, 0x02, 0x11},
-    {0x29, 0x02, 0x11},
-    {0x38, 0x03, 0x11},
-    {0x03, 0x02, 0x12},
-    {0x06, 0x02, 0x12},
-    {0x0A, 0x02, 0x12},
-    {0x0F, 0x02, 0x12},
-    {0x18, 0x02, 0x12},
-    {0x1F, 0x02, 0x12},
-    {0x29, 0x02, 0x12},
-    {0x38, 0x03, 0x12},
-  },
-  /* 238 */
-  {
-    {0x00, 0x03, 0x13},
-    {0x00, 0x03, 0x14},
-    {0x00, 0x03, 0x15},
-    {0x00, 0x03, 0x17},
-    {0x00, 0x03, 0x18},
-    {0x00, 0x03, 0x19},
-    {0x00, 0x03, 0x1A},
-    {0x00, 0x03, 0x1B},
-    {0x00, 0x03, 0x1C},
-    {0x00, 0x03, 0x1D},
-    {0x00, 0x03, 0x1E},
-    {0x00, 0x03, 0x1F},
-    {0x00, 0x03, 0x7F},
-    {0x00, 0x03, 0xDC},
-    {0x00, 0x03, 0xF9},
-    {0xFD, 0x00, 0x00},
-  },
-  /* 239 */
-  {
-    {0x01, 0x02, 0x13},
-    {0x16, 0x03, 0x13},
-    {0x01, 0x02, 0x14},
-    {0x16, 0x03, 0x14},
-    {0x01, 0x02, 0x15},
-    {0x16, 0x03, 0x15},
-    {0x01, 0x02, 0x17},
-    {0x16, 0x03, 0x17},
-    {0x01, 0x02, 0x18},
-    {0x16, 0x03, 0x18},
-    {0x01, 0x02, 0x19},
-    {0x16, 0x03, 0x19},
-    {0x01, 0x02, 0x1A},
-    {0x16, 0x03, 0x1A},
-    {0x01, 0x02, 0x1B},
-    {0x16, 0x03, 0x1B},
-  },
-  /* 240 */
-  {
-    {0x02, 0x02, 0x13},
-    {0x09, 0x02, 0x13},
-    {0x17, 0x02, 0x13},
-    {0x28, 0x03, 0x13},
-    {0x02, 0x02, 0x14},
-    {0x09, 0x02, 0x14},
-    {0x17, 0x02, 0x14},
-    {0x28, 0x03, 0x14},
-    {0x02, 0x02, 0x15},
-    {0x09, 0x02, 0x15},
-    {0x17, 0x02, 0x15},
-    {0x28, 0x03, 0x15},
-    {0x02, 0x02, 0x17},
-    {0x09, 0x02, 0x17},
-    {0x17, 0x02, 0x17},
-    {0x28, 0x03, 0x17},
-  },
-  /* 241 */
-  {
-    {0x03, 0x02, 0x13},
-    {0x06, 0x02, 0x13},
-    {0x0A, 0x02, 0x13},
-    {0x0F, 0x02, 0x13},
-    {0x18, 0x02, 0x13},
-    {0x1F, 0x02, 0x13},
-    {0x29, 0x02, 0x13},
-    {0x38, 0x03, 0x13},
-    {0x03, 0x02, 0x14},
-    {0x06, 0x02, 0x14},
-    {0x0A, 0x02, 0x14},
-    {0x0F, 0x02, 0x14},
-    {0x18, 0x02, 0x14},
-    {0x1F, 0x02, 0x14},
-    {0x29, 0x02, 0x14},
-    {0x38, 0x03, 0x14},
-  },
-  /* 242 */
-  {
-    {0x03, 0x02, 0x15},
-    {0x06, 0x02, 0x15},
-    {0x0A, 0x02, 0x15},
-    {0x0F, 0x02, 0x15},
-    {0x18, 0x02, 0x15},
-    {0x1F, 0x02, 0x15},
-    {0x29, 0x02, 0x15},
-    {0x38, 0x03, 0x15},
-    {0x03, 0x02, 0x17},
-    {0x06, 0x02, 0x17},
-    {0x0A, 0x02, 0x17},
-    {0x0F, 0x02, 0x17},
-    {0x18, 0x02, 0x17},
-    {0x1F, 0x02, 0x17},
-    {0x29, 0x02, 0x17},
-    {0x38, 0x03, 0x17},
-  },
-  /* 243 */
-  {
-    {0x02, 0x02, 0x18},
-    {0x09, 0x02, 0x18},
-    {0x17, 0x02, 0x18},
-    {0x28, 0x03, 0x18},
-    {0x02, 0x02, 0x19},
-    {0x09, 0x02, 0x19},
-    {0x17, 0x02, 0x19},
-    {0x28, 0x03, 0x19},
-    {0x02, 0x02, 0x1A},
-    {0x09, 0x02, 0x1A},
-    {0x17, 0x02, 0x1A},
-    {0x28, 0x03, 0x1A},
-    {0x02, 0x02, 0x1B},
-    {0x09, 0x02, 0x1B},
-    {0x17, 0x02, 0x1B},
-    {0x28, 0x03, 0x1B},
-  },
-  /* 244 */
-  {
-    {0x03, 0x02, 0x18},
-    {0x06, 0x02, 0x18},
-    {0x0A, 0x02, 0x18},
-    {0x0F, 0x02, 0x18},
-    {0x18, 0x02, 0x18},
-    {0x1F, 0x02, 0x18},
-    {0x29, 0x02, 0x18},
-    {0x38, 0x03, 0x18},
-    {0x03, 0x02, 0x19},
-    {0x06, 0x02, 0x19},
-    {0x0A, 0x02, 0x19},
-    {0x0F, 0x02, 0x19},
-    {0x18, 0x02, 0x19},
-    {0x1F, 0x02, 0x19},
-    {0x29, 0x02, 0x19},
-    {0x38, 0x03, 0x19},
-  },
-  /* 245 */
-  {
-    {0x03, 0x02, 0x1A},
-    {0x06, 0x02, 0x1A},
-    {0x0A, 0x02, 0x1A},
-    {0x0F, 0x02, 0x1A},
-    {0x18, 0x02, 0x1A},
-    {0x1F, 0x02, 0x1A},
-    {0x29, 0x02, 0x1A},
-    {0x38, 0x03, 0x1A},
-    {0x03, 0x02, 0x1B},
-    {0x06, 0x02, 0x1B},
-    {0x0A, 0x02, 0x1B},
-    {0x0F, 0x02, 0x1B},
-    {0x18, 0x02, 0x1B},
-    {0x1F, 0x02, 0x1B},
-    {0x29, 0x02, 0x1B},
-    {0x38, 0x03, 0x1B},
-  },
-  /* 246 */
-  {
-    {0x01, 0x02, 0x1C},
-    {0x16, 0x03, 0x1C},
-    {0x01, 0x02, 0x1D},
-    {0x16, 0x03, 0x1D},
-    {0x01, 0x02, 0x1E},
-    {0x16, 0x03, 0x1E},
-    {0x01, 0x02, 0x1F},
-    {0x16, 0x03, 0x1F},
-    {0x01, 0x02, 0x7F},
-    {0x16, 0x03, 0x7F},
-    {0x01, 0x02, 0xDC},
-    {0x16, 0x03, 0xDC},
-    {0x01, 0x02, 0xF9},
-    {0x16, 0x03, 0xF9},
-    {0xFE, 0x00, 0x00},
-    {0xFF, 0x00, 0x00},
-  },
-  /* 247 */
-  {
-    {0x02, 0x02, 0x1C},
-    {0x09, 0x02, 0x1C},
-    {0x17, 0x02, 0x1C},
-    {0x28, 0x03, 0x1C},
-    {0x02, 0x02, 0x1D},
-    {0x09, 0x02, 0x1D},
-    {0x17, 0x02, 0x1D},
-    {0x28, 0x03, 0x1D},
-    {0x02, 0x02, 0x1E},
-    {0x09, 0x02, 0x1E},
-    {0x17, 0x02, 0x1E},
-    {0x28, 0x03, 0x1E},
-    {0x02, 0x02, 0x1F},
-    {0x09, 0x02, 0x1F},
-    {0x17, 0x02, 0x1F},
-    {0x28, 0x03, 0x1F},
-  },
-  /* 248 */
-  {
-    {0x03, 0x02, 0x1C},
-    {0x06, 0x02, 0x1C},
-    {0x0A, 0x02, 0x1C},
-    {0x0F, 0x02, 0x1C},
-    {0x18, 0x02, 0x1C},
-    {0x1F, 0x02, 0x1C},
-    {0x29, 0x02, 0x1C},
-    {0x38, 0x03, 0x1C},
-    {0x03, 0x02, 0x1D},
-    {0x06, 0x02, 0x1D},
-    {0x0A, 0x02, 0x1D},
-    {0x0F, 0x02, 0x1D},
-    {0x18, 0x02, 0x1D},
-    {0x1F, 0x02, 0x1D},
-    {0x29, 0x02, 0x1D},
-    {0x38, 0x03, 0x1D},
-  },
-  /* 249 */
-  {
-    {0x03, 0x02, 0x1E},
-    {0x06, 0x02, 0x1E},
-    {0x0A, 0x02, 0x1E},
-    {0x0F, 0x02, 0x1E},
-    {0x18, 0x02, 0x1E},
-    {0x1F, 0x02, 0x1E},
-    {0x29, 0x02, 0x1E},
-    {0x38, 0x03, 0x1E},
-    {0x03, 0x02, 0x1F},
-    {0x06, 0x02, 0x1F},
-    {0x0A, 0x02, 0x1F},
-    {0x0F, 0x02, 0x1F},
-    {0x18, 0x02, 0x1F},
-    {0x1F, 0x02, 0x1F},
-    {0x29, 0x02, 0x1F},
-    {0x38, 0x03, 0x1F},
-  },
-  /* 250 */
-  {
-    {0x02, 0x02, 0x7F},
-    {0x09, 0x02, 0x7F},
-    {0x17, 0x02, 0x7F},
-    {0x28, 0x03, 0x7F},
-    {0x02, 0x02, 0xDC},
-    {0x09, 0x02, 0xDC},
-    {0x17, 0x02, 0xDC},
-    {0x28, 0x03, 0xDC},
-    {0x02, 0x02, 0xF9},
-    {0x09, 0x02, 0xF9},
-    {0x17, 0x02, 0xF9},
-    {0x28, 0x03, 0xF9},
-    {0x00, 0x03, 0x0A},
-    {0x00, 0x03, 0x0D},
-    {0x00, 0x03, 0x16},
-    {0x100, 0x00, 0x00},
-  },
-  /* 251 */
-  {
-    {0x03, 0x02, 0x7F},
-    {0x06, 0x02, 0x7F},
-    {0x0A, 0x02, 0x7F},
-    {0x0F, 0x02, 0x7F},
-    {0x18, 0x02, 0x7F},
-    {0x1F, 0x02, 0x7F},
-    {0x29, 0x02, 0x7F},
-    {0x38, 0x03, 0x7F},
-    {0x03, 0x02, 0xDC},
-    {0x06, 0x02, 0xDC},
-    {0x0A, 0x02, 0xDC},
-    {0x0F, 0x02, 0xDC},
-    {0x18, 0x02, 0xDC},
-    {0x1F, 0x02, 0xDC},
-    {0x29, 0x02, 0xDC},
-    {0x38, 0x03, 0xDC},
-  },
-  /* 252 */
-  {
-    {0x03, 0x02, 0xF9},
-    {0x06, 0x02, 0xF9},
-    {0x0A, 0x02, 0xF9},
-    {0x0F, 0x02, 0xF9},
-    {0x18, 0x02, 0xF9},
-    {0x1F, 0x02, 0xF9},
-    {0x29, 0x02, 0xF9},
-    {0x38, 0x03, 0xF9},
-    {0x01, 0x02, 0x0A},
-    {0x16, 0x03, 0x0A},
-    {0x01, 0x02, 0x0D},
-    {0x16, 0x03, 0x0D},
-    {0x01, 0x02, 0x16},
-    {0x16, 0x03, 0x16},
-    {0x100, 0x00, 0x00},
-    {0x100, 0x00, 0x00},
-  },
-  /* 253 */
-  {
-    {0x02, 0x02, 0x0A},
-    {0x09, 0x02, 0x0A},
-    {0x17, 0x02, 0x0A},
-    {0x28, 0x03, 0x0A},
-    {0x02, 0x02, 0x0D},
-    {0x09, 0x02, 0x0D},
-    {0x17, 0x02, 0x0D},
-    {0x28, 0x03, 0x0D},
-    {0x02, 0x02, 0x16},
-    {0x09, 0x02, 0x16},
-    {0x17, 0x02, 0x16},
-    {0x28, 0x03, 0x16},
-    {0x100, 0x00, 0x00},
-    {0x100, 0x00, 0x00},
-    {0x100, 0x00, 0x00},
-    {0x100, 0x00, 0x00},
-  },
-  /* 254 */
-  {
-    {0x03, 0x02, 0x0A},
-    {0x06, 0x02, 0x0A},
-    {0x0A, 0x02, 0x0A},
-    {0x0F, 0x02, 0x0A},
-    {0x18, 0x02, 0x0A},
-    {0x1F, 0x02, 0x0A},
-    {0x29, 0x02, 0x0A},
-    {0x38, 0x03, 0x0A},
-    {0x03, 0x02, 0x0D},
-    {0x06, 0x02, 0x0D},
-    {0x0A, 0x02, 0x0D},
-    {0x0F, 0x02, 0x0D},
-    {0x18, 0x02, 0x0D},
-    {0x1F, 0x02, 0x0D},
-    {0x29, 0x02, 0x0D},
-    {0x38, 0x03, 0x0D},
-  },
-  /* 255 */
-  {
-    {0x03, 0x02, 0x16},
-    {0x06, 0x02, 0x16},
-    {0x0A, 0x02, 0x16},
-    {0x0F, 0x02, 0x16},
-    {0x18, 0x02, 0x16},
-    {0x1F, 0x02, 0x16},
-    {0x29, 0x02, 0x16},
-    {0x38, 0x03, 0x16},
-    {0x100, 0x00, 0x00},
-    {0x100, 0x00, 0x00},
-    {0x100, 0x00, 0x00},
-    {0x100, 0x00, 0x00},
-    {0x100, 0x00, 0x00},
-    {0x100, 0x00, 0x00},
-    {0x100, 0x00, 0x00},
-    {0x100, 0x00, 0x00},
-  },
-  /* 256 */
-  {
-    {0x100, 0x00, 0x00},
-    {0x100, 0x00, 0x00},
-    {0x100, 0x00, 0x00},
-    {0x100, 0x00, 0x00},
-    {0x100, 0x00, 0x00},
-    {0x100, 0x00, 0x00},
-    {0x100, 0x00, 0x00},
-    {0x100, 0x00, 0x00},
-    {0x100, 0x00, 0x00},
-    {0x100, 0x00, 0x00},
-    {0x100, 0x00, 0x00},
-    {0x100, 0x00, 0x00},
-    {0x100, 0x00, 0x00},
-    {0x100, 0x00, 0x00},
-    {0x100, 0x00, 0x00},
-    {0x100, 0x00, 0x00},
-  },
+const nghttp3_qpack_huffman_decode_entry qpack_huffman_decode_table[] = {
+  {{0x30, 0x30}, 5, 10}, {{0x30, 0x30}, 5, 10}, {{0x30, 0x30}, 5, 10},
+  {{0x30, 0x30}, 5, 10}, {{0x30, 0x31}, 5, 10}, {{0x30, 0x31}, 5, 10},
+  {{0x30, 0x31}, 5, 10}, {{0x30, 0x31}, 5, 10}, {{0x30, 0x32}, 5, 10},
+  {{0x30, 0x32}, 5, 10}, {{0x30, 0x32}, 5, 10}, {{0x30, 0x32}, 5, 10},
+  {{0x30, 0x61}, 5, 10}, {{0x30, 0x61}, 5, 10}, {{0x30, 0x61}, 5, 10},
+  {{0x30, 0x61}, 5, 10}, {{0x30, 0x63}, 5, 10}, {{0x30, 0x63}, 5, 10},
+  {{0x30, 0x63}, 5, 10}, {{0x30, 0x63}, 5, 10}, {{0x30, 0x65}, 5, 10},
+  {{0x30, 0x65}, 5, 10}, {{0x30, 0x65}, 5, 10}, {{0x30, 0x65}, 5, 10},
+  {{0x30, 0x69}, 5, 10}, {{0x30, 0x69}, 5, 10}, {{0x30, 0x69}, 5, 10},
+  {{0x30, 0x69}, 5, 10}, {{0x30, 0x6F}, 5, 10}, {{0x30, 0x6F}, 5, 10},
+  {{0x30, 0x6F}, 5, 10}, {{0x30, 0x6F}, 5, 10}, {{0x30, 0x73}, 5, 10},
+  {{0x30, 0x73}, 5, 10}, {{0x30, 0x73}, 5, 10}, {{0x30, 0x73}, 5, 10},
+  {{0x30, 0x74}, 5, 10}, {{0x30, 0x74}, 5, 10}, {{0x30, 0x74}, 5, 10},
+  {{0x30, 0x74}, 5, 10}, {{0x30, 0x20}, 5, 11}, {{0x30, 0x20}, 5, 11},
+  {{0x30, 0x25}, 5, 11}, {{0x30, 0x25}, 5, 11}, {{0x30, 0x2D}, 5, 11},
+  {{0x30, 0x2D}, 5, 11}, {{0x30, 0x2E}, 5, 11}, {{0x30, 0x2E}, 5, 11},
+  {{0x30, 0x2F}, 5, 11}, {{0x30, 0x2F}, 5, 11}, {{0x30, 0x33}, 5, 11},
+  {{0x30, 0x33}, 5, 11}, {{0x30, 0x34}, 5, 11}, {{0x30, 0x34}, 5, 11},
+  {{0x30, 0x35}, 5, 11}, {{0x30, 0x35}, 5, 11}, {{0x30, 0x36}, 5, 11},
+  {{0x30, 0x36}, 5, 11}, {{0x30, 0x37}, 5, 11}, {{0x30, 0x37}, 5, 11},
+  {{0x30, 0x38}, 5, 11}, {{0x30, 0x38}, 5, 11}, {{0x30, 0x39}, 5, 11},
+  {{0x30, 0x39}, 5, 11}, {{0x30, 0x3D}, 5, 11}, {{0x30, 0x3D}, 5, 11},
+  {{0x30, 0x41}, 5, 11}, {{0x30, 0x41}, 5, 11}, {{0x30, 0x5F}, 5, 11},
+  {{0x30, 0x5F}, 5, 11}, {{0x30, 0x62}, 5, 11}, {{0x30, 0x62}, 5, 11},
+  {{0x30, 0x64}, 5, 11}, {{0x30, 0x64}, 5, 11}, {{0x30, 0x66}, 5, 11},
+  {{0x30, 0x66}, 5, 11}, {{0x30, 0x67}, 5, 11}, {{0x30, 0x67}, 5, 11},
+  {{0x30, 0x68}, 5, 11}, {{0x30, 0x68}, 5, 11}, {{0x30, 0x6C}, 5, 11},
+  {{0x30, 0x6C}, 5, 11}, {{0x30, 0x6D}, 5, 11}, {{0x30, 0x6D}, 5, 11},
+  {{0x30, 0x6E}, 5, 11}, {{0x30, 0x6E}, 5, 11}, {{0x30, 0x70}, 5, 11},
+  {{0x30, 0x70}, 5, 11}, {{0x30, 0x72}, 5, 11}, {{0x30, 0x72}, 5, 11},
+  {{0x30, 0x75}, 5, 11}, {{0x30, 0x75}, 5, 11}, {{0x30, 0x3A}, 5, 12},
+  {{0x30, 0x42}, 5, 12}, {{0x30, 0x43}, 5, 12}, {{0x30, 0x44}, 5, 12},
+  {{0x30, 0x45}, 5, 12}, {{0x30, 0x46}, 5, 12}, {{0x30, 0x47}, 5, 12},
+  {{0x30, 0x48}, 5, 12}, {{0x30, 0x49}, 5, 12}, {{0x30, 0x4A}, 5, 12},
+  {{0x30, 0x4B}, 5, 12}, {{0x30, 0x4C}, 5, 12}, {{0x30, 0x4D}, 5, 12},
+  {{0x30, 0x4E}, 5, 12}, {{0x30, 0x4F}, 5, 12}, {{0x30, 0x50}, 5, 12},
+  {{0x30, 0x51}, 5, 12}, {{0x30, 0x52}, 5, 12}, {{0x30, 0x53}, 5, 12},
+  {{0x30, 0x54}, 5, 12}, {{0x30, 0x55}, 5, 12}, {{0x30, 0x56}, 5, 12},
+  {{0x30, 0x57}, 5, 12}, {{0x30, 0x59}, 5, 12}, {{0x30, 0x6A}, 5, 12},
+  {{0x30, 0x6B}, 5, 12}, {{0x30, 0x71}, 5, 12}, {{0x30, 0x76}, 5, 12},
+  {{0x30, 0x77}, 5, 12}, {{0x30, 0x78}, 5, 12}, {{0x30, 0x79}, 5, 12},
+  {{0x30, 0x7A}, 5, 12}, {{0x30, 0x30}, 5, 5}, {{0x30, 0x30}, 5, 5},
+  {{0x30, 0x30}, 5, 5}, {{0x30, 0x30}, 5, 5}, {{0x31, 0x30}, 5, 10},
+  {{0x31, 0x30}, 5, 10}, {{0x31, 0x30}, 5, 10}, {{0x31, 0x30}, 5, 10},
+  {{0x31, 0x31}, 5, 10}, {{0x31, 0x31}, 5, 10}, {{0x31, 0x31}, 5, 10},
+  {{0x31, 0x31}, 5, 10}, {{0x31, 0x32}, 5, 10}, {{0x31, 0x32}, 5, 10},
+  {{0x31, 0x32}, 5, 10}, {{0x31, 0x32}, 5, 10}, {{0x31, 0x61}, 5, 10},
+  {{0x31, 0x61}, 5, 10}, {{0x31, 0x61}, 5, 10}, {{0x31, 0x61}, 5, 10},
+  {{0x31, 0x63}, 5, 10}, {{0x31, 0x63}, 5, 10}, {{0x31, 0x63}, 5, 10},
+  {{0x31, 0x63}, 5, 10}, {{0x31, 0x65}, 5, 10}, {{0x31, 0x65}, 5, 10},
+  {{0x31, 0x65}, 5, 10}, {{0x31, 0x65}, 5, 10}, {{0x31, 0x69}, 5, 10},
+  {{0x31, 0x69}, 5, 10}, {{0x31, 0x69}, 5, 10}, {{0x31, 0x69}, 5, 10},
+  {{0x31, 0x6F}, 5, 10}, {{0x31, 0x6F}, 5, 10}, {{0x31, 0x6F}, 5, 10},
+  {{0x31, 0x6F}, 5, 10}, {{0x31, 0x73}, 5, 10}, {{0x31, 0x73}, 5, 10},
+  {{0x31, 0x73}, 5, 10}, {{0x31, 0x73}, 5, 10}, {{0x31, 0x74}, 5, 10},
+  {{0x31, 0x74}, 5, 10}, {{0x31, 0x74}, 5, 10}, {{0x31, 0x74}, 5, 10},
+  {{0x31, 0x20}, 5, 11}, {{0x31, 0x20}, 5, 11}, {{0x31, 0x25}, 5, 11},
+  {{0x31, 0x25}, 5, 11}, {{0x31, 0x2D}, 5, 11}, {{0x31, 0x2D}, 5, 11},
+  {{0x31, 0x2E}, 5, 11}, {{0x31, 0x2E}, 5, 11}, {{0x31, 0x2F}, 5, 11},
+  {{0x31, 0x2F}, 5, 11}, {{0x31, 0x33}, 5, 11}, {{0x31, 0x33}, 5, 11},
+  {{0x31, 0x34}, 5, 11}, {{0x31, 0x34}, 5, 11}, {{0x31, 0x35}, 5, 11},
+  {{0x31, 0x35}, 5, 11}, {{0x31, 0x36}, 5, 11}, {{0x31, 0x36}, 5, 11},
+  {{0x31, 0x37}, 5, 11}, {{0x31, 0x37}, 5, 11}, {{0x31, 0x38}, 5, 11},
+  {{0x31, 0x38}, 5, 11}, {{0x31, 0x39}, 5, 11}, {{0x31, 0x39}, 5, 11},
+  {{0x31, 0x3D}, 5, 11}, {{0x31, 0x3D}, 5, 11}, {{0x31, 0x41}, 5, 11},
+  {{0x31, 0x41}, 5, 11}, {{0x31, 0x5F}, 5, 11}, {{0x31, 0x5F}, 5, 11},
+  {{0x31, 0x62}, 5, 11}, {{0x31, 0x62}, 5, 11}, {{0x31, 0x64}, 5, 11},
+  {{0x31, 0x64}, 5, 11}, {{0x31, 0x66}, 5, 11}, {{0x31, 0x66}, 5, 11},
+  {{0x31, 0x67}, 5, 11}, {{0x31, 0x67}, 5, 11}, {{0x31, 0x68}, 5, 11},
+  {{0x31, 0x68}, 5, 11}, {{0x31, 0x6C}, 5, 11}, {{0x31, 0x6C}, 5, 11},
+  {{0x31, 0x6D}, 5, 11}, {{0x31, 0x6D}, 5, 11}, {{0x31, 0x6E}, 5, 11},
+  {{0x31, 0x6E}, 5, 11}, {{0x31, 0x70}, 5, 11}, {{0x31, 0x70}, 5, 11},
+  {{0x31, 0x72}, 5, 11}, {{0x31, 0x72}, 5, 11}, {{0x31, 0x75}, 5, 11},
+  {{0x31, 0x75}, 5, 11}, {{0x31, 0x3A}, 5, 12}, {{0x31, 0x42}, 5, 12},
+  {{0x31, 0x43}, 5, 12}, {{0x31, 0x44}, 5, 12}, {{0x31, 0x45}, 5, 12},
+  {{0x31, 0x46}, 5, 12}, {{0x31, 0x47}, 5, 12}, {{0x31, 0x48}, 5, 12},
+  {{0x31, 0x49}, 5, 12}, {{0x31, 0x4A}, 5, 12}, {{0x31, 0x4B}, 5, 12},
+  {{0x31, 0x4C}, 5, 12}, {{0x31, 0x4D}, 5, 12}, {{0x31, 0x4E}, 5, 12},
+  {{0x31, 0x4F}, 5, 12}, {{0x31, 0x50}, 5, 12}, {{0x31, 0x51}, 5, 12},
+  {{0x31, 0x52}, 5, 12}, {{0x31, 0x53}, 5, 12}, {{0x31, 0x54}, 5, 12},
+  {{0x31, 0x55}, 5, 12}, {{0x31, 0x56}, 5, 12}, {{0x31, 0x57}, 5, 12},
+  {{0x31, 0x59}, 5, 12}, {{0x31, 0x6A}, 5, 12}, {{0x31, 0x6B}, 5, 12},
+  {{0x31, 0x71}, 5, 12}, {{0x31, 0x76}, 5, 12}, {{0x31, 0x77}, 5, 12},
+  {{0x31, 0x78}, 5, 12}, {{0x31, 0x79}, 5, 12}, {{0x31, 0x7A}, 5, 12},
+  {{0x31, 0x31}, 5, 5}, {{0x31, 0x31}, 5, 5}, {{0x31, 0x31}, 5, 5},
+  {{0x31, 0x31}, 5, 5}, {{0x32, 0x30}, 5, 10}, {{0x32, 0x30}, 5, 10},
+  {{0x32, 0x30}, 5, 10}, {{0x32, 0x30}, 5, 10}, {{0x32, 0x31}, 5, 10},
+  {{0x32, 0x31}, 5, 10}, {{0x32, 0x31}, 5, 10}, {{0x32, 0x31}, 5, 10},
+  {{0x32, 0x32}, 5, 10}, {{0x32, 0x32}, 5, 10}, {{0x32, 0x32}, 5, 10},
+  {{0x32, 0x32}, 5, 10}, {{0x32, 0x61}, 5, 10}, {{0x32, 0x61}, 5, 10},
+  {{0x32, 0x61}, 5, 10}, {{0x32, 0x61}, 5, 10}, {{0x32, 0x63}, 5, 10},
+  {{0x32, 0x63}, 5, 10}, {{0x32, 0x63}, 5, 10}, {{0x32, 0x63}, 5, 10},
+  {{0x32, 0x65}, 5, 10}, {{0x32, 0x65}, 5, 10}, {{0x32, 0x65}, 5, 10},
+  {{0x32, 0x65}, 5, 10}, {{0x32, 0x69}, 5, 10}, {{0x32, 0x69}, 5, 10},
+  {{0x32, 0x69}, 5, 10}, {{0x32, 0x69}, 5, 10}, {{0x32, 0x6F}, 5, 10},
+  {{0x32, 0x6F}, 5, 10}, {{0x32, 0x6F}, 5, 10}, {{0x32, 0x6F}, 5, 10},
+  {{0x32, 0x73}, 5, 10}, {{0x32, 0x73}, 5, 10}, {{0x32, 0x73}, 5, 10},
+  {{0x32, 0x73}, 5, 10}, {{0x32, 0x74}, 5, 10}, {{0x32, 0x74}, 5, 10},
+  {{0x32, 0x74}, 5, 10}, {{0x32, 0x74}, 5, 10}, {{0x32, 0x20}, 5, 11},
+  {{0x32, 0x20}, 5, 11}, {{0x32, 0x25}, 5, 11}, {{0x32, 0x25}, 5, 11},
+  {{0x32, 0x2D}, 5, 11}, {{0x32, 0x2D}, 5, 11}, {{0x32, 0x2E}, 5, 11},
+  {{0x32, 0x2E}, 5, 11}, {{0x32, 0x2F}, 5, 11}, {{0x32, 0x2F}, 5, 11},
+  {{0x32, 0x33}, 5, 11}, {{0x32, 0x33}, 5, 11}, {{0x32, 0x34}, 5, 11},
+  {{0x32, 0x34}, 5, 11}, {{0x32, 0x35}, 5, 11}, {{0x32, 0x35}, 5, 11},
+  {{0x32, 0x36}, 5, 11}, {{0x32, 0x36}, 5, 11}, {{0x32, 0x37}, 5, 11},
+  {{0x32, 0x37}, 5, 11}, {{0x32, 0x38}, 5, 11}, {{0x32, 0x38}, 5, 11},
+  {{0x32, 0x39}, 5, 11}, {{0x32, 0x39}, 5, 11}, {{0x32, 0x3D}, 5, 11},
+  {{0x32, 0x3D}, 5, 11}, {{0x32, 0x41}, 5, 11}, {{0x32, 0x41}, 5, 11},
+  {{0x32, 0x5F}, 5, 11}, {{0x32, 0x5F}, 5, 11}, {{0x32, 0x62}, 5, 11},
+  {{0x32, 0x62}, 5, 11}, {{0x32, 0x64}, 5, 11}, {{0x32, 0x64}, 5, 11},
+  {{0x32, 0x66}, 5, 11}, {{0x32, 0x66}, 5, 11}, {{0x32, 0x67}, 5, 11},
+  {{0x32, 0x67}, 5, 11}, {{0x32, 0x68}, 5, 11}, {{0x32, 0x68}, 5, 11},
+  {{0x32, 0x6C}, 5, 11}, {{0x32, 0x6C}, 5, 11}, {{0x32, 0x6D}, 5, 11},
+  {{0x32, 0x6D}, 5, 11}, {{0x32, 0x6E}, 5, 11}, {{0x32, 0x6E}, 5, 11},
+  {{0x32, 0x70}, 5, 11}, {{0x32, 0x70}, 5, 11}, {{0x32, 0x72}, 5, 11},
+  {{0x32, 0x72}, 5, 11}, {{0x32, 0x75}, 5, 11}, {{0x32, 0x75}, 5, 11},
+  {{0x32, 0x3A}, 5, 12}, {{0x32, 0x42}, 5, 12}, {{0x32, 0x43}, 5, 12},
+  {{0x32, 0x44}, 5, 12}, {{0x32, 0x45}, 5, 12}, {{0x32, 0x46}, 5, 12},
+  {{0x32, 0x47}, 5, 12}, {{0x32, 0x48}, 5, 12}, {{0x32, 0x49}, 5, 12},
+  {{0x32, 0x4A}, 5, 12}, {{0x32, 0x4B}, 5, 12}, {{0x32, 0x4C}, 5, 12},
+  {{0x32, 0x4D}, 5, 12}, {{0x32, 0x4E}, 5, 12}, {{0x32, 0x4F}, 5, 12},
+  {{0x32, 0x50}, 5, 12}, {{0x32, 0x51}, 5, 12}, {{0x32, 0x52}, 5, 12},
+  {{0x32, 0x53}, 5, 12}, {{0x32, 0x54}, 5, 12}, {{0x32, 0x55}, 5, 12},
+  {{0x32, 0x56}, 5, 12}, {{0x32, 0x57}, 5, 12}, {{0x32, 0x59}, 5, 12},
+  {{0x32, 0x6A}, 5, 12}, {{0x32, 0x6B}, 5, 12}, {{0x32, 0x71}, 5, 12},
+  {{0x32, 0x76}, 5, 12}, {{0x32, 0x77}, 5, 12}, {{0x32, 0x78}, 5, 12},
+  {{0x32, 0x79}, 5, 12}, {{0x32, 0x7A}, 5, 12}, {{0x32, 0x32}, 5, 5},
+  {{0x32, 0x32}, 5, 5}, {{0x32, 0x32}, 5, 5}, {{0x32, 0x32}, 5, 5},
+  {{0x61, 0x30}, 5, 10}, {{0x61, 0x30}, 5, 10}, {{0x61, 0x30}, 5, 10},
+  {{0x61, 0x30}, 5, 10}, {{0x61, 0x31}, 5, 10}, {{0x61, 0x31}, 5, 10},
+  {{0x61, 0x31}, 5, 10}, {{0x61, 0x31}, 5, 10}, {{0x61, 0x32}, 5, 10},
+  {{0x61, 0x32}, 5, 10}, {{0x61, 0x32}, 5, 10}, {{0x61, 0x32}, 5, 10},
+  {{0x61, 0x61}, 5, 10}, {{0x61, 0x61}, 5, 10}, {{0x61, 0x61}, 5, 10},
+  {{0x61, 0x61}, 5, 10}, {{0x61, 0x63}, 5, 10}, {{0x61, 0x63}, 5, 10},
+  {{0x61, 0x63}, 5, 10}, {{0x61, 0x63}, 5, 10}, {{0x61, 0x65}, 5, 10},
+  {{0x61, 0x65}, 5, 10}, {{0x61, 0x65}, 5, 10}, {{0x61, 0x65}, 5, 10},
+  {{0x61, 0x69}, 5, 10}, {{0x61, 0x69}, 5, 10}, {{0x61, 0x69}, 5, 10},
+  {{0x61, 0x69}, 5, 10}, {{0x61, 0x6F}, 5, 10}, {{0x61, 0x6F}, 5, 10},
+  {{0x61, 0x6F}, 5, 10}, {{0x61, 0x6F}, 5, 10}, {{0x61, 0x73}, 5, 10},
+  {{0x61, 0x73}, 5, 10}, {{0x61, 0x73}, 5, 10}, {{0x61, 0x73}, 5, 10},
+  {{0x61, 0x74}, 5, 10}, {{0x61, 0x74}, 5, 10}, {{0x61, 0x74}, 5, 10},
+  {{0x61, 0x74}, 5, 10}, {{0x61, 0x20}, 5, 11}, {{0x61, 0x20}, 5, 11},
+  {{0x61, 0x25}, 5, 11}, {{0x61, 0x25}, 5, 11}, {{0x61, 0x2D}, 5, 11},
+  {{0x61, 0x2D}, 5, 11}, {{0x61, 0x2E}, 5, 11}, {{0x61, 0x2E}, 5, 11},
+  {{0x61, 0x2F}, 5, 11}, {{0x61, 0x2F}, 5, 11}, {{0x61, 0x33}, 5, 11},
+  {{0x61, 0x33}, 5, 11}, {{0x61, 0x34}, 5, 11}, {{0x61, 0x34}, 5, 11},
+  {{0x61, 0x35}, 5, 11}, {{0x61, 0x35}, 5, 11}, {{0x61, 0x36}, 5, 11},
+  {{0x61, 0x36}, 5, 11}, {{0x61, 0x37}, 5, 11}, {{0x61, 0x37}, 5, 11},
+  {{0x61, 0x38}, 5, 11}, {{0x61, 0x38}, 5, 11}, {{0x61, 0x39}, 5, 11},
+  {{0x61, 0x39}, 5, 11}, {{0x61, 0x3D}, 5, 11}, {{0x61, 0x3D}, 5, 11},
+  {{0x61, 0x41}, 5, 11}, {{0x61, 0x41}, 5, 11}, {{0x61, 0x5F}, 5, 11},
+  {{0x61, 0x5F}, 5, 11}, {{0x61, 0x62}, 5, 11}, {{0x61, 0x62}, 5, 11},
+  {{0x61, 0x64}, 5, 11}, {{0x61, 0x64}, 5, 11}, {{0x61, 0x66}, 5, 11},
+  {{0x61, 0x66}, 5, 11}, {{0x61, 0x67}, 5, 11}, {{0x61, 0x67}, 5, 11},
+  {{0x61, 0x68}, 5, 11}, {{0x61, 0x68}, 5, 11}, {{0x61, 0x6C}, 5, 11},
+  {{0x61, 0x6C}, 5, 11}, {{0x61, 0x6D}, 5, 11}, {{0x61, 0x6D}, 5, 11},
+  {{0x61, 0x6E}, 5, 11}, {{0x61, 0x6E}, 5, 11}, {{0x61, 0x70}, 5, 11},
+  {{0x61, 0x70}, 5, 11}, {{0x61, 0x72}, 5, 11}, {{0x61, 0x72}, 5, 11},
+  {{0x61, 0x75}, 5, 11}, {{0x61, 0x75}, 5, 11}, {{0x61, 0x3A}, 5, 12},
+  {{0x61, 0x42}, 5, 12}, {{0x61, 0x43}, 5, 12}, {{0x61, 0x44}, 5, 12},
+  {{0x61, 0x45}, 5, 12}, {{0x61, 0x46}, 5, 12}, {{0x61, 0x47}, 5, 12},
+  {{0x61, 0x48}, 5, 12}, {{0x61, 0x49}, 5, 12}, {{0x61, 0x4A}, 5, 12},
+  {{0x61, 0x4B}, 5, 12}, {{0x61, 0x4C}, 5, 12}, {{0x61, 0x4D}, 5, 12},
+  {{0x61, 0x4E}, 5, 12}, {{0x61, 0x4F}, 5, 12}, {{0x61, 0x50}, 5, 12},
+  {{0x61, 0x51}, 5, 12}, {{0x61, 0x52}, 5, 12}, {{0x61, 0x53}, 5, 12},
+  {{0x61, 0x54}, 5, 12}, {{0x61, 0x55}, 5, 12}, {{0x61, 0x56}, 5, 12},
+  {{0x61, 0x57}, 5, 12}, {{0x61, 0x59}, 5, 12}, {{0x61, 0x6A}, 5, 12},
+  {{0x61, 0x6B}, 5, 12}, {{0x61, 0x71}, 5, 12}, {{0x61, 0x76}, 5, 12},
+  {{0x61, 0x77}, 5, 12}, {{0x61, 0x78}, 5, 12}, {{0x61, 0x79}, 5, 12},
+  {{0x61, 0x7A}, 5, 12}, {{0x61, 0x61}, 5, 5}, {{0x61, 0x61}, 5, 5},
+  {{0x61, 0x61}, 5, 5}, {{0x61, 0x61}, 5, 5}, {{0x63, 0x30}, 5, 10},
+  {{0x63, 0x30}, 5, 10}, {{0x63, 0x30}, 5, 10}, {{0x63, 0x30}, 5, 10},
+  {{0x63, 0x31}, 5, 10}, {{0x63, 0x31}, 5, 10}, {{0x63, 0x31}, 5, 10},
+  {{0x63, 0x31}, 5, 10}, {{0x63, 0x32}, 5, 10}, {{0x63, 0x32}, 5, 10},
+  {{0x63, 0x32}, 5, 10}, {{0x63, 0x32}, 5, 10}, {{0x63, 0x61}, 5, 10},
+  {{0x63, 0x61}, 5, 10}, {{0x63, 0x61}, 5, 10}, {{0x63, 0x61}, 5, 10},
+  {{0x63, 0x63}, 5, 10}, {{0x63, 0x63}, 5, 10}, {{0x63, 0x63}, 5, 10},
+  {{0x63, 0x63}, 5, 10}, {{0x63, 0x65}, 5, 10}, {{0x63, 0x65}, 5, 10},
+  {{0x63, 0x65}, 5, 10}, {{0x63, 0x65}, 5, 10}, {{0x63, 0x69}, 5, 10},
+  {{0x63, 0x69}, 5, 10}, {{0x63, 0x69}, 5, 10}, {{0x63, 0x69}, 5, 10},
+  {{0x63, 0x6F}, 5, 10}, {{0x63, 0x6F}, 5, 10}, {{0x63, 0x6F}, 5, 10},
+  {{0x63, 0x6F}, 5, 10}, {{0x63, 0x73}, 5, 10}, {{0x63, 0x73}, 5, 10},
+  {{0x63, 0x73}, 5, 10}, {{0x63, 0x73}, 5, 10}, {{0x63, 0x74}, 5, 10},
+  {{0x63, 0x74}, 5, 10}, {{0x63, 0x74}, 5, 10}, {{0x63, 0x74}, 5, 10},
+  {{0x63, 0x20}, 5, 11}, {{0x63, 0x20}, 5, 11}, {{0x63, 0x25}, 5, 11},
+  {{0x63, 0x25}, 5, 11}, {{0x63, 0x2D}, 5, 11}, {{0x63, 0x2D}, 5, 11},
+  {{0x63, 0x2E}, 5, 11}, {{0x63, 0x2E}, 5, 11}, {{0x63, 0x2F}, 5, 11},
+  {{0x63, 0x2F}, 5, 11}, {{0x63, 0x33}, 5, 11}, {{0x63, 0x33}, 5, 11},
+  {{0x63, 0x34}, 5, 11}, {{0x63, 0x34}, 5, 11}, {{0x63, 0x35}, 5, 11},
+  {{0x63, 0x35}, 5, 11}, {{0x63, 0x36}, 5, 11}, {{0x63, 0x36}, 5, 11},
+  {{0x63, 0x37}, 5, 11}, {{0x63, 0x37}, 5, 11}, {{0x63, 0x38}, 5, 11},
+  {{0x63, 0x38}, 5, 11}, {{0x63, 0x39}, 5, 11}, {{0x63, 0x39}, 5, 11},
+  {{0x63, 0x3D}, 5, 11}, {{0x63, 0x3D}, 5, 11}, {{0x63, 0x41}, 5, 11},
+  {{0x63, 0x41}, 5, 11}, {{0x63, 0x5F}, 5, 11}, {{0x63, 0x5F}, 5, 11},
+  {{0x63, 0x62}, 5, 11}, {{0x63, 0x62}, 5, 11}, {{0x63, 0x64}, 5, 11},
+  {{0x63, 0x64}, 5, 11}, {{0x63, 0x66}, 5, 11}, {{0x63, 0x66}, 5, 11},
+  {{0x63, 0x67}, 5, 11}, {{0x63, 0x67}, 5, 11}, {{0x63, 0x68}, 5, 11},
+  {{0x63, 0x68}, 5, 11}, {{0x63, 0x6C}, 5, 11}, {{0x63, 0x6C}, 5, 11},
+  {{0x63, 0x6D}, 5, 11}, {{0x63, 0x6D}, 5, 11}, {{0x63, 0x6E}, 5, 11},
+  {{0x63, 0x6E}, 5, 11}, {{0x63, 0x70}, 5, 11}, {{0x63, 0x70}, 5, 11},
+  {{0x63, 0x72}, 5, 11}, {{0x63, 0x72}, 5, 11}, {{0x63, 0x75}, 5, 11},
+  {{0x63, 0x75}, 5, 11}, {{0x63, 0x3A}, 5, 12}, {{0x63, 0x42}, 5, 12},
+  {{0x63, 0x43}, 5, 12}, {{0x63, 0x44}, 5, 12}, {{0x63, 0x45}, 5, 12},
+  {{0x63, 0x46}, 5, 12}, {{0x63, 0x47}, 5, 12}, {{0x63, 0x48}, 5, 12},
+  {{0x63, 0x49}, 5, 12}, {{0x63, 0x4A}, 5, 12}, {{0x63, 0x4B}, 5, 12},
+  {{0x63, 0x4C}, 5, 12}, {{0x63, 0x4D}, 5, 12}, {{0x63, 0x4E}, 5, 12},
+  {{0x63, 0x4F}, 5, 12}, {{0x63, 0x50}, 5, 12}, {{0x63, 0x51}, 5, 12},
+  {{0x63, 0x52}, 5, 12}, {{0x63, 0x53}, 5, 12}, {{0x63, 0x54}, 5, 12},
+  {{0x63, 0x55}, 5, 12}, {{0x63, 0x56}, 5, 12}, {{0x63, 0x57}, 5, 12},
+  {{0x63, 0x59}, 5, 12}, {{0x63, 0x6A}, 5, 12}, {{0x63, 0x6B}, 5, 12},
+  {{0x63, 0x71}, 5, 12}, {{0x63, 0x76}, 5, 12}, {{0x63, 0x77}, 5, 12},
+  {{0x63, 0x78}, 5, 12}, {{0x63, 0x79}, 5, 12}, {{0x63, 0x7A}, 5, 12},
+  {{0x63, 0x63}, 5, 5}, {{0x63, 0x63}, 5, 5}, {{0x63, 0x63}, 5, 5},
+  {{0x63, 0x63}, 5, 5}, {{0x65, 0x30}, 5, 10}, {{0x65, 0x30}, 5, 10},
+  {{0x65, 0x30}, 5, 10}, {{0x65, 0x30}, 5, 10}, {{0x65, 0x31}, 5, 10},
+  {{0x65, 0x31}, 5, 10}, {{0x65, 0x31}, 5, 10}, {{0x65, 0x31}, 5, 10},
+  {{0x65, 0x32}, 5, 10}, {{0x65, 0x32}, 5, 10}, {{0x65, 0x32}, 5, 10},
+  {{0x65, 0x32}, 5, 10}, {{0x65, 0x61}, 5, 10}, {{0x65, 0x61}, 5, 10},
+  {{0x65, 0x61}, 5, 10}, {{0x65, 0x61}, 5, 10}, {{0x65, 0x63}, 5, 10},
+  {{0x65, 0x63}, 5, 10}, {{0x65, 0x63}, 5, 10}, {{0x65, 0x63}, 5, 10},
+  {{0x65, 0x65}, 5, 10}, {{0x65, 0x65}, 5, 10}, {{0x65, 0x65}, 5, 10},
+  {{0x65, 0x65}, 5, 10}, {{0x65, 0x69}, 5, 10}, {{0x65, 0x69}, 5, 10},
+  {{0x65, 0x69}, 5, 10}, {{0x65, 0x69}, 5, 10}, {{0x65, 0x6F}, 5, 10},
+  {{0x65, 0x6F}, 5, 10}, {{0x65, 0x6F}, 5, 10}, {{0x65, 0x6F}, 5, 10},
+  {{0x65, 0x73}, 5, 10}, {{0x65, 0x73}, 5, 10}, {{0x65, 0x73}, 5, 10},
+  {{0x65, 0x73}, 5, 10}, {{0x65, 0x74}, 5, 10}, {{0x65, 0x74}, 5, 10},
+  {{0x65, 0x74}, 5, 10}, {{0x65, 0x74}, 5, 10}, {{0x65, 0x20}, 5, 11},
+  {{0x65, 0x20}, 5, 11}, {{0x65, 0x25}, 5, 11}, {{0x65, 0x25}, 5, 11},
+  {{0x65, 0x2D}, 5, 11}, {{0x65, 0x2D}, 5, 11}, {{0x65, 0x2E}, 5, 11},
+  {{0x65, 0x2E}, 5, 11}, {{0x65, 0x2F}, 5, 11}, {{0x65, 0x2F}, 5, 11},
+  {{0x65, 0x33}, 5, 11}, {{0x65, 0x33}, 5, 11}, {{0x65, 0x34}, 5, 11},
+  {{0x65, 0x34}, 5, 11}, {{0x65, 0x35}, 5, 11}, {{0x65, 0x35}, 5, 11},
+  {{0x65, 0x36}, 5, 11}, {{0x65, 0x36}, 5, 11}, {{0x65, 0x37}, 5, 11},
+  {{0x65, 0x37}, 5, 11}, {{0x65, 0x38}, 5, 11}, {{0x65, 0x38}, 5, 11},
+  {{0x65, 0x39}, 5, 11}, {{0x65, 0x39}, 5, 11}, {{0x65, 0x3D}, 5, 11},
+  {{0x65, 0x3D}, 5, 11}, {{0x65, 0x41}, 5, 11}, {{0x65, 0x41}, 5, 11},
+  {{0x65, 0x5F}, 5, 11}, {{0x65, 0x5F}, 5, 11}, {{0x65, 0x62}, 5, 11},
+  {{0x65, 0x62}, 5, 11}, {{0x65, 0x64}, 5, 11}, {{0x65, 0x64}, 5, 11},
+  {{0x65, 0x66}, 5, 11}, {{0x65, 0x66}, 5, 11}, {{0x65, 0x67}, 5, 11},
+  {{0x65, 0x67}, 5, 11}, {{0x65, 0x68}, 5, 11}, {{0x65, 0x68}, 5, 11},
+  {{0x65, 0x6C}, 5, 11}, {{0x65, 0x6C}, 5, 11}, {{0x65, 0x6D}, 5, 11},
+  {{0x65, 0x6D}, 5, 11}, {{0x65, 0x6E}, 5, 11}, {{0x65, 0x6E}, 5, 11},
+  {{0x65, 0x70}, 5, 11}, {{0x65, 0x70}, 5, 11}, {{0x65, 0x72}, 5, 11},
+  {{0x65, 0x72}, 5, 11}, {{0x65, 0x75}, 5, 11}, {{0x65, 0x75}, 5, 11},
+  {{0x65, 0x3A}, 5, 12}, {{0x65, 0x42}, 5, 12}, {{0x65, 0x43}, 5, 12},
+  {{0x65, 0x44}, 5, 12}, {{0x65, 0x45}, 5, 12}, {{0x65, 0x46}, 5, 12},
+  {{0x65, 0x47}, 5, 12}, {{0x65, 0x48}, 5, 12}, {{0x65, 0x49}, 5, 12},
+  {{0x65, 0x4A}, 5, 12}, {{0x65, 0x4B}, 5, 12}, {{0x65, 0x4C}, 5, 12},
+  {{0x65, 0x4D}, 5, 12}, {{0x65, 0x4E}, 5, 12}, {{0x65, 0x4F}, 5, 12},
+  {{0x65, 0x50}, 5, 12}, {{0x65, 0x51}, 5, 12}, {{0x65, 0x52}, 5, 12},
+  {{0x65, 0x53}, 5, 12}, {{0x65, 0x54}, 5, 12}, {{0x65, 0x55}, 5, 12},
+  {{0x65, 0x56}, 5, 12}, {{0x65, 0x57}, 5, 12}, {{0x65, 0x59}, 5, 12},
+  {{0x65, 0x6A}, 5, 12}, {{0x65, 0x6B}, 5, 12}, {{0x65, 0x71}, 5, 12},
+  {{0x65, 0x76}, 5, 12}, {{0x65, 0x77}, 5, 12}, {{0x65, 0x78}, 5, 12},
+  {{0x65, 0x79}, 5, 12}, {{0x65, 0x7A}, 5, 12}, {{0x65, 0x65}, 5, 5},
+  {{0x65, 0x65}, 5, 5}, {{0x65, 0x65}, 5, 5}, {{0x65, 0x65}, 5, 5},
+  {{0x69, 0x30}, 5, 10}, {{0x69, 0x30}, 5, 10}, {{0x69, 0x30}, 5, 10},
+  {{0x69, 0x30}, 5, 10}, {{0x69, 0x31}, 5, 10}, {{0x69, 0x31}, 5, 10},
+  {{0x69, 0x31}, 5, 10}, {{0x69, 0x31}, 5, 10}, {{0x69, 0x32}, 5, 10},
+  {{0x69, 0x32}, 5, 10}, {{0x69, 0x32}, 5, 10}, {{0x69, 0x32}, 5, 10},
+  {{0x69, 0x61}, 5, 10}, {{0x69, 0x61}, 5, 10}, {{0x69, 0x61}, 5, 10},
+  {{0x69, 0x61}, 5, 10}, {{0x69, 0x63}, 5, 10}, {{0x69, 0x63}, 5, 10},
+  {{0x69, 0x63}, 5, 10}, {{0x69, 0x63}, 5, 10}, {{0x69, 0x65}, 5, 10},
+  {{0x69, 0x65}, 5, 10}, {{0x69, 0x65}, 5, 10}, {{0x69, 0x65}, 5, 10},
+  {{0x69, 0x69}, 5, 10}, {{0x69, 0x69}, 5, 10}, {{0x69, 0x69}, 5, 10},
+  {{0x69, 0x69}, 5, 10}, {{0x69, 0x6F}, 5, 10}, {{0x69, 0x6F}, 5, 10},
+  {{0x69, 0x6F}, 5, 10}, {{0x69, 0x6F}, 5, 10}, {{0x69, 0x73}, 5, 10},
+  {{0x69, 0x73}, 5, 10}, {{0x69, 0x73}, 5, 10}, {{0x69, 0x73}, 5, 10},
+  {{0x69, 0x74}, 5, 10}, {{0x69, 0x74}, 5, 10}, {{0x69, 0x74}, 5, 10},
+  {{0x69, 0x74}, 5, 10}, {{0x69, 0x20}, 5, 11}, {{0x69, 0x20}, 5, 11},
+  {{0x69, 0x25}, 5, 11}, {{0x69, 0x25}, 5, 11}, {{0x69, 0x2D}, 5, 11},
+  {{0x69, 0x2D}, 5, 11}, {{0x69, 0x2E}, 5, 11}, {{0x69, 0x2E}, 5, 11},
+  {{0x69, 0x2F}, 5, 11}, {{0x69, 0x2F}, 5, 11}, {{0x69, 0x33}, 5, 11},
+  {{0x69, 0x33}, 5, 11}, {{0x69, 0x34}, 5, 11}, {{0x69, 0x34}, 5, 11},
+  {{0x69, 0x35}, 5, 11}, {{0x69, 0x35}, 5, 11}, {{0x69, 0x36}, 5, 11},
+  {{0x69, 0x36}, 5, 11}, {{0x69, 0x37}, 5, 11}, {{0x69, 0x37}, 5, 11},
+  {{0x69, 0x38}, 5, 11}, {{0x69, 0x38}, 5, 11}, {{0x69, 0x39}, 5, 11},
+  {{0x69, 0x39}, 5, 11}, {{0x69, 0x3D}, 5, 11}, {{0x69, 0x3D}, 5, 11},
+  {{0x69, 0x41}, 5, 11}, {{0x69, 0x41}, 5, 11}, {{0x69, 0x5F}, 5, 11},
+  {{0x69, 0x5F}, 5, 11}, {{0x69, 0x62}, 5, 11}, {{0x69, 0x62}, 5, 11},
+  {{0x69, 0x64}, 5, 11}, {{0x69, 0x64}, 5, 11}, {{0x69, 0x66}, 5, 11},
+  {{0x69, 0x66}, 5, 11}, {{0x69, 0x67}, 5, 11}, {{0x69, 0x67}, 5, 11},
+  {{0x69, 0x68}, 5, 11}, {{0x69, 0x68}, 5, 11}, {{0x69, 0x6C}, 5, 11},
+  {{0x69, 0x6C}, 5, 11}, {{0x69, 0x6D}, 5, 11}, {{0x69, 0x6D}, 5, 11},
+  {{0x69, 0x6E}, 5, 11}, {{0x69, 0x6E}, 5, 11}, {{0x69, 0x70}, 5, 11},
+  {{0x69, 0x70}, 5, 11}, {{0x69, 0x72}, 5, 11}, {{0x69, 0x72}, 5, 11},
+  {{0x69, 0x75}, 5, 11}, {{0x69, 0x75}, 5, 11}, {{0x69, 0x3A}, 5, 12},
+  {{0x69, 0x42}, 5, 12}, {{0x69, 0x43}, 5, 12}, {{0x69, 0x44}, 5, 12},
+  {{0x69, 0x45}, 5, 12}, {{0x69, 0x46}, 5, 12}, {{0x69, 0x47}, 5, 12},
+  {{0x69, 0x48}, 5, 12}, {{0x69, 0x49}, 5, 12}, {{0x69, 0x4A}, 5, 12},
+  {{0x69, 0x4B}, 5, 12}, {{0x69, 0x4C}, 5, 12}, {{0x69, 0x4D}, 5, 12},
+  {{0x69, 0x4E}, 5, 12}, {{0x69, 0x4F}, 5, 12}, {{0x69, 0x50}, 5, 12},
+  {{0x69, 0x51}, 5, 12}, {{0x69, 0x52}, 5, 12}, {{0x69, 0x53}, 5, 12},
+  {{0x69, 0x54}, 5, 12}, {{0x69, 0x55}, 5, 12}, {{0x69, 0x56}, 5, 12},
+  {{0x69, 0x57}, 5, 12}, {{0x69, 0x59}, 5, 12}, {{0x69, 0x6A}, 5, 12},
+  {{0x69, 0x6B}, 5, 12}, {{0x69, 0x71}, 5, 12}, {{0x69, 0x76}, 5, 12},
+  {{0x69, 0x77}, 5, 12}, {{0x69, 0x78}, 5, 12}, {{0x69, 0x79}, 5, 12},
+  {{0x69, 0x7A}, 5, 12}, {{0x69, 0x69}, 5, 5}, {{0x69, 0x69}, 5, 5},
+  {{0x69, 0x69}, 5, 5}, {{0x69, 0x69}, 5, 5}, {{0x6F, 0x30}, 5, 10},
+  {{0x6F, 0x30}, 5, 10}, {{0x6F, 0x30}, 5, 10}, {{0x6F, 0x30}, 5, 10},
+  {{0x6F, 0x31}, 5, 10}, {{0x6F, 0x31}, 5, 10}, {{0x6F, 0x31}, 5, 10},
+  {{0x6F, 0x31}, 5, 10}, {{0x6F, 0x32}, 5, 10}, {{0x6F, 0x32}, 5, 10},
+  {{0x6F, 0x32}, 5, 10}, {{0x6F, 0x32}, 5, 10}, {{0x6F, 0x61}, 5, 10},
+  {{0x6F, 0x61}, 5, 10}, {{0x6F, 0x61}, 5, 10}, {{0x6F, 0x61}, 5, 10},
+  {{0x6F, 0x63}, 5, 10}, {{0x6F, 0x63}, 5, 10}, {{0x6F, 0x63}, 5, 10},
+  {{0x6F, 0x63}, 5, 10}, {{0x6F, 0x65}, 5, 10}, {{0x6F, 0x65}, 5, 10},
+  {{0x6F, 0x65}, 5, 10}, {{0x6F, 0x65}, 5, 10}, {{0x6F, 0x69}, 5, 10},
+  {{0x6F, 0x69}, 5, 10}, {{0x6F, 0x69}, 5, 10}, {{0x6F, 0x69}, 5, 10},
+  {{0x6F, 0x6F}, 5, 10}, {{0x6F, 0x6F}, 5, 10}, {{0x6F, 0x6F}, 5, 10},
+  {{0x6F, 0x6F}, 5, 10}, {{0x6F, 0x73}, 5, 10}, {{0x6F, 0x73}, 5, 10},
+  {{0x6F, 0x73}, 5, 10}, {{0x6F, 0x73}, 5, 10}, {{0x6F, 0x74}, 5, 10},
+  {{0x6F, 0x74}, 5, 10}, {{0x6F, 0x74}, 5, 10}, {{0x6F, 0x74}, 5, 10},
+  {{0x6F, 0x20}, 5, 11}, {{0x6F, 0x20}, 5, 11}, {{0x6F, 0x25}, 5, 11},
+  {{0x6F, 0x25}, 5, 11}, {{0x6F, 0x2D}, 5, 11}, {{0x6F, 0x2D}, 5, 11},
+  {{0x6F, 0x2E}, 5, 11}, {{0x6F, 0x2E}, 5, 11}, {{0x6F, 0x2F}, 5, 11},
+  {{0x6F, 0x2F}, 5, 11}, {{0x6F, 0x33}, 5, 11}, {{0x6F, 0x33}, 5, 11},
+  {{0x6F, 0x34}, 5, 11}, {{0x6F, 0x34}, 5, 11}, {{0x6F, 0x35}, 5, 11},
+  {{0x6F, 0x35}, 5, 11}, {{0x6F, 0x36}, 5, 11}, {{0x6F, 0x36}, 5, 11},
+  {{0x6F, 0x37}, 5, 11}, {{0x6F, 0x37}, 5, 11}, {{0x6F, 0x38}, 5, 11},
+  {{0x6F, 0x38}, 5, 11}, {{0x6F, 0x39}, 5, 11}, {{0x6F, 0x39}, 5, 11},
+  {{0x6F, 0x3D}, 5, 11}, {{0x6F, 0x3D}, 5, 11}, {{0x6F, 0x41}, 5, 11},
+  {{0x6F, 0x41}, 5, 11}, {{0x6F, 0x5F}, 5, 11}, {{0x6F, 0x5F}, 5, 11},
+  {{0x6F, 0x62}, 5, 11}, {{0x6F, 0x62}, 5, 11}, {{0x6F, 0x64}, 5, 11},
+  {{0x6F, 0x64}, 5, 11}, {{0x6F, 0x66}, 5, 11}, {{0x6F, 0x66}, 5, 11},
+  {{0x6F, 0x67}, 5, 11}, {{0x6F, 0x67}, 5, 11}, {{0x6F, 0x68}, 5, 11},
+  {{0x6F, 0x68}, 5, 11}, {{0x6F, 0x6C}, 5, 11}, {{0x6F, 0x6C}, 5, 11},
+  {{0x6F, 0x6D}, 5, 11}, {{0x6F, 0x6D}, 5, 11}, {{0x6F, 0x6E}, 5, 11},
+  {{0x6F, 0x6E}, 5, 11}, {{0x6F, 0x70}, 5, 11}, {{0x6F, 0x70}, 5, 11},
+  {{0x6F, 0x72}, 5, 11}, {{0x6F, 0x72}, 5, 11}, {{0x6F, 0x75}, 5, 11},
+  {{0x6F, 0x75}, 5, 11}, {{0x6F, 0x3A}, 5, 12}, {{0x6F, 0x42}, 5, 12},
+  {{0x6F, 0x43}, 5, 12}, {{0x6F, 0x44}, 5, 12}, {{0x6F, 0x45}, 5, 12},
+  {{0x6F, 0x46}, 5, 12}, {{0x6F, 0x47}, 5, 12}, {{0x6F, 0x48}, 5, 12},
+  {{0x6F, 0x49}, 5, 12}, {{0x6F, 0x4A}, 5, 12}, {{0x6F, 0x4B}, 5, 12},
+  {{0x6F, 0x4C}, 5, 12}, {{0x6F, 0x4D}, 5, 12}, {{0x6F, 0x4E}, 5, 12},
+  {{0x6F, 0x4F}, 5, 12}, {{0x6F, 0x50}, 5, 12}, {{0x6F, 0x51}, 5, 12},
+  {{0x6F, 0x52}, 5, 12}, {{0x6F, 0x53}, 5, 12}, {{0x6F, 0x54}, 5, 12},
+  {{0x6F, 0x55}, 5, 12}, {{0x6F, 0x56}, 5, 12}, {{0x6F, 0x57}, 5, 12},
+  {{0x6F, 0x59}, 5, 12}, {{0x6F, 0x6A}, 5, 12}, {{0x6F, 0x6B}, 5, 12},
+  {{0x6F, 0x71}, 5, 12}, {{0x6F, 0x76}, 5, 12}, {{0x6F, 0x77}, 5, 12},
+  {{0x6F, 0x78}, 5, 12}, {{0x6F, 0x79}, 5, 12}, {{0x6F, 0x7A}, 5, 12},
+  {{0x6F, 0x6F}, 5, 5}, {{0x6F, 0x6F}, 5, 5}, {{0x6F, 0x6F}, 5, 5},
+  {{0x6F, 0x6F}, 5, 5}, {{0x73, 0x30}, 5, 10}, {{0x73, 0x30}, 5, 10},
+  {{0x73, 0x30}, 5, 10}, {{0x73, 0x30}, 5, 10}, {{0x73, 0x31}, 5, 10},
+  {{0x73, 0x31}, 5, 10}, {{0x73, 0x31}, 5, 10}, {{0x73, 0x31}, 5, 10},
+  {{0x73, 0x32}, 5, 10}, {{0x73, 0x32}, 5, 10}, {{0x73, 0x32}, 5, 10},
+  {{0x73, 0x32}, 5, 10}, {{0x73, 0x61}, 5, 10}, {{0x73, 0x61}, 5, 10},
+  {{0x73, 0x61}, 5, 10}, {{0x73, 0x61}, 5, 10}, {{0x73, 0x63}, 5, 10},
+  {{0x73, 0x63}, 5, 10}, {{0x73, 0x63}, 5, 10}, {{0x73, 0x63}, 5, 10},
+  {{0x73, 0x65}, 5, 10}, {{0x73, 0x65}, 5, 10}, {{0x73, 0x65}, 5, 10},
+  {{0x73, 0x65}, 5, 10}, {{0x73, 0x69}, 5, 10}, {{0x73, 0x69}, 5, 10},
+  {{0x73, 0x69}, 5, 10}, {{0x73, 0x69}, 5, 10}, {{0x73, 0x6F}, 5, 10},
+  {{0x73, 0x6F}, 5, 10}, {{0x73, 0x6F}, 5, 10}, {{0x73, 0x6F}, 5, 10},
+  {{0x73, 0x73}, 5, 10}, {{0x73, 0x73}, 5, 10}, {{0x73, 0x73}, 5, 10},
+  {{0x73, 0x73}, 5, 10}, {{0x73, 0x74}, 5, 10}, {{0x73, 0x74}, 5, 10},
+  {{0x73, 0x74}, 5, 10}, {{0x73, 0x74}, 5, 10}, {{0x73, 0x20}, 5, 11},
+  {{0x73, 0x20}, 5, 11}, {{0x73, 0x25}, 5, 11}, {{0x73, 0x25}, 5, 11},
+  {{0x73, 0x2D}, 5, 11}, {{0x73, 0x2D}, 5, 11}, {{0x73, 0x2E}, 5, 11},
+  {{0x73, 0x2E}, 5, 11}, {{0x73, 0x2F}, 5, 11}, {{0x73, 0x2F}, 5, 11},
+  {{0x73, 0x33}, 5, 11}, {{0x73, 0x33}, 5, 11}, {{0x73, 0x34}, 5, 11},
+  {{0x73, 0x34}, 5, 11}, {{0x73, 0x35}, 5, 11}, {{0x73, 0x35}, 5, 11},
+  {{0x73, 0x36}, 5, 11}, {{0x73, 0x36}, 5, 11}, {{0x73, 0x37}, 5, 11},
+  {{0x73, 0x37}, 5, 11}, {{0x73, 0x38}, 5, 11}, {{0x73, 0x38}, 5, 11},
+  {{0x73, 0x39}, 5, 11}, {{0x73, 0x39}, 5, 11}, {{0x73, 0x3D}, 5, 11},
+  {{0x73, 0x3D}, 5, 11}, {{0x73, 0x41}, 5, 11}, {{0x73, 0x41}, 5, 11},
+  {{0x73, 0x5F}, 5, 11}, {{0x73, 0x5F}, 5, 11}, {{0x73, 0x62}, 5, 11},
+  {{0x73, 0x62}, 5, 11}, {{0x73, 0x64}, 5, 11}, {{0x73, 0x64}, 5, 11},
+  {{0x73, 0x66}, 5, 11}, {{0x73, 0x66}, 5, 11}, {{0x73, 0x67}, 5, 11},
+  {{0x73, 0x67}, 5, 11}, {{0x73, 0x68}, 5, 11}, {{0x73, 0x68}, 5, 11},
+  {{0x73, 0x6C}, 5, 11}, {{0x73, 0x6C}, 5, 11}, {{0x73, 0x6D}, 5, 11},
+  {{0x73, 0x6D}, 5, 11}, {{0x73, 0x6E}, 5, 11}, {{0x73, 0x6E}, 5, 11},
+  {{0x73, 0x70}, 5, 11}, {{0x73, 0x70}, 5, 11}, {{0x73, 0x72}, 5, 11},
+  {{0x73, 0x72}, 5, 11}, {{0x73, 0x75}, 5, 11}, {{0x73, 0x75}, 5, 11},
+  {{0x73, 0x3A}, 5, 12}, {{0x73, 0x42}, 5, 12}, {{0x73, 0x43}, 5, 12},
+  {{0x73, 0x44}, 5, 12}, {{0x73, 0x45}, 5, 12}, {{0x73, 0x46}, 5, 12},
+  {{0x73, 0x47}, 5, 12}, {{0x73, 0x48}, 5, 12}, {{0x73, 0x49}, 5, 12},
+  {{0x73, 0x4A}, 5, 12}, {{0x73, 0x4B}, 5, 12}, {{0x73, 0x4C}, 5, 12},
+  {{0x73, 0x4D}, 5, 12}, {{0x73, 0x4E}, 5, 12}, {{0x73, 0x4F}, 5, 12},
+  {{0x73, 0x50}, 5, 12}, {{0x73, 0x51}, 5, 12}, {{0x73, 0x52}, 5, 12},
+  {{0x73, 0x53}, 5, 12}, {{0x73, 0x54}, 5, 12}, {{0x73, 0x55}, 5, 12},
+  {{0x73, 0x56}, 5, 12}, {{0x73, 0x57}, 5, 12}, {{0x73, 0x59}, 5, 12},
+  {{0x73, 0x6A}, 5, 12}, {{0x73, 0x6B}, 5, 12}, {{0x73, 0x71}, 5, 12},
+  {{0x73, 0x76}, 5, 12}, {{0x73, 0x77}, 5, 12}, {{0x73, 0x78}, 5, 12},
+  {{0x73, 0x79}, 5, 12}, {{0x73, 0x7A}, 5, 12}, {{0x73, 0x73}, 5, 5},
+  {{0x73, 0x73}, 5, 5}, {{0x73, 0x73}, 5, 5}, {{0x73, 0x73}, 5, 5},
+  {{0x74, 0x30}, 5, 10}, {{0x74, 0x30}, 5, 10}, {{0x74, 0x30}, 5, 10},
+  {{0x74, 0x30}, 5, 10}, {{0x74, 0x31}, 5, 10}, {{0x74, 0x31}, 5, 10},
+  {{0x74, 0x31}, 5, 10}, {{0x74, 0x31}, 5, 10}, {{0x74, 0x32}, 5, 10},
+  {{0x74, 0x32}, 5, 10}, {{0x74, 0x32}, 5, 10}, {{0x74, 0x32}, 5, 10},
+  {{0x74, 0x61}, 5, 10}, {{0x74, 0x61}, 5, 10}, {{0x74, 0x61}, 5, 10},
+  {{0x74, 0x61}, 5, 10}, {{0x74, 0x63}, 5, 10}, {{0x74, 0x63}, 5, 10},
+  {{0x74, 0x63}, 5, 10}, {{0x74, 0x63}, 5, 10}, {{0x74, 0x65}, 5, 10},
+  {{0x74, 0x65}, 5, 10}, {{0x74, 0x65}, 5, 10}, {{0x74, 0x65}, 5, 10},
+  {{0x74, 0x69}, 5, 10}, {{0x74, 0x69}, 5, 10}, {{0x74, 0x69}, 5, 10},
+  {{0x74, 0x69}, 5, 10}, {{0x74, 0x6F}, 5, 10}, {{0x74, 0x6F}, 5, 10},
+  {{0x74, 0x6F}, 5, 10}, {{0x74, 0x6F}, 5, 10}, {{0x74, 0x73}, 5, 10},
+  {{0x74, 0x73}, 5, 10}, {{0x74, 0x73}, 5, 10}, {{0x74, 0x73}, 5, 10},
+  {{0x74, 0x74}, 5, 10}, {{0x74, 0x74}, 5, 10}, {{0x74, 0x74}, 5, 10},
+  {{0x74, 0x74}, 5, 10}, {{0x74, 0x20}, 5, 11}, {{0x74, 0x20}, 5, 11},
+  {{0x74, 0x25}, 5, 11}, {{0x74, 0x25}, 5, 11}, {{0x74, 0x2D}, 5, 11},
+  {{0x74, 0x2D}, 5, 11}, {{0x74, 0x2E}, 5, 11}, {{0x74, 0x2E}, 5, 11},
+  {{0x74, 0x2F}, 5, 11}, {{0x74, 0x2F}, 5, 11}, {{0x74, 0x33}, 5, 11},
+  {{0x74, 0x33}, 5, 11}, {{0x74, 0x34}, 5, 11}, {{0x74, 0x34}, 5, 11},
+  {{0x74, 0x35}, 5, 11}, {{0x74, 0x35}, 5, 11}, {{0x74, 0x36}, 5, 11},
+  {{0x74, 0x36}, 5, 11}, {{0x74, 0x37}, 5, 11}, {{0x74, 0x37}, 5, 11},
+  {{0x74, 0x38}, 5, 11}, {{0x74, 0x38}, 5, 11}, {{0x74, 0x39}, 5, 11},
+  {{0x74, 0x39}, 5, 11}, {{0x74, 0x3D}, 5, 11}, {{0x74, 0x3D}, 5, 11},
+  {{0x74, 0x41}, 5, 11}, {{0x74, 0x41}, 5, 11}, {{0x74, 0x5F}, 5, 11},
+  {{0x74, 0x5F}, 5, 11}, {{0x74, 0x62}, 5, 11}, {{0x74, 0x62}, 5, 11},
+  {{0x74, 0x64}, 5, 11}, {{0x74, 0x64}, 5, 11}, {{0x74, 0x66}, 5, 11},
+  {{0x74, 0x66}, 5, 11}, {{0x74, 0x67}, 5, 11}, {{0x74, 0x67}, 5, 11},
+  {{0x74, 0x68}, 5, 11}, {{0x74, 0x68}, 5, 11}, {{0x74, 0x6C}, 5, 11},
+  {{0x74, 0x6C}, 5, 11}, {{0x74, 0x6D}, 5, 11}, {{0x74, 0x6D}, 5, 11},
+  {{0x74, 0x6E}, 5, 11}, {{0x74, 0x6E}, 5, 11}, {{0x74, 0x70}, 5, 11},
+  {{0x74, 0x70}, 5, 11}, {{0x74, 0x72}, 5, 11}, {{0x74, 0x72}, 5, 11},
+  {{0x74, 0x75}, 5, 11}, {{0x74, 0x75}, 5, 11}, {{0x74, 0x3A}, 5, 12},
+  {{0x74, 0x42}, 5, 12}, {{0x74, 0x43}, 5, 12}, {{0x74, 0x44}, 5, 12},
+  {{0x74, 0x45}, 5, 12}, {{0x74, 0x46}, 5, 12}, {{0x74, 0x47}, 5, 12},
+  {{0x74, 0x48}, 5, 12}, {{0x74, 0x49}, 5, 12}, {{0x74, 0x4A}, 5, 12},
+  {{0x74, 0x4B}, 5, 12}, {{0x74, 0x4C}, 5, 12}, {{0x74, 0x4D}, 5, 12},
+  {{0x74, 0x4E}, 5, 12}, {{0x74, 0x4F}, 5, 12}, {{0x74, 0x50}, 5, 12},
+  {{0x74, 0x51}, 5, 12}, {{0x74, 0x52}, 5, 12}, {{0x74, 0x53}, 5, 12},
+  {{0x74, 0x54}, 5, 12}, {{0x74, 0x55}, 5, 12}, {{0x74, 0x56}, 5, 12},
+  {{0x74, 0x57}, 5, 12}, {{0x74, 0x59}, 5, 12}, {{0x74, 0x6A}, 5, 12},
+  {{0x74, 0x6B}, 5, 12}, {{0x74, 0x71}, 5, 12}, {{0x74, 0x76}, 5, 12},
+  {{0x74, 0x77}, 5, 12}, {{0x74, 0x78}, 5, 12}, {{0x74, 0x79}, 5, 12},
+  {{0x74, 0x7A}, 5, 12}, {{0x74, 0x74}, 5, 5}, {{0x74, 0x74}, 5, 5},
+  {{0x74, 0x74}, 5, 5}, {{0x74, 0x74}, 5, 5}, {{0x20, 0x30}, 6, 11},
+  {{0x20, 0x30}, 6, 11}, {{0x20, 0x31}, 6, 11}, {{0x20, 0x31}, 6, 11},
+  {{0x20, 0x32}, 6, 11}, {{0x20, 0x32}, 6, 11}, {{0x20, 0x61}, 6, 11},
+  {{0x20, 0x61}, 6, 11}, {{0x20, 0x63}, 6, 11}, {{0x20, 0x63}, 6, 11},
+  {{0x20, 0x65}, 6, 11}, {{0x20, 0x65}, 6, 11}, {{0x20, 0x69}, 6, 11},
+  {{0x20, 0x69}, 6, 11}, {{0x20, 0x6F}, 6, 11}, {{0x20, 0x6F}, 6, 11},
+  {{0x20, 0x73}, 6, 11}, {{0x20, 0x73}, 6, 11}, {{0x20, 0x74}, 6, 11},
+  {{0x20, 0x74}, 6, 11}, {{0x20, 0x20}, 6, 12}, {{0x20, 0x25}, 6, 12},
+  {{0x20, 0x2D}, 6, 12}, {{0x20, 0x2E}, 6, 12}, {{0x20, 0x2F}, 6, 12},
+  {{0x20, 0x33}, 6, 12}, {{0x20, 0x34}, 6, 12}, {{0x20, 0x35}, 6, 12},
+  {{0x20, 0x36}, 6, 12}, {{0x20, 0x37}, 6, 12}, {{0x20, 0x38}, 6, 12},
+  {{0x20, 0x39}, 6, 12}, {{0x20, 0x3D}, 6, 12}, {{0x20, 0x41}, 6, 12},
+  {{0x20, 0x5F}, 6, 12}, {{0x20, 0x62}, 6, 12}, {{0x20, 0x64}, 6, 12},
+  {{0x20, 0x66}, 6, 12}, {{0x20, 0x67}, 6, 12}, {{0x20, 0x68}, 6, 12},
+  {{0x20, 0x6C}, 6, 12}, {{0x20, 0x6D}, 6, 12}, {{0x20, 0x6E}, 6, 12},
+  {{0x20, 0x70}, 6, 12}, {{0x20, 0x72}, 6, 12}, {{0x20, 0x75}, 6, 12},
+  {{0x20, 0x20}, 6, 6}, {{0x20, 0x20}, 6, 6}, {{0x20, 0x20}, 6, 6},
+  {{0x20, 0x20}, 6, 6}, {{0x20, 0x20}, 6, 6}, {{0x20, 0x20}, 6, 6},
+  {{0x20, 0x20}, 6, 6}, {{0x20, 0x20}, 6, 6}, {{0x20, 0x20}, 6, 6},
+  {{0x20, 0x20}, 6, 6}, {{0x20, 0x20}, 6, 6}, {{0x20, 0x20}, 6, 6},
+  {{0x20, 0x20}, 6, 6}, {{0x20, 0x20}, 6, 6}, {{0x20, 0x20}, 6, 6},
+  {{0x20, 0x20}, 6, 6}, {{0x20, 0x20}, 6, 6}, {{0x20, 0x20}, 6, 6},
+  {{0x25, 0x30}, 6, 11}, {{0x25, 0x30}, 6, 11}, {{0x25, 0x31}, 6, 11},
+  {{0x25, 0x31}, 6, 11}, {{0x25, 0x32}, 6, 11}, {{0x25, 0x32}, 6, 11},
+  {{0x25, 0x61}, 6, 11}, {{0x25, 0x61}, 6, 11}, {{0x25, 0x63}, 6, 11},
+  {{0x25, 0x63}, 6, 11}, {{0x25, 0x65}, 6, 11}, {{0x25, 0x65}, 6, 11},
+  {{0x25, 0x69}, 6, 11}, {{0x25, 0x69}, 6, 11}, {{0x25, 0x6F}, 6, 11},
+  {{0x25, 0x6F}, 6, 11}, {{0x25, 0x73}, 6, 11}, {{0x25, 0x73}, 6, 11},
+  {{0x25, 0x74}, 6, 11}, {{0x25, 0x74}, 6, 11}, {{0x25, 0x20}, 6, 12},
+  {{0x25, 0x25}, 6, 12}, {{0x25, 0x2D}, 6, 12}, {{0x25, 0x2E}, 6, 12},
+  {{0x25, 0x2F}, 6, 12}, {{0x25, 0x33}, 6, 12}, {{0x25, 0x34}, 6, 12},
+  {{0x25, 0x35}, 6, 12}, {{0x25, 0x36}, 6, 12}, {{0x25, 0x37}, 6, 12},
+  {{0x25, 0x38}, 6, 12}, {{0x25, 0x39}, 6, 12}, {{0x25, 0x3D}, 6, 12},
+  {{0x25, 0x41}, 6, 12}, {{0x25, 0x5F}, 6, 12}, {{0x25, 0x62}, 6, 12},
+  {{0x25, 0x64}, 6, 12}, {{0x25, 0x66}, 6, 12}, {{0x25, 0x67}, 6, 12},
+  {{0x25, 0x68}, 6, 12}, {{0x25, 0x6C}, 6, 12}, {{0x25, 0x6D}, 6, 12},
+  {{0x25, 0x6E}, 6, 12}, {{0x25, 0x70}, 6, 12}, {{0x25, 0x72}, 6, 12},
+  {{0x25, 0x75}, 6, 12}, {{0x25, 0x25}, 6, 6}, {{0x25, 0x25}, 6, 6},
+  {{0x25, 0x25}, 6, 6}, {{0x25, 0x25}, 6, 6}, {{0x25, 0x25}, 6, 6},
+  {{0x25, 0x25}, 6, 6}, {{0x25, 0x25}, 6, 6}, {{0x25, 0x25}, 6, 6},
+  {{0x25, 0x25}, 6, 6}, {{0x25, 0x25}, 6, 6}, {{0x25, 0x25}, 6, 6},
+  {{0x25, 0x25}, 6, 6}, {{0x25, 0x25}, 6, 6}, {{0x25, 0x25}, 6, 6},
+  {{0x25, 0x25}, 6, 6}, {{0x25, 0x25}, 6, 6}, {{0x25, 0x25}, 6, 6},
+  {{0x25, 0x25}, 6, 6}, {{0x2D, 0x30}, 6, 11}, {{0x2D, 0x30}, 6, 11},
+  {{0x2D, 0x31}, 6, 11}, {{0x2D, 0x31}, 6, 11}, {{0x2D, 0x32}, 6, 11},
+  {{0x2D, 0x32}, 6, 11}, {{0x2D, 0x61}, 6, 11}, {{0x2D, 0x61}, 6, 11},
+  {{0x2D, 0x63}, 6, 11}, {{0x2D, 0x63}, 6, 11}, {{0x2D, 0x65}, 6, 11},
+  {{0x2D, 0x65}, 6, 11}, {{0x2D, 0x69}, 6, 11}, {{0x2D, 0x69}, 6, 11},
+  {{0x2D, 0x6F}, 6, 11}, {{0x2D, 0x6F}, 6, 11}, {{0x2D, 0x73}, 6, 11},
+  {{0x2D, 0x73}, 6, 11}, {{0x2D, 0x74}, 6, 11}, {{0x2D, 0x74}, 6, 11},
+  {{0x2D, 0x20}, 6, 12}, {{0x2D, 0x25}, 6, 12}, {{0x2D, 0x2D}, 6, 12},
+  {{0x2D, 0x2E}, 6, 12}, {{0x2D, 0x2F}, 6, 12}, {{0x2D, 0x33}, 6, 12},
+  {{0x2D, 0x34}, 6, 12}, {{0x2D, 0x35}, 6, 12}, {{0x2D, 0x36}, 6, 12},
+  {{0x2D, 0x37}, 6, 12}, {{0x2D, 0x38}, 6, 12}, {{0x2D, 0x39}, 6, 12},
+  {{0x2D, 0x3D}, 6, 12}, {{0x2D, 0x41}, 6, 12}, {{0x2D, 0x5F}, 6, 12},
+  {{0x2D, 0x62}, 6, 12}, {{0x2D, 0x64}, 6, 12}, {{0x2D, 0x66}, 6, 12},
+  {{0x2D, 0x67}, 6, 12}, {{0x2D, 0x68}, 6, 12}, {{0x2D, 0x6C}, 6, 12},
+  {{0x2D, 0x6D}, 6, 12}, {{0x2D, 0x6E}, 6, 12}, {{0x2D, 0x70}, 6, 12},
+  {{0x2D, 0x72}, 6, 12}, {{0x2D, 0x75}, 6, 12}, {{0x2D, 0x2D}, 6, 6},
+  {{0x2D, 0x2D}, 6, 6}, {{0x2D, 0x2D}, 6, 6}, {{0x2D, 0x2D}, 6, 6},
+  {{0x2D, 0x2D}, 6, 6}, {{0x2D, 0x2D}, 6, 6}, {{0x2D, 0x2D}, 6, 6},
+  {{0x2D, 0x2D}, 6, 6}, {{0x2D, 0x2D}, 6, 6}, {{0x2D, 0x2D}, 6, 6},
+  {{0x2D, 0x2D}, 6, 6}, {{0x2D, 0x2D}, 6, 6}, {{0x2D, 0x2D}, 6, 6},
+  {{0x2D, 0x2D}, 6, 6}, {{0x2D, 0x2D}, 6, 6}, {{0x2D, 0x2D}, 6, 6},
+  {{0x2D, 0x2D}, 6, 6}, {{0x2D, 0x2D}, 6, 6}, {{0x2E, 0x30}, 6, 11},
+  {{0x2E, 0x30}, 6, 11}, {{0x2E, 0x31}, 6, 11}, {{0x2E, 0x31}, 6, 11},
+  {{0x2E, 0x32}, 6, 11}, {{0x2E, 0x32}, 6, 11}, {{0x2E, 0x61}, 6, 11},
+  {{0x2E, 0x61}, 6, 11}, {{0x2E, 0x63}, 6, 11}, {{0x2E, 0x63}, 6, 11},
+  {{0x2E, 0x65}, 6, 11}, {{0x2E, 0x65}, 6, 11}, {{0x2E, 0x69}, 6, 11},
+  {{0x2E, 0x69}, 6, 11}, {{0x2E, 0x6F}, 6, 11}, {{0x2E, 0x6F}, 6, 11},
+  {{0x2E, 0x73}, 6, 11}, {{0x2E, 0x73}, 6, 11}, {{0x2E, 0x74}, 6, 11},
+  {{0x2E, 0x74}, 6, 11}, {{0x2E, 0x20}, 6, 12}, {{0x2E, 0x25}, 6, 12},
+  {{0x2E, 0x2D}, 6, 12}, {{0x2E, 0x2E}, 6, 12}, {{0x2E, 0x2F}, 6, 12},
+  {{0x2E, 0x33}, 6, 12}, {{0x2E, 0x34}, 6, 12}, {{0x2E, 0x35}, 6, 12},
+  {{0x2E, 0x36}, 6, 12}, {{0x2E, 0x37}, 6, 12}, {{0x2E, 0x38}, 6, 12},
+  {{0x2E, 0x39}, 6, 12}, {{0x2E, 0x3D}, 6, 12}, {{0x2E, 0x41}, 6, 12},
+  {{0x2E, 0x5F}, 6, 12}, {{0x2E, 0x62}, 6, 12}, {{0x2E, 0x64}, 6, 12},
+  {{0x2E, 0x66}, 6, 12}, {{0x2E, 0x67}, 6, 12}, {{0x2E, 0x68}, 6, 12},
+  {{0x2E, 0x6C}, 6, 12}, {{0x2E, 0x6D}, 6, 12}, {{0x2E, 0x6E}, 6, 12},
+  {{0x2E, 0x70}, 6, 12}, {{0x2E, 0x72}, 6, 12}, {{0x2E, 0x75}, 6, 12},
+  {{0x2E, 0x2E}, 6, 6}, {{0x2E, 0x2E}, 6, 6}, {{0x2E, 0x2E}, 6, 6},
+  {{0x2E, 0x2E}, 6, 6}, {{0x2E, 0x2E}, 6, 6}, {{0x2E, 0x2E}, 6, 6},
+  {{0x2E, 0x2E}, 6, 6}, {{0x2E, 0x2E}, 6, 6}, {{0x2E, 0x2E}, 6, 6},
+  {{0x2E, 0x2E}, 6, 6}, {{0x2E, 0x2E}, 6, 6}, {{0x2E, 0x2E}, 6, 6},
+  {{0x2E, 0x2E}, 6, 6}, {{0x2E, 0x2E}, 6, 6}, {{0x2E, 0x2E}, 6, 6},
+  {{0x2E, 0x2E}, 6, 6}, {{0x2E, 0x2E}, 6, 6}, {{0x2E, 0x2E}, 6, 6},
+  {{0x2F, 0x30}, 6, 11}, {{0x2F, 0x30}, 6, 11}, {{0x2F, 0x31}, 6, 11},
+  {{0x2F, 0x31}, 6, 11}, {{0x2F, 0x32}, 6, 11}, {{0x2F, 0x32}, 6, 11},
+  {{0x2F, 0x61}, 6, 11}, {{0x2F, 0x61}, 6, 11}, {{0x2F, 0x63}, 6, 11},
+  {{0x2F, 0x63}, 6, 11}, {{0x2F, 0x65}, 6, 11}, {{0x2F, 0x65}, 6, 11},
+  {{0x2F, 0x69}, 6, 11}, {{0x2F, 0x69}, 6, 11}, {{0x2F, 0x6F}, 6, 11},
+  {{0x2F, 0x6F}, 6, 11}, {{0x2F, 0x73}, 6, 11}, {{0x2F, 0x73}, 6, 11},
+  {{0x2F, 0x74}, 6, 11}, {{0x2F, 0x74}, 6, 11}, {{0x2F, 0x20}, 6, 12},
+  {{0x2F, 0x25}, 6, 12}, {{0x2F, 0x2D}, 6, 12}, {{0x2F, 0x2E}, 6, 12},
+  {{0x2F, 0x2F}, 6, 12}, {{0x2F, 0x33}, 6, 12}, {{0x2F, 0x34}, 6, 12},
+  {{0x2F, 0x35}, 6, 12}, {{0x2F, 0x36}, 6, 12}, {{0x2F, 0x37}, 6, 12},
+  {{0x2F, 0x38}, 6, 12}, {{0x2F, 0x39}, 6, 12}, {{0x2F, 0x3D}, 6, 12},
+  {{0x2F, 0x41}, 6, 12}, {{0x2F, 0x5F}, 6, 12}, {{0x2F, 0x62}, 6, 12},
+  {{0x2F, 0x64}, 6, 12}, {{0x2F, 0x66}, 6, 12}, {{0x2F, 0x67}, 6, 12},
+  {{0x2F, 0x68}, 6, 12}, {{0x2F, 0x6C}, 6, 12}, {{0x2F, 0x6D}, 6, 12},
+  {{0x2F, 0x6E}, 6, 12}, {{0x2F, 0x70}, 6, 12}, {{0x2F, 0x72}, 6, 12},
+  {{0x2F, 0x75}, 6, 12}, {{0x2F, 0x2F}, 6, 6}, {{0x2F, 0x2F}, 6, 6},
+  {{0x2F, 0x2F}, 6, 6}, {{0x2F, 0x2F}, 6, 6}, {{0x2F, 0x2F}, 6, 6},
+  {{0x2F, 0x2F}, 6, 6}, {{0x2F, 0x2F}, 6, 6}, {{0x2F, 0x2F}, 6, 6},
+  {{0x2F, 0x2F}, 6, 6}, {{0x2F, 0x2F}, 6, 6}, {{0x2F, 0x2F}, 6, 6},
+  {{0x2F, 0x2F}, 6, 6}, {{0x2F, 0x2F}, 6, 6}, {{0x2F, 0x2F}, 6, 6},
+  {{0x2F, 0x2F}, 6, 6}, {{0x2F, 0x2F}, 6, 6}, {{0x2F, 0x2F}, 6, 6},
+  {{0x2F, 0x2F}, 6, 6}, {{0x33, 0x30}, 6, 11}, {{0x33, 0x30}, 6, 11},
+  {{0x33, 0x31}, 6, 11}, {{0x33, 0x31}, 6, 11}, {{0x33, 0x32}, 6, 11},
+  {{0x33, 0x32}, 6, 11}, {{0x33, 0x61}, 6, 11}, {{0x33, 0x61}, 6, 11},
+  {{0x33, 0x63}, 6, 11}, {{0x33, 0x63}, 6, 11}, {{0x33, 0x65}, 6, 11},
+  {{0x33, 0x65}, 6, 11}, {{0x33, 0x69}, 6, 11}, {{0x33, 0x69}, 6, 11},
+  {{0x33, 0x6F}, 6, 11}, {{0x33, 0x6F}, 6, 11}, {{0x33, 0x73}, 6, 11},
+  {{0x33, 0x73}, 6, 11}, {{0x33, 0x74}, 6, 11}, {{0x33, 0x74}, 6, 11},
+  {{0x33, 0x20}, 6, 12}, {{0x33, 0x25}, 6, 12}, {{0x33, 0x2D}, 6, 12},
+  {{0x33, 0x2E}, 6, 12}, {{0x33, 0x2F}, 6, 12}, {{0x33, 0x33}, 6, 12},
+  {{0x33, 0x34}, 6, 12}, {{0x33, 0x35}, 6, 12}, {{0x33, 0x36}, 6, 12},
+  {{0x33, 0x37}, 6, 12}, {{0x33, 0x38}, 6, 12}, {{0x33, 0x39}, 6, 12},
+  {{0x33, 0x3D}, 6, 12}, {{0x33, 0x41}, 6, 12}, {{0x33, 0x5F}, 6, 12},
+  {{0x33, 0x62}, 6, 12}, {{0x33, 0x64}, 6, 12}, {{0x33, 0x66}, 6, 12},
+  {{0x33, 0x67}, 6, 12}, {{0x33, 0x68}, 6, 12}, {{0x33, 0x6C}, 6, 12},
+  {{0x33, 0x6D}, 6, 12}, {{0x33, 0x6E}, 6, 12}, {{0x33, 0x70}, 6, 12},
+  {{0x33, 0x72}, 6, 12}, {{0x33, 0x75}, 6, 12}, {{0x33, 0x33}, 6, 6},
+  {{0x33, 0x33}, 6, 6}, {{0x33, 0x33}, 6, 6}, {{0x33, 0x33}, 6, 6},
+  {{0x33, 0x33}, 6, 6}, {{0x33, 0x33}, 6, 6}, {{0x33, 0x33}, 6, 6},
+  {{0x33, 0x33}, 6, 6}, {{0x33, 0x33}, 6, 6}, {{0x33, 0x33}, 6, 6},
+  {{0x33, 0x33}, 6, 6}, {{0x33, 0x33}, 6, 6}, {{0x33, 0x33}, 6, 6},
+  {{0x33, 0x33}, 6, 6}, {{0x33, 0x33}, 6, 6}, {{0x33, 0x33}, 6, 6},
+  {{0x33, 0x33}, 6, 6}, {{0x33, 0x33}, 6, 6}, {{0x34, 0x30}, 6, 11},
+  {{0x34, 0x30}, 6, 11}, {{0x34, 0x31}, 6, 11}, {{0x34, 0x31}, 6, 11},
+  {{0x34, 0x32}, 6, 11}, {{0x34, 0x32}, 6, 11}, {{0x34, 0x61}, 6, 11},
+  {{0x34, 0x61}, 6, 11}, {{0x34, 0x63}, 6, 11}, {{0x34, 0x63}, 6, 11},
+  {{0x34, 0x65}, 6, 11}, {{0x34, 0x65}, 6, 11}, {{0x34, 0x69}, 6, 11},
+  {{0x34, 0x69}, 6, 11}, {{0x34, 0x6F}, 6, 11}, {{0x34, 0x6F}, 6, 11},
+  {{0x34, 0x73}, 6, 11}, {{0x34, 0x73}, 6, 11}, {{0x34, 0x74}, 6, 11},
+  {{0x34, 0x74}, 6, 11}, {{0x34, 0x20}, 6, 12}, {{0x34, 0x25}, 6, 12},
+  {{0x34, 0x2D}, 6, 12}, {{0x34, 0x2E}, 6, 12}, {{0x34, 0x2F}, 6, 12},
+  {{0x34, 0x33}, 6, 12}, {{0x34, 0x34}, 6, 12}, {{0x34, 0x35}, 6, 12},
+  {{0x34, 0x36}, 6, 12}, {{0x34, 0x37}, 6, 12}, {{0x34, 0x38}, 6, 12},
+  {{0x34, 0x39}, 6, 12}, {{0x34, 0x3D}, 6, 12}, {{0x34, 0x41}, 6, 12},
+  {{0x34, 0x5F}, 6, 12}, {{0x34, 0x62}, 6, 12}, {{0x34, 0x64}, 6, 12},
+  {{0x34, 0x66}, 6, 12}, {{0x34, 0x67}, 6, 12}, {{0x34, 0x68}, 6, 12},
+  {{0x34, 0x6C}, 6, 12}, {{0x34, 0x6D}, 6, 12}, {{0x34, 0x6E}, 6, 12},
+  {{0x34, 0x70}, 6, 12}, {{0x34, 0x72}, 6, 12}, {{0x34, 0x75}, 6, 12},
+  {{0x34, 0x34}, 6, 6}, {{0x34, 0x34}, 6, 6}, {{0x34, 0x34}, 6, 6},
+  {{0x34, 0x34}, 6, 6}, {{0x34, 0x34}, 6, 6}, {{0x34, 0x34}, 6, 6},
+  {{0x34, 0x34}, 6, 6}, {{0x34, 0x34}, 6, 6}, {{0x34, 0x34}, 6, 6},
+  {{0x34, 0x34}, 6, 6}, {{0x34, 0x34}, 6, 6}, {{0x34, 0x34}, 6, 6},
+  {{0x34, 0x34}, 6, 6}, {{0x34, 0x34}, 6, 6}, {{0x34, 0x34}, 6, 6},
+  {{0x34, 0x34}, 6, 6}, {{0x34, 0x34}, 6, 6}, {{0x34, 0x34}, 6, 6},
+  {{0x35, 0x30}, 6, 11}, {{0x35, 0x30}, 6, 11}, {{0x35, 0x31}, 6, 11},
+  {{0x35, 0x31}, 6, 11}, {{0x35, 0x32}, 6, 11}, {{0x35, 0x32}, 6, 11},
+  {{0x35, 0x61}, 6, 11}, {{0x35, 0x61}, 6, 11}, {{0x35, 0x63}, 6, 11},
+  {{0x35, 0x63}, 6, 11}, {{0x35, 0x65}, 6, 11}, {{0x35, 0x65}, 6, 11},
+  {{0x35, 0x69}, 6, 11}, {{0x35, 0x69}, 6, 11}, {{0x35, 0x6F}, 6, 11},
+  {{0x35, 0x6F}, 6, 11}, {{0x35, 0x73}, 6, 11}, {{0x35, 0x73}, 6, 11},
+  {{0x35, 0x74}, 6, 11}, {{0x35, 0x74}, 6, 11}, {{0x35, 0x20}, 6, 12},
+  {{0x35, 0x25}, 6, 12}, {{0x35, 0x2D}, 6, 12}, {{0x35, 0x2E}, 6, 12},
+  {{0x35, 0x2F}, 6, 12}, {{0x35, 0x33}, 6, 12}, {{0x35, 0x34}, 6, 12},
+  {{0x35, 0x35}, 6, 12}, {{0x35, 0x36}, 6, 12}, {{0x35, 0x37}, 6, 12},
+  {{0x35, 0x38}, 6, 12}, {{0x35, 0x39}, 6, 12}, {{0x35, 0x3D}, 6, 12},
+  {{0x35, 0x41}, 6, 12}, {{0x35, 0x5F}, 6, 12}, {{0x35, 0x62}, 6, 12},
+  {{0x35, 0x64}, 6, 12}, {{0x35, 0x66}, 6, 12}, {{0x35, 0x67}, 6, 12},
+  {{0x35, 0x68}, 6, 12}, {{0x35, 0x6C}, 6, 12}, {{0x35, 0x6D}, 6, 12},
+  {{0x35, 0x6E}, 6, 12}, {{0x35, 0x70}, 6, 12}, {{0x35, 0x72}, 6, 12},
+  {{0x35, 0x75}, 6, 12}, {{0x35, 0x35}, 6, 6}, {{0x35, 0x35}, 6, 6},
+  {{0x35, 0x35}, 6, 6}, {{0x35, 0x35}, 6, 6}, {{0x35, 0x35}, 6, 6},
+  {{0x35, 0x35}, 6, 6}, {{0x35, 0x35}, 6, 6}, {{0x35, 0x35}, 6, 6},
+  {{0x35, 0x35}, 6, 6}, {{0x35, 0x35}, 6, 6}, {{0x35, 0x35}, 6, 6},
+  {{0x35, 0x35}, 6, 6}, {{0x35, 0x35}, 6, 6}, {{0x35, 0x35}, 6, 6},
+  {{0x35, 0x35}, 6, 6}, {{0x35, 0x35}, 6, 6}, {{0x35, 0x35}, 6, 6},
+  {{0x35, 0x35}, 6, 6}, {{0x36, 0x30}, 6, 11}, {{0x36, 0x30}, 6, 11},
+  {{0x36, 0x31}, 6, 11}, {{0x36, 0x31}, 6, 11}, {{0x36, 0x32}, 6, 11},
+  {{0x36, 0x32}, 6, 11}, {{0x36, 0x61}, 6, 11}, {{0x36, 0x61}, 6, 11},
+  {{0x36, 0x63}, 6, 11}, {{0x36, 0x63}, 6, 11}, {{0x36, 0x65}, 6, 11},
+  {{0x36, 0x65}, 6, 11}, {{0x36, 0x69}, 6, 11}, {{0x36, 0x69}, 6, 11},
+  {{0x36, 0x6F}, 6, 11}, {{0x36, 0x6F}, 6, 11}, {{0x36, 0x73}, 6, 11},
+  {{0x36, 0x73}, 6, 11}, {{0x36, 0x74}, 6, 11}, {{0x36, 0x74}, 6, 11},
+  {{0x36, 0x20}, 6, 12}, {{0x36, 0x25}, 6, 12}, {{0x36, 0x2D}, 6, 12},
+  {{0x36, 0x2E}, 6, 12}, {{0x36, 0x2F}, 6, 12}, {{0x36, 0x33}, 6, 12},
+  {{0x36, 0x34}, 6, 12}, {{0x36, 0x35}, 6, 12}, {{0x36, 0x36}, 6, 12},
+  {{0x36, 0x37}, 6, 12}, {{0x36, 0x38}, 6, 12}, {{0x36, 0x39}, 6, 12},
+  {{0x36, 0x3D}, 6, 12}, {{0x36, 0x41}, 6, 12}, {{0x36, 0x5F}, 6, 12},
+  {{0x36, 0x62}, 6, 12}, {{0x36, 0x64}, 6, 12}, {{0x36, 0x66}, 6, 12},
+  {{0x36, 0x67}, 6, 12}, {{0x36, 0x68}, 6, 12}, {{0x36, 0x6C}, 6, 12},
+  {{0x36, 0x6D}, 6, 12}, {{0x36, 0x6E}, 6, 12}, {{0x36, 0x70}, 6, 12},
+  {{0x36, 0x72}, 6, 12}, {{0x36, 0x75}, 6, 12}, {{0x36, 0x36}, 6, 6},
+  {{0x36, 0x36}, 6, 6}, {{0x36, 0x36}, 6, 6}, {{0x36, 0x36}, 6, 6},
+  {{0x36, 0x36}, 6, 6}, {{0x36, 0x36}, 6, 6}, {{0x36, 0x36}, 6, 6},
+  {{0x36, 0x36}, 6, 6}, {{0x36, 0x36}, 6, 6}, {{0x36, 0x36}, 6, 6},
+  {{0x36, 0x36}, 6, 6}, {{0x36, 0x36}, 6, 6}, {{0x36, 0x36}, 6, 6},
+  {{0x36, 0x36}, 6, 6}, {{0x36, 0x36}, 6, 6}, {{0x36, 0x36}, 6, 6},
+  {{0x36, 0x36}, 6, 6}, {{0x36, 0x36}, 6, 6}, {{0x37, 0x30}, 6, 11},
+  {{0x37, 0x30}, 6, 11}, {{0x37, 0x31}, 6, 11}, {{0x37, 0x31}, 6, 11},
+  {{0x37, 0x32}, 6, 11}, {{0x37, 0x32}, 6, 11}, {{0x37, 0x61}, 6, 11},
+  {{0x37, 0x61}, 6, 11}, {{0x37, 0x63}, 6, 11}, {{0x37, 0x63}, 6, 11},
+  {{0x37, 0x65}, 6, 11}, {{0x37, 0x65}, 6, 11}, {{0x37, 0x69}, 6, 11},
+  {{0x37, 0x69}, 6, 11}, {{0x37, 0x6F}, 6, 11}, {{0x37, 0x6F}, 6, 11},
+  {{0x37, 0x73}, 6, 11}, {{0x37, 0x73}, 6, 11}, {{0x37, 0x74}, 6, 11},
+  {{0x37, 0x74}, 6, 11}, {{0x37, 0x20}, 6, 12}, {{0x37, 0x25}, 6, 12},
+  {{0x37, 0x2D}, 6, 12}, {{0x37, 0x2E}, 6, 12}, {{0x37, 0x2F}, 6, 12},
+  {{0x37, 0x33}, 6, 12}, {{0x37, 0x34}, 6, 12}, {{0x37, 0x35}, 6, 12},
+  {{0x37, 0x36}, 6, 12}, {{0x37, 0x37}, 6, 12}, {{0x37, 0x38}, 6, 12},
+  {{0x37, 0x39}, 6, 12}, {{0x37, 0x3D}, 6, 12}, {{0x37, 0x41}, 6, 12},
+  {{0x37, 0x5F}, 6, 12}, {{0x37, 0x62}, 6, 12}, {{0x37, 0x64}, 6, 12},
+  {{0x37, 0x66}, 6, 12}, {{0x37, 0x67}, 6, 12}, {{0x37, 0x68}, 6, 12},
+  {{0x37, 0x6C}, 6, 12}, {{0x37, 0x6D}, 6, 12}, {{0x37, 0x6E}, 6, 12},
+  {{0x37, 0x70}, 6, 12}, {{0x37, 0x72}, 6, 12}, {{0x37, 0x75}, 6, 12},
+  {{0x37, 0x37}, 6, 6}, {{0x37, 0x37}, 6, 6}, {{0x37, 0x37}, 6, 6},
+  {{0x37, 0x37}, 6, 6}, {{0x37, 0x37}, 6, 6}, {{0x37, 0x37}, 6, 6},
+  {{0x37, 0x37}, 6, 6}, {{0x37, 0x37}, 6, 6}, {{0x37, 0x37}, 6, 6},
+  {{0x37, 0x37}, 6, 6}, {{0x37, 0x37}, 6, 6}, {{0x37, 0x37}, 6, 6},
+  {{0x37, 0x37}, 6, 6}, {{0x37, 0x37}, 6, 6}, {{0x37, 0x37}, 6, 6},
+  {{0x37, 0x37}, 6, 6}, {{0x37, 0x37}, 6, 6}, {{0x37, 0x37}, 6, 6},
+  {{0x38, 0x30}, 6, 11}, {{0x38, 0x30}, 6, 11}, {{0x38, 0x31}, 6, 11},
+  {{0x38, 0x31}, 6, 11}, {{0x38, 0x32}, 6, 11}, {{0x38, 0x32}, 6, 11},
+  {{0x38, 0x61}, 6, 11}, {{0x38, 0x61}, 6, 11}, {{0x38, 0x63}, 6, 11},
+  {{0x38, 0x63}, 6, 11}, {{0x38, 0x65}, 6, 11}, {{0x38, 0x65}, 6, 11},
+  {{0x38, 0x69}, 6, 11}, {{0x38, 0x69}, 6, 11}, {{0x38, 0x6F}, 6, 11},
+  {{0x38, 0x6F}, 6, 11}, {{0x38, 0x73}, 6, 11}, {{0x38, 0x73}, 6, 11},
+  {{0x38, 0x74}, 6, 11}, {{0x38, 0x74}, 6, 11}, {{0x38, 0x20}, 6, 12},
+  {{0x38, 0x25}, 6, 12}, {{0x38, 0x2D}, 6, 12}, {{0x38, 0x2E}, 6, 12},
+  {{0x38, 0x2F}, 6, 12}, {{0x38, 0x33}, 6, 12}, {{0x38, 0x34}, 6, 12},
+  {{0x38, 0x35}, 6, 12}, {{0x38, 0x36}, 6, 12}, {{0x38, 0x37}, 6, 12},
+  {{0x38, 0x38}, 6, 12}, {{0x38, 0x39}, 6, 12}, {{0x38, 0x3D}, 6, 12},
+  {{0x38, 0x41}, 6, 12}, {{0x38, 0x5F}, 6, 12}, {{0x38, 0x62}, 6, 12},
+  {{0x38, 0x64}, 6, 12}, {{0x38, 0x66}, 6, 12}, {{0x38, 0x67}, 6, 12},
+  {{0x38, 0x68}, 6, 12}, {{0x38, 0x6C}, 6, 12}, {{0x38, 0x6D}, 6, 12},
+  {{0x38, 0x6E}, 6, 12}, {{0x38, 0x70}, 6, 12}, {{0x38, 0x72}, 6, 12},
+  {{0x38, 0x75}, 6, 12}, {{0x38, 0x38}, 6, 6}, {{0x38, 0x38}, 6, 6},
+  {{0x38, 0x38}, 6, 6}, {{0x38, 0x38}, 6, 6}, {{0x38, 0x38}, 6, 6},
+  {{0x38, 0x38}, 6, 6}, {{0x38, 0x38}, 6, 6}, {{0x38, 0x38}, 6, 6},
+  {{0x38, 0x38}, 6, 6}, {{0x38, 0x38}, 6, 6}, {{0x38, 0x38}, 6, 6},
+  {{0x38, 0x38}, 6, 6}, {{0x38, 0x38}, 6, 6}, {{0x38, 0x38}, 6, 6},
+  {{0x38, 0x38}, 6, 6}, {{0x38, 0x38}, 6, 6}, {{0x38, 0x38}, 6, 6},
+  {{0x38, 0x38}, 6, 6}, {{0x39, 0x30}, 6, 11}, {{0x39, 0x30}, 6, 11},
+  {{0x39, 0x31}, 6, 11}, {{0x39, 0x31}, 6, 11}, {{0x39, 0x32}, 6, 11},
+  {{0x39, 0x32}, 6, 11}, {{0x39, 0x61}, 6, 11}, {{0x39, 0x61}, 6, 11},
+  {{0x39, 0x63}, 6, 11}, {{0x39, 0x63}, 6, 11}, {{0x39, 0x65}, 6, 11},
+  {{0x39, 0x65}, 6, 11}, {{0x39, 0x69}, 6, 11}, {{0x39, 0x69}, 6, 11},
+  {{0x39, 0x6F}, 6, 11}, {{0x39, 0x6F}, 6, 11}, {{0x39, 0x73}, 6, 11},
+  {{0x39, 0x73}, 6, 11}, {{0x39, 0x74}, 6, 11}, {{0x39, 0x74}, 6, 11},
+  {{0x39, 0x20}, 6, 12}, {{0x39, 0x25}, 6, 12}, {{0x39, 0x2D}, 6, 12},
+  {{0x39, 0x2E}, 6, 12}, {{0x39, 0x2F}, 6, 12}, {{0x39, 0x33}, 6, 12},
+  {{0x39, 0x34}, 6, 12}, {{0x39, 0x35}, 6, 12}, {{0x39, 0x36}, 6, 12},
+  {{0x39, 0x37}, 6, 12}, {{0x39, 0x38}, 6, 12}, {{0x39, 0x39}, 6, 12},
+  {{0x39, 0x3D}, 6, 12}, {{0x39, 0x41}, 6, 12}, {{0x39, 0x5F}, 6, 12},
+  {{0x39, 0x62}, 6, 12}, {{0x39, 0x64}, 6, 12}, {{0x39, 0x66}, 6, 12},
+  {{0x39, 0x67}, 6, 12}, {{0x39, 0x68}, 6, 12}, {{0x39, 0x6C}, 6, 12},
+  {{0x39, 0x6D}, 6, 12}, {{0x39, 0x6E}, 6, 12}, {{0x39, 0x70}, 6, 12},
+  {{0x39, 0x72}, 6, 12}, {{0x39, 0x75}, 6, 12}, {{0x39, 0x39}, 6, 6},
+  {{0x39, 0x39}, 6, 6}, {{0x39, 0x39}, 6, 6}, {{0x39, 0x39}, 6, 6},
+  {{0x39, 0x39}, 6, 6}, {{0x39, 0x39}, 6, 6}, {{0x39, 0x39}, 6, 6},
+  {{0x39, 0x39}, 6, 6}, {{0x39, 0x39}, 6, 6}, {{0x39, 0x39}, 6, 6},
+  {{0x39, 0x39}, 6, 6}, {{0x39, 0x39}, 6, 6}, {{0x39, 0x39}, 6, 6},
+  {{0x39, 0x39}, 6, 6}, {{0x39, 0x39}, 6, 6}, {{0x39, 0x39}, 6, 6},
+  {{0x39, 0x39}, 6, 6}, {{0x39, 0x39}, 6, 6}, {{0x3D, 0x30}, 6, 11},
+  {{0x3D, 0x30}, 6, 11}, {{0x3D, 0x31}, 6, 11}, {{0x3D, 0x31}, 6, 11},
+  {{0x3D, 0x32}, 6, 11}, {{0x3D, 0x32}, 6, 11}, {{0x3D, 0x61}, 6, 11},
+  {{0x3D, 0x61}, 6, 11}, {{0x3D, 0x63}, 6, 11}, {{0x3D, 0x63}, 6, 11},
+  {{0x3D, 0x65}, 6, 11}, {{0x3D, 0x65}, 6, 11}, {{0x3D, 0x69}, 6, 11},
+  {{0x3D, 0x69}, 6, 11}, {{0x3D, 0x6F}, 6, 11}, {{0x3D, 0x6F}, 6, 11},
+  {{0x3D, 0x73}, 6, 11}, {{0x3D, 0x73}, 6, 11}, {{0x3D, 0x74}, 6, 11},
+  {{0x3D, 0x74}, 6, 11}, {{0x3D, 0x20}, 6, 12}, {{0x3D, 0x25}, 6, 12},
+  {{0x3D, 0x2D}, 6, 12}, {{0x3D, 0x2E}, 6, 12}, {{0x3D, 0x2F}, 6, 12},
+  {{0x3D, 0x33}, 6, 12}, {{0x3D, 0x34}, 6, 12}, {{0x3D, 0x35}, 6, 12},
+  {{0x3D, 0x36}, 6, 12}, {{0x3D, 0x37}, 6, 12}, {{0x3D, 0x38}, 6, 12},
+  {{0x3D, 0x39}, 6, 12}, {{0x3D, 0x3D}, 6, 12}, {{0x3D, 0x41}, 6, 12},
+  {{0x3D, 0x5F}, 6, 12}, {{0x3D, 0x62}, 6, 12}, {{0x3D, 0x64}, 6, 12},
+  {{0x3D, 0x66}, 6, 12}, {{0x3D, 0x67}, 6, 12}, {{0x3D, 0x68}, 6, 12},
+  {{0x3D, 0x6C}, 6, 12}, {{0x3D, 0x6D}, 6, 12}, {{0x3D, 0x6E}, 6, 12},
+  {{0x3D, 0x70}, 6, 12}, {{0x3D, 0x72}, 6, 12}, {{0x3D, 0x75}, 6, 12},
+  {{0x3D, 0x3D}, 6, 6}, {{0x3D, 0x3D}, 6, 6}, {{0x3D, 0x3D}, 6, 6},
+  {{0x3D, 0x3D}, 6, 6}, {{0x3D, 0x3D}, 6, 6}, {{0x3D, 0x3D}, 6, 6},
+  {{0x3D, 0x3D}, 6, 6}, {{0x3D, 0x3D}, 6, 6}, {{0x3D, 0x3D}, 6, 6},
+  {{0x3D, 0x3D}, 6, 6}, {{0x3D, 0x3D}, 6, 6}, {{0x3D, 0x3D}, 6, 6},
+  {{0x3D, 0x3D}, 6, 6}, {{0x3D, 0x3D}, 6, 6}, {{0x3D, 0x3D}, 6, 6},
+  {{0x3D, 0x3D}, 6, 6}, {{0x3D, 0x3D}, 6, 6}, {{0x3D, 0x3D}, 6, 6},
+  {{0x41, 0x30}, 6, 11}, {{0x41, 0x30}, 6, 11}, {{0x41, 0x31}, 6, 11},
+  {{0x41, 0x31}, 6, 11}, {{0x41, 0x32}, 6, 11}, {{0x41, 0x32}, 6, 11},
+  {{0x41, 0x61}, 6, 11}, {{0x41, 0x61}, 6, 11}, {{0x41, 0x63}, 6, 11},
+  {{0x41, 0x63}, 6, 11}, {{0x41, 0x65}, 6, 11}, {{0x41, 0x65}, 6, 11},
+  {{0x41, 0x69}, 6, 11}, {{0x41, 0x69}, 6, 11}, {{0x41, 0x6F}, 6, 11},
+  {{0x41, 0x6F}, 6, 11}, {{0x41, 0x73}, 6, 11}, {{0x41, 0x73}, 6, 11},
+  {{0x41, 0x74}, 6, 11}, {{0x41, 0x74}, 6, 11}, {{0x41, 0x20}, 6, 12},
+  {{0x41, 0x25}, 6, 12}, {{0x41, 0x2D}, 6, 12}, {{0x41, 0x2E}, 6, 12},
+  {{0x41, 0x2F}, 6, 12}, {{0x41, 0x33}, 6, 12}, {{0x41, 0x34}, 6, 12},
+  {{0x41, 0x35}, 6, 12}, {{0x41, 0x36}, 6, 12}, {{0x41, 0x37}, 6, 12},
+  {{0x41, 0x38}, 6, 12}, {{0x41, 0x39}, 6, 12}, {{0x41, 0x3D}, 6, 12},
+  {{0x41, 0x41}, 6, 12}, {{0x41, 0x5F}, 6, 12}, {{0x41, 0x62}, 6, 12},
+  {{0x41, 0x64}, 6, 12}, {{0x41, 0x66}, 6, 12}, {{0x41, 0x67}, 6, 12},
+  {{0x41, 0x68}, 6, 12}, {{0x41, 0x6C}, 6, 12}, {{0x41, 0x6D}, 6, 12},
+  {{0x41, 0x6E}, 6, 12}, {{0x41, 0x70}, 6, 12}, {{0x41, 0x72}, 6, 12},
+  {{0x41, 0x75}, 6, 12}, {{0x41, 0x41}, 6, 6}, {{0x41, 0x41}, 6, 6},
+  {{0x41, 0x41}, 6, 6}, {{0x41, 0x41}, 6, 6}, {{0x41, 0x41}, 6, 6},
+  {{0x41, 0x41}, 6, 6}, {{0x41, 0x41}, 6, 6}, {{0x41, 0x41}, 6, 6},
+  {{0x41, 0x41}, 6, 6}, {{0x41, 0x41}, 6, 6}, {{0x41, 0x41}, 6, 6},
+  {{0x41, 0x41}, 6, 6}, {{0x41, 0x41}, 6, 6}, {{0x41, 0x41}, 6, 6},
+  {{0x41, 0x41}, 6, 6}, {{0x41, 0x41}, 6, 6}, {{0x41, 0x41}, 6, 6},
+  {{0x41, 0x41}, 6, 6}, {{0x5F, 0x30}, 6, 11}, {{0x5F, 0x30}, 6, 11},
+  {{0x5F, 0x31}, 6, 11}, {{0x5F, 0x31}, 6, 11}, {{0x5F, 0x32}, 6, 11},
+  {{0x5F, 0x32}, 6, 11}, {{0x5F, 0x61}, 6, 11}, {{0x5F, 0x61}, 6, 11},
+  {{0x5F, 0x63}, 6, 11}, {{0x5F, 0x63}, 6, 11}, {{0x5F, 0x65}, 6, 11},
+  {{0x5F, 0x65}, 6, 11}, {{0x5F, 0x69}, 6, 11}, {{0x5F, 0x69}, 6, 11},
+  {{0x5F, 0x6F}, 6, 11}, {{0x5F, 0x6F}, 6, 11}, {{0x5F, 0x73}, 6, 11},
+  {{0x5F, 0x73}, 6, 11}, {{0x5F, 0x74}, 6, 11}, {{0x5F, 0x74}, 6, 11},
+  {{0x5F, 0x20}, 6, 12}, {{0x5F, 0x25}, 6, 12}, {{0x5F, 0x2D}, 6, 12},
+  {{0x5F, 0x2E}, 6, 12}, {{0x5F, 0x2F}, 6, 12}, {{0x5F, 0x33}, 6, 12},
+  {{0x5F, 0x34}, 6, 12}, {{0x5F, 0x35}, 6, 12}, {{0x5F, 0x36}, 6, 12},
+  {{0x5F, 0x37}, 6, 12}, {{0x5F, 0x38}, 6, 12}, {{0x5F, 0x39}, 6, 12},
+  {{0x5F, 0x3D}, 6, 12}, {{0x5F, 0x41}, 6, 12}, {{0x5F, 0x5F}, 6, 12},
+  {{0x5F, 0x62}, 6, 12}, {{0x5F, 0x64}, 6, 12}, {{0x5F, 0x66}, 6, 12},
+  {{0x5F, 0x67}, 6, 12}, {{0x5F, 0x68}, 6, 12}, {{0x5F, 0x6C}, 6, 12},
+  {{0x5F, 0x6D}, 6, 12}, {{0x5F, 0x6E}, 6, 12}, {{0x5F, 0x70}, 6, 12},
+  {{0x5F, 0x72}, 6, 12}, {{0x5F, 0x75}, 6, 12}, {{0x5F, 0x5F}, 6, 6},
+  {{0x5F, 0x5F}, 6, 6}, {{0x5F, 0x5F}, 6, 6}, {{0x5F, 0x5F}, 6, 6},
+  {{0x5F, 0x5F}, 6, 6}, {{0x5F, 0x5F}, 6, 6}, {{0x5F, 0x5F}, 6, 6},
+  {{0x5F, 0x5F}, 6, 6}, {{0x5F, 0x5F}, 6, 6}, {{0x5F, 0x5F}, 6, 6},
+  {{0x5F, 0x5F}, 6, 6}, {{0x5F, 0x5F}, 6, 6}, {{0x5F, 0x5F}, 6, 6},
+  {{0x5F, 0x5F}, 6, 6}, {{0x5F, 0x5F}, 6, 6}, {{0x5F, 0x5F}, 6, 6},
+  {{0x5F, 0x5F}, 6, 6}, {{0x5F, 0x5F}, 6, 6}, {{0x62, 0x30}, 6, 11},
+  {{0x62, 0x30}, 6, 11}, {{0x62, 0x31}, 6, 11}, {{0x62, 0x31}, 6, 11},
+  {{0x62, 0x32}, 6, 11}, {{0x62, 0x32}, 6, 11}, {{0x62, 0x61}, 6, 11},
+  {{0x62, 0x61}, 6, 11}, {{0x62, 0x63}, 6, 11}, {{0x62, 0x63}, 6, 11},
+  {{0x62, 0x65}, 6, 11}, {{0x62, 0x65}, 6, 11}, {{0x62, 0x69}, 6, 11},
+  {{0x62, 0x69}, 6, 11}, {{0x62, 0x6F}, 6, 11}, {{0x62, 0x6F}, 6, 11},
+  {{0x62, 0x73}, 6, 11}, {{0x62, 0x73}, 6, 11}, {{0x62, 0x74}, 6, 11},
+  {{0x62, 0x74}, 6, 11}, {{0x62, 0x20}, 6, 12}, {{0x62, 0x25}, 6, 12},
+  {{0x62, 0x2D}, 6, 12}, {{0x62, 0x2E}, 6, 12}, {{0x62, 0x2F}, 6, 12},
+  {{0x62, 0x33}, 6, 12}, {{0x62, 0x34}, 6, 12}, {{0x62, 0x35}, 6, 12},
+  {{0x62, 0x36}, 6, 12}, {{0x62, 0x37}, 6, 12}, {{0x62, 0x38}, 6, 12},
+  {{0x62, 0x39}, 6, 12}, {{0x62, 0x3D}, 6, 12}, {{0x62, 0x41}, 6, 12},
+  {{0x62, 0x5F}, 6, 12}, {{0x62, 0x62}, 6, 12}, {{0x62, 0x64}, 6, 12},
+  {{0x62, 0x66}, 6, 12}, {{0x62, 0x67}, 6, 12}, {{0x62, 0x68}, 6, 12},
+  {{0x62, 0x6C}, 6, 12}, {{0x62, 0x6D}, 6, 12}, {{0x62, 0x6E}, 6, 12},
+  {{0x62, 0x70}, 6, 12}, {{0x62, 0x72}, 6, 12}, {{0x62, 0x75}, 6, 12},
+  {{0x62, 0x62}, 6, 6}, {{0x62, 0x62}, 6, 6}, {{0x62, 0x62}, 6, 6},
+  {{0x62, 0x62}, 6, 6}, {{0x62, 0x62}, 6, 6}, {{0x62, 0x62}, 6, 6},
+  {{0x62, 0x62}, 6, 6}, {{0x62, 0x62}, 6, 6}, {{0x62, 0x62}, 6, 6},
+  {{0x62, 0x62}, 6, 6}, {{0x62, 0x62}, 6, 6}, {{0x62, 0x62}, 6, 6},
+  {{0x62, 0x62}, 6, 6}, {{0x62, 0x62}, 6, 6}, {{0x62, 0x62}, 6, 6},
+  {{0x62, 0x62}, 6, 6}, {{0x62, 0x62}, 6, 6}, {{0x62, 0x62}, 6, 6},
+  {{0x64, 0x30}, 6, 11}, {{0x64, 0x30}, 6, 11}, {{0x64, 0x31}, 6, 11},
+  {{0x64, 0x31}, 6, 11}, {{0x64, 0x32}, 6, 11}, {{0x64, 0x32}, 6, 11},
+  {{0x64, 0x61}, 6, 11}, {{0x64, 0x61}, 6, 11}, {{0x64, 0x63}, 6, 11},
+  {{0x64, 0x63}, 6, 11}, {{0x64, 0x65}, 6, 11}, {{0x64, 0x65}, 6, 11},
+  {{0x64, 0x69}, 6, 11}, {{0x64, 0x69}, 6, 11}, {{0x64, 0x6F}, 6, 11},
+  {{0x64, 0x6F}, 6, 11}, {{0x64, 0x73}, 6, 11}, {{0x64, 0x73}, 6, 11},
+  {{0x64, 0x74}, 6, 11}, {{0x64, 0x74}, 6, 11}, {{0x64, 0x20}, 6, 12},
+  {{0x64, 0x25}, 6, 12}, {{0x64, 0x2D}, 6, 12}, {{0x64, 0x2E}, 6, 12},
+  {{0x64, 0x2F}, 6, 12}, {{0x64, 0x33}, 6, 12}, {{0x64, 0x34}, 6, 12},
+  {{0x64, 0x35}, 6, 12}, {{0x64, 0x36}, 6, 12}, {{0x64, 0x37}, 6, 12},
+  {{0x64, 0x38}, 6, 12}, {{0x64, 0x39}, 6, 12}, {{0x64, 0x3D}, 6, 12},
+  {{0x64, 0x41}, 6, 12}, {{0x64, 0x5F}, 6, 12}, {{0x64, 0x62}, 6, 12},
+  {{0x64, 0x64}, 6, 12}, {{0x64, 0x66}, 6, 12}, {{0x64, 0x67}, 6, 12},
+  {{0x64, 0x68}, 6, 12}, {{0x64, 0x6C}, 6, 12}, {{0x64, 0x6D}, 6, 12},
+  {{0x64, 0x6E}, 6, 12}, {{0x64, 0x70}, 6, 12}, {{0x64, 0x72}, 6, 12},
+  {{0x64, 0x75}, 6, 12}, {{0x64, 0x64}, 6, 6}, {{0x64, 0x64}, 6, 6},
+  {{0x64, 0x64}, 6, 6}, {{0x64, 0x64}, 6, 6}, {{0x64, 0x64}, 6, 6},
+  {{0x64, 0x64}, 6, 6}, {{0x64, 0x64}, 6, 6}, {{0x64, 0x64}, 6, 6},
+  {{0x64, 0x64}, 6, 6}, {{0x64, 0x64}, 6, 6}, {{0x64, 0x64}, 6, 6},
+  {{0x64, 0x64}, 6, 6}, {{0x64, 0x64}, 6, 6}, {{0x64, 0x64}, 6, 6},
+  {{0x64, 0x64}, 6, 6}, {{0x64, 0x64}, 6, 6}, {{0x64, 0x64}, 6, 6},
+  {{0x64, 0x64}, 6, 6}, {{0x66, 0x30}, 6, 11}, {{0x66, 0x30}, 6, 11},
+  {{0x66, 0x31}, 6, 11}, {{0x66, 0x31}, 6, 11}, {{0x66, 0x32}, 6, 11},
+  {{0x66, 0x32}, 6, 11}, {{0x66, 0x61}, 6, 11}, {{0x66, 0x61}, 6, 11},
+  {{0x66, 0x63}, 6, 11}, {{0x66, 0x63}, 6, 11}, {{0x66, 0x65}, 6, 11},
+  {{0x66, 0x65}, 6, 11}, {{0x66, 0x69}, 6, 11}, {{0x66, 0x69}, 6, 11},
+  {{0x66, 0x6F}, 6, 11}, {{0x66, 0x6F}, 6, 11}, {{0x66, 0x73}, 6, 11},
+  {{0x66, 0x73}, 6, 11}, {{0x66, 0x74}, 6, 11}, {{0x66, 0x74}, 6, 11},
+  {{0x66, 0x20}, 6, 12}, {{0x66, 0x25}, 6, 12}, {{0x66, 0x2D}, 6, 12},
+  {{0x66, 0x2E}, 6, 12}, {{0x66, 0x2F}, 6, 12}, {{0x66, 0x33}, 6, 12},
+  {{0x66, 0x34}, 6, 12}, {{0x66, 0x35}, 6, 12}, {{0x66, 0x36}, 6, 12},
+  {{0x66, 0x37}, 6, 12}, {{0x66, 0x38}, 6, 12}, {{0x66, 0x39}, 6, 12},
+  {{0x66, 0x3D}, 6, 12}, {{0x66, 0x41}, 6, 12}, {{0x66, 0x5F}, 6, 12},
+  {{0x66, 0x62}, 6, 12}, {{0x66, 0x64}, 6, 12}, {{0x66, 0x66}, 6, 12},
+  {{0x66, 0x67}, 6, 12}, {{0x66, 0x68}, 6, 12}, {{0x66, 0x6C}, 6, 12},
+  {{0x66, 0x6D}, 6, 12}, {{0x66, 0x6E}, 6, 12}, {{0x66, 0x70}, 6, 12},
+  {{0x66, 0x72}, 6, 12}, {{0x66, 0x75}, 6, 12}, {{0x66, 0x66}, 6, 6},
+  {{0x66, 0x66}, 6, 6}, {{0x66, 0x66}, 6, 6}, {{0x66, 0x66}, 6, 6},
+  {{0x66, 0x66}, 6, 6}, {{0x66, 0x66}, 6, 6}, {{0x66, 0x66}, 6, 6},
+  {{0x66, 0x66}, 6, 6}, {{0x66, 0x66}, 6, 6}, {{0x66, 0x66}, 6, 6},
+  {{0x66, 0x66}, 6, 6}, {{0x66, 0x66}, 6, 6}, {{0x66, 0x66}, 6, 6},
+  {{0x66, 0x66}, 6, 6}, {{0x66, 0x66}, 6, 6}, {{0x66, 0x66}, 6, 6},
+  {{0x66, 0x66}, 6, 6}, {{0x66, 0x66}, 6, 6}, {{0x67, 0x30}, 6, 11},
+  {{0x67, 0x30}, 6, 11}, {{0x67, 0x31}, 6, 11}, {{0x67, 0x31}, 6, 11},
+  {{0x67, 0x32}, 6, 11}, {{0x67, 0x32}, 6, 11}, {{0x67, 0x61}, 6, 11},
+  {{0x67, 0x61}, 6, 11}, {{0x67, 0x63}, 6, 11}, {{0x67, 0x63}, 6, 11},
+  {{0x67, 0x65}, 6, 11}, {{0x67, 0x65}, 6, 11}, {{0x67, 0x69}, 6, 11},
+  {{0x67, 0x69}, 6, 11}, {{0x67, 0x6F}, 6, 11}, {{0x67, 0x6F}, 6, 11},
+  {{0x67, 0x73}, 6, 11}, {{0x67, 0x73}, 6, 11}, {{0x67, 0x74}, 6, 11},
+  {{0x67, 0x74}, 6, 11}, {{0x67, 0x20}, 6, 12}, {{0x67, 0x25}, 6, 12},
+  {{0x67, 0x2D}, 6, 12}, {{0x67, 0x2E}, 6, 12}, {{0x67, 0x2F}, 6, 12},
+  {{0x67, 0x33}, 6, 12}, {{0x67, 0x34}, 6, 12}, {{0x67, 0x35}, 6, 12},
+  {{0x67, 0x36}, 6, 12}, {{0x67, 0x37}, 6, 12}, {{0x67, 0x38}, 6, 12},
+  {{0x67, 0x39}, 6, 12}, {{0x67, 0x3D}, 6, 12}, {{0x67, 0x41}, 6, 12},
+  {{0x67, 0x5F}, 6, 12}, {{0x67, 0x62}, 6, 12}, {{0x67, 0x64}, 6, 12},
+  {{0x67, 0x66}, 6, 12}, {{0x67, 0x67}, 6, 12}, {{0x67, 0x68}, 6, 12},
+  {{0x67, 0x6C}, 6, 12}, {{0x67, 0x6D}, 6, 12}, {{0x67, 0x6E}, 6, 12},
+  {{0x67, 0x70}, 6, 12}, {{0x67, 0x72}, 6, 12}, {{0x67, 0x75}, 6, 12},
+  {{0x67, 0x67}, 6, 6}, {{0x67, 0x67}, 6, 6}, {{0x67, 0x67}, 6, 6},
+  {{0x67, 0x67}, 6, 6}, {{0x67, 0x67}, 6, 6}, {{0x67, 0x67}, 6, 6},
+  {{0x67, 0x67}, 6, 6}, {{0x67, 0x67}, 6, 6}, {{0x67, 0x67}, 6, 6},
+  {{0x67, 0x67}, 6, 6}, {{0x67, 0x67}, 6, 6}, {{0x67, 0x67}, 6, 6},
+  {{0x67, 0x67}, 6, 6}, {{0x67, 0x67}, 6, 6}, {{0x67, 0x67}, 6, 6},
+  {{0x67, 0x67}, 6, 6}, {{0x67, 0x67}, 6, 6}, {{0x67, 0x67}, 6, 6},
+  {{0x68, 0x30}, 6, 11}, {{0x68, 0x30}, 6, 11}, {{0x68, 0x31}, 6, 11},
+  {{0x68, 0x31}, 6, 11}, {{0x68, 0x32}, 6, 11}, {{0x68, 0x32}, 6, 11},
+  {{0x68, 0x61}, 6, 11}, {{0x68, 0x61}, 6, 11}, {{0x68, 0x63}, 6, 11},
+  {{0x68, 0x63}, 6, 11}, {{0x68, 0x65}, 6, 11}, {{0x68, 0x65}, 6, 11},
+  {{0x68, 0x69}, 6, 11}, {{0x68, 0x69}, 6, 11}, {{0x68, 0x6F}, 6, 11},
+  {{0x68, 0x6F}, 6, 11}, {{0x68, 0x73}, 6, 11}, {{0x68, 0x73}, 6, 11},
+  {{0x68, 0x74}, 6, 11}, {{0x68, 0x74}, 6, 11}, {{0x68, 0x20}, 6, 12},
+  {{0x68, 0x25}, 6, 12}, {{0x68, 0x2D}, 6, 12}, {{0x68, 0x2E}, 6, 12},
+  {{0x68, 0x2F}, 6, 12}, {{0x68, 0x33}, 6, 12}, {{0x68, 0x34}, 6, 12},
+  {{0x68, 0x35}, 6, 12}, {{0x68, 0x36}, 6, 12}, {{0x68, 0x37}, 6, 12},
+  {{0x68, 0x38}, 6, 12}, {{0x68, 0x39}, 6, 12}, {{0x68, 0x3D}, 6, 12},
+  {{0x68, 0x41}, 6, 12}, {{0x68, 0x5F}, 6, 12}, {{0x68, 0x62}, 6, 12},
+  {{0x68, 0x64}, 6, 12}, {{0x68, 0x66}, 6, 12}, {{0x68, 0x67}, 6, 12},
+  {{0x68, 0x68}, 6, 12}, {{0x68, 0x6C}, 6, 12}, {{0x68, 0x6D}, 6, 12},
+  {{0x68, 0x6E}, 6, 12}, {{0x68, 0x70}, 6, 12}, {{0x68, 0x72}, 6, 12},
+  {{0x68, 0x75}, 6, 12}, {{0x68, 0x68}, 6, 6}, {{0x68, 0x68}, 6, 6},
+  {{0x68, 0x68}, 6, 6}, {{0x68, 0x68}, 6, 6}, {{0x68, 0x68}, 6, 6},
+  {{0x68, 0x68}, 6, 6}, {{0x68, 0x68}, 6, 6}, {{0x68, 0x68}, 6, 6},
+  {{0x68, 0x68}, 6, 6}, {{0x68, 0x68}, 6, 6}, {{0x68, 0x68}, 6, 6},
+  {{0x68, 0x68}, 6, 6}, {{0x68, 0x68}, 6, 6}, {{0x68, 0x68}, 6, 6},
+  {{0x68, 0x68}, 6, 6}, {{0x68, 0x68}, 6, 6}, {{0x68, 0x68}, 6, 6},
+  {{0x68, 0x68}, 6, 6}, {{0x6C, 0x30}, 6, 11}, {{0x6C, 0x30}, 6, 11},
+  {{0x6C, 0x31}, 6, 11}, {{0x6C, 0x31}, 6, 11}, {{0x6C, 0x32}, 6, 11},
+  {{0x6C, 0x32}, 6, 11}, {{0x6C, 0x61}, 6, 11}, {{0x6C, 0x61}, 6, 11},
+  {{0x6C, 0x63}, 6, 11}, {{0x6C, 0x63}, 6, 11}, {{0x6C, 0x65}, 6, 11},
+  {{0x6C, 0x65}, 6, 11}, {{0x6C, 0x69}, 6, 11}, {{0x6C, 0x69}, 6, 11},
+  {{0x6C, 0x6F}, 6, 11}, {{0x6C, 0x6F}, 6, 11}, {{0x6C, 0x73}, 6, 11},
+  {{0x6C, 0x73}, 6, 11}, {{0x6C, 0x74}, 6, 11}, {{0x6C, 0x74}, 6, 11},
+  {{0x6C, 0x20}, 6, 12}, {{0x6C, 0x25}, 6, 12}, {{0x6C, 0x2D}, 6, 12},
+  {{0x6C, 0x2E}, 6, 12}, {{0x6C, 0x2F}, 6, 12}, {{0x6C, 0x33}, 6, 12},
+  {{0x6C, 0x34}, 6, 12}, {{0x6C, 0x35}, 6, 12}, {{0x6C, 0x36}, 6, 12},
+  {{0x6C, 0x37}, 6, 12}, {{0x6C, 0x38}, 6, 12}, {{0x6C, 0x39}, 6, 12},
+  {{0x6C, 0x3D}, 6, 12}, {{0x6C, 0x41}, 6, 12}, {{0x6C, 0x5F}, 6, 12},
+  {{0x6C, 0x62}, 6, 12}, {{0x6C, 0x64}, 6, 12}, {{0x6C, 0x66}, 6, 12},
+  {{0x6C, 0x67}, 6, 12}, {{0x6C, 0x68}, 6, 12}, {{0x6C, 0x6C}, 6, 12},
+  {{0x6C, 0x6D}, 6, 12}, {{0x6C, 0x6E}, 6, 12}, {{0x6C, 0x70}, 6, 12},
+  {{0x6C, 0x72}, 6, 12}, {{0x6C, 0x75}, 6, 12}, {{0x6C, 0x6C}, 6, 6},
+  {{0x6C, 0x6C}, 6, 6}, {{0x6C, 0x6C}, 6, 6}, {{0x6C, 0x6C}, 6, 6},
+  {{0x6C, 0x6C}, 6, 6}, {{0x6C, 0x6C}, 6, 6}, {{0x6C, 0x6C}, 6, 6},
+  {{0x6C, 0x6C}, 6, 6}, {{0x6C, 0x6C}, 6, 6}, {{0x6C, 0x6C}, 6, 6},
+  {{0x6C, 0x6C}, 6, 6}, {{0x6C, 0x6C}, 6, 6}, {{0x6C, 0x6C}, 6, 6},
+  {{0x6C, 0x6C}, 6, 6}, {{0x6C, 0x6C}, 6, 6}, {{0x6C, 0x6C}, 6, 6},
+  {{0x6C, 0x6C}, 6, 6}, {{0x6C, 0x6C}, 6, 6}, {{0x6D, 0x30}, 6, 11},
+  {{0x6D, 0x30}, 6, 11}, {{0x6D, 0x31}, 6, 11}, {{0x6D, 0x31}, 6, 11},
+  {{0x6D, 0x32}, 6, 11}, {{0x6D, 0x32}, 6, 11}, {{0x6D, 0x61}, 6, 11},
+  {{0x6D, 0x61}, 6, 11}, {{0x6D, 0x63}, 6, 11}, {{0x6D, 0x63}, 6, 11},
+  {{0x6D, 0x65}, 6, 11}, {{0x6D, 0x65}, 6, 11}, {{0x6D, 0x69}, 6, 11},
+  {{0x6D, 0x69}, 6, 11}, {{0x6D, 0x6F}, 6, 11}, {{0x6D, 0x6F}, 6, 11},
+  {{0x6D, 0x73}, 6, 11}, {{0x6D, 0x73}, 6, 11}, {{0x6D, 0x74}, 6, 11},
+  {{0x6D, 0x74}, 6, 11}, {{0x6D, 0x20}, 6, 12}, {{0x6D, 0x25}, 6, 12},
+  {{0x6D, 0x2D}, 6, 12}, {{0x6D, 0x2E}, 6, 12}, {{0x6D, 0x2F}, 6, 12},
+  {{0x6D, 0x33}, 6, 12}, {{0x6D, 0x34}, 6, 12}, {{0x6D, 0x35}, 6, 12},
+  {{0x6D, 0x36}, 6, 12}, {{0x6D, 0x37}, 6, 12}, {{0x6D, 0x38}, 6, 12},
+  {{0x6D, 0x39}, 6, 12}, {{0x6D, 0x3D}, 6, 12}, {{0x6D, 0x41}, 6, 12},
+  {{0x6D, 0x5F}, 6, 12}, {{0x6D, 0x62}, 6, 12}, {{0x6D, 0x64}, 6, 12},
+  {{0x6D, 0x66}, 6, 12}, {{0x6D, 0x67}, 6, 12}, {{0x6D, 0x68}, 6, 12},
+  {{0x6D, 0x6C}, 6, 12}, {{0x6D, 0x6D}, 6, 12}, {{0x6D, 0x6E}, 6, 12},
+  {{0x6D, 0x70}, 6, 12}, {{0x6D, 0x72}, 6, 12}, {{0x6D, 0x75}, 6, 12},
+  {{0x6D, 0x6D}, 6, 6}, {{0x6D, 0x6D}, 6, 6}, {{0x6D, 0x6D}, 6, 6},
+  {{0x6D, 0x6D}, 6, 6}, {{0x6D, 0x6D}, 6, 6}, {{0x6D, 0x6D}, 6, 6},
+  {{0x6D, 0x6D}, 6, 6}, {{0x6D, 0x6D}, 6, 6}, {{0x6D, 0x6D}, 6, 6},
+  {{0x6D, 0x6D}, 6, 6}, {{0x6D, 0x6D}, 6, 6}, {{0x6D, 0x6D}, 6, 6},
+  {{0x6D, 0x6D}, 6, 6}, {{0x6D, 0x6D}, 6, 6}, {{0x6D, 0x6D}, 6, 6},
+  {{0x6D, 0x6D}, 6, 6}, {{0x6D, 0x6D}, 6, 6}, {{0x6D, 0x6D}, 6, 6},
+  {{0x6E, 0x30}, 6, 11}, {{0x6E, 0x30}, 6, 11}, {{0x6E, 0x31}, 6, 11},
+  {{0x6E, 0x31}, 6, 11}, {{0x6E, 0x32}, 6, 11}, {{0x6E, 0x32}, 6, 11},
+  {{0x6E, 0x61}, 6, 11}, {{0x6E, 0x61}, 6, 11}, {{0x6E, 0x63}, 6, 11},
+  {{0x6E, 0x63}, 6, 11}, {{0x6E, 0x65}, 6, 11}, {{0x6E, 0x65}, 6, 11},
+  {{0x6E, 0x69}, 6, 11}, {{0x6E, 0x69}, 6, 11}, {{0x6E, 0x6F}, 6, 11},
+  {{0x6E, 0x6F}, 6, 11}, {{0x6E, 0x73}, 6, 11}, {{0x6E, 0x73}, 6, 11},
+  {{0x6E, 0x74}, 6, 11}, {{0x6E, 0x74}, 6, 11}, {{0x6E, 0x20}, 6, 12},
+  {{0x6E, 0x25}, 6, 12}, {{0x6E, 0x2D}, 6, 12}, {{0x6E, 0x2E}, 6, 12},
+  {{0x6E, 0x2F}, 6, 12}, {{0x6E, 0x33}, 6, 12}, {{0x6E, 0x34}, 6, 12},
+  {{0x6E, 0x35}, 6, 12}, {{0x6E, 0x36}, 6, 12}, {{0x6E, 0x37}, 6, 12},
+  {{0x6E, 0x38}, 6, 12}, {{0x6E, 0x39}, 6, 12}, {{0x6E, 0x3D}, 6, 12},
+  {{0x6E, 0x41}, 6, 12}, {{0x6E, 0x5F}, 6, 12}, {{0x6E, 0x62}, 6, 12},
+  {{0x6E, 0x64}, 6, 12}, {{0x6E, 0x66}, 6, 12}, {{0x6E, 0x67}, 6, 12},
+  {{0x6E, 0x68}, 6, 12}, {{0x6E, 0x6C}, 6, 12}, {{0x6E, 0x6D}, 6, 12},
+  {{0x6E, 0x6E}, 6, 12}, {{0x6E, 0x70}, 6, 12}, {{0x6E, 0x72}, 6, 12},
+  {{0x6E, 0x75}, 6, 12}, {{0x6E, 0x6E}, 6, 6}, {{0x6E, 0x6E}, 6, 6},
+  {{0x6E, 0x6E}, 6, 6}, {{0x6E, 0x6E}, 6, 6}, {{0x6E, 0x6E}, 6, 6},
+  {{0x6E, 0x6E}, 6, 6}, {{0x6E, 0x6E}, 6, 6}, {{0x6E, 0x6E}, 6, 6},
+  {{0x6E, 0x6E}, 6, 6}, {{0x6E, 0x6E}, 6, 6}, {{0x6E, 0x6E}, 6, 6},
+  {{0x6E, 0x6E}, 6, 6}, {{0x6E, 0x6E}, 6, 6}, {{0x6E, 0x6E}, 6, 6},
+  {{0x6E, 0x6E}, 6, 6}, {{0x6E, 0x6E}, 6, 6}, {{0x6E, 0x6E}, 6, 6},
+  {{0x6E, 0x6E}, 6, 6}, {{0x70, 0x30}, 6, 11}, {{0x70, 0x30}, 6, 11},
+  {{0x70, 0x31}, 6, 11}, {{0x70, 0x31}, 6, 11}, {{0x70, 0x32}, 6, 11},
+  {{0x70, 0x32}, 6, 11}, {{0x70, 0x61}, 6, 11}, {{0x70, 0x61}, 6, 11},
+  {{0x70, 0x63}, 6, 11}, {{0x70, 0x63}, 6, 11}, {{0x70, 0x65}, 6, 11},
+  {{0x70, 0x65}, 6, 11}, {{0x70, 0x69}, 6, 11}, {{0x70, 0x69}, 6, 11},
+  {{0x70, 0x6F}, 6, 11}, {{0x70, 0x6F}, 6, 11}, {{0x70, 0x73}, 6, 11},
+  {{0x70, 0x73}, 6, 11}, {{0x70, 0x74}, 6, 11}, {{0x70, 0x74}, 6, 11},
+  {{0x70, 0x20}, 6, 12}, {{0x70, 0x25}, 6, 12}, {{0x70, 0x2D}, 6, 12},
+  {{0x70, 0x2E}, 6, 12}, {{0x70, 0x2F}, 6, 12}, {{0x70, 0x33}, 6, 12},
+  {{0x70, 0x34}, 6, 12}, {{0x70, 0x35}, 6, 12}, {{0x70, 0x36}, 6, 12},
+  {{0x70, 0x37}, 6, 12}, {{0x70, 0x38}, 6, 12}, {{0x70, 0x39}, 6, 12},
+  {{0x70, 0x3D}, 6, 12}, {{0x70, 0x41}, 6, 12}, {{0x70, 0x5F}, 6, 12},
+  {{0x70, 0x62}, 6, 12}, {{0x70, 0x64}, 6, 12}, {{0x70, 0x66}, 6, 12},
+  {{0x70, 0x67}, 6, 12}, {{0x70, 0x68}, 6, 12}, {{0x70, 0x6C}, 6, 12},
+  {{0x70, 0x6D}, 6, 12}, {{0x70, 0x6E}, 6, 12}, {{0x70, 0x70}, 6, 12},
+  {{0x70, 0x72}, 6, 12}, {{0x70, 0x75}, 6, 12}, {{0x70, 0x70}, 6, 6},
+  {{0x70, 0x70}, 6, 6}, {{0x70, 0x70}, 6, 6}, {{0x70, 0x70}, 6, 6},
+  {{0x70, 0x70}, 6, 6}, {{0x70, 0x70}, 6, 6}, {{0x70, 0x70}, 6, 6},
+  {{0x70, 0x70}, 6, 6}, {{0x70, 0x70}, 6, 6}, {{0x70, 0x70}, 6, 6},
+  {{0x70, 0x70}, 6, 6}, {{0x70, 0x70}, 6, 6}, {{0x70, 0x70}, 6, 6},
+  {{0x70, 0x70}, 6, 6}, {{0x70, 0x70}, 6, 6}, {{0x70, 0x70}, 6, 6},
+  {{0x70, 0x70}, 6, 6}, {{0x70, 0x70}, 6, 6}, {{0x72, 0x30}, 6, 11},
+  {{0x72, 0x30}, 6, 11}, {{0x72, 0x31}, 6, 11}, {{0x72, 0x31}, 6, 11},
+  {{0x72, 0x32}, 6, 11}, {{0x72, 0x32}, 6, 11}, {{0x72, 0x61}, 6, 11},
+  {{0x72, 0x61}, 6, 11}, {{0x72, 0x63}, 6, 11}, {{0x72, 0x63}, 6, 11},
+  {{0x72, 0x65}, 6, 11}, {{0x72, 0x65}, 6, 11}, {{0x72, 0x69}, 6, 11},
+  {{0x72, 0x69}, 6, 11}, {{0x72, 0x6F}, 6, 11}, {{0x72, 0x6F}, 6, 11},
+  {{0x72, 0x73}, 6, 11}, {{0x72, 0x73}, 6, 11}, {{0x72, 0x74}, 6, 11},
+  {{0x72, 0x74}, 6, 11}, {{0x72, 0x20}, 6, 12}, {{0x72, 0x25}, 6, 12},
+  {{0x72, 0x2D}, 6, 12}, {{0x72, 0x2E}, 6, 12}, {{0x72, 0x2F}, 6, 12},
+  {{0x72, 0x33}, 6, 12}, {{0x72, 0x34}, 6, 12}, {{0x72, 0x35}, 6, 12},
+  {{0x72, 0x36}, 6, 12}, {{0x72, 0x37}, 6, 12}, {{0x72, 0x38}, 6, 12},
+  {{0x72, 0x39}, 6, 12}, {{0x72, 0x3D}, 6, 12}, {{0x72, 0x41}, 6, 12},
+  {{0x72, 0x5F}, 6, 12}, {{0x72, 0x62}, 6, 12}, {{0x72, 0x64}, 6, 12},
+  {{0x72, 0x66}, 6, 12}, {{0x72, 0x67}, 6, 12}, {{0x72, 0x68}, 6, 12},
+  {{0x72, 0x6C}, 6, 12}, {{0x72, 0x6D}, 6, 12}, {{0x72, 0x6E}, 6, 12},
+  {{0x72, 0x70}, 6, 12}, {{0x72, 0x72}, 6, 12}, {{0x72, 0x75}, 6, 12},
+  {{0x72, 0x72}, 6, 6}, {{0x72, 0x72}, 6, 6}, {{0x72, 0x72}, 6, 6},
+  {{0x72, 0x72}, 6, 6}, {{0x72, 0x72}, 6, 6}, {{0x72, 0x72}, 6, 6},
+  {{0x72, 0x72}, 6, 6}, {{0x72, 0x72}, 6, 6}, {{0x72, 0x72}, 6, 6},
+  {{0x72, 0x72}, 6, 6}, {{0x72, 0x72}, 6, 6}, {{0x72, 0x72}, 6, 6},
+  {{0x72, 0x72}, 6, 6}, {{0x72, 0x72}, 6, 6}, {{0x72, 0x72}, 6, 6},
+  {{0x72, 0x72}, 6, 6}, {{0x72, 0x72}, 6, 6}, {{0x72, 0x72}, 6, 6},
+  {{0x75, 0x30}, 6, 11}, {{0x75, 0x30}, 6, 11}, {{0x75, 0x31}, 6, 11},
+  {{0x75, 0x31}, 6, 11}, {{0x75, 0x32}, 6, 11}, {{0x75, 0x32}, 6, 11},
+  {{0x75, 0x61}, 6, 11}, {{0x75, 0x61}, 6, 11}, {{0x75, 0x63}, 6, 11},
+  {{0x75, 0x63}, 6, 11}, {{0x75, 0x65}, 6, 11}, {{0x75, 0x65}, 6, 11},
+  {{0x75, 0x69}, 6, 11}, {{0x75, 0x69}, 6, 11}, {{0x75, 0x6F}, 6, 11},
+  {{0x75, 0x6F}, 6, 11}, {{0x75, 0x73}, 6, 11}, {{0x75, 0x73}, 6, 11},
+  {{0x75, 0x74}, 6, 11}, {{0x75, 0x74}, 6, 11}, {{0x75, 0x20}, 6, 12},
+  {{0x75, 0x25}, 6, 12}, {{0x75, 0x2D}, 6, 12}, {{0x75, 0x2E}, 6, 12},
+  {{0x75, 0x2F}, 6, 12}, {{0x75, 0x33}, 6, 12}, {{0x75, 0x34}, 6, 12},
+  {{0x75, 0x35}, 6, 12}, {{0x75, 0x36}, 6, 12}, {{0x75, 0x37}, 6, 12},
+  {{0x75, 0x38}, 6, 12}, {{0x75, 0x39}, 6, 12}, {{0x75, 0x3D}, 6, 12},
+  {{0x75, 0x41}, 6, 12}, {{0x75, 0x5F}, 6, 12}, {{0x75, 0x62}, 6, 12},
+  {{0x75, 0x64}, 6, 12}, {{0x75, 0x66}, 6, 12}, {{0x75, 0x67}, 6, 12},
+  {{0x75, 0x68}, 6, 12}, {{0x75, 0x6C}, 6, 12}, {{0x75, 0x6D}, 6, 12},
+  {{0x75, 0x6E}, 6, 12}, {{0x75, 0x70}, 6, 12}, {{0x75, 0x72}, 6, 12},
+  {{0x75, 0x75}, 6, 12}, {{0x75, 0x75}, 6, 6}, {{0x75, 0x75}, 6, 6},
+  {{0x75, 0x75}, 6, 6}, {{0x75, 0x75}, 6, 6}, {{0x75, 0x75}, 6, 6},
+  {{0x75, 0x75}, 6, 6}, {{0x75, 0x75}, 6, 6}, {{0x75, 0x75}, 6, 6},
+  {{0x75, 0x75}, 6, 6}, {{0x75, 0x75}, 6, 6}, {{0x75, 0x75}, 6, 6},
+  {{0x75, 0x75}, 6, 6}, {{0x75, 0x75}, 6, 6}, {{0x75, 0x75}, 6, 6},
+  {{0x75, 0x75}, 6, 6}, {{0x75, 0x75}, 6, 6}, {{0x75, 0x75}, 6, 6},
+  {{0x75, 0x75}, 6, 6}, {{0x3A, 0x30}, 7, 12}, {{0x3A, 0x31}, 7, 12},
+  {{0x3A, 0x32}, 7, 12}, {{0x3A, 0x61}, 7, 12}, {{0x3A, 0x63}, 7, 12},
+  {{0x3A, 0x65}, 7, 12}, {{0x3A, 0x69}, 7, 12}, {{0x3A, 0x6F}, 7, 12},
+  {{0x3A, 0x73}, 7, 12}, {{0x3A, 0x74}, 7, 12}, {{0x3A, 0x3A}, 7, 7},
+  {{0x3A, 0x3A}, 7, 7}, {{0x3A, 0x3A}, 7, 7}, {{0x3A, 0x3A}, 7, 7},
+  {{0x3A, 0x3A}, 7, 7}, {{0x3A, 0x3A}, 7, 7}, {{0x3A, 0x3A}, 7, 7},
+  {{0x3A, 0x3A}, 7, 7}, {{0x3A, 0x3A}, 7, 7}, {{0x3A, 0x3A}, 7, 7},
+  {{0x3A, 0x3A}, 7, 7}, {{0x3A, 0x3A}, 7, 7}, {{0x3A, 0x3A}, 7, 7},
+  {{0x3A, 0x3A}, 7, 7}, {{0x3A, 0x3A}, 7, 7}, {{0x3A, 0x3A}, 7, 7},
+  {{0x3A, 0x3A}, 7, 7}, {{0x3A, 0x3A}, 7, 7}, {{0x3A, 0x3A}, 7, 7},
+  {{0x3A, 0x3A}, 7, 7}, {{0x3A, 0x3A}, 7, 7}, {{0x3A, 0x3A}, 7, 7},
+  {{0x42, 0x30}, 7, 12}, {{0x42, 0x31}, 7, 12}, {{0x42, 0x32}, 7, 12},
+  {{0x42, 0x61}, 7, 12}, {{0x42, 0x63}, 7, 12}, {{0x42, 0x65}, 7, 12},
+  {{0x42, 0x69}, 7, 12}, {{0x42, 0x6F}, 7, 12}, {{0x42, 0x73}, 7, 12},
+  {{0x42, 0x74}, 7, 12}, {{0x42, 0x42}, 7, 7}, {{0x42, 0x42}, 7, 7},
+  {{0x42, 0x42}, 7, 7}, {{0x42, 0x42}, 7, 7}, {{0x42, 0x42}, 7, 7},
+  {{0x42, 0x42}, 7, 7}, {{0x42, 0x42}, 7, 7}, {{0x42, 0x42}, 7, 7},
+  {{0x42, 0x42}, 7, 7}, {{0x42, 0x42}, 7, 7}, {{0x42, 0x42}, 7, 7},
+  {{0x42, 0x42}, 7, 7}, {{0x42, 0x42}, 7, 7}, {{0x42, 0x42}, 7, 7},
+  {{0x42, 0x42}, 7, 7}, {{0x42, 0x42}, 7, 7}, {{0x42, 0x42}, 7, 7},
+  {{0x42, 0x42}, 7, 7}, {{0x42, 0x42}, 7, 7}, {{0x42, 0x42}, 7, 7},
+  {{0x42, 0x42}, 7, 7}, {{0x42, 0x42}, 7, 7}, {{0x43, 0x30}, 7, 12},
+  {{0x43, 0x31}, 7, 12}, {{0x43, 0x32}, 7, 12}, {{0x43, 0x61}, 7, 12},
+  {{0x43, 0x63}, 7, 12}, {{0x43, 0x65}, 7, 12}, {{0x43, 0x69}, 7, 12},
+  {{0x43, 0x6F}, 7, 12}, {{0x43, 0x73}, 7, 12}, {{0x43, 0x74}, 7, 12},
+  {{0x43, 0x43}, 7, 7}, {{0x43, 0x43}, 7, 7}, {{0x43, 0x43}, 7, 7},
+  {{0x43, 0x43}, 7, 7}, {{0x43, 0x43}, 7, 7}, {{0x43, 0x43}, 7, 7},
+  {{0x43, 0x43}, 7, 7}, {{0x43, 0x43}, 7, 7}, {{0x43, 0x43}, 7, 7},
+  {{0x43, 0x43}, 7, 7}, {{0x43, 0x43}, 7, 7}, {{0x43, 0x43}, 7, 7},
+  {{0x43, 0x43}, 7, 7}, {{0x43, 0x43}, 7, 7}, {{0x43, 0x43}, 7, 7},
+  {{0x43, 0x43}, 7, 7}, {{0x43, 0x43}, 7, 7}, {{0x43, 0x43}, 7, 7},
+  {{0x43, 0x43}, 7, 7}, {{0x43, 0x43}, 7, 7}, {{0x43, 0x43}, 7, 7},
+  {{0x43, 0x43}, 7, 7}, {{0x44, 0x30}, 7, 12}, {{0x44, 0x31}, 7, 12},
+  {{0x44, 0x32}, 7, 12}, {{0x44, 0x61}, 7, 12}, {{0x44, 0x63}, 7, 12},
+  {{0x44, 0x65}, 7, 12}, {{0x44, 0x69}, 7, 12}, {{0x44, 0x6F}, 7, 12},
+  {{0x44, 0x73}, 7, 12}, {{0x44, 0x74}, 7, 12}, {{0x44, 0x44}, 7, 7},
+  {{0x44, 0x44}, 7, 7}, {{0x44, 0x44}, 7, 7}, {{0x44, 0x44}, 7, 7},
+  {{0x44, 0x44}, 7, 7}, {{0x44, 0x44}, 7, 7}, {{0x44, 0x44}, 7, 7},
+  {{0x44, 0x44}, 7, 7}, {{0x44, 0x44}, 7, 7}, {{0x44, 0x44}, 7, 7},
+  {{0x44, 0x44}, 7, 7}, {{0x44, 0x44}, 7, 7}, {{0x44, 0x44}, 7, 7},
+  {{0x44, 0x44}, 7, 7}, {{0x44, 0x44}, 7, 7}, {{0x44, 0x44}, 7, 7},
+  {{0x44, 0x44}, 7, 7}, {{0x44, 0x44}, 7, 7}, {{0x44, 0x44}, 7, 7},
+  {{0x44, 0x44}, 7, 7}, {{0x44, 0x44}, 7, 7}, {{0x44, 0x44}, 7, 7},
+  {{0x45, 0x30}, 7, 12}, {{0x45, 0x31}, 7, 12}, {{0x45, 0x32}, 7, 12},
+  {{0x45, 0x61}, 7, 12}, {{0x45, 0x63}, 7, 12}, {{0x45, 0x65}, 7, 12},
+  {{0x45, 0x69}, 7, 12}, {{0x45, 0x6F}, 7, 12}, {{0x45, 0x73}, 7, 12},
+  {{0x45, 0x74}, 7, 12}, {{0x45, 0x45}, 7, 7}, {{0x45, 0x45}, 7, 7},
+  {{0x45, 0x45}, 7, 7}, {{0x45, 0x45}, 7, 7}, {{0x45, 0x45}, 7, 7},
+  {{0x45, 0x45}, 7, 7}, {{0x45, 0x45}, 7, 7}, {{0x45, 0x45}, 7, 7},
+  {{0x45, 0x45}, 7, 7}, {{0x45, 0x45}, 7, 7}, {{0x45, 0x45}, 7, 7},
+  {{0x45, 0x45}, 7, 7}, {{0x45, 0x45}, 7, 7}, {{0x45, 0x45}, 7, 7},
+  {{0x45, 0x45}, 7, 7}, {{0x45, 0x45}, 7, 7}, {{0x45, 0x45}, 7, 7},
+  {{0x45, 0x45}, 7, 7}, {{0x45, 0x45}, 7, 7}, {{0x45, 0x45}, 7, 7},
+  {{0x45, 0x45}, 7, 7}, {{0x45, 0x45}, 7, 7}, {{0x46, 0x30}, 7, 12},
+  {{0x46, 0x31}, 7, 12}, {{0x46, 0x32}, 7, 12}, {{0x46, 0x61}, 7, 12},
+  {{0x46, 0x63}, 7, 12}, {{0x46, 0x65}, 7, 12}, {{0x46, 0x69}, 7, 12},
+  {{0x46, 0x6F}, 7, 12}, {{0x46, 0x73}, 7, 12}, {{0x46, 0x74}, 7, 12},
+  {{0x46, 0x46}, 7, 7}, {{0x46, 0x46}, 7, 7}, {{0x46, 0x46}, 7, 7},
+  {{0x46, 0x46}, 7, 7}, {{0x46, 0x46}, 7, 7}, {{0x46, 0x46}, 7, 7},
+  {{0x46, 0x46}, 7, 7}, {{0x46, 0x46}, 7, 7}, {{0x46, 0x46}, 7, 7},
+  {{0x46, 0x46}, 7, 7}, {{0x46, 0x46}, 7, 7}, {{0x46, 0x46}, 7, 7},
+  {{0x46, 0x46}, 7, 7}, {{0x46, 0x46}, 7, 7}, {{0x46, 0x46}, 7, 7},
+  {{0x46, 0x46}, 7, 7}, {{0x46, 0x46}, 7, 7}, {{0x46, 0x46}, 7, 7},
+  {{0x46, 0x46}, 7, 7}, {{0x46, 0x46}, 7, 7}, {{0x46, 0x46}, 7, 7},
+  {{0x46, 0x46}, 7, 7}, {{0x47, 0x30}, 7, 12}, {{0x47, 0x31}, 7, 12},
+  {{0x47, 0x32}, 7, 12}, {{0x47, 0x61}, 7, 12}, {{0x47, 0x63}, 7, 12},
+  {{0x47, 0x65}, 7, 12}, {{0x47, 0x69}, 7, 12}, {{0x47, 0x6F}, 7, 12},
+  {{0x47, 0x73}, 7, 12}, {{0x47, 0x74}, 7, 12}, {{0x47, 0x47}, 7, 7},
+  {{0x47, 0x47}, 7, 7}, {{0x47, 0x47}, 7, 7}, {{0x47, 0x47}, 7, 7},
+  {{0x47, 0x47}, 7, 7}, {{0x47, 0x47}, 7, 7}, {{0x47, 0x47}, 7, 7},
+  {{0x47, 0x47}, 7, 7}, {{0x47, 0x47}, 7, 7}, {{0x47, 0x47}, 7, 7},
+  {{0x47, 0x47}, 7, 7}, {{0x47, 0x47}, 7, 7}, {{0x47, 0x47}, 7, 7},
+  {{0x47, 0x47}, 7, 7}, {{0x47, 0x47}, 7, 7}, {{0x47, 0x47}, 7, 7},
+  {{0x47, 0x47}, 7, 7}, {{0x47, 0x47}, 7, 7}, {{0x47, 0x47}, 7, 7},
+  {{0x47, 0x47}, 7, 7}, {{0x47, 0x47}, 7, 7}, {{0x47, 0x47}, 7, 7},
+  {{0x48, 0x30}, 7, 12}, {{0x48, 0x31}, 7, 12}, {{0x48, 0x32}, 7, 12},
+  {{0x48, 0x61}, 7, 12}, {{0x48, 0x63}, 7, 12}, {{0x48, 0x65}, 7, 12},
+  {{0x48, 0x69}, 7, 12}, {{0x48, 0x6F}, 7, 12}, {{0x48, 0x73}, 7, 12},
+  {{0x48, 0x74}, 7, 12}, {{0x48, 0x48}, 7, 7}, {{0x48, 0x48}, 7, 7},
+  {{0x48, 0x48}, 7, 7}, {{0x48, 0x48}, 7, 7}, {{0x48, 0x48}, 7, 7},
+  {{0x48, 0x48}, 7, 7}, {{0x48, 0x48}, 7, 7}, {{0x48, 0x48}, 7, 7},
+  {{0x48, 0x48}, 7, 7}, {{0x48, 0x48}, 7, 7}, {{0x48, 0x48}, 7, 7},
+  {{0x48, 0x48}, 7, 7}, {{0x48, 0x48}, 7, 7}, {{0x48, 0x48}, 7, 7},
+  {{0x48, 0x48}, 7, 7}, {{0x48, 0x48}, 7, 7}, {{0x48, 0x48}, 7, 7},
+  {{0x48, 0x48}, 7, 7}, {{0x48, 0x48}, 7, 7}, {{0x48, 0x48}, 7, 7},
+  {{0x48, 0x48}, 7, 7}, {{0x48, 0x48}, 7, 7}, {{0x49, 0x30}, 7, 12},
+  {{0x49, 0x31}, 7, 12}, {{0x49, 0x32}, 7, 12}, {{0x49, 0x61}, 7, 12},
+  {{0x49, 0x63}, 7, 12}, {{0x49, 0x65}, 7, 12}, {{0x49, 0x69}, 7, 12},
+  {{0x49, 0x6F}, 7, 12}, {{0x49, 0x73}, 7, 12}, {{0x49, 0x74}, 7, 12},
+  {{0x49, 0x49}, 7, 7}, {{0x49, 0x49}, 7, 7}, {{0x49, 0x49}, 7, 7},
+  {{0x49, 0x49}, 7, 7}, {{0x49, 0x49}, 7, 7}, {{0x49, 0x49}, 7, 7},
+  {{0x49, 0x49}, 7, 7}, {{0x49, 0x49}, 7, 7}, {{0x49, 0x49}, 7, 7},
+  {{0x49, 0x49}, 7, 7}, {{0x49, 0x49}, 7, 7}, {{0x49, 0x49}, 7, 7},
+  {{0x49, 0x49}, 7, 7}, {{0x49, 0x49}, 7, 7}, {{0x49, 0x49}, 7, 7},
+  {{0x49, 0x49}, 7, 7}, {{0x49, 0x49}, 7, 7}, {{0x49, 0x49}, 7, 7},
+  {{0x49, 0x49}, 7, 7}, {{0x49, 0x49}, 7, 7}, {{0x49, 0x49}, 7, 7},
+  {{0x49, 0x49}, 7, 7}, {{0x4A, 0x30}, 7, 12}, {{0x4A, 0x31}, 7, 12},
+  {{0x4A, 0x32}, 7, 12}, {{0x4A, 0x61}, 7, 12}, {{0x4A, 0x63}, 7, 12},
+  {{0x4A, 0x65}, 7, 12}, {{0x4A, 0x69}, 7, 12}, {{0x4A, 0x6F}, 7, 12},
+  {{0x4A, 0x73}, 7, 12}, {{0x4A, 0x74}, 7, 12}, {{0x4A, 0x4A}, 7, 7},
+  {{0x4A, 0x4A}, 7, 7}, {{0x4A, 0x4A}, 7, 7}, {{0x4A, 0x4A}, 7, 7},
+  {{0x4A, 0x4A}, 7, 7}, {{0x4A, 0x4A}, 7, 7}, {{0x4A, 0x4A}, 7, 7},
+  {{0x4A, 0x4A}, 7, 7}, {{0x4A, 0x4A}, 7, 7}, {{0x4A, 0x4A}, 7, 7},
+  {{0x4A, 0x4A}, 7, 7}, {{0x4A, 0x4A}, 7, 7}, {{0x4A, 0x4A}, 7, 7},
+  {{0x4A, 0x4A}, 7, 7}, {{0x4A, 0x4A}, 7, 7}, {{0x4A, 0x4A}, 7, 7},
+  {{0x4A, 0x4A}, 7, 7}, {{0x4A, 0x4A}, 7, 7}, {{0x4A, 0x4A}, 7, 7},
+  {{0x4A, 0x4A}, 7, 7}, {{0x4A, 0x4A}, 7, 7}, {{0x4A, 0x4A}, 7, 7},
+  {{0x4B, 0x30}, 7, 12}, {{0x4B, 0x31}, 7, 12}, {{0x4B, 0x32}, 7, 12},
+  {{0x4B, 0x61}, 7, 12}, {{0x4B, 0x63}, 7, 12}, {{0x4B, 0x65}, 7, 12},
+  {{0x4B, 0x69}, 7, 12}, {{0x4B, 0x6F}, 7, 12}, {{0x4B, 0x73}, 7, 12},
+  {{0x4B, 0x74}, 7, 12}, {{0x4B, 0x4B}, 7, 7}, {{0x4B, 0x4B}, 7, 7},
+  {{0x4B, 0x4B}, 7, 7}, {{0x4B, 0x4B}, 7, 7}, {{0x4B, 0x4B}, 7, 7},
+  {{0x4B, 0x4B}, 7, 7}, {{0x4B, 0x4B}, 7, 7}, {{0x4B, 0x4B}, 7, 7},
+  {{0x4B, 0x4B}, 7, 7}, {{0x4B, 0x4B}, 7, 7}, {{0x4B, 0x4B}, 7, 7},
+  {{0x4B, 0x4B}, 7, 7}, {{0x4B, 0x4B}, 7, 7}, {{0x4B, 0x4B}, 7, 7},
+  {{0x4B, 0x4B}, 7, 7}, {{0x4B, 0x4B}, 7, 7}, {{0x4B, 0x4B}, 7, 7},
+  {{0x4B, 0x4B}, 7, 7}, {{0x4B, 0x4B}, 7, 7}, {{0x4B, 0x4B}, 7, 7},
+  {{0x4B, 0x4B}, 7, 7}, {{0x4B, 0x4B}, 7, 7}, {{0x4C, 0x30}, 7, 12},
+  {{0x4C, 0x31}, 7, 12}, {{0x4C, 0x32}, 7, 12}, {{0x4C, 0x61}, 7, 12},
+  {{0x4C, 0x63}, 7, 12}, {{0x4C, 0x65}, 7, 12}, {{0x4C, 0x69}, 7, 12},
+  {{0x4C, 0x6F}, 7, 12}, {{0x4C, 0x73}, 7, 12}, {{0x4C, 0x74}, 7, 12},
+  {{0x4C, 0x4C}, 7, 7}, {{0x4C, 0x4C}, 7, 7}, {{0x4C, 0x4C}, 7, 7},
+  {{0x4C, 0x4C}, 7, 7}, {{0x4C, 0x4C}, 7, 7}, {{0x4C, 0x4C}, 7, 7},
+  {{0x4C, 0x4C}, 7, 7}, {{0x4C, 0x4C}, 7, 7}, {{0x4C, 0x4C}, 7, 7},
+  {{0x4C, 0x4C}, 7, 7}, {{0x4C, 0x4C}, 7, 7}, {{0x4C, 0x4C}, 7, 7},
+  {{0x4C, 0x4C}, 7, 7}, {{0x4C, 0x4C}, 7, 7}, {{0x4C, 0x4C}, 7, 7},
+  {{0x4C, 0x4C}, 7, 7}, {{0x4C, 0x4C}, 7, 7}, {{0x4C, 0x4C}, 7, 7},
+  {{0x4C, 0x4C}, 7, 7}, {{0x4C, 0x4C}, 7, 7}, {{0x4C, 0x4C}, 7, 7},
+  {{0x4C, 0x4C}, 7, 7}, {{0x4D, 0x30}, 7, 12}, {{0x4D, 0x31}, 7, 12},
+  {{0x4D, 0x32}, 7, 12}, {{0x4D, 0x61}, 7, 12}, {{0x4D, 0x63}, 7, 12},
+  {{0x4D, 0x65}, 7, 12}, {{0x4D, 0x69}, 7, 12}, {{0x4D, 0x6F}, 7, 12},
+  {{0x4D, 0x73}, 7, 12}, {{0x4D, 0x74}, 7, 12}, {{0x4D, 0x4D}, 7, 7},
+  {{0x4D, 0x4D}, 7, 7}, {{0x4D, 0x4D}, 7, 7}, {{0x4D, 0x4D}, 7, 7},
+  {{0x4D, 0x4D}, 7, 7}, {{0x4D, 0x4D}, 7, 7}, {{0x4D, 0x4D}, 7, 7},
+  {{0x4D, 0x4D}, 7, 7}, {{0x4D, 0x4D}, 7, 7}, {{0x4D, 0x4D}, 7, 7},
+  {{0x4D, 0x4D}, 7, 7}, {{0x4D, 0x4D}, 7, 7}, {{0x4D, 0x4D}, 7, 7},
+  {{0x4D, 0x4D}, 7, 7}, {{0x4D, 0x4D}, 7, 7}, {{0x4D, 0x4D}, 7, 7},
+  {{0x4D, 0x4D}, 7, 7}, {{0x4D, 0x4D}, 7, 7}, {{0x4D, 0x4D}, 7, 7},
+  {{0x4D, 0x4D}, 7, 7}, {{0x4D, 0x4D}, 7, 7}, {{0x4D, 0x4D}, 7, 7},
+  {{0x4E, 0x30}, 7, 12}, {{0x4E, 0x31}, 7, 12}, {{0x4E, 0x32}, 7, 12},
+  {{0x4E, 0x61}, 7, 12}, {{0x4E, 0x63}, 7, 12}, {{0x4E, 0x65}, 7, 12},
+  {{0x4E, 0x69}, 7, 12}, {{0x4E, 0x6F}, 7, 12}, {{0x4E, 0x73}, 7, 12},
+  {{0x4E, 0x74}, 7, 12}, {{0x4E, 0x4E}, 7, 7}, {{0x4E, 0x4E}, 7, 7},
+  {{0x4E, 0x4E}, 7, 7}, {{0x4E, 0x4E}, 7, 7}, {{0x4E, 0x4E}, 7, 7},
+  {{0x4E, 0x4E}, 7, 7}, {{0x4E, 0x4E}, 7, 7}, {{0x4E, 0x4E}, 7, 7},
+  {{0x4E, 0x4E}, 7, 7}, {{0x4E, 0x4E}, 7, 7}, {{0x4E, 0x4E}, 7, 7},
+  {{0x4E, 0x4E}, 7, 7}, {{0x4E, 0x4E}, 7, 7}, {{0x4E, 0x4E}, 7, 7},
+  {{0x4E, 0x4E}, 7, 7}, {{0x4E, 0x4E}, 7, 7}, {{0x4E, 0x4E}, 7, 7},
+  {{0x4E, 0x4E}, 7, 7}, {{0x4E, 0x4E}, 7, 7}, {{0x4E, 0x4E}, 7, 7},
+  {{0x4E, 0x4E}, 7, 7}, {{0x4E, 0x4E}, 7, 7}, {{0x4F, 0x30}, 7, 12},
+  {{0x4F, 0x31}, 7, 12}, {{0x4F, 0x32}, 7, 12}, {{0x4F, 0x61}, 7, 12},
+  {{0x4F, 0x63}, 7, 12}, {{0x4F, 0x65}, 7, 12}, {{0x4F, 0x69}, 7, 12},
+  {{0x4F, 0x6F}, 7, 12}, {{0x4F, 0x73}, 7, 12}, {{0x4F, 0x74}, 7, 12},
+  {{0x4F, 0x4F}, 7, 7}, {{0x4F, 0x4F}, 7, 7}, {{0x4F, 0x4F}, 7, 7},
+  {{0x4F, 0x4F}, 7, 7}, {{0x4F, 0x4F}, 7, 7}, {{0x4F, 0x4F}, 7, 7},
+  {{0x4F, 0x4F}, 7, 7}, {{0x4F, 0x4F}, 7, 7}, {{0x4F, 0x4F}, 7, 7},
+  {{0x4F, 0x4F}, 7, 7}, {{0x4F, 0x4F}, 7, 7}, {{0x4F, 0x4F}, 7, 7},
+  {{0x4F, 0x4F}, 7, 7}, {{0x4F, 0x4F}, 7, 7}, {{0x4F, 0x4F}, 7, 7},
+  {{0x4F, 0x4F}, 7, 7}, {{0x4F, 0x4F}, 7, 7}, {{0x4F, 0x4F}, 7, 7},
+  {{0x4F, 0x4F}, 7, 7}, {{0x4F, 0x4F}, 7, 7}, {{0x4F, 0x4F}, 7, 7},
+  {{0x4F, 0x4F}, 7, 7}, {{0x50, 0x30}, 7, 12}, {{0x50, 0x31}, 7, 12},
+  {{0x50, 0x32}, 7, 12}, {{0x50, 0x61}, 7, 12}, {{0x50, 0x63}, 7, 12},
+  {{0x50, 0x65}, 7, 12}, {{0x50, 0x69}, 7, 12}, {{0x50, 0x6F}, 7, 12},
+  {{0x50, 0x73}, 7, 12}, {{0x50, 0x74}, 7, 12}, {{0x50, 0x50}, 7, 7},
+  {{0x50, 0x50}, 7, 7}, {{0x50, 0x50}, 7, 7}, {{0x50, 0x50}, 7, 7},
+  {{0x50, 0x50}, 7, 7}, {{0x50, 0x50}, 7, 7}, {{0x50, 0x50}, 7, 7},
+  {{0x50, 0x50}, 7, 7}, {{0x50, 0x50}, 7, 7}, {{0x50, 0x50}, 7, 7},
+  {{0x50, 0x50}, 7, 7}, {{0x50, 0x50}, 7, 7}, {{0x50, 0x50}, 7, 7},
+  {{0x50, 0x50}, 7, 7}, {{0x50, 0x50}, 7, 7}, {{0x50, 0x50}, 7, 7},
+  {{0x50, 0x50}, 7, 7}, {{0x50, 0x50}, 7, 7}, {{0x50, 0x50}, 7, 7},
+  {{0x50, 0x50}, 7, 7}, {{0x50, 0x50}, 7, 7}, {{0x50, 0x50}, 7, 7},
+  {{0x51, 0x30}, 7, 12}, {{0x51, 0x31}, 7, 12}, {{0x51, 0x32}, 7, 12},
+  {{0x51, 0x61}, 7, 12}, {{0x51, 0x63}, 7, 12}, {{0x51, 0x65}, 7, 12},
+  {{0x51, 0x69}, 7, 12}, {{0x51, 0x6F}, 7, 12}, {{0x51, 0x73}, 7, 12},
+  {{0x51, 0x74}, 7, 12}, {{0x51, 0x51}, 7, 7}, {{0x51, 0x51}, 7, 7},
+  {{0x51, 0x51}, 7, 7}, {{0x51, 0x51}, 7, 7}, {{0x51, 0x51}, 7, 7},
+  {{0x51, 0x51}, 7, 7}, {{0x51, 0x51}, 7, 7}, {{0x51, 0x51}, 7, 7},
+  {{0x51, 0x51}, 7, 7}, {{0x51, 0x51}, 7, 7}, {{0x51, 0x51}, 7, 7},
+  {{0x51, 0x51}, 7, 7}, {{0x51, 0x51}, 7, 7}, {{0x51, 0x51}, 7, 7},
+  {{0x51, 0x51}, 7, 7}, {{0x51, 0x51}, 7, 7}, {{0x51, 0x51}, 7, 7},
+  {{0x51, 0x51}, 7, 7}, {{0x51, 0x51}, 7, 7}, {{0x51, 0x51}, 7, 7},
+  {{0x51, 0x51}, 7, 7}, {{0x51, 0x51}, 7, 7}, {{0x52, 0x30}, 7, 12},
+  {{0x52, 0x31}, 7, 12}, {{0x52, 0x32}, 7, 12}, {{0x52, 0x61}, 7, 12},
+  {{0x52, 0x63}, 7, 12}, {{0x52, 0x65}, 7, 12}, {{0x52, 0x69}, 7, 12},
+  {{0x52, 0x6F}, 7, 12}, {{0x52, 0x73}, 7, 12}, {{0x52, 0x74}, 7, 12},
+  {{0x52, 0x52}, 7, 7}, {{0x52, 0x52}, 7, 7}, {{0x52, 0x52}, 7, 7},
+  {{0x52, 0x52}, 7, 7}, {{0x52, 0x52}, 7, 7}, {{0x52, 0x52}, 7, 7},
+  {{0x52, 0x52}, 7, 7}, {{0x52, 0x52}, 7, 7}, {{0x52, 0x52}, 7, 7},
+  {{0x52, 0x52}, 7, 7}, {{0x52, 0x52}, 7, 7}, {{0x52, 0x52}, 7, 7},
+  {{0x52, 0x52}, 7, 7}, {{0x52, 0x52}, 7, 7}, {{0x52, 0x52}, 7, 7},
+  {{0x52, 0x52}, 7, 7}, {{0x52, 0x52}, 7, 7}, {{0x52, 0x52}, 7, 7},
+  {{0x52, 0x52}, 7, 7}, {{0x52, 0x52}, 7, 7}, {{0x52, 0x52}, 7, 7},
+  {{0x52, 0x52}, 7, 7}, {{0x53, 0x30}, 7, 12}, {{0x53, 0x31}, 7, 12},
+  {{0x53, 0x32}, 7, 12}, {{0x53, 0x61}, 7, 12}, {{0x53, 0x63}, 7, 12},
+  {{0x53, 0x65}, 7, 12}, {{0x53, 0x69}, 7, 12}, {{0x53, 0x6F}, 7, 12},
+  {{0x53, 0x73}, 7, 12}, {{0x53, 0x74}, 7, 12}, {{0x53, 0x53}, 7, 7},
+  {{0x53, 0x53}, 7, 7}, {{0x53, 0x53}, 7, 7}, {{0x53, 0x53}, 7, 7},
+  {{0x53, 0x53}, 7, 7}, {{0x53, 0x53}, 7, 7}, {{0x53, 0x53}, 7, 7},
+  {{0x53, 0x53}, 7, 7}, {{0x53, 0x53}, 7, 7}, {{0x53, 0x53}, 7, 7},
+  {{0x53, 0x53}, 7, 7}, {{0x53, 0x53}, 7, 7}, {{0x53, 0x53}, 7, 7},
+  {{0x53, 0x53}, 7, 7}, {{0x53, 0x53}, 7, 7}, {{0x53, 0x53}, 7, 7},
+  {{0x53, 0x53}, 7, 7}, {{0x53, 0x53}, 7, 7}, {{0x53, 0x53}, 7, 7},
+  {{0x53, 0x53}, 7, 7}, {{0x53, 0x53}, 7, 7}, {{0x53, 0x53}, 7, 7},
+  {{0x54, 0x30}, 7, 12}, {{0x54, 0x31}, 7, 12}, {{0x54, 0x32}, 7, 12},
+  {{0x54, 0x61}, 7, 12}, {{0x54, 0x63}, 7, 12}, {{0x54, 0x65}, 7, 12},
+  {{0x54, 0x69}, 7, 12}, {{0x54, 0x6F}, 7, 12}, {{0x54, 0x73}, 7, 12},
+  {{0x54, 0x74}, 7, 12}, {{0x54, 0x54}, 7, 7}, {{0x54, 0x54}, 7, 7},
+  {{0x54, 0x54}, 7, 7}, {{0x54, 0x54}, 7, 7}, {{0x54, 0x54}, 7, 7},
+  {{0x54, 0x54}, 7, 7}, {{0x54, 0x54}, 7, 7}, {{0x54, 0x54}, 7, 7},
+  {{0x54, 0x54}, 7, 7}, {{0x54, 0x54}, 7, 7}, {{0x54, 0x54}, 7, 7},
+  {{0x54, 0x54}, 7, 7}, {{0x54, 0x54}, 7, 7}, {{0x54, 0x54}, 7, 7},
+  {{0x54, 0x54}, 7, 7}, {{0x54, 0x54}, 7, 7}, {{0x54, 0x54}, 7, 7},
+  {{0x54, 0x54}, 7, 7}, {{0x54, 0x54}, 7, 7}, {{0x54, 0x54}, 7, 7},
+  {{0x54, 0x54}, 7, 7}, {{0x54, 0x54}, 7, 7}, {{0x55, 0x30}, 7, 12},
+  {{0x55, 0x31}, 7, 12}, {{0x55, 0x32}, 7, 12}, {{0x55, 0x61}, 7, 12},
+  {{0x55, 0x63}, 7, 12}, {{0x55, 0x65}, 7, 12}, {{0x55, 0x69}, 7, 12},
+  {{0x55, 0x6F}, 7, 12}, {{0x55, 0x73}, 7, 12}, {{0x55, 0x74}, 7, 12},
+  {{0x55, 0x55}, 7, 7}, {{0x55, 0x55}, 7, 7}, {{0x55, 0x55}, 7, 7},
+  {{0x55, 0x55}, 7, 7}, {{0x55, 0x55}, 7, 7}, {{0x55, 0x55}, 7, 7},
+  {{0x55, 0x55}, 7, 7}, {{0x55, 0x55}, 7, 7}, {{0x55, 0x55}, 7, 7},
+  {{0x55, 0x55}, 7, 7}, {{0x55, 0x55}, 7, 7}, {{0x55, 0x55}, 7, 7},
+  {{0x55, 0x55}, 7, 7}, {{0x55, 0x55}, 7, 7}, {{0x55, 0x55}, 7, 7},
+  {{0x55, 0x55}, 7, 7}, {{0x55, 0x55}, 7, 7}, {{0x55, 0x55}, 7, 7},
+  {{0x55, 0x55}, 7, 7}, {{0x55, 0x55}, 7, 7}, {{0x55, 0x55}, 7, 7},
+  {{0x55, 0x55}, 7, 7}, {{0x56, 0x30}, 7, 12}, {{0x56, 0x31}, 7, 12},
+  {{0x56, 0x32}, 7, 12}, {{0x56, 0x61}, 7, 12}, {{0x56, 0x63}, 7, 12},
+  {{0x56, 0x65}, 7, 12}, {{0x56, 0x69}, 7, 12}, {{0x56, 0x6F}, 7, 12},
+  {{0x56, 0x73}, 7, 12}, {{0x56, 0x74}, 7, 12}, {{0x56, 0x56}, 7, 7},
+  {{0x56, 0x56}, 7, 7}, {{0x56, 0x56}, 7, 7}, {{0x56, 0x56}, 7, 7},
+  {{0x56, 0x56}, 7, 7}, {{0x56, 0x56}, 7, 7}, {{0x56, 0x56}, 7, 7},
+  {{0x56, 0x56}, 7, 7}, {{0x56, 0x56}, 7, 7}, {{0x56, 0x56}, 7, 7},
+  {{0x56, 0x56}, 7, 7}, {{0x56, 0x56}, 7, 7}, {{0x56, 0x56}, 7, 7},
+  {{0x56, 0x56}, 7, 7}, {{0x56, 0x56}, 7, 7}, {{0x56, 0x56}, 7, 7},
+  {{0x56, 0x56}, 7, 7}, {{0x56, 0x56}, 7, 7}, {{0x56, 0x56}, 7, 7},
+  {{0x56, 0x56}, 7, 7}, {{0x56, 0x56}, 7, 7}, {{0x56, 0x56}, 7, 7},
+  {{0x57, 0x30}, 7, 12}, {{0x57, 0x31}, 7, 12}, {{0x57, 0x32}, 7, 12},
+  {{0x57, 0x61}, 7, 12}, {{0x57, 0x63}, 7, 12}, {{0x57, 0x65}, 7, 12},
+  {{0x57, 0x69}, 7, 12}, {{0x57, 0x6F}, 7, 12}, {{0x57, 0x73}, 7, 12},
+  {{0x57, 0x74}, 7, 12}, {{0x57, 0x57}, 7, 7}, {{0x57, 0x57}, 7, 7},
+  {{0x57, 0x57}, 7, 7}, {{0x57, 0x57}, 7, 7}, {{0x57, 0x57}, 7, 7},
+  {{0x57, 0x57}, 7, 7}, {{0x57, 0x57}, 7, 7}, {{0x57, 0x57}, 7, 7},
+  {{0x57, 0x57}, 7, 7}, {{0x57, 0x57}, 7, 7}, {{0x57, 0x57}, 7, 7},
+  {{0x57, 0x57}, 7, 7}, {{0x57, 0x57}, 7, 7}, {{0x57, 0x57}, 7, 7},
+  {{0x57, 0x57}, 7, 7}, {{0x57, 0x57}, 7, 7}, {{0x57, 0x57}, 7, 7},
+  {{0x57, 0x57}, 7, 7}, {{0x57, 0x57}, 7, 7}, {{0x57, 0x57}, 7, 7},
+  {{0x57, 0x57}, 7, 7}, {{0x57, 0x57}, 7, 7}, {{0x59, 0x30}, 7, 12},
+  {{0x59, 0x31}, 7, 12}, {{0x59, 0x32}, 7, 12}, {{0x59, 0x61}, 7, 12},
+  {{0x59, 0x63}, 7, 12}, {{0x59, 0x65}, 7, 12}, {{0x59, 0x69}, 7, 12},
+  {{0x59, 0x6F}, 7, 12}, {{0x59, 0x73}, 7, 12}, {{0x59, 0x74}, 7, 12},
+  {{0x59, 0x59}, 7, 7}, {{0x59, 0x59}, 7, 7}, {{0x59, 0x59}, 7, 7},
+  {{0x59, 0x59}, 7, 7}, {{0x59, 0x59}, 7, 7}, {{0x59, 0x59}, 7, 7},
+  {{0x59, 0x59}, 7, 7}, {{0x59, 0x59}, 7, 7}, {{0x59, 0x59}, 7, 7},
+  {{0x59, 0x59}, 7, 7}, {{0x59, 0x59}, 7, 7}, {{0x59, 0x59}, 7, 7},
+  {{0x59, 0x59}, 7, 7}, {{0x59, 0x59}, 7, 7}, {{0x59, 0x59}, 7, 7},
+  {{0x59, 0x59}, 7, 7}, {{0x59, 0x59}, 7, 7}, {{0x59, 0x59}, 7, 7},
+  {{0x59, 0x59}, 7, 7}, {{0x59, 0x59}, 7, 7}, {{0x59, 0x59}, 7, 7},
+  {{0x59, 0x59}, 7, 7}, {{0x6A, 0x30}, 7, 12}, {{0x6A, 0x31}, 7, 12},
+  {{0x6A, 0x32}, 7, 12}, {{0x6A, 0x61}, 7, 12}, {{0x6A, 0x63}, 7, 12},
+  {{0x6A, 0x65}, 7, 12}, {{0x6A, 0x69}, 7, 12}, {{0x6A, 0x6F}, 7, 12},
+  {{0x6A, 0x73}, 7, 12}, {{0x6A, 0x74}, 7, 12}, {{0x6A, 0x6A}, 7, 7},
+  {{0x6A, 0x6A}, 7, 7}, {{0x6A, 0x6A}, 7, 7}, {{0x6A, 0x6A}, 7, 7},
+  {{0x6A, 0x6A}, 7, 7}, {{0x6A, 0x6A}, 7, 7}, {{0x6A, 0x6A}, 7, 7},
+  {{0x6A, 0x6A}, 7, 7}, {{0x6A, 0x6A}, 7, 7}, {{0x6A, 0x6A}, 7, 7},
+  {{0x6A, 0x6A}, 7, 7}, {{0x6A, 0x6A}, 7, 7}, {{0x6A, 0x6A}, 7, 7},
+  {{0x6A, 0x6A}, 7, 7}, {{0x6A, 0x6A}, 7, 7}, {{0x6A, 0x6A}, 7, 7},
+  {{0x6A, 0x6A}, 7, 7}, {{0x6A, 0x6A}, 7, 7}, {{0x6A, 0x6A}, 7, 7},
+  {{0x6A, 0x6A}, 7, 7}, {{0x6A, 0x6A}, 7, 7}, {{0x6A, 0x6A}, 7, 7},
+  {{0x6B, 0x30}, 7, 12}, {{0x6B, 0x31}, 7, 12}, {{0x6B, 0x32}, 7, 12},
+  {{0x6B, 0x61}, 7, 12}, {{0x6B, 0x63}, 7, 12}, {{0x6B, 0x65}, 7, 12},
+  {{0x6B, 0x69}, 7, 12}, {{0x6B, 0x6F}, 7, 12}, {{0x6B, 0x73}, 7, 12},
+  {{0x6B, 0x74}, 7, 12}, {{0x6B, 0x6B}, 7, 7}, {{0x6B, 0x6B}, 7, 7},
+  {{0x6B, 0x6B}, 7, 7}, {{0x6B, 0x6B}, 7, 7}, {{0x6B, 0x6B}, 7, 7},
+  {{0x6B, 0x6B}, 7, 7}, {{0x6B, 0x6B}, 7, 7}, {{0x6B, 0x6B}, 7, 7},
+  {{0x6B, 0x6B}, 7, 7}, {{0x6B, 0x6B}, 7, 7}, {{0x6B, 0x6B}, 7, 7},
+  {{0x6B, 0x6B}, 7, 7}, {{0x6B, 0x6B}, 7, 7}, {{0x6B, 0x6B}, 7, 7},
+  {{0x6B, 0x6B}, 7, 7}, {{0x6B, 0x6B}, 7, 7}, {{0x6B, 0x6B}, 7, 7},
+  {{0x6B, 0x6B}, 7, 7}, {{0x6B, 0x6B}, 7, 7}, {{0x6B, 0x6B}, 7, 7},
+  {{0x6B, 0x6B}, 7, 7}, {{0x6B, 0x6B}, 7, 7}, {{0x71, 0x30}, 7, 12},
+  {{0x71, 0x31}, 7, 12}, {{0x71, 0x32}, 7, 12}, {{0x71, 0x61}, 7, 12},
+  {{0x71, 0x63}, 7, 12}, {{0x71, 0x65}, 7, 12}, {{0x71, 0x69}, 7, 12},
+  {{0x71, 0x6F}, 7, 12}, {{0x71, 0x73}, 7, 12}, {{0x71, 0x74}, 7, 12},
+  {{0x71, 0x71}, 7, 7}, {{0x71, 0x71}, 7, 7}, {{0x71, 0x71}, 7, 7},
+  {{0x71, 0x71}, 7, 7}, {{0x71, 0x71}, 7, 7}, {{0x71, 0x71}, 7, 7},
+  {{0x71, 0x71}, 7, 7}, {{0x71, 0x71}, 7, 7}, {{0x71, 0x71}, 7, 7},
+  {{0x71, 0x71}, 7, 7}, {{0x71, 0x71}, 7, 7}, {{0x71, 0x71}, 7, 7},
+  {{0x71, 0x71}, 7, 7}, {{0x71, 0x71}, 7, 7}, {{0x71, 0x71}, 7, 7},
+  {{0x71, 0x71}, 7, 7}, {{0x71, 0x71}, 7, 7}, {{0x71, 0x71}, 7, 7},
+  {{0x71, 0x71}, 7, 7}, {{0x71, 0x71}, 7, 7}, {{0x71, 0x71}, 7, 7},
+  {{0x71, 0x71}, 7, 7}, {{0x76, 0x30}, 7, 12}, {{0x76, 0x31}, 7, 12},
+  {{0x76, 0x32}, 7, 12}, {{0x76, 0x61}, 7, 12}, {{0x76, 0x63}, 7, 12},
+  {{0x76, 0x65}, 7, 12}, {{0x76, 0x69}, 7, 12}, {{0x76, 0x6F}, 7, 12},
+  {{0x76, 0x73}, 7, 12}, {{0x76, 0x74}, 7, 12}, {{0x76, 0x76}, 7, 7},
+  {{0x76, 0x76}, 7, 7}, {{0x76, 0x76}, 7, 7}, {{0x76, 0x76}, 7, 7},
+  {{0x76, 0x76}, 7, 7}, {{0x76, 0x76}, 7, 7}, {{0x76, 0x76}, 7, 7},
+  {{0x76, 0x76}, 7, 7}, {{0x76, 0x76}, 7, 7}, {{0x76, 0x76}, 7, 7},
+  {{0x76, 0x76}, 7, 7}, {{0x76, 0x76}, 7, 7}, {{0x76, 0x76}, 7, 7},
+  {{0x76, 0x76}, 7, 7}, {{0x76, 0x76}, 7, 7}, {{0x76, 0x76}, 7, 7},
+  {{0x76, 0x76}, 7, 7}, {{0x76, 0x76}, 7, 7}, {{0x76, 0x76}, 7, 7},
+  {{0x76, 0x76}, 7, 7}, {{0x76, 0x76}, 7, 7}, {{0x76, 0x76}, 7, 7},
+  {{0x77, 0x30}, 7, 12}, {{0x77, 0x31}, 7, 12}, {{0x77, 0x32}, 7, 12},
+  {{0x77, 0x61}, 7, 12}, {{0x77, 0x63}, 7, 12}, {{0x77, 0x65}, 7, 12},
+  {{0x77, 0x69}, 7, 12}, {{0x77, 0x6F}, 7, 12}, {{0x77, 0x73}, 7, 12},
+  {{0x77, 0x74}, 7, 12}, {{0x77, 0x77}, 7, 7}, {{0x77, 0x77}, 7, 7},
+  {{0x77, 0x77}, 7, 7}, {{0x77, 0x77}, 7, 7}, {{0x77, 0x77}, 7, 7},
+  {{0x77, 0x77}, 7, 7}, {{0x77, 0x77}, 7, 7}, {{0x77, 0x77}, 7, 7},
+  {{0x77, 0x77}, 7, 7}, {{0x77, 0x77}, 7, 7}, {{0x77, 0x77}, 7, 7},
+  {{0x77, 0x77}, 7, 7}, {{0x77, 0x77}, 7, 7}, {{0x77, 0x77}, 7, 7},
+  {{0x77, 0x77}, 7, 7}, {{0x77, 0x77}, 7, 7}, {{0x77, 0x77}, 7, 7},
+  {{0x77, 0x77}, 7, 7}, {{0x77, 0x77}, 7, 7}, {{0x77, 0x77}, 7, 7},
+  {{0x77, 0x77}, 7, 7}, {{0x77, 0x77}, 7, 7}, {{0x78, 0x30}, 7, 12},
+  {{0x78, 0x31}, 7, 12}, {{0x78, 0x32}, 7, 12}, {{0x78, 0x61}, 7, 12},
+  {{0x78, 0x63}, 7, 12}, {{0x78, 0x65}, 7, 12}, {{0x78, 0x69}, 7, 12},
+  {{0x78, 0x6F}, 7, 12}, {{0x78, 0x73}, 7, 12}, {{0x78, 0x74}, 7, 12},
+  {{0x78, 0x78}, 7, 7}, {{0x78, 0x78}, 7, 7}, {{0x78, 0x78}, 7, 7},
+  {{0x78, 0x78}, 7, 7}, {{0x78, 0x78}, 7, 7}, {{0x78, 0x78}, 7, 7},
+  {{0x78, 0x78}, 7, 7}, {{0x78, 0x78}, 7, 7}, {{0x78, 0x78}, 7, 7},
+  {{0x78, 0x78}, 7, 7}, {{0x78, 0x78}, 7, 7}, {{0x78, 0x78}, 7, 7},
+  {{0x78, 0x78}, 7, 7}, {{0x78, 0x78}, 7, 7}, {{0x78, 0x78}, 7, 7},
+  {{0x78, 0x78}, 7, 7}, {{0x78, 0x78}, 7, 7}, {{0x78, 0x78}, 7, 7},
+  {{0x78, 0x78}, 7, 7}, {{0x78, 0x78}, 7, 7}, {{0x78, 0x78}, 7, 7},
+  {{0x78, 0x78}, 7, 7}, {{0x79, 0x30}, 7, 12}, {{0x79, 0x31}, 7, 12},
+  {{0x79, 0x32}, 7, 12}, {{0x79, 0x61}, 7, 12}, {{0x79, 0x63}, 7, 12},
+  {{0x79, 0x65}, 7, 12}, {{0x79, 0x69}, 7, 12}, {{0x79, 0x6F}, 7, 12},
+  {{0x79, 0x73}, 7, 12}, {{0x79, 0x74}, 7, 12}, {{0x79, 0x79}, 7, 7},
+  {{0x79, 0x79}, 7, 7}, {{0x79, 0x79}, 7, 7}, {{0x79, 0x79}, 7, 7},
+  {{0x79, 0x79}, 7, 7}, {{0x79, 0x79}, 7, 7}, {{0x79, 0x79}, 7, 7},
+  {{0x79, 0x79}, 7, 7}, {{0x79, 0x79}, 7, 7}, {{0x79, 0x79}, 7, 7},
+  {{0x79, 0x79}, 7, 7}, {{0x79, 0x79}, 7, 7}, {{0x79, 0x79}, 7, 7},
+  {{0x79, 0x79}, 7, 7}, {{0x79, 0x79}, 7, 7}, {{0x79, 0x79}, 7, 7},
+  {{0x79, 0x79}, 7, 7}, {{0x79, 0x79}, 7, 7}, {{0x79, 0x79}, 7, 7},
+  {{0x79, 0x79}, 7, 7}, {{0x79, 0x79}, 7, 7}, {{0x79, 0x79}, 7, 7},
+  {{0x7A, 0x30}, 7, 12}, {{0x7A, 0x31}, 7, 12}, {{0x7A, 0x32}, 7, 12},
+  {{0x7A, 0x61}, 7, 12}, {{0x7A, 0x63}, 7, 12}, {{0x7A, 0x65}, 7, 12},
+  {{0x7A, 0x69}, 7, 12}, {{0x7A, 0x6F}, 7, 12}, {{0x7A, 0x73}, 7, 12},
+  {{0x7A, 0x74}, 7, 12}, {{0x7A, 0x7A}, 7, 7}, {{0x7A, 0x7A}, 7, 7},
+  {{0x7A, 0x7A}, 7, 7}, {{0x7A, 0x7A}, 7, 7}, {{0x7A, 0x7A}, 7, 7},
+  {{0x7A, 0x7A}, 7, 7}, {{0x7A, 0x7A}, 7, 7}, {{0x7A, 0x7A}, 7, 7},
+  {{0x7A, 0x7A}, 7, 7}, {{0x7A, 0x7A}, 7, 7}, {{0x7A, 0x7A}, 7, 7},
+  {{0x7A, 0x7A}, 7, 7}, {{0x7A, 0x7A}, 7, 7}, {{0x7A, 0x7A}, 7, 7},
+  {{0x7A, 0x7A}, 7, 7}, {{0x7A, 0x7A}, 7, 7}, {{0x7A, 0x7A}, 7, 7},
+  {{0x7A, 0x7A}, 7, 7}, {{0x7A, 0x7A}, 7, 7}, {{0x7A, 0x7A}, 7, 7},
+  {{0x7A, 0x7A}, 7, 7}, {{0x7A, 0x7A}, 7, 7}, {{0x26, 0x26}, 8, 8},
+  {{0x26, 0x26}, 8, 8}, {{0x26, 0x26}, 8, 8}, {{0x26, 0x26}, 8, 8},
+  {{0x26, 0x26}, 8, 8}, {{0x26, 0x26}, 8, 8}, {{0x26, 0x26}, 8, 8},
+  {{0x26, 0x26}, 8, 8}, {{0x26, 0x26}, 8, 8}, {{0x26, 0x26}, 8, 8},
+  {{0x26, 0x26}, 8, 8}, {{0x26, 0x26}, 8, 8}, {{0x26, 0x26}, 8, 8},
+  {{0x26, 0x26}, 8, 8}, {{0x26, 0x26}, 8, 8}, {{0x26, 0x26}, 8, 8},
+  {{0x2A, 0x2A}, 8, 8}, {{0x2A, 0x2A}, 8, 8}, {{0x2A, 0x2A}, 8, 8},
+  {{0x2A, 0x2A}, 8, 8}, {{0x2A, 0x2A}, 8, 8}, {{0x2A, 0x2A}, 8, 8},
+  {{0x2A, 0x2A}, 8, 8}, {{0x2A, 0x2A}, 8, 8}, {{0x2A, 0x2A}, 8, 8},
+  {{0x2A, 0x2A}, 8, 8}, {{0x2A, 0x2A}, 8, 8}, {{0x2A, 0x2A}, 8, 8},
+  {{0x2A, 0x2A}, 8, 8}, {{0x2A, 0x2A}, 8, 8}, {{0x2A, 0x2A}, 8, 8},
+  {{0x2A, 0x2A}, 8, 8}, {{0x2C, 0x2C}, 8, 8}, {{0x2C, 0x2C}, 8, 8},
+  {{0x2C, 0x2C}, 8, 8}, {{0x2C, 0x2C}, 8, 8}, {{0x2C, 0x2C}, 8, 8},
+  {{0x2C, 0x2C}, 8, 8}, {{0x2C, 0x2C}, 8, 8}, {{0x2C, 0x2C}, 8, 8},
+  {{0x2C, 0x2C}, 8, 8}, {{0x2C, 0x2C}, 8, 8}, {{0x2C, 0x2C}, 8, 8},
+  {{0x2C, 0x2C}, 8, 8}, {{0x2C, 0x2C}, 8, 8}, {{0x2C, 0x2C}, 8, 8},
+  {{0x2C, 0x2C}, 8, 8}, {{0x2C, 0x2C}, 8, 8}, {{0x3B, 0x3B}, 8, 8},
+  {{0x3B, 0x3B}, 8, 8}, {{0x3B, 0x3B}, 8, 8}, {{0x3B, 0x3B}, 8, 8},
+  {{0x3B, 0x3B}, 8, 8}, {{0x3B, 0x3B}, 8, 8}, {{0x3B, 0x3B}, 8, 8},
+  {{0x3B, 0x3B}, 8, 8}, {{0x3B, 0x3B}, 8, 8}, {{0x3B, 0x3B}, 8, 8},
+  {{0x3B, 0x3B}, 8, 8}, {{0x3B, 0x3B}, 8, 8}, {{0x3B, 0x3B}, 8, 8},
+  {{0x3B, 0x3B}, 8, 8}, {{0x3B, 0x3B}, 8, 8}, {{0x3B, 0x3B}, 8, 8},
+  {{0x58, 0x58}, 8, 8}, {{0x58, 0x58}, 8, 8}, {{0x58, 0x58}, 8, 8},
+  {{0x58, 0x58}, 8, 8}, {{0x58, 0x58}, 8, 8}, {{0x58, 0x58}, 8, 8},
+  {{0x58, 0x58}, 8, 8}, {{0x58, 0x58}, 8, 8}, {{0x58, 0x58}, 8, 8},
+  {{0x58, 0x58}, 8, 8}, {{0x58, 0x58}, 8, 8}, {{0x58, 0x58}, 8, 8},
+  {{0x58, 0x58}, 8, 8}, {{0x58, 0x58}, 8, 8}, {{0x58, 0x58}, 8, 8},
+  {{0x58, 0x58}, 8, 8}, {{0x5A, 0x5A}, 8, 8}, {{0x5A, 0x5A}, 8, 8},
+  {{0x5A, 0x5A}, 8, 8}, {{0x5A, 0x5A}, 8, 8}, {{0x5A, 0x5A}, 8, 8},
+  {{0x5A, 0x5A}, 8, 8}, {{0x5A, 0x5A}, 8, 8}, {{0x5A, 0x5A}, 8, 8},
+  {{0x5A, 0x5A}, 8, 8}, {{0x5A, 0x5A}, 8, 8}, {{0x5A, 0x5A}, 8, 8},
+  {{0x5A, 0x5A}, 8, 8}, {{0x5A, 0x5A}, 8, 8}, {{0x5A, 0x5A}, 8, 8},
+  {{0x5A, 0x5A}, 8, 8}, {{0x5A, 0x5A}, 8, 8}, {{0x21, 0x21}, 10, 10},
+  {{0x21, 0x21}, 10, 10}, {{0x21, 0x21}, 10, 10}, {{0x21, 0x21}, 10, 10},
+  {{0x22, 0x22}, 10, 10}, {{0x22, 0x22}, 10, 10}, {{0x22, 0x22}, 10, 10},
+  {{0x22, 0x22}, 10, 10}, {{0x28, 0x28}, 10, 10}, {{0x28, 0x28}, 10, 10},
+  {{0x28, 0x28}, 10, 10}, {{0x28, 0x28}, 10, 10}, {{0x29, 0x29}, 10, 10},
+  {{0x29, 0x29}, 10, 10}, {{0x29, 0x29}, 10, 10}, {{0x29, 0x29}, 10, 10},
+  {{0x3F, 0x3F}, 10, 10}, {{0x3F, 0x3F}, 10, 10}, {{0x3F, 0x3F}, 10, 10},
+  {{0x3F, 0x3F}, 10, 10}, {{0x27, 0x27}, 11, 11}, {{0x27, 0x27}, 11, 11},
+  {{0x2B, 0x2B}, 11, 11}, {{0x2B, 0x2B}, 11, 11}, {{0x7C, 0x7C}, 11, 11},
+  {{0x7C, 0x7C}, 11, 11}, {{0x23, 0x23}, 12, 12}, {{0x3E, 0x3E}, 12, 12},
+  {{0x00, 0x00}, 0, 0}, {{0x00, 0x00}, 0, 0}, {{0x00, 0x00}, 0, 0},
+  {{0x00, 0x00}, 0, 0},
 };
+
+const uint32_t qpack_huffman_decode_limit[] = {
+  0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U,
+  0x00000000U, 0x4FFFFFFFU, 0xB7FFFFFFU, 0xF7FFFFFFU,
+  0xFDFFFFFFU, 0xFDFFFFFFU, 0xFF3FFFFFU, 0xFF9FFFFFU,
+  0xFFBFFFFFU, 0xFFEFFFFFU, 0xFFF7FFFFU, 0xFFFDFFFFU,
+  0xFFFDFFFFU, 0xFFFDFFFFU, 0xFFFDFFFFU, 0xFFFE5FFFU,
+  0xFFFEDFFFU, 0xFFFF47FFU, 0xFFFFAFFFU, 0xFFFFE9FFU,
+  0xFFFFF5FFU, 0xFFFFF7FFU, 0xFFFFFBBFU, 0xFFFFFE1FU,
+  0xFFFFFFEFU, 0xFFFFFFEFU, 0xFFFFFFFFU,
+};
+
+const uint32_t qpack_huffman_decode_offset[] = {
+  0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U,
+  0x00000000U, 0x00000000U, 0xFFFFFFF6U, 0xFFFFFFC8U,
+  0xFFFFFF4CU, 0x00000000U, 0xFFFFFC52U, 0xFFFFF855U,
+  0xFFFFF058U, 0xFFFFE05CU, 0xFFFFC05EU, 0xFFFF8060U,
+  0x00000000U, 0x00000000U, 0x00000000U, 0xFFF8006FU,
+  0xFFF0007CU, 0xFFE0008EU, 0xFFC000A5U, 0xFF8000B9U,
+  0xFF0000C4U, 0xFE0000CEU, 0xFC0000DEU, 0xF80000EFU,
+  0xF00000FEU, 0x00000000U, 0xC0000101U,
+};
+
+const uint16_t qpack_huffman_decode_sym[] = {
+  0x30, 0x31, 0x32, 0x61, 0x63, 0x65, 0x69, 0x6F,
+  0x73, 0x74, 0x20, 0x25, 0x2D, 0x2E, 0x2F, 0x33,
+  0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3D, 0x41,
+  0x5F, 0x62, 0x64, 0x66, 0x67, 0x68, 0x6C, 0x6D,
+  0x6E, 0x70, 0x72, 0x75, 0x3A, 0x42, 0x43, 0x44,
+  0x45, 0x46, 0x47, 0x48, 0x49, 0x4A, 0x4B, 0x4C,
+  0x4D, 0x4E, 0x4F, 0x50, 0x51, 0x52, 0x53, 0x54,
+  0x55, 0x56, 0x57, 0x59, 0x6A, 0x6B, 0x71, 0x76,
+  0x77, 0x78, 0x79, 0x7A, 0x26, 0x2A, 0x2C, 0x3B,
+  0x58, 0x5A, 0x21, 0x22, 0x28, 0x29, 0x3F, 0x27,
+  0x2B, 0x7C, 0x23, 0x3E, 0x00, 0x24, 0x40, 0x5B,
+  0x5D, 0x7E, 0x5E, 0x7D, 0x3C, 0x60, 0x7B, 0x5C,
+  0xC3, 0xD0, 0x80, 0x82, 0x83, 0xA2, 0xB8, 0xC2,
+  0xE0, 0xE2, 0x99, 0xA1, 0xA7, 0xAC, 0xB0, 0xB1,
+  0xB3, 0xD1, 0xD8, 0xD9, 0xE3, 0xE5, 0xE6, 0x81,
+  0x84, 0x85, 0x86, 0x88, 0x92, 0x9A, 0x9C, 0xA0,
+  0xA3, 0xA4, 0xA9, 0xAA, 0xAD, 0xB2, 0xB5, 0xB9,
+  0xBA, 0xBB, 0xBD, 0xBE, 0xC4, 0xC6, 0xE4, 0xE8,
+  0xE9, 0x01, 0x87, 0x89, 0x8A, 0x8B, 0x8C, 0x8D,
+  0x8F, 0x93, 0x95, 0x96, 0x97, 0x98, 0x9B, 0x9D,
+  0x9E, 0xA5, 0xA6, 0xA8, 0xAE, 0xAF, 0xB4, 0xB6,
+  0xB7, 0xBC, 0xBF, 0xC5, 0xE7, 0xEF, 0x09, 0x8E,
+  0x90, 0x91, 0x94, 0x9F, 0xAB, 0xCE, 0xD7, 0xE1,
+  0xEC, 0xED, 0xC7, 0xCF, 0xEA, 0xEB, 0xC0, 0xC1,
+  0xC8, 0xC9, 0xCA, 0xCD, 0xD2, 0xD5, 0xDA, 0xDB,
+  0xEE, 0xF0, 0xF2, 0xF3, 0xFF, 0xCB, 0xCC, 0xD3,
+  0xD4, 0xD6, 0xDD, 0xDE, 0xDF, 0xF1, 0xF4, 0xF5,
+  0xF6, 0xF7, 0xF8, 0xFA, 0xFB, 0xFC, 0xFD, 0xFE,
+  0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x0B,
+  0x0C, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14,
+  0x15, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D,
+  0x1E, 0x1F, 0x7F, 0xDC, 0xF9, 0x0A, 0x0D, 0x16,
+  0x100,
+};
+
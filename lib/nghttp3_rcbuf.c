@@ -78,8 +78,17 @@ void nghttp3_rcbuf_del(nghttp3_rcbuf *rcbuf) {
   nghttp3_mem_free(rcbuf->mem, rcbuf);
 }
 
+void nghttp3_rcbuf_borrow_init(nghttp3_rcbuf *rcbuf, const uint8_t *base,
+                               size_t len) {
+  *rcbuf = (nghttp3_rcbuf){
+    .base = (uint8_t *)base,
+    .len = len,
+    .ref = NGHTTP3_RCBUF_REF_BORROWED,
+  };
+}
+
 void nghttp3_rcbuf_incref(nghttp3_rcbuf *rcbuf) {
-  if (rcbuf->ref == -1) {
+  if (rcbuf->ref < 0) {
     return;
   }
 
@@ -87,7 +96,7 @@ void nghttp3_rcbuf_incref(nghttp3_rcbuf *rcbuf) {
 }
 
 void nghttp3_rcbuf_decref(nghttp3_rcbuf *rcbuf) {
-  if (rcbuf == NULL || rcbuf->ref == -1) {
+  if (rcbuf == NULL || rcbuf->ref < 0) {
     return;
   }
 
@@ -104,5 +113,9 @@ nghttp3_vec nghttp3_rcbuf_get_buf(const nghttp3_rcbuf *rcbuf) {
 }
 
 int nghttp3_rcbuf_is_static(const nghttp3_rcbuf *rcbuf) {
-  return rcbuf->ref == -1;
+  return rcbuf->ref == NGHTTP3_RCBUF_REF_STATIC;
+}
+
+int nghttp3_rcbuf_is_borrowed(const nghttp3_rcbuf *rcbuf) {
+  return rcbuf->ref == NGHTTP3_RCBUF_REF_BORROWED;
 }
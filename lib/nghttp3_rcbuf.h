@@ -78,4 +78,20 @@ int nghttp3_rcbuf_new2(nghttp3_rcbuf **rcbuf_ptr, const uint8_t *src,
  */
 void nghttp3_rcbuf_del(nghttp3_rcbuf *rcbuf);
 
+/* NGHTTP3_RCBUF_REF_STATIC is the reference count of nghttp3_rcbuf
+   which points to statically allocated buffer. */
+#define NGHTTP3_RCBUF_REF_STATIC -1
+/* NGHTTP3_RCBUF_REF_BORROWED is the reference count of nghttp3_rcbuf
+   which is a borrowed view into a buffer owned by someone else. */
+#define NGHTTP3_RCBUF_REF_BORROWED -2
+
+/*
+ * nghttp3_rcbuf_borrow_init initializes |rcbuf| as a borrowed view
+ * into |len| bytes of buffer pointed by |base|.  nghttp3_rcbuf_incref
+ * and nghttp3_rcbuf_decref do nothing for |rcbuf|.  Unlike the other
+ * nghttp3_rcbuf, |base| is not NULL-terminated.
+ */
+void nghttp3_rcbuf_borrow_init(nghttp3_rcbuf *rcbuf, const uint8_t *base,
+                               size_t len);
+
 #endif /* !defined(NGHTTP3_RCBUF_H) */
@@ -112,6 +112,17 @@ int nghttp3_ringbuf_full(const nghttp3_ringbuf *rb) {
   return rb->len == rb->nmemb;
 }
 
+void nghttp3_ringbuf_shrink(nghttp3_ringbuf *rb) {
+  if (rb->len) {
+    return;
+  }
+
+  nghttp3_mem_free(rb->mem, rb->buf);
+  rb->buf = NULL;
+  rb->nmemb = 0;
+  rb->first = 0;
+}
+
 int nghttp3_ringbuf_reserve(nghttp3_ringbuf *rb, size_t nmemb) {
   uint8_t *buf;
 
@@ -112,4 +112,15 @@ int nghttp3_ringbuf_full(const nghttp3_ringbuf *rb);
 
 int nghttp3_ringbuf_reserve(nghttp3_ringbuf *rb, size_t nmemb);
 
+/* nghttp3_ringbuf_shrink frees the underlying buffer of |rb| if it
+   is empty.  The buffer is allocated again by
+   nghttp3_ringbuf_reserve. */
+void nghttp3_ringbuf_shrink(nghttp3_ringbuf *rb);
+
+/* nghttp3_ringbuf_get_memusage returns the number of bytes allocated
+   for the underlying buffer of |rb|. */
+static inline size_t nghttp3_ringbuf_get_memusage(const nghttp3_ringbuf *rb) {
+  return rb->buf ? rb->nmemb * rb->size : 0;
+}
+
 #endif /* !defined(NGHTTP3_RINGBUF_H) */
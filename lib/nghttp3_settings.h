@@ -37,6 +37,12 @@
 /* NGHTTP3_DEFAULT_GLITCH_RATELIM_RATE is the rate of tokens generated
    per second for glitch rate limiter. */
 #define NGHTTP3_DEFAULT_GLITCH_RATELIM_RATE 33
+/* NGHTTP3_DEFAULT_READ_DATA_VECCNT is the default number of objects
+   passed to read_data callback at once. */
+#define NGHTTP3_DEFAULT_READ_DATA_VECCNT 8
+/* NGHTTP3_MAX_READ_DATA_VECCNT is the maximum number of objects
+   passed to read_data callback at once. */
+#define NGHTTP3_MAX_READ_DATA_VECCNT 1024
 
 /*
  * nghttp3_settings_convert_to_latest converts |src| of version
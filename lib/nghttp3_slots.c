@@ -0,0 +1,132 @@
+/*
+ * nghttp3
+ *
+ * Copyright (c) 2026 nghttp3 contributors
+ * Copyright (c) 2017 ngtcp2 contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "nghttp3_slots.h"
+
+#include <assert.h>
+
+void nghttp3_slots_init(nghttp3_slots *slots, const nghttp3_mem *mem) {
+  *slots = (nghttp3_slots){
+    .mem = mem,
+  };
+}
+
+void nghttp3_slots_free(nghttp3_slots *slots) {
+  nghttp3_mem_free(slots->mem, slots->slots);
+}
+
+/*
+ * slots_resize changes the number of slots to |nmemb|, keeping the
+ * stored pointers.  It returns 0 if it succeeds, or -1.
+ */
+static int slots_resize(nghttp3_slots *slots, size_t nmemb) {
+  void **p;
+  uint64_t i;
+
+  p = nghttp3_mem_calloc(slots->mem, nmemb, sizeof(p[0]));
+  if (p == NULL) {
+    return -1;
+  }
+
+  for (i = slots->base; i < slots->base + slots->nmemb; ++i) {
+    p[i & (nmemb - 1)] = slots->slots[i & (slots->nmemb - 1)];
+  }
+
+  nghttp3_mem_free(slots->mem, slots->slots);
+
+  slots->slots = p;
+  slots->nmemb = nmemb;
+
+  return 0;
+}
+
+int nghttp3_slots_insert(nghttp3_slots *slots, uint64_t idx, void *ptr) {
+  size_t nmemb;
+
+  if (slots->len == 0) {
+    if (slots->nmemb == 0 &&
+        slots_resize(slots, NGHTTP3_SLOTS_INITIAL_NMEMB) != 0) {
+      return -1;
+    }
+
+    slots->base = idx;
+  } else if (idx < slots->base) {
+    return -1;
+  } else if (idx - slots->base >= slots->nmemb) {
+    /* Slide the window over the slots which have been released. */
+    for (; idx - slots->base >= slots->nmemb &&
+           slots->slots[slots->base & (slots->nmemb - 1)] == NULL;
+         ++slots->base)
+      ;
+
+    if (idx - slots->base >= slots->nmemb) {
+      if (idx - slots->base >= NGHTTP3_SLOTS_MAX_NMEMB) {
+        return -1;
+      }
+
+      for (nmemb = slots->nmemb * 2; idx - slots->base >= nmemb; nmemb *= 2)
+        ;
+
+      if (slots_resize(slots, nmemb) != 0) {
+        return -1;
+      }
+    }
+  }
+
+  assert(slots->slots[idx & (slots->nmemb - 1)] == NULL);
+
+  slots->slots[idx & (slots->nmemb - 1)] = ptr;
+  ++slots->len;
+
+  return 0;
+}
+
+int nghttp3_slots_remove(nghttp3_slots *slots, uint64_t idx) {
+  void **p;
+
+  if (idx - slots->base >= slots->nmemb) {
+    return -1;
+  }
+
+  p = &slots->slots[idx & (slots->nmemb - 1)];
+  if (*p == NULL) {
+    return -1;
+  }
+
+  *p = NULL;
+  --slots->len;
+
+  return 0;
+}
+
+void nghttp3_slots_shrink(nghttp3_slots *slots) {
+  if (slots->len) {
+    return;
+  }
+
+  nghttp3_mem_free(slots->mem, slots->slots);
+  slots->slots = NULL;
+  slots->nmemb = 0;
+}
@@ -0,0 +1,116 @@
+/*
+ * nghttp3
+ *
+ * Copyright (c) 2026 nghttp3 contributors
+ * Copyright (c) 2017 ngtcp2 contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#ifndef NGHTTP3_SLOTS_H
+#define NGHTTP3_SLOTS_H
+
+#ifdef HAVE_CONFIG_H
+#  include <config.h>
+#endif /* defined(HAVE_CONFIG_H) */
+
+#include <nghttp3/nghttp3.h>
+
+#include "nghttp3_mem.h"
+
+/* NGHTTP3_SLOTS_INITIAL_NMEMB is the number of slots allocated when
+   the first pointer is inserted. */
+#define NGHTTP3_SLOTS_INITIAL_NMEMB 16
+/* NGHTTP3_SLOTS_MAX_NMEMB is the maximum number of slots. */
+#define NGHTTP3_SLOTS_MAX_NMEMB 1024
+
+/*
+ * nghttp3_slots is a direct-indexed array of pointers over a sliding
+ * window of indices [base, base + nmemb).  It is meant to be used
+ * alongside a generic map for keys that are allocated sequentially,
+ * and that are released roughly in order, like QUIC stream IDs.  A
+ * pointer whose index does not fit in the window is not stored, and
+ * the caller has to keep it elsewhere.
+ */
+typedef struct nghttp3_slots {
+  /* slots is the array of nmemb pointers.  The pointer of index i is
+     stored at slots[i & (nmemb - 1)]. */
+  void **slots;
+  const nghttp3_mem *mem;
+  /* base is the lowest index that the window covers. */
+  uint64_t base;
+  /* nmemb is the number of slots.  It is 0 or power of 2. */
+  size_t nmemb;
+  /* len is the number of pointers stored. */
+  size_t len;
+} nghttp3_slots;
+
+/*
+ * nghttp3_slots_init initializes |slots|.
+ */
+void nghttp3_slots_init(nghttp3_slots *slots, const nghttp3_mem *mem);
+
+/*
+ * nghttp3_slots_free frees resources allocated for |slots|.
+ */
+void nghttp3_slots_free(nghttp3_slots *slots);
+
+/*
+ * nghttp3_slots_insert stores |ptr| at index |idx|.  The window
+ * slides forward over empty slots, and grows up to
+ * NGHTTP3_SLOTS_MAX_NMEMB to fit |idx|.
+ *
+ * This function returns 0 if it succeeds, or -1 if |idx| is below
+ * the window, it does not fit in the window, or memory allocation
+ * fails.  |slots| is not modified in the latter case.
+ */
+int nghttp3_slots_insert(nghttp3_slots *slots, uint64_t idx, void *ptr);
+
+/*
+ * nghttp3_slots_remove removes the pointer at |idx|.  It returns 0 if
+ * it succeeds, or -1 if there is no pointer at |idx|.
+ */
+int nghttp3_slots_remove(nghttp3_slots *slots, uint64_t idx);
+
+/*
+ * nghttp3_slots_find returns the pointer at |idx|, or NULL.
+ */
+static inline void *nghttp3_slots_find(const nghttp3_slots *slots,
+                                       uint64_t idx) {
+  if (idx - slots->base >= slots->nmemb) {
+    return NULL;
+  }
+
+  return slots->slots[idx & (slots->nmemb - 1)];
+}
+
+/*
+ * nghttp3_slots_shrink frees the array if |slots| is empty.
+ */
+void nghttp3_slots_shrink(nghttp3_slots *slots);
+
+/*
+ * nghttp3_slots_get_memusage returns the number of bytes allocated
+ * for |slots|.
+ */
+static inline size_t nghttp3_slots_get_memusage(const nghttp3_slots *slots) {
+  return slots->nmemb * sizeof(slots->slots[0]);
+}
+
+#endif /* !defined(NGHTTP3_SLOTS_H) */
@@ -27,6 +27,10 @@
 #include <string.h>
 #include <assert.h>
 #include <stdio.h>
+#ifdef HAVE_PREAD
+#  include <unistd.h>
+#  include <errno.h>
+#endif /* defined(HAVE_PREAD) */
 
 #include "nghttp3_conv.h"
 #include "nghttp3_macro.h"
@@ -49,6 +53,7 @@ nghttp3_objalloc_def(stream, nghttp3_stream, oplent)
 int nghttp3_stream_new(nghttp3_stream **pstream, int64_t stream_id,
                        const nghttp3_stream_callbacks *callbacks,
                        nghttp3_objalloc *out_chunk_objalloc,
+                       nghttp3_objalloc *inq_chunk_objalloc,
                        nghttp3_objalloc *stream_objalloc,
                        const nghttp3_mem *mem) {
   nghttp3_stream *stream = nghttp3_objalloc_stream_get(stream_objalloc);
@@ -59,6 +64,7 @@ int nghttp3_stream_new(nghttp3_stream **pstream, int64_t stream_id,
 
   *stream = (nghttp3_stream){
     .out_chunk_objalloc = out_chunk_objalloc,
+    .inq_chunk_objalloc = inq_chunk_objalloc,
     .stream_objalloc = stream_objalloc,
     .qpack_blocked_pe.index = NGHTTP3_PQ_BAD_INDEX,
     .mem = mem,
@@ -89,30 +95,68 @@ int nghttp3_stream_new(nghttp3_stream **pstream, int64_t stream_id,
   return 0;
 }
 
-static void delete_outq(nghttp3_ringbuf *outq, const nghttp3_mem *mem) {
+/*
+ * stream_release_tbuf calls release callback of |tbuf| of type
+ * NGHTTP3_BUF_TYPE_ALIEN_RELEASE.
+ */
+static void stream_release_tbuf(nghttp3_stream *stream,
+                                const nghttp3_typed_buf *tbuf) {
+  nghttp3_conn *conn = stream->conn;
+
+  assert(conn);
+
+  tbuf->release(conn, stream->node.id, tbuf->release_user_data,
+                conn->user_data);
+}
+
+/*
+ * stream_release_file_chunk returns the buffer of |tbuf| of type
+ * NGHTTP3_BUF_TYPE_FILE to the pool.
+ */
+static void stream_release_file_chunk(nghttp3_stream *stream,
+                                      const nghttp3_typed_buf *tbuf) {
+  assert(stream->conn);
+
+  nghttp3_objalloc_chunk_release(&stream->conn->pool->file_chunk_objalloc,
+                                 (void *)tbuf->buf.begin);
+}
+
+static void delete_outq(nghttp3_stream *stream) {
+  nghttp3_ringbuf *outq = &stream->outq;
   nghttp3_typed_buf *tbuf;
   size_t i, len = nghttp3_ringbuf_len(outq);
 
   for (i = 0; i < len; ++i) {
     tbuf = nghttp3_ringbuf_get(outq, i);
-    if (tbuf->type == NGHTTP3_BUF_TYPE_PRIVATE) {
-      nghttp3_buf_free(&tbuf->buf, mem);
+    switch (tbuf->type) {
+    case NGHTTP3_BUF_TYPE_PRIVATE:
+      nghttp3_buf_free(&tbuf->buf, stream->mem);
+      break;
+    case NGHTTP3_BUF_TYPE_ALIEN_RELEASE:
+      stream_release_tbuf(stream, tbuf);
+      break;
+    case NGHTTP3_BUF_TYPE_FILE:
+      stream_release_file_chunk(stream, tbuf);
+      break;
+    default:
+      break;
     }
   }
 
   nghttp3_ringbuf_free(outq);
 }
 
-static void delete_chunks(nghttp3_ringbuf *chunks, const nghttp3_mem *mem) {
+static void delete_inq(nghttp3_ringbuf *inq,
+                       nghttp3_objalloc *inq_chunk_objalloc) {
   nghttp3_buf *buf;
-  size_t i, len = nghttp3_ringbuf_len(chunks);
+  size_t i, len = nghttp3_ringbuf_len(inq);
 
   for (i = 0; i < len; ++i) {
-    buf = nghttp3_ringbuf_get(chunks, i);
-    nghttp3_buf_free(buf, mem);
+    buf = nghttp3_ringbuf_get(inq, i);
+    nghttp3_objalloc_chunk_release(inq_chunk_objalloc, (void *)buf->begin);
   }
 
-  nghttp3_ringbuf_free(chunks);
+  nghttp3_ringbuf_free(inq);
 }
 
 static void delete_out_chunks(nghttp3_ringbuf *chunks,
@@ -135,7 +179,7 @@ static void delete_out_chunks(nghttp3_ringbuf *chunks,
   nghttp3_ringbuf_free(chunks);
 }
 
-static void delete_frq(nghttp3_ringbuf *frq, const nghttp3_mem *mem) {
+static void clear_frq(nghttp3_ringbuf *frq, const nghttp3_mem *mem) {
   nghttp3_frame *fr;
   size_t i, len = nghttp3_ringbuf_len(frq);
 
@@ -153,6 +197,11 @@ static void delete_frq(nghttp3_ringbuf *frq, const nghttp3_mem *mem) {
     }
   }
 
+  nghttp3_ringbuf_resize(frq, 0);
+}
+
+static void delete_frq(nghttp3_ringbuf *frq, const nghttp3_mem *mem) {
+  clear_frq(frq, mem);
   nghttp3_ringbuf_free(frq);
 }
 
@@ -162,8 +211,8 @@ void nghttp3_stream_del(nghttp3_stream *stream) {
   }
 
   nghttp3_qpack_stream_context_free(&stream->qpack_sctx);
-  delete_chunks(&stream->inq, stream->mem);
-  delete_outq(&stream->outq, stream->mem);
+  delete_inq(&stream->inq, stream->inq_chunk_objalloc);
+  delete_outq(stream);
   delete_out_chunks(&stream->chunks, stream->out_chunk_objalloc, stream->mem);
   delete_frq(&stream->frq, stream->mem);
   nghttp3_tnode_free(&stream->node);
@@ -223,6 +272,10 @@ nghttp3_ssize nghttp3_read_varint(nghttp3_varint_read_state *rvint,
   return (nghttp3_ssize)len;
 }
 
+void nghttp3_stream_clear_frq(nghttp3_stream *stream) {
+  clear_frq(&stream->frq, stream->mem);
+}
+
 int nghttp3_stream_frq_emplace(nghttp3_stream *stream, nghttp3_frame **pfr) {
   nghttp3_ringbuf *frq = &stream->frq;
   int rv;
@@ -245,9 +298,15 @@ int nghttp3_stream_fill_outq(nghttp3_stream *stream) {
   nghttp3_frame *fr;
   int data_eof;
   int rv;
+  size_t watermark;
+
+  assert(stream->conn);
+
+  watermark = stream->conn->local.settings.unsent_bytes_watermark;
 
   for (; nghttp3_ringbuf_len(frq) &&
-         stream->unsent_bytes < NGHTTP3_MIN_UNSENT_BYTES;) {
+         stream->unsent_bytes <
+           nghttp3_max(NGHTTP3_MIN_UNSENT_BYTES, watermark);) {
     fr = nghttp3_ringbuf_get(frq, 0);
 
     switch (fr->hd.type) {
@@ -273,6 +332,11 @@ int nghttp3_stream_fill_outq(nghttp3_stream *stream) {
         return 0;
       }
       if (!data_eof) {
+        /* Keep reading body until unsent_bytes_watermark is
+           reached. */
+        if (stream->unsent_bytes < watermark) {
+          continue;
+        }
         return 0;
       }
       break;
@@ -307,6 +371,18 @@ int nghttp3_stream_fill_outq(nghttp3_stream *stream) {
   return 0;
 }
 
+/*
+ * stream_add_frame_sent_stats updates the counters of the connection
+ * which |stream| belongs to for a frame of type |type| whose payload
+ * length is |payloadlen|.
+ */
+static void stream_add_frame_sent_stats(nghttp3_stream *stream,
+                                        uint64_t type, uint64_t payloadlen) {
+  if (stream->conn) {
+    nghttp3_conn_add_frame_sent_stats(stream->conn, type, payloadlen);
+  }
+}
+
 int nghttp3_stream_write_stream_type(nghttp3_stream *stream) {
   size_t len = nghttp3_put_uvarintlen(stream->type);
   nghttp3_buf *chunk;
@@ -385,6 +461,8 @@ int nghttp3_stream_write_settings(nghttp3_stream *stream,
 
   chunk->last = nghttp3_frame_write_settings(chunk->last, &fr, payloadlen);
 
+  stream_add_frame_sent_stats(stream, NGHTTP3_FRAME_SETTINGS, payloadlen);
+
   tbuf.buf.last = chunk->last;
 
   return nghttp3_stream_outq_add(stream, &tbuf);
@@ -410,6 +488,8 @@ int nghttp3_stream_write_goaway(nghttp3_stream *stream,
 
   chunk->last = nghttp3_frame_write_goaway(chunk->last, fr, payloadlen);
 
+  stream_add_frame_sent_stats(stream, fr->type, payloadlen);
+
   tbuf.buf.last = chunk->last;
 
   return nghttp3_stream_outq_add(stream, &tbuf);
@@ -436,6 +516,8 @@ int nghttp3_stream_write_priority_update(
   chunk->last =
     nghttp3_frame_write_priority_update(chunk->last, fr, payloadlen);
 
+  stream_add_frame_sent_stats(stream, fr->type, payloadlen);
+
   tbuf.buf.last = chunk->last;
 
   return nghttp3_stream_outq_add(stream, &tbuf);
@@ -460,6 +542,8 @@ int nghttp3_stream_write_origin(nghttp3_stream *stream,
   chunk->last =
     nghttp3_frame_write_hd(chunk->last, fr->type, fr->origin_list.len);
 
+  stream_add_frame_sent_stats(stream, fr->type, fr->origin_list.len);
+
   tbuf.buf.last = chunk->last;
 
   rv = nghttp3_stream_outq_add(stream, &tbuf);
@@ -487,7 +571,7 @@ int nghttp3_stream_write_headers(nghttp3_stream *stream,
 
   return nghttp3_stream_write_header_block(
     stream, &conn->qenc, conn->tx.qenc, &conn->tx.qpack.rbuf,
-    &conn->tx.qpack.ebuf, NGHTTP3_FRAME_HEADERS, fr->nva, fr->nvlen);
+    &conn->tx.qpack.ebuf, NGHTTP3_FRAME_HEADERS, fr->nva, fr->nvlen, fr->pnva);
 }
 
 int nghttp3_stream_write_header_block(nghttp3_stream *stream,
@@ -495,7 +579,8 @@ int nghttp3_stream_write_header_block(nghttp3_stream *stream,
                                       nghttp3_stream *qenc_stream,
                                       nghttp3_buf *rbuf, nghttp3_buf *ebuf,
                                       uint64_t frame_type,
-                                      const nghttp3_nv *nva, size_t nvlen) {
+                                      const nghttp3_nv *nva, size_t nvlen,
+                                      const nghttp3_prepared_nva *pnva) {
   nghttp3_buf pbuf;
   int rv;
   size_t len;
@@ -507,8 +592,13 @@ int nghttp3_stream_write_header_block(nghttp3_stream *stream,
 
   nghttp3_buf_wrap_init(&pbuf, raw_pbuf, sizeof(raw_pbuf));
 
-  rv = nghttp3_qpack_encoder_encode(qenc, &pbuf, rbuf, ebuf, stream->node.id,
-                                    nva, nvlen);
+  if (pnva) {
+    rv = nghttp3_qpack_encoder_encode_prepared(qenc, &pbuf, rbuf, ebuf,
+                                               stream->node.id, pnva);
+  } else {
+    rv = nghttp3_qpack_encoder_encode(qenc, &pbuf, rbuf, ebuf, stream->node.id,
+                                      nva, nvlen);
+  }
   if (rv != 0) {
     return rv;
   }
@@ -535,6 +625,8 @@ int nghttp3_stream_write_header_block(nghttp3_stream *stream,
 
   chunk->last = nghttp3_frame_write_hd(chunk->last, frame_type, payloadlen);
 
+  stream_add_frame_sent_stats(stream, frame_type, payloadlen);
+
   chunk->last = nghttp3_cpymem(chunk->last, pbuf.pos, pbuflen);
   nghttp3_buf_init(&pbuf);
 
@@ -600,39 +692,48 @@ int nghttp3_stream_write_header_block(nghttp3_stream *stream,
   return 0;
 }
 
-int nghttp3_stream_write_data(nghttp3_stream *stream, int *peof,
-                              const nghttp3_frame_data *fr) {
+/*
+ * stream_release_data_bufs calls release callback of each buffer in
+ * |dbuf| of length |dbufcnt| if it is set.
+ */
+static void stream_release_data_bufs(nghttp3_stream *stream,
+                                     const nghttp3_data_buf *dbuf,
+                                     size_t dbufcnt) {
+  nghttp3_conn *conn = stream->conn;
+  size_t i;
+
+  for (i = 0; i < dbufcnt; ++i) {
+    if (dbuf[i].release) {
+      dbuf[i].release(conn, stream->node.id, dbuf[i].release_user_data,
+                      conn->user_data);
+    }
+  }
+}
+
+/*
+ * stream_write_vec writes DATA frame which contains |vec| of length
+ * |veccnt|.  If |dbuf| is not NULL, it must be of length |veccnt|,
+ * and each element corresponds to the one in |vec|.  |*pnowned| is
+ * set to the number of leading buffers in |dbuf| which have been
+ * either added to outq or released.  The caller is responsible for
+ * releasing the rest of them.
+ */
+static int stream_write_vec(nghttp3_stream *stream, int *peof,
+                            const nghttp3_vec *vec,
+                            const nghttp3_data_buf *dbuf, size_t veccnt,
+                            uint32_t flags, size_t *pnowned) {
   int rv;
   size_t len;
   nghttp3_typed_buf tbuf;
   nghttp3_buf buf;
   nghttp3_buf *chunk;
-  nghttp3_read_data_callback read_data = fr->dr.read_data;
-  nghttp3_conn *conn = stream->conn;
   uint64_t datalen;
-  uint32_t flags = 0;
-  nghttp3_vec vec[8];
-  nghttp3_vec *v;
-  nghttp3_ssize sveccnt;
+  const nghttp3_vec *v;
   size_t i;
 
-  assert(!(stream->flags & NGHTTP3_STREAM_FLAG_READ_DATA_BLOCKED));
-  assert(read_data);
-  assert(conn);
-
-  *peof = 0;
-
-  sveccnt = read_data(conn, stream->node.id, vec, nghttp3_arraylen(vec), &flags,
-                      conn->user_data, stream->user_data);
-  if (sveccnt < 0) {
-    if (sveccnt == NGHTTP3_ERR_WOULDBLOCK) {
-      stream->flags |= NGHTTP3_STREAM_FLAG_READ_DATA_BLOCKED;
-      return 0;
-    }
-    return NGHTTP3_ERR_CALLBACK_FAILURE;
-  }
+  *pnowned = 0;
 
-  rv = nghttp3_vec_len_uvarint(&datalen, vec, (size_t)sveccnt);
+  rv = nghttp3_vec_len_uvarint(&datalen, vec, veccnt);
   if (rv == -1) {
     return NGHTTP3_ERR_STREAM_DATA_OVERFLOW;
   }
@@ -677,6 +778,8 @@ int nghttp3_stream_write_data(nghttp3_stream *stream, int *peof,
   chunk->last =
     nghttp3_frame_write_hd(chunk->last, NGHTTP3_FRAME_DATA, datalen);
 
+  stream_add_frame_sent_stats(stream, NGHTTP3_FRAME_DATA, datalen);
+
   tbuf.buf.last = chunk->last;
 
   rv = nghttp3_stream_outq_add(stream, &tbuf);
@@ -686,21 +789,240 @@ int nghttp3_stream_write_data(nghttp3_stream *stream, int *peof,
 
   assert(datalen);
 
-  for (i = 0; i < (size_t)sveccnt; ++i) {
+  for (i = 0; i < veccnt; ++i) {
     v = &vec[i];
     if (v->len == 0) {
+      if (dbuf) {
+        stream_release_data_bufs(stream, &dbuf[i], 1);
+        *pnowned = i + 1;
+      }
       continue;
     }
     nghttp3_buf_wrap_init(&buf, v->base, v->len);
     buf.last = buf.end;
-    nghttp3_typed_buf_init(&tbuf, &buf, NGHTTP3_BUF_TYPE_ALIEN);
+
+    if (dbuf && dbuf[i].release) {
+      nghttp3_typed_buf_init(&tbuf, &buf, NGHTTP3_BUF_TYPE_ALIEN_RELEASE);
+      tbuf.release = dbuf[i].release;
+      tbuf.release_user_data = dbuf[i].release_user_data;
+    } else {
+      nghttp3_typed_buf_init(&tbuf, &buf, NGHTTP3_BUF_TYPE_ALIEN);
+    }
+
     rv = nghttp3_stream_outq_add(stream, &tbuf);
     if (rv != 0) {
       return rv;
     }
+
+    *pnowned = i + 1;
+  }
+
+  return 0;
+}
+
+#ifdef HAVE_PREAD
+/*
+ * stream_write_fd reads at most NGHTTP3_STREAM_FILE_CHUNK_SIZE bytes
+ * from the file range |dfd|, and writes DATA frame which contains
+ * them.  |dfd| is advanced by the number of bytes read.
+ *
+ * This function returns 0 if it succeeds, or one of the following
+ * negative error codes:
+ *
+ * NGHTTP3_ERR_H3_INTERNAL_ERROR
+ *     pread failed, or the file ended before the end of the range.
+ * NGHTTP3_ERR_NOMEM
+ *     Out of memory.
+ */
+static int stream_write_fd(nghttp3_stream *stream, int *peof,
+                           nghttp3_data_fd *dfd) {
+  nghttp3_objalloc *objalloc = &stream->conn->pool->file_chunk_objalloc;
+  nghttp3_typed_buf tbuf;
+  nghttp3_buf buf;
+  nghttp3_buf *chunk;
+  uint8_t *p;
+  size_t n, len;
+  ssize_t nread;
+  int rv;
+
+  assert(dfd->len);
+
+  n = (size_t)nghttp3_min(dfd->len, NGHTTP3_STREAM_FILE_CHUNK_SIZE);
+
+  p = (uint8_t *)nghttp3_objalloc_chunk_len_get(objalloc,
+                                                NGHTTP3_STREAM_FILE_CHUNK_SIZE);
+  if (p == NULL) {
+    return NGHTTP3_ERR_NOMEM;
+  }
+
+  do {
+    nread = pread(dfd->fd, p, n, (off_t)dfd->offset);
+  } while (nread == -1 && errno == EINTR);
+
+  if (nread <= 0) {
+    rv = NGHTTP3_ERR_H3_INTERNAL_ERROR;
+    goto fail;
+  }
+
+  len = nghttp3_frame_write_hd_len(NGHTTP3_FRAME_DATA, (uint64_t)nread);
+
+  rv = nghttp3_stream_ensure_chunk(stream, len);
+  if (rv != 0) {
+    goto fail;
+  }
+
+  chunk = nghttp3_stream_get_chunk(stream);
+  nghttp3_typed_buf_shared_init(&tbuf, chunk);
+
+  chunk->last =
+    nghttp3_frame_write_hd(chunk->last, NGHTTP3_FRAME_DATA, (uint64_t)nread);
+
+  stream_add_frame_sent_stats(stream, NGHTTP3_FRAME_DATA, (uint64_t)nread);
+
+  tbuf.buf.last = chunk->last;
+
+  rv = nghttp3_stream_outq_add(stream, &tbuf);
+  if (rv != 0) {
+    goto fail;
+  }
+
+  nghttp3_buf_wrap_init(&buf, p, (size_t)nread);
+  buf.last = buf.end;
+  nghttp3_typed_buf_init(&tbuf, &buf, NGHTTP3_BUF_TYPE_FILE);
+
+  rv = nghttp3_stream_outq_add(stream, &tbuf);
+  if (rv != 0) {
+    goto fail;
+  }
+
+  dfd->offset += (uint64_t)nread;
+  dfd->len -= (uint64_t)nread;
+
+  if (dfd->len == 0) {
+    *peof = 1;
+    stream->flags |= NGHTTP3_STREAM_FLAG_WRITE_END_STREAM;
   }
 
   return 0;
+
+fail:
+  nghttp3_objalloc_chunk_release(objalloc, (void *)p);
+
+  return rv;
+}
+#endif /* defined(HAVE_PREAD) */
+
+int nghttp3_stream_write_data(nghttp3_stream *stream, int *peof,
+                              nghttp3_frame_data *fr) {
+  int rv;
+  nghttp3_conn *conn = stream->conn;
+  uint32_t flags;
+  nghttp3_vec *vec;
+  nghttp3_data_buf *dbuf;
+  size_t veccnt, n = 0;
+  uint64_t coalesce_size, gathered = 0, prev_gathered;
+  nghttp3_ssize sveccnt;
+  size_t i, nowned;
+
+  assert(!(stream->flags & NGHTTP3_STREAM_FLAG_READ_DATA_BLOCKED));
+  assert(fr->dr.read_data || fr->read_data_buf || fr->use_fd);
+  assert(conn);
+
+  *peof = 0;
+
+  if (fr->use_fd) {
+#ifdef HAVE_PREAD
+    return stream_write_fd(stream, peof, &fr->fd);
+#else  /* !defined(HAVE_PREAD) */
+    nghttp3_unreachable();
+#endif /* !defined(HAVE_PREAD) */
+  }
+
+  veccnt = conn->local.settings.read_data_veccnt;
+  coalesce_size = conn->local.settings.data_coalesce_size;
+
+  if (conn->tx.data_vec == NULL) {
+    conn->tx.data_vec = nghttp3_mem_malloc(
+      stream->mem, veccnt * (sizeof(nghttp3_vec) + sizeof(nghttp3_data_buf)));
+    if (conn->tx.data_vec == NULL) {
+      return NGHTTP3_ERR_NOMEM;
+    }
+
+    conn->tx.data_buf = (nghttp3_data_buf *)(conn->tx.data_vec + veccnt);
+  }
+
+  vec = conn->tx.data_vec;
+  dbuf = conn->tx.data_buf;
+
+  /* If data_coalesce_size is nonzero, keep reading body into the
+     rest of the arrays so that the small pieces are sent in a single
+     DATA frame. */
+  for (;;) {
+    flags = 0;
+
+    if (fr->read_data_buf) {
+      sveccnt = fr->read_data_buf(conn, stream->node.id, dbuf + n, veccnt - n,
+                                  &flags, conn->user_data, stream->user_data);
+    } else {
+      sveccnt =
+        fr->dr.read_data(conn, stream->node.id, vec + n, veccnt - n, &flags,
+                         conn->user_data, stream->user_data);
+    }
+    if (sveccnt < 0) {
+      if (sveccnt == NGHTTP3_ERR_WOULDBLOCK) {
+        stream->flags |= NGHTTP3_STREAM_FLAG_READ_DATA_BLOCKED;
+        if (n == 0) {
+          return 0;
+        }
+
+        /* Send what we have gathered so far. */
+        flags = 0;
+
+        break;
+      }
+
+      if (fr->read_data_buf) {
+        stream_release_data_bufs(stream, dbuf, n);
+      }
+
+      return NGHTTP3_ERR_CALLBACK_FAILURE;
+    }
+
+    assert((size_t)sveccnt <= veccnt - n);
+
+    prev_gathered = gathered;
+
+    for (i = n; i < n + (size_t)sveccnt; ++i) {
+      if (fr->read_data_buf) {
+        vec[i] = (nghttp3_vec){
+          .base = dbuf[i].base,
+          .len = dbuf[i].len,
+        };
+      }
+
+      gathered += vec[i].len;
+    }
+
+    n += (size_t)sveccnt;
+
+    /* Stop if the callback provides no data, otherwise it would be
+       called forever. */
+    if (coalesce_size == 0 || gathered == prev_gathered ||
+        gathered >= coalesce_size || n == veccnt ||
+        (flags & (NGHTTP3_DATA_FLAG_EOF | NGHTTP3_DATA_FLAG_FLUSH))) {
+      break;
+    }
+  }
+
+  if (!fr->read_data_buf) {
+    return stream_write_vec(stream, peof, vec, NULL, n, flags, &nowned);
+  }
+
+  rv = stream_write_vec(stream, peof, vec, dbuf, n, flags, &nowned);
+
+  stream_release_data_bufs(stream, dbuf + nowned, n - nowned);
+
+  return rv;
 }
 
 int nghttp3_stream_write_qpack_decoder_stream(nghttp3_stream *stream) {
@@ -928,6 +1250,12 @@ static void stream_pop_outq_entry(nghttp3_stream *stream,
   case NGHTTP3_BUF_TYPE_ALIEN:
   case NGHTTP3_BUF_TYPE_ALIEN_NO_ACK:
     break;
+  case NGHTTP3_BUF_TYPE_ALIEN_RELEASE:
+    stream_release_tbuf(stream, tbuf);
+    break;
+  case NGHTTP3_BUF_TYPE_FILE:
+    stream_release_file_chunk(stream, tbuf);
+    break;
   case NGHTTP3_BUF_TYPE_SHARED:
     assert(nghttp3_ringbuf_len(chunks));
 
@@ -963,9 +1291,12 @@ int nghttp3_stream_update_ack_offset(nghttp3_stream *stream, uint64_t offset) {
     tbuf = nghttp3_ringbuf_get(outq, 0);
     buflen = (size_t)(tbuf->buf.last - tbuf->buf.begin);
 
-    /* For NGHTTP3_BUF_TYPE_ALIEN, we never add 0 length buffer. */
-    if (tbuf->type == NGHTTP3_BUF_TYPE_ALIEN && stream->ack_offset < offset &&
-        stream->callbacks.acked_data) {
+    /* For NGHTTP3_BUF_TYPE_ALIEN and NGHTTP3_BUF_TYPE_ALIEN_RELEASE,
+       we never add 0 length buffer.  NGHTTP3_BUF_TYPE_FILE is owned
+       by the library, and is not reported. */
+    if ((tbuf->type == NGHTTP3_BUF_TYPE_ALIEN ||
+         tbuf->type == NGHTTP3_BUF_TYPE_ALIEN_RELEASE) &&
+        stream->ack_offset < offset && stream->callbacks.acked_data) {
       nack =
         nghttp3_min(offset, stream->ack_base + buflen) - stream->ack_offset;
 
@@ -1024,13 +1355,14 @@ int nghttp3_stream_buffer_data(nghttp3_stream *stream, const uint8_t *data,
       }
     }
 
-    rawbuf = nghttp3_mem_malloc(stream->mem, 16384);
+    rawbuf = (uint8_t *)nghttp3_objalloc_chunk_len_get(
+      stream->inq_chunk_objalloc, NGHTTP3_STREAM_INQ_CHUNK_SIZE);
     if (rawbuf == NULL) {
       return NGHTTP3_ERR_NOMEM;
     }
 
     buf = nghttp3_ringbuf_push_back(inq);
-    nghttp3_buf_wrap_init(buf, rawbuf, 16384);
+    nghttp3_buf_wrap_init(buf, rawbuf, NGHTTP3_STREAM_INQ_CHUNK_SIZE);
     bufleft = nghttp3_buf_left(buf);
     nwrite = nghttp3_min(datalen, bufleft);
     buf->last = nghttp3_cpymem(buf->last, data, nwrite);
@@ -1041,6 +1373,14 @@ int nghttp3_stream_buffer_data(nghttp3_stream *stream, const uint8_t *data,
   return 0;
 }
 
+void nghttp3_stream_pop_inq(nghttp3_stream *stream) {
+  nghttp3_buf *buf = nghttp3_ringbuf_get(&stream->inq, 0);
+
+  nghttp3_objalloc_chunk_release(stream->inq_chunk_objalloc,
+                                 (void *)buf->begin);
+  nghttp3_ringbuf_pop_front(&stream->inq);
+}
+
 size_t nghttp3_stream_get_buffered_datalen(nghttp3_stream *stream) {
   nghttp3_ringbuf *inq = &stream->inq;
   size_t len = nghttp3_ringbuf_len(inq);
@@ -1055,6 +1395,62 @@ size_t nghttp3_stream_get_buffered_datalen(nghttp3_stream *stream) {
   return n;
 }
 
+uint64_t nghttp3_stream_get_unacked_outq_len(nghttp3_stream *stream) {
+  nghttp3_ringbuf *outq = &stream->outq;
+  size_t len = nghttp3_ringbuf_len(outq);
+  size_t i;
+  uint64_t n = 0, nacked;
+  nghttp3_typed_buf *tbuf;
+
+  for (i = 0; i < len; ++i) {
+    tbuf = nghttp3_ringbuf_get(outq, i);
+    n += (uint64_t)(tbuf->buf.last - tbuf->buf.begin);
+  }
+
+  nacked = stream->ack_offset - stream->ack_base;
+
+  return n > nacked ? n - nacked : 0;
+}
+
+void nghttp3_stream_shrink(nghttp3_stream *stream) {
+  nghttp3_ringbuf_shrink(&stream->frq);
+  nghttp3_ringbuf_shrink(&stream->chunks);
+  nghttp3_ringbuf_shrink(&stream->outq);
+  nghttp3_ringbuf_shrink(&stream->inq);
+}
+
+void nghttp3_stream_add_mem_usage(nghttp3_stream *stream,
+                                  nghttp3_conn_mem_usage *dest) {
+  nghttp3_buf *buf;
+  nghttp3_typed_buf *tbuf;
+  size_t i, len;
+
+  dest->stream_inq += nghttp3_ringbuf_get_memusage(&stream->inq);
+
+  dest->stream_outq += nghttp3_ringbuf_get_memusage(&stream->outq) +
+                       nghttp3_ringbuf_get_memusage(&stream->frq);
+
+  len = nghttp3_ringbuf_len(&stream->outq);
+
+  for (i = 0; i < len; ++i) {
+    tbuf = nghttp3_ringbuf_get(&stream->outq, i);
+    if (tbuf->type == NGHTTP3_BUF_TYPE_PRIVATE) {
+      dest->stream_outq += nghttp3_buf_cap(&tbuf->buf);
+    }
+  }
+
+  dest->stream_chunks += nghttp3_ringbuf_get_memusage(&stream->chunks);
+
+  len = nghttp3_ringbuf_len(&stream->chunks);
+
+  for (i = 0; i < len; ++i) {
+    buf = nghttp3_ringbuf_get(&stream->chunks, i);
+    if (nghttp3_buf_cap(buf) != NGHTTP3_STREAM_MIN_CHUNK_SIZE) {
+      dest->stream_chunks += nghttp3_buf_cap(buf);
+    }
+  }
+}
+
 int nghttp3_stream_transit_rx_http_state(nghttp3_stream *stream,
                                          nghttp3_stream_http_event event) {
   int rv;
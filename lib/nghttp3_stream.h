@@ -41,6 +41,16 @@
 
 #define NGHTTP3_STREAM_MIN_CHUNK_SIZE 256
 
+/* NGHTTP3_STREAM_FILE_CHUNK_SIZE is the maximum number of bytes read
+   from a file descriptor at once, which is also the size of a buffer
+   holding them. */
+#define NGHTTP3_STREAM_FILE_CHUNK_SIZE 16384
+
+/* NGHTTP3_STREAM_INQ_CHUNK_SIZE is the size of a buffer which holds
+   the stream data received while the stream is blocked by QPACK
+   decoder. */
+#define NGHTTP3_STREAM_INQ_CHUNK_SIZE 4096
+
 /* NGHTTP3_MIN_UNSENT_BYTES is the minimum unsent bytes which is large
    enough to fill outgoing single QUIC packet. */
 #define NGHTTP3_MIN_UNSENT_BYTES 4096
@@ -197,6 +207,9 @@ struct nghttp3_stream {
     struct {
       const nghttp3_mem *mem;
       nghttp3_objalloc *out_chunk_objalloc;
+      /* inq_chunk_objalloc allocates the buffers of
+         NGHTTP3_STREAM_INQ_CHUNK_SIZE bytes stored in inq. */
+      nghttp3_objalloc *inq_chunk_objalloc;
       nghttp3_objalloc *stream_objalloc;
       nghttp3_tnode node;
       nghttp3_pq_entry qpack_blocked_pe;
@@ -223,6 +236,9 @@ struct nghttp3_stream {
          endpoint so far. */
       uint64_t ack_offset;
       uint64_t unscheduled_nwrite;
+      /* qpack_blocked_ts is the timestamp when this stream was last
+         blocked by QPACK decoder. */
+      nghttp3_tstamp qpack_blocked_ts;
       nghttp3_stream_type type;
       nghttp3_stream_read_state rstate;
       /* error_code indicates the reason of closure of this stream. */
@@ -249,6 +265,7 @@ nghttp3_objalloc_decl(stream, nghttp3_stream, oplent)
 int nghttp3_stream_new(nghttp3_stream **pstream, int64_t stream_id,
                        const nghttp3_stream_callbacks *callbacks,
                        nghttp3_objalloc *out_chunk_objalloc,
+                       nghttp3_objalloc *inq_chunk_objalloc,
                        nghttp3_objalloc *stream_objalloc,
                        const nghttp3_mem *mem);
 
@@ -262,6 +279,12 @@ nghttp3_ssize nghttp3_read_varint(nghttp3_varint_read_state *rvint,
                                   const uint8_t *begin, const uint8_t *end,
                                   int fin);
 
+/*
+ * nghttp3_stream_clear_frq removes all frames which have not been
+ * written yet from |stream|.
+ */
+void nghttp3_stream_clear_frq(nghttp3_stream *stream);
+
 /*
  * nghttp3_stream_frq_emplace adds new space for nghttp3_frame to
  * stream->frq, and assigns the pointer to the space to |*pfr| if it
@@ -295,10 +318,11 @@ int nghttp3_stream_write_header_block(nghttp3_stream *stream,
                                       nghttp3_stream *qenc_stream,
                                       nghttp3_buf *rbuf, nghttp3_buf *ebuf,
                                       uint64_t frame_type,
-                                      const nghttp3_nv *nva, size_t nvlen);
+                                      const nghttp3_nv *nva, size_t nvlen,
+                                      const nghttp3_prepared_nva *pnva);
 
 int nghttp3_stream_write_data(nghttp3_stream *stream, int *peof,
-                              const nghttp3_frame_data *fr);
+                              nghttp3_frame_data *fr);
 
 int nghttp3_stream_write_settings(nghttp3_stream *stream,
                                   const nghttp3_frame_settings *fr);
@@ -346,11 +370,48 @@ int nghttp3_stream_is_active(nghttp3_stream *stream);
  */
 int nghttp3_stream_require_schedule(const nghttp3_stream *stream);
 
+/*
+ * nghttp3_stream_buffer_data appends |srclen| bytes pointed by |src|
+ * to inq.  The buffers are allocated from inq_chunk_objalloc.
+ *
+ * This function returns 0 if it succeeds, or one of the following
+ * negative error codes:
+ *
+ * NGHTTP3_ERR_NOMEM
+ *     Out of memory
+ */
 int nghttp3_stream_buffer_data(nghttp3_stream *stream, const uint8_t *src,
                                size_t srclen);
 
+/*
+ * nghttp3_stream_pop_inq removes the first buffer from inq, and
+ * returns it to inq_chunk_objalloc.
+ */
+void nghttp3_stream_pop_inq(nghttp3_stream *stream);
+
 size_t nghttp3_stream_get_buffered_datalen(nghttp3_stream *stream);
 
+/*
+ * nghttp3_stream_get_unacked_outq_len returns the number of bytes in
+ * outq which are not acknowledged yet.
+ */
+uint64_t nghttp3_stream_get_unacked_outq_len(nghttp3_stream *stream);
+
+/*
+ * nghttp3_stream_shrink frees the buffers of the empty queues of
+ * |stream|.  They are allocated again when needed.
+ */
+void nghttp3_stream_shrink(nghttp3_stream *stream);
+
+/*
+ * nghttp3_stream_add_mem_usage adds the number of bytes held by the
+ * buffers of |stream| to the corresponding fields of |dest|.  The
+ * stream object itself and the chunks allocated from
+ * out_chunk_objalloc and inq_chunk_objalloc are not counted.
+ */
+void nghttp3_stream_add_mem_usage(nghttp3_stream *stream,
+                                  nghttp3_conn_mem_usage *dest);
+
 int nghttp3_stream_ensure_qpack_stream_context(nghttp3_stream *stream);
 
 void nghttp3_stream_delete_qpack_stream_context(nghttp3_stream *stream);
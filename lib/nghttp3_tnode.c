@@ -33,7 +33,6 @@
 
 void nghttp3_tnode_init(nghttp3_tnode *tnode, int64_t id) {
   *tnode = (nghttp3_tnode){
-    .pe.index = NGHTTP3_PQ_BAD_INDEX,
     .id = id,
     .pri.urgency = NGHTTP3_DEFAULT_URGENCY,
   };
@@ -41,55 +40,329 @@ void nghttp3_tnode_init(nghttp3_tnode *tnode, int64_t id) {
 
 void nghttp3_tnode_free(nghttp3_tnode *tnode) { (void)tnode; }
 
-static void tnode_unschedule(nghttp3_tnode *tnode, nghttp3_pq *pq) {
-  assert(tnode->pe.index != NGHTTP3_PQ_BAD_INDEX);
+#define NGHTTP3_TNODE_QUEUE_MASK (NGHTTP3_TNODE_QUEUE_NBUCKETS - 1)
 
-  nghttp3_pq_remove(pq, &tnode->pe);
-  tnode->pe.index = NGHTTP3_PQ_BAD_INDEX;
+void nghttp3_tnode_queue_init(nghttp3_tnode_queue *q, const nghttp3_mem *mem) {
+  *q = (nghttp3_tnode_queue){
+    .mem = mem,
+  };
+}
+
+void nghttp3_tnode_queue_free(nghttp3_tnode_queue *q) {
+  nghttp3_mem_free(q->mem, q->buckets);
+}
+
+void nghttp3_tnode_queue_shrink(nghttp3_tnode_queue *q) {
+  if (q->size) {
+    return;
+  }
+
+  nghttp3_mem_free(q->mem, q->buckets);
+  q->buckets = NULL;
+}
+
+/*
+ * tnode_heap_link makes the root of the pairing heap |a| or |b| whose
+ * id is larger the first child of the other, and returns the other.
+ */
+static nghttp3_tnode *tnode_heap_link(nghttp3_tnode *a, nghttp3_tnode *b) {
+  nghttp3_tnode *t;
+
+  if (b->id < a->id) {
+    t = a;
+    a = b;
+    b = t;
+  }
+
+  b->prev = a;
+  b->next = a->child;
+
+  if (a->child) {
+    a->child->prev = b;
+  }
+
+  a->child = b;
+
+  return a;
+}
+
+/*
+ * tnode_heap_merge_pairs merges the pairing heaps in the list of
+ * siblings starting at |first| into one, and returns its root.  It
+ * links the heaps in pairs from left to right, and then links the
+ * results from right to left.  This is where the nodes pushed out of
+ * the order of id are actually sorted.
+ */
+static nghttp3_tnode *tnode_heap_merge_pairs(nghttp3_tnode *first) {
+  nghttp3_tnode *a, *b, *stack = NULL;
+
+  if (first == NULL) {
+    return NULL;
+  }
+
+  /* The first pass keeps the linked pairs in stack in the reverse
+     order through next field. */
+  while (first) {
+    a = first;
+    b = a->next;
+
+    if (b == NULL) {
+      a->next = stack;
+      stack = a;
+
+      break;
+    }
+
+    first = b->next;
+
+    a = tnode_heap_link(a, b);
+    a->next = stack;
+    stack = a;
+  }
+
+  a = stack;
+  stack = stack->next;
+
+  while (stack) {
+    b = stack;
+    stack = stack->next;
+
+    a = tnode_heap_link(a, b);
+  }
+
+  a->prev = a->next = NULL;
+
+  return a;
+}
+
+/*
+ * tnode_heap_push pushes |tnode| to the pairing heap of |b|.
+ */
+static void tnode_heap_push(nghttp3_tnode_bucket *b, nghttp3_tnode *tnode) {
+  tnode->prev = tnode->next = tnode->child = NULL;
+
+  if (b->heap == NULL) {
+    b->heap = tnode;
+  } else {
+    b->heap = tnode_heap_link(b->heap, tnode);
+    b->heap->prev = b->heap->next = NULL;
+  }
+
+  tnode->in_heap = 1;
+}
+
+/*
+ * tnode_heap_remove removes |tnode| from the pairing heap of |b|.
+ */
+static void tnode_heap_remove(nghttp3_tnode_bucket *b, nghttp3_tnode *tnode) {
+  nghttp3_tnode *sub;
+
+  if (b->heap == tnode) {
+    b->heap = tnode_heap_merge_pairs(tnode->child);
+  } else {
+    /* Detach the subtree rooted at tnode from its parent or its
+       previous sibling. */
+    if (tnode->prev->child == tnode) {
+      tnode->prev->child = tnode->next;
+    } else {
+      tnode->prev->next = tnode->next;
+    }
+
+    if (tnode->next) {
+      tnode->next->prev = tnode->prev;
+    }
+
+    sub = tnode_heap_merge_pairs(tnode->child);
+    if (sub) {
+      b->heap = tnode_heap_link(b->heap, sub);
+    }
+  }
+
+  tnode->child = NULL;
+  tnode->in_heap = 0;
+}
+
+/*
+ * ctz64 returns the number of trailing zero bits in |n|.  |n| must
+ * not be 0.
+ */
+static size_t ctz64(uint64_t n) {
+#ifndef WIN32
+  return (size_t)__builtin_ctzll(n);
+#else  /* defined(WIN32) */
+  size_t i = 0;
+
+  for (; !(n & 1); n >>= 1, ++i)
+    ;
+
+  return i;
+#endif /* defined(WIN32) */
+}
+
+nghttp3_tnode *nghttp3_tnode_queue_top(nghttp3_tnode_queue *q) {
+  size_t k, d;
+  uint64_t rot;
+  nghttp3_tnode_bucket *b;
+
+  if (q->size == 0) {
+    return NULL;
+  }
+
+  /* Rotate the bitmap so that bit 0 corresponds to base, and skip
+     the empty buckets. */
+  k = (size_t)(q->base & NGHTTP3_TNODE_QUEUE_MASK);
+  rot = k ? (q->nonempty >> k) | (q->nonempty << (64 - k)) : q->nonempty;
+  d = ctz64(rot);
+
+  q->base += d;
+
+  b = &q->buckets[(k + d) & NGHTTP3_TNODE_QUEUE_MASK];
+
+  if (b->heap == NULL) {
+    return b->head;
+  }
+
+  if (b->head == NULL || b->heap->id < b->head->id) {
+    return b->heap;
+  }
+
+  return b->head;
+}
+
+int nghttp3_tnode_queue_push(nghttp3_tnode_queue *q, nghttp3_tnode *tnode) {
+  nghttp3_tnode_bucket *b;
+  nghttp3_tnode *head;
+  size_t idx;
+
+  assert(!tnode->scheduled);
+
+  if (q->size == 0) {
+    if (q->buckets == NULL) {
+      q->buckets = nghttp3_mem_calloc(q->mem, NGHTTP3_TNODE_QUEUE_NBUCKETS,
+                                      sizeof(q->buckets[0]));
+      if (q->buckets == NULL) {
+        return NGHTTP3_ERR_NOMEM;
+      }
+    }
+
+    q->base = tnode->cycle;
+  } else if (tnode->cycle < q->base) {
+    tnode->cycle = q->base;
+  } else if (tnode->cycle - q->base >= NGHTTP3_TNODE_QUEUE_NBUCKETS) {
+    /* Advance base to the lowest cycle before clamping */
+    nghttp3_tnode_queue_top(q);
+
+    tnode->cycle =
+      nghttp3_min(tnode->cycle, q->base + NGHTTP3_TNODE_QUEUE_NBUCKETS - 1);
+  }
+
+  idx = (size_t)(tnode->cycle & NGHTTP3_TNODE_QUEUE_MASK);
+  b = &q->buckets[idx];
+  head = b->head;
+
+  if (head == NULL) {
+    tnode->prev = tnode->next = tnode;
+    b->head = tnode;
+  } else if (head->prev->id < tnode->id || tnode->id < head->id) {
+    tnode->prev = head->prev;
+    tnode->next = head;
+    head->prev->next = tnode;
+    head->prev = tnode;
+
+    if (tnode->id < head->id) {
+      b->head = tnode;
+    }
+  } else {
+    /* Keep the list sorted without walking it. */
+    tnode_heap_push(b, tnode);
+  }
+
+  q->nonempty |= 1ULL << idx;
+  tnode->scheduled = 1;
+  ++q->size;
+
+  return 0;
+}
+
+void nghttp3_tnode_queue_remove(nghttp3_tnode_queue *q, nghttp3_tnode *tnode) {
+  size_t idx = (size_t)(tnode->cycle & NGHTTP3_TNODE_QUEUE_MASK);
+  nghttp3_tnode_bucket *b = &q->buckets[idx];
+
+  assert(tnode->scheduled);
+  assert(q->size);
+
+  if (tnode->in_heap) {
+    tnode_heap_remove(b, tnode);
+  } else if (tnode->next == tnode) {
+    assert(b->head == tnode);
+
+    b->head = NULL;
+  } else {
+    tnode->prev->next = tnode->next;
+    tnode->next->prev = tnode->prev;
+
+    if (b->head == tnode) {
+      b->head = tnode->next;
+    }
+  }
+
+  if (b->head == NULL && b->heap == NULL) {
+    q->nonempty &= ~(1ULL << idx);
+  }
+
+  tnode->prev = tnode->next = NULL;
+  tnode->scheduled = 0;
+  --q->size;
+}
+
+int nghttp3_tnode_queue_empty(const nghttp3_tnode_queue *q) {
+  return q->size == 0;
+}
+
+size_t nghttp3_tnode_queue_size(const nghttp3_tnode_queue *q) {
+  return q->size;
 }
 
-void nghttp3_tnode_unschedule(nghttp3_tnode *tnode, nghttp3_pq *pq) {
-  if (tnode->pe.index == NGHTTP3_PQ_BAD_INDEX) {
+void nghttp3_tnode_unschedule(nghttp3_tnode *tnode, nghttp3_tnode_queue *q) {
+  if (!tnode->scheduled) {
     return;
   }
 
-  tnode_unschedule(tnode, pq);
+  nghttp3_tnode_queue_remove(q, tnode);
 }
 
-static uint64_t pq_get_first_cycle(const nghttp3_pq *pq) {
-  nghttp3_tnode *top;
+static uint64_t queue_get_first_cycle(nghttp3_tnode_queue *q) {
+  nghttp3_tnode *top = nghttp3_tnode_queue_top(q);
 
-  if (nghttp3_pq_empty(pq)) {
+  if (top == NULL) {
     return 0;
   }
 
-  top = nghttp3_struct_of(nghttp3_pq_top(pq), nghttp3_tnode, pe);
   return top->cycle;
 }
 
-int nghttp3_tnode_schedule(nghttp3_tnode *tnode, nghttp3_pq *pq,
+int nghttp3_tnode_schedule(nghttp3_tnode *tnode, nghttp3_tnode_queue *q,
                            uint64_t nwrite) {
   uint64_t penalty = nwrite / NGHTTP3_STREAM_MIN_WRITELEN;
 
-  if (tnode->pe.index == NGHTTP3_PQ_BAD_INDEX) {
+  if (!tnode->scheduled) {
     tnode->cycle =
-      pq_get_first_cycle(pq) +
+      queue_get_first_cycle(q) +
       ((nwrite == 0 || !tnode->pri.inc) ? 0 : nghttp3_max(1, penalty));
   } else if (nwrite > 0) {
-    if (!tnode->pri.inc || nghttp3_pq_size(pq) == 1) {
+    if (!tnode->pri.inc || q->size == 1) {
       return 0;
     }
 
-    nghttp3_pq_remove(pq, &tnode->pe);
-    tnode->pe.index = NGHTTP3_PQ_BAD_INDEX;
+    nghttp3_tnode_queue_remove(q, tnode);
     tnode->cycle += nghttp3_max(1, penalty);
   } else {
     return 0;
   }
 
-  return nghttp3_pq_push(pq, &tnode->pe);
+  return nghttp3_tnode_queue_push(q, tnode);
 }
 
 int nghttp3_tnode_is_scheduled(const nghttp3_tnode *tnode) {
-  return tnode->pe.index != NGHTTP3_PQ_BAD_INDEX;
+  return tnode->scheduled;
 }
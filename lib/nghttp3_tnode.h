@@ -31,29 +31,140 @@
 
 #include <nghttp3/nghttp3.h>
 
-#include "nghttp3_pq.h"
+#include "nghttp3_mem.h"
 
-#define NGHTTP3_TNODE_MAX_CYCLE_GAP (1ULL << 24)
+/* NGHTTP3_TNODE_QUEUE_NBUCKETS is the number of buckets in
+   nghttp3_tnode_queue.  It must be 64 because nonempty field is a
+   bitmap of buckets.  It also bounds the distance between the
+   cycles of the nodes in a queue. */
+#define NGHTTP3_TNODE_QUEUE_NBUCKETS 64
 
-typedef struct nghttp3_tnode {
-  nghttp3_pq_entry pe;
+typedef struct nghttp3_tnode nghttp3_tnode;
+
+struct nghttp3_tnode {
+  /* prev and next link this node in the sorted list of a bucket of
+     nghttp3_tnode_queue.  If this node is in the pairing heap of a
+     bucket, next is the next sibling, and prev is the previous
+     sibling, or the parent if this node is the first child. */
+  nghttp3_tnode *prev, *next;
+  /* child is the first child of this node in the pairing heap. */
+  nghttp3_tnode *child;
   int64_t id;
   uint64_t cycle;
   nghttp3_pri pri;
-} nghttp3_tnode;
+  /* scheduled is nonzero if this node is in nghttp3_tnode_queue. */
+  uint8_t scheduled;
+  /* in_heap is nonzero if this node is in the pairing heap of a
+     bucket instead of its sorted list. */
+  uint8_t in_heap;
+};
 
 void nghttp3_tnode_init(nghttp3_tnode *tnode, int64_t id);
 
 void nghttp3_tnode_free(nghttp3_tnode *tnode);
 
-void nghttp3_tnode_unschedule(nghttp3_tnode *tnode, nghttp3_pq *pq);
+/* nghttp3_tnode_bucket is a bucket of nghttp3_tnode_queue. */
+typedef struct nghttp3_tnode_bucket {
+  /* head is the node of the lowest id in the circular list of the
+     nodes which have been pushed in the order of id.  It is NULL if
+     the list is empty. */
+  nghttp3_tnode *head;
+  /* heap is the root of the pairing heap of the nodes which have
+     been pushed out of the order of id.  It is NULL if the heap is
+     empty. */
+  nghttp3_tnode *heap;
+} nghttp3_tnode_bucket;
+
+/*
+ * nghttp3_tnode_queue is a calendar queue of nghttp3_tnode ordered by
+ * cycle, and then by id.  Nodes of the same cycle share a bucket.  A
+ * node whose id is larger or smaller than any other node in the
+ * sorted list of its bucket is added to either end of the list in
+ * constant time, which is the case for the round-robin of
+ * incremental streams, and for the streams that are opened one
+ * after another.  The other nodes are pushed to the pairing heap of
+ * the bucket in constant time without being compared with anything
+ * but the root.  They are sorted lazily when the root is removed, in
+ * amortized logarithmic time.
+ */
+typedef struct nghttp3_tnode_queue {
+  /* buckets is the array of NGHTTP3_TNODE_QUEUE_NBUCKETS buckets.
+     The node of cycle c belongs to buckets[c %
+     NGHTTP3_TNODE_QUEUE_NBUCKETS].  It is allocated when the first
+     node is pushed. */
+  nghttp3_tnode_bucket *buckets;
+  const nghttp3_mem *mem;
+  /* base is the lower bound of the cycles of nodes in this queue.
+     All nodes have cycle in [base, base +
+     NGHTTP3_TNODE_QUEUE_NBUCKETS). */
+  uint64_t base;
+  /* nonempty is the bitmap of buckets.  The bit i is set if
+     buckets[i] has a node either in its list or in its heap. */
+  uint64_t nonempty;
+  /* size is the number of nodes in this queue. */
+  size_t size;
+} nghttp3_tnode_queue;
+
+/*
+ * nghttp3_tnode_queue_init initializes |q|.
+ */
+void nghttp3_tnode_queue_init(nghttp3_tnode_queue *q, const nghttp3_mem *mem);
+
+/*
+ * nghttp3_tnode_queue_free frees resources allocated for |q|.  It
+ * does not free the nodes in |q|.
+ */
+void nghttp3_tnode_queue_free(nghttp3_tnode_queue *q);
+
+/*
+ * nghttp3_tnode_queue_shrink frees the buckets of |q| if |q| is
+ * empty.
+ */
+void nghttp3_tnode_queue_shrink(nghttp3_tnode_queue *q);
+
+/*
+ * nghttp3_tnode_queue_push pushes |tnode| to |q| at tnode->cycle.
+ * The cycle is clamped so that it stays within
+ * NGHTTP3_TNODE_QUEUE_NBUCKETS from the lowest cycle in |q|.
+ *
+ * This function returns 0 if it succeeds, or one of the following
+ * negative error codes:
+ *
+ * NGHTTP3_ERR_NOMEM
+ *     Out of memory
+ */
+int nghttp3_tnode_queue_push(nghttp3_tnode_queue *q, nghttp3_tnode *tnode);
+
+/*
+ * nghttp3_tnode_queue_remove removes |tnode| from |q|.  |tnode| must
+ * be in |q|.
+ */
+void nghttp3_tnode_queue_remove(nghttp3_tnode_queue *q, nghttp3_tnode *tnode);
+
+/*
+ * nghttp3_tnode_queue_top returns the node of the lowest cycle in
+ * |q|.  If |q| is empty, it returns NULL.
+ */
+nghttp3_tnode *nghttp3_tnode_queue_top(nghttp3_tnode_queue *q);
+
+/*
+ * nghttp3_tnode_queue_empty returns nonzero if |q| is empty.
+ */
+int nghttp3_tnode_queue_empty(const nghttp3_tnode_queue *q);
+
+/*
+ * nghttp3_tnode_queue_size returns the number of nodes in |q|.
+ */
+size_t nghttp3_tnode_queue_size(const nghttp3_tnode_queue *q);
+
+void nghttp3_tnode_unschedule(nghttp3_tnode *tnode, nghttp3_tnode_queue *q);
 
 /*
  * nghttp3_tnode_schedule schedules |tnode| using |nwrite| as penalty.
  * If |tnode| has already been scheduled, it is rescheduled by the
  * amount of |nwrite|.
  */
-int nghttp3_tnode_schedule(nghttp3_tnode *tnode, nghttp3_pq *pq,
+int nghttp3_tnode_schedule(nghttp3_tnode *tnode, nghttp3_tnode_queue *q,
                            uint64_t nwrite);
 
 /*
@@ -2,8 +2,12 @@
 # -*- coding: utf-8 -*-
 
 # This script reads Huffman Code table [1] and generates symbol table
-# and decoding tables in C language.  The resulting code is used in
-# lib/nghttp3_qpack_huffman.h and lib/nghttp3_qpack_huffman_data.c
+# and decoding tables in C language.  The decoding tables consist of a
+# lookup table indexed by NGHTTP3_QPACK_HUFFMAN_DECODE_BITS bits of
+# input, each entry of which yields up to 2 symbols, and the tables of
+# canonical Huffman code to decode a code which is longer than that.
+# The resulting code is used in lib/nghttp3_qpack_huffman.h and
+# lib/nghttp3_qpack_huffman_data.c
 #
 # [1] http://http2.github.io/http2-spec/compression.html
 
@@ -272,144 +276,94 @@ HUFFMAN_CODE_TABLE = """\
 EOS (256)  |11111111|11111111|11111111|111111      3fffffff  [30]
 """
 
-class Node:
+# NGHTTP3_QPACK_HUFFMAN_DECODE_BITS is the number of bits that the
+# decoder looks up at a time.  An entry of the lookup table contains
+# up to 2 symbols whose codes fit in this number of bits.
+NGHTTP3_QPACK_HUFFMAN_DECODE_BITS = 12
 
-    def __init__(self, term = None):
-        self.term = term
-        self.left = None
-        self.right = None
-        self.trans = []
-        self.id = None
-        self.accept = False
+# The maximum length of Huffman code including EOS.
+MAX_NBITS = 30
 
-class Context:
+EOS = 256
 
-    def __init__(self):
-        self.next_id_ = 0
-        self.root = Node()
+def build_decode_table(symbol_tbl):
+    # codes maps (nbits, code) to symbol.
+    codes = {}
+    for sym, (nbits, code) in enumerate(symbol_tbl):
+        codes[(nbits, int(code, 16))] = sym
 
-    def next_id(self):
-        id = self.next_id_
-        self.next_id_ += 1
-        return id
+    def lookup(bits, nbits):
+        # Returns (sym, code length) of the code at the start of bits
+        # which has nbits bits, or None if it does not fit.
+        for n in range(1, nbits + 1):
+            sym = codes.get((n, bits >> (nbits - n)))
+            if sym is not None:
+                return sym, n
+        return None
 
-def _add(node, sym, bits):
-    if len(bits) == 0:
-        node.term = sym
-        return
-    else:
-        if bits[0] == '0':
-            if node.left is None:
-                node.left = Node()
-            child = node.left
-        else:
-            if node.right is None:
-                node.right = Node()
-            child = node.right
-        _add(child, sym, bits[1:])
+    table = []
+    for i in range(1 << NGHTTP3_QPACK_HUFFMAN_DECODE_BITS):
+        nbits = NGHTTP3_QPACK_HUFFMAN_DECODE_BITS
+        syms = []
+        nbits1 = 0
+        total = 0
+        r = lookup(i, nbits)
+        if r is not None and r[0] != EOS:
+            syms.append(r[0])
+            nbits1 = total = r[1]
+            rest = nbits - total
+            r = lookup(i & ((1 << rest) - 1), rest)
+            if r is not None and r[0] != EOS:
+                syms.append(r[0])
+                total += r[1]
+        # If only 1 symbol is decoded, it is repeated so that sym[1]
+        # can be examined without knowing the number of symbols.
+        while len(syms) < 2:
+            syms.append(syms[0] if syms else 0)
+        table.append((syms, nbits1, total))
 
-def huffman_tree_add(ctx, sym, bits):
-    _add(ctx.root, sym, bits)
+    return table
 
-def _set_node_id(ctx, node, prefix):
-    if node.term is not None:
-        return
-    if len(prefix) <= 7 and [1] * len(prefix) == prefix:
-        node.accept = True
-    node.id = ctx.next_id()
-    _set_node_id(ctx, node.left, prefix + [0])
-    _set_node_id(ctx, node.right, prefix + [1])
+def build_canonical_tables(symbol_tbl):
+    # HPACK Huffman code is canonical: codes of the same length are
+    # consecutive, and ordered by symbol.  Verify it.
+    syms = sorted(range(len(symbol_tbl)),
+                  key=lambda sym: (symbol_tbl[sym][0], sym))
+    code = 0
+    prev_nbits = symbol_tbl[syms[0]][0]
+    for sym in syms:
+        nbits = symbol_tbl[sym][0]
+        code <<= nbits - prev_nbits
+        prev_nbits = nbits
+        assert int(symbol_tbl[sym][1], 16) == code
+        code += 1
 
-def huffman_tree_set_node_id(ctx):
-    _set_node_id(ctx, ctx.root, [])
+    limit = [0] * (MAX_NBITS + 1)
+    offset = [0] * (MAX_NBITS + 1)
+    for nbits in range(1, MAX_NBITS + 1):
+        limit[nbits] = limit[nbits - 1]
+        idx = [i for i, sym in enumerate(syms) if symbol_tbl[sym][0] == nbits]
+        if not idx:
+            continue
+        first_code = int(symbol_tbl[syms[idx[0]]][1], 16)
+        last_code = int(symbol_tbl[syms[idx[-1]]][1], 16)
+        # limit is the largest 32 bit value which starts with a code
+        # of nbits bits or shorter.
+        limit[nbits] = ((last_code + 1) << (32 - nbits)) - 1
+        # offset is added to the code to get the index to syms.  It
+        # is computed modulo 2**32.
+        offset[nbits] = (idx[0] - first_code) & 0xffffffff
 
-def _traverse(node, sym, start_node, root, left):
-    if left == 0:
-        if sym == 256:
-            sym = None
-            node = None
-        start_node.trans.append((node, sym))
-        return
+    return syms, limit, offset
 
-    if node.term is not None:
-        node = root
-
-    def go(node):
-        if node.term is not None:
-            assert sym is None
-            nsym = node.term
-        else:
-            nsym = sym
-
-        _traverse(node, nsym, start_node, root, left - 1)
-
-    go(node.left)
-    go(node.right)
-
-def _build_transition_table(ctx, node):
-    if node is None:
-        return
-    _traverse(node, None, node, ctx.root, 4)
-    _build_transition_table(ctx, node.left)
-    _build_transition_table(ctx, node.right)
-
-def huffman_tree_build_transition_table(ctx):
-    _build_transition_table(ctx, ctx.root)
-
-NGHTTP3_QPACK_HUFFMAN_FLAG_ACCEPTED = 1
-NGHTTP3_QPACK_HUFFMAN_FLAG_SYM = 1 << 1
-
-def _print_transition_table(node):
-    if node.term is not None:
-        return
-    print('/* {} */'.format(node.id))
-    print('{')
-    for nd, sym in node.trans:
-        flags = 0
-        if sym is None:
-            out = 0
-        else:
-            out = sym
-            flags |= NGHTTP3_QPACK_HUFFMAN_FLAG_SYM
-        if nd is None:
-            id = 256
-        else:
-            id = nd.id
-            if id is None:
-                # if nd.id is None, it is a leaf node
-                id = 0
-                flags |= NGHTTP3_QPACK_HUFFMAN_FLAG_ACCEPTED
-            elif nd.accept:
-                flags |= NGHTTP3_QPACK_HUFFMAN_FLAG_ACCEPTED
-        print('  {{0x{:02X}, 0x{:02X}, 0x{:02X}}},'.format(id, flags, out))
-    print('},')
-    _print_transition_table(node.left)
-    _print_transition_table(node.right)
-
-def huffman_tree_print_transition_table(ctx):
-    _print_transition_table(ctx.root)
-    print('/* 256 */')
-    print('{')
-    print('  {0x100, 0x00, 0x00},')
-    print('  {0x100, 0x00, 0x00},')
-    print('  {0x100, 0x00, 0x00},')
-    print('  {0x100, 0x00, 0x00},')
-    print('  {0x100, 0x00, 0x00},')
-    print('  {0x100, 0x00, 0x00},')
-    print('  {0x100, 0x00, 0x00},')
-    print('  {0x100, 0x00, 0x00},')
-    print('  {0x100, 0x00, 0x00},')
-    print('  {0x100, 0x00, 0x00},')
-    print('  {0x100, 0x00, 0x00},')
-    print('  {0x100, 0x00, 0x00},')
-    print('  {0x100, 0x00, 0x00},')
-    print('  {0x100, 0x00, 0x00},')
-    print('  {0x100, 0x00, 0x00},')
-    print('  {0x100, 0x00, 0x00},')
-    print('},')
+def print_array(decl, items, per_line):
+    print('{} = {{'.format(decl))
+    for i in range(0, len(items), per_line):
+        print('  ' + ' '.join(items[i:i + per_line]))
+    print('};')
+    print('')
 
 if __name__ == '__main__':
-    ctx = Context()
     symbol_tbl = [(None, 0) for i in range(257)]
 
     for line in io.StringIO(HUFFMAN_CODE_TABLE):
@@ -424,10 +378,6 @@ if __name__ == '__main__':
                 raise Error('Code is more than 4 bytes long')
             assert(len(bits) == nbits)
             symbol_tbl[sym] = (nbits, code)
-            huffman_tree_add(ctx, sym, bits)
-
-    huffman_tree_set_node_id(ctx)
-    huffman_tree_build_transition_table(ctx)
 
     print('''\
 typedef struct {
@@ -449,19 +399,26 @@ const nghttp3_qpack_huffman_sym huffman_sym_table[] = {''')
     print('')
 
     print('''\
-#define NGHTTP3_QPACK_HUFFMAN_FLAG_ACCEPTED 0x{:02X}U
-#define NGHTTP3_QPACK_HUFFMAN_FLAG_SYM 0x{:02X}U
-'''.format(NGHTTP3_QPACK_HUFFMAN_FLAG_ACCEPTED, NGHTTP3_QPACK_HUFFMAN_FLAG_SYM))
+#define NGHTTP3_QPACK_HUFFMAN_DECODE_BITS {}
 
-    print('''\
-typedef struct {
-  uint16_t fstate;
-  uint8_t flags;
-  uint8_t sym;
-} nghttp3_qpack_huffman_decode_node;
-''')
+typedef struct {{
+  uint8_t sym[2];
+  uint8_t nbits1;
+  uint8_t nbits;
+}} nghttp3_qpack_huffman_decode_entry;
+'''.format(NGHTTP3_QPACK_HUFFMAN_DECODE_BITS))
 
-    print('''\
-const nghttp3_qpack_huffman_decode_node qpack_huffman_decode_table[][16] = {''')
-    huffman_tree_print_transition_table(ctx)
-    print('};')
+    table = build_decode_table(symbol_tbl)
+    print_array(
+        'const nghttp3_qpack_huffman_decode_entry qpack_huffman_decode_table[]',
+        ['{{{{0x{:02X}, 0x{:02X}}}, {}, {}}},'.format(syms[0], syms[1],
+                                                    nbits1, nbits)
+         for syms, nbits1, nbits in table], 3)
+
+    syms, limit, offset = build_canonical_tables(symbol_tbl)
+    print_array('const uint32_t qpack_huffman_decode_limit[]',
+                ['0x{:08X}U,'.format(x) for x in limit], 4)
+    print_array('const uint32_t qpack_huffman_decode_offset[]',
+                ['0x{:08X}U,'.format(x) for x in offset], 4)
+    print_array('const uint16_t qpack_huffman_decode_sym[]',
+                ['0x{:02X},'.format(x) for x in syms], 8)
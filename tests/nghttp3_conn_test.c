@@ -52,10 +52,23 @@ static const MunitTest tests[] = {
   munit_void_test(test_nghttp3_conn_http_record_request_method),
   munit_void_test(test_nghttp3_conn_http_error),
   munit_void_test(test_nghttp3_conn_qpack_blocked_stream),
+  munit_void_test(test_nghttp3_conn_max_blocked_stream_data),
   munit_void_test(test_nghttp3_conn_qpack_decoder_cancel_stream),
   munit_void_test(test_nghttp3_conn_just_fin),
   munit_void_test(test_nghttp3_conn_submit_response_read_blocked),
+  munit_void_test(test_nghttp3_conn_submit_response_fd),
   munit_void_test(test_nghttp3_conn_submit_info),
+  munit_void_test(test_nghttp3_conn_submit_prepared),
+  munit_void_test(test_nghttp3_conn_get_stats),
+  munit_void_test(test_nghttp3_conn_get_mem_usage),
+  munit_void_test(test_nghttp3_conn_shrink),
+  munit_void_test(test_nghttp3_conn_writev_streams),
+  munit_void_test(test_nghttp3_conn_set_scheduler),
+  munit_void_test(test_nghttp3_conn_read_data_veccnt),
+  munit_void_test(test_nghttp3_conn_data_coalesce),
+  munit_void_test(test_nghttp3_conn_shared_pool),
+  munit_void_test(test_nghttp3_conn_find_stream),
+  munit_void_test(test_nghttp3_conn_submit_request_data_buf),
   munit_void_test(test_nghttp3_conn_recv_uni),
   munit_void_test(test_nghttp3_conn_recv_goaway),
   munit_void_test(test_nghttp3_conn_shutdown_server),
@@ -73,6 +86,7 @@ static const MunitTest tests[] = {
   munit_void_test(test_nghttp3_conn_recv_origin),
   munit_void_test(test_nghttp3_conn_write_origin),
   munit_void_test(test_nghttp3_conn_recv_unknown_frame),
+  munit_void_test(test_nghttp3_conn_read_bidi_frame_boundary),
   munit_void_test(test_nghttp3_conn_get_stream_user_data),
   munit_void_test(test_nghttp3_conn_is_stream_flushed),
   munit_test_end(),
@@ -102,6 +116,7 @@ typedef struct {
     size_t nblock;
     size_t left;
     size_t step;
+    size_t veccnt;
   } data;
   struct {
     size_t ncalled;
@@ -140,6 +155,13 @@ typedef struct {
     size_t origin_listlen;
     size_t offset;
   } recv_origin_cb;
+  struct {
+    size_t ncalled;
+    uint64_t datalen;
+  } recv_data_cb;
+  struct {
+    size_t ncalled;
+  } end_stream_cb;
 } userdata;
 
 typedef struct {
@@ -258,6 +280,135 @@ static nghttp3_ssize step_read_data(nghttp3_conn *conn, int64_t stream_id,
   return 1;
 }
 
+static void count_release_data(nghttp3_conn *conn, int64_t stream_id,
+                               void *release_user_data, void *user_data) {
+  (void)conn;
+  (void)stream_id;
+  (void)user_data;
+
+  ++*(size_t *)release_user_data;
+}
+
+static nghttp3_ssize release_read_data_buf(nghttp3_conn *conn,
+                                           int64_t stream_id,
+                                           nghttp3_data_buf *buf,
+                                           size_t bufcnt, uint32_t *pflags,
+                                           void *user_data,
+                                           void *stream_user_data) {
+  size_t *released = stream_user_data;
+
+  (void)conn;
+  (void)stream_id;
+  (void)user_data;
+
+  assert_size(3, <=, bufcnt);
+
+  buf[0] = (nghttp3_data_buf){
+    .base = nulldata,
+    .len = 100,
+    .release = count_release_data,
+    .release_user_data = &released[0],
+  };
+  buf[1] = (nghttp3_data_buf){
+    .base = nulldata,
+    .release = count_release_data,
+    .release_user_data = &released[1],
+  };
+  buf[2] = (nghttp3_data_buf){
+    .base = nulldata + 100,
+    .len = 200,
+    .release = count_release_data,
+    .release_user_data = &released[2],
+  };
+
+  *pflags = NGHTTP3_DATA_FLAG_EOF;
+
+  return 3;
+}
+
+static nghttp3_ssize fill_read_data(nghttp3_conn *conn, int64_t stream_id,
+                                    nghttp3_vec *vec, size_t veccnt,
+                                    uint32_t *pflags, void *user_data,
+                                    void *stream_user_data) {
+  userdata *ud = user_data;
+  size_t i, n;
+
+  (void)conn;
+  (void)stream_id;
+  (void)stream_user_data;
+
+  ud->data.veccnt = veccnt;
+
+  for (i = 0; i < veccnt && ud->data.left; ++i) {
+    n = nghttp3_min(ud->data.left, ud->data.step);
+
+    vec[i] = (nghttp3_vec){
+      .base = nulldata,
+      .len = n,
+    };
+
+    ud->data.left -= n;
+  }
+
+  if (ud->data.left == 0) {
+    *pflags = NGHTTP3_DATA_FLAG_EOF;
+  }
+
+  return (nghttp3_ssize)i;
+}
+
+typedef struct coalesce_source {
+  size_t ncalled;
+  size_t left;
+  /* flush_at, if nonzero, is the call on which NGHTTP3_DATA_FLAG_FLUSH
+     is set. */
+  size_t flush_at;
+  /* block_at, if nonzero, is the call which returns
+     NGHTTP3_ERR_WOULDBLOCK. */
+  size_t block_at;
+  /* empty_at, if nonzero, is the call which provides no data without
+     setting any flags. */
+  size_t empty_at;
+} coalesce_source;
+
+static nghttp3_ssize coalesce_read_data(nghttp3_conn *conn, int64_t stream_id,
+                                        nghttp3_vec *vec, size_t veccnt,
+                                        uint32_t *pflags, void *user_data,
+                                        void *stream_user_data) {
+  coalesce_source *cs = stream_user_data;
+
+  (void)conn;
+  (void)stream_id;
+  (void)user_data;
+
+  assert_size(0, <, veccnt);
+
+  if (++cs->ncalled == cs->block_at) {
+    return NGHTTP3_ERR_WOULDBLOCK;
+  }
+
+  if (cs->ncalled == cs->empty_at) {
+    return 0;
+  }
+
+  vec[0] = (nghttp3_vec){
+    .base = nulldata,
+    .len = 100,
+  };
+
+  cs->left -= 100;
+
+  if (cs->left == 0) {
+    *pflags |= NGHTTP3_DATA_FLAG_EOF;
+  }
+
+  if (cs->ncalled == cs->flush_at) {
+    *pflags |= NGHTTP3_DATA_FLAG_FLUSH;
+  }
+
+  return 1;
+}
+
 static nghttp3_ssize
 block_then_step_read_data(nghttp3_conn *conn, int64_t stream_id,
                           nghttp3_vec *vec, size_t veccnt, uint32_t *pflags,
@@ -459,6 +610,33 @@ static int recv_origin(nghttp3_conn *conn, const uint8_t *origin,
   return 0;
 }
 
+static int recv_data(nghttp3_conn *conn, int64_t stream_id,
+                     const uint8_t *data, size_t datalen, void *user_data,
+                     void *stream_user_data) {
+  userdata *ud = user_data;
+  (void)conn;
+  (void)stream_id;
+  (void)data;
+  (void)stream_user_data;
+
+  ++ud->recv_data_cb.ncalled;
+  ud->recv_data_cb.datalen += datalen;
+
+  return 0;
+}
+
+static int end_stream(nghttp3_conn *conn, int64_t stream_id, void *user_data,
+                      void *stream_user_data) {
+  userdata *ud = user_data;
+  (void)conn;
+  (void)stream_id;
+  (void)stream_user_data;
+
+  ++ud->end_stream_cb.ncalled;
+
+  return 0;
+}
+
 static void rand_cb(uint8_t *data, size_t datalen) {
   memset(data, 0xFE, datalen);
 }
@@ -3862,6 +4040,121 @@ void test_nghttp3_conn_qpack_blocked_stream(void) {
   nghttp3_buf_free(&ebuf, mem);
 }
 
+void test_nghttp3_conn_max_blocked_stream_data(void) {
+  const nghttp3_mem *mem = nghttp3_mem_default();
+  nghttp3_conn *conn;
+  static const nghttp3_callbacks callbacks = {
+    .stop_sending = stop_sending,
+    .reset_stream = reset_stream,
+    .deferred_consume = deferred_consume,
+  };
+  nghttp3_settings settings;
+  nghttp3_qpack_encoder qenc;
+  int rv;
+  nghttp3_buf ebuf;
+  uint8_t rawbuf[4096];
+  nghttp3_buf buf;
+  nghttp3_frame fr;
+  nghttp3_ssize sconsumed;
+  size_t buffered_datalen;
+  nghttp3_stream *stream;
+  userdata ud = {0};
+  conn_options opts;
+
+  nghttp3_settings_default(&settings);
+  settings.qpack_max_dtable_capacity = 4096;
+  settings.qpack_blocked_streams = 100;
+  settings.max_blocked_stream_data = 2000;
+
+  nghttp3_buf_init(&ebuf);
+  nghttp3_buf_wrap_init(&buf, rawbuf, sizeof(rawbuf));
+
+  nghttp3_qpack_encoder_init(&qenc, settings.qpack_max_dtable_capacity,
+                             NGHTTP3_TEST_MAP_SEED, mem);
+  nghttp3_qpack_encoder_set_max_blocked_streams(&qenc,
+                                                settings.qpack_blocked_streams);
+  nghttp3_qpack_encoder_set_max_dtable_capacity(
+    &qenc, settings.qpack_max_dtable_capacity);
+
+  opts = (conn_options){
+    .callbacks = &callbacks,
+    .settings = &settings,
+    .user_data = &ud,
+  };
+
+  setup_default_client_with_options(&conn, opts);
+  nghttp3_conn_bind_qpack_streams(conn, 2, 6);
+
+  rv = nghttp3_conn_submit_request(conn, 0, req_nva, nghttp3_arraylen(req_nva),
+                                   NULL, NULL);
+
+  assert_int(0, ==, rv);
+
+  fr.headers = (nghttp3_frame_headers){
+    .type = NGHTTP3_FRAME_HEADERS,
+    .nva = (nghttp3_nv *)resp_nva,
+    .nvlen = nghttp3_arraylen(resp_nva),
+  };
+
+  nghttp3_write_frame_qpack_dyn(&buf, &ebuf, &qenc, 0, &fr);
+  nghttp3_write_frame_data(&buf, 1000);
+
+  sconsumed = nghttp3_conn_read_stream2(conn, 0, buf.pos, nghttp3_buf_len(&buf),
+                                        /* fin = */ 0, 0);
+
+  assert_ptrdiff(0, <, sconsumed);
+  assert_ptrdiff((nghttp3_ssize)nghttp3_buf_len(&buf), !=, sconsumed);
+
+  buffered_datalen = nghttp3_buf_len(&buf) - (size_t)sconsumed;
+  stream = nghttp3_conn_find_stream(conn, 0);
+
+  assert_size(buffered_datalen, ==,
+              nghttp3_stream_get_buffered_datalen(stream));
+  assert_size(buffered_datalen, ==, conn->rx.blocked_inq_bytes);
+  assert_size(0, ==, ud.stop_sending_cb.ncalled);
+
+  /* The next data would exceed the limit, and the stream is reset. */
+  nghttp3_buf_reset(&buf);
+  nghttp3_write_frame_data(&buf, 1111);
+
+  sconsumed = nghttp3_conn_read_stream2(conn, 0, buf.pos, nghttp3_buf_len(&buf),
+                                        /* fin = */ 0, 0);
+
+  assert_ptrdiff((nghttp3_ssize)nghttp3_buf_len(&buf), ==, sconsumed);
+  assert_size(1, ==, ud.stop_sending_cb.ncalled);
+  assert_int64(0, ==, ud.stop_sending_cb.stream_id);
+  assert_uint64(NGHTTP3_H3_EXCESSIVE_LOAD, ==,
+                ud.stop_sending_cb.app_error_code);
+  assert_size(1, ==, ud.reset_stream_cb.ncalled);
+  assert_int64(0, ==, ud.reset_stream_cb.stream_id);
+  assert_uint64(NGHTTP3_H3_EXCESSIVE_LOAD, ==,
+                ud.reset_stream_cb.app_error_code);
+  assert_size(buffered_datalen, ==, ud.deferred_consume_cb.consumed_total);
+  assert_size(0, ==, nghttp3_stream_get_buffered_datalen(stream));
+  assert_size(0, ==, conn->rx.blocked_inq_bytes);
+  assert_true(stream->flags & NGHTTP3_STREAM_FLAG_SHUT_RD);
+  assert_false(stream->flags & NGHTTP3_STREAM_FLAG_QPACK_DECODE_BLOCKED);
+  assert_true(nghttp3_pq_empty(&conn->qpack_blocked_streams));
+  /* Stream Cancellation is queued. */
+  assert_size(0, <, nghttp3_buf_len(&conn->qdec.dbuf));
+
+  /* Further data are discarded. */
+  sconsumed = nghttp3_conn_read_stream2(conn, 0, buf.pos, nghttp3_buf_len(&buf),
+                                        /* fin = */ 1, 0);
+
+  assert_ptrdiff((nghttp3_ssize)nghttp3_buf_len(&buf), ==, sconsumed);
+  assert_size(1, ==, ud.stop_sending_cb.ncalled);
+
+  rv = nghttp3_conn_close_stream(conn, 0, NGHTTP3_H3_EXCESSIVE_LOAD);
+
+  assert_int(0, ==, rv);
+  assert_size(buffered_datalen, ==, ud.deferred_consume_cb.consumed_total);
+
+  nghttp3_conn_del(conn);
+  nghttp3_qpack_encoder_free(&qenc);
+  nghttp3_buf_free(&ebuf, mem);
+}
+
 void test_nghttp3_conn_qpack_decoder_cancel_stream(void) {
   nghttp3_conn *conn;
   nghttp3_vec vec[256];
@@ -4040,71 +4333,1695 @@ void test_nghttp3_conn_submit_response_read_blocked(void) {
   nghttp3_conn_del(conn);
 }
 
-void test_nghttp3_conn_submit_info(void) {
+void test_nghttp3_conn_submit_response_fd(void) {
+#ifdef HAVE_PREAD
   nghttp3_conn *conn;
-  static const nghttp3_nv nva[] = {
-    MAKE_NV("foo", "bar"),
-  };
   nghttp3_stream *stream;
-  int rv;
+  nghttp3_callbacks callbacks = {
+    .acked_stream_data = acked_stream_data,
+    .stop_sending = stop_sending,
+    .reset_stream = reset_stream,
+  };
+  userdata ud = {0};
+  conn_options opts;
+  nghttp3_data_fd dfd;
   nghttp3_vec vec[256];
-  int fin;
+  nghttp3_stream_vec svec[16];
+  nghttp3_ssize sveccnt, nsvec;
+  nghttp3_typed_buf *tbuf;
   int64_t stream_id;
-  nghttp3_ssize sveccnt;
+  int fin;
+  uint8_t data[40000], body[40000];
+  uint8_t *p;
+  uint64_t written;
+  size_t i, len, ndata;
+  FILE *fp;
+  int rv;
 
-  setup_default_server(&conn);
+  for (i = 0; i < sizeof(data); ++i) {
+    data[i] = (uint8_t)(i * 31);
+  }
+
+  fp = tmpfile();
+
+  assert_not_null(fp);
+  assert_size(sizeof(data), ==, fwrite(data, 1, sizeof(data), fp));
+  assert_int(0, ==, fflush(fp));
+
+  opts = (conn_options){
+    .callbacks = &callbacks,
+    .user_data = &ud,
+  };
+
+  setup_default_server_with_options(&conn, opts);
   conn_write_initial_streams(conn);
+  conn->remote.bidi.max_client_streams = 5;
 
   nghttp3_conn_create_stream(conn, &stream, 0);
 
-  rv = nghttp3_conn_submit_info(conn, 0, nva, nghttp3_arraylen(nva));
+  dfd = (nghttp3_data_fd){
+    .fd = fileno(fp),
+    .offset = 1000,
+    .len = 35000,
+  };
+
+  rv = nghttp3_conn_submit_response_fd(conn, 0, resp_nva,
+                                       nghttp3_arraylen(resp_nva), &dfd);
 
   assert_int(0, ==, rv);
 
-  sveccnt = nghttp3_conn_writev_stream(conn, &stream_id, &fin, vec,
-                                       nghttp3_arraylen(vec));
+  written = 0;
+  fin = 0;
 
-  assert_ptrdiff(0, <, sveccnt);
+  for (;;) {
+    sveccnt = nghttp3_conn_writev_stream(conn, &stream_id, &fin, vec,
+                                         nghttp3_arraylen(vec));
 
-  nghttp3_conn_del(conn);
+    assert_ptrdiff(0, <=, sveccnt);
 
-  /* Submitting non-final response against non-existing stream is
-     treated as error. */
-  setup_default_server(&conn);
+    if (stream_id < 0) {
+      break;
+    }
 
-  rv = nghttp3_conn_submit_info(conn, 0, nva, nghttp3_arraylen(nva));
+    assert_int64(0, ==, stream_id);
 
-  assert_int(NGHTTP3_ERR_STREAM_NOT_FOUND, ==, rv);
+    written += nghttp3_vec_len(vec, (size_t)sveccnt);
 
-  nghttp3_conn_del(conn);
-}
+    rv = nghttp3_conn_add_write_offset(
+      conn, 0, nghttp3_vec_len(vec, (size_t)sveccnt));
 
-void test_nghttp3_conn_recv_uni(void) {
-  nghttp3_conn *conn;
-  nghttp3_ssize nread;
-  uint8_t buf[256];
-  size_t i;
+    assert_int(0, ==, rv);
 
-  /* 0 length unidirectional stream must be ignored */
-  setup_default_client(&conn);
+    if (fin) {
+      break;
+    }
+  }
 
-  nread = nghttp3_conn_read_stream2(conn, 3, NULL, 0, /* fin = */ 1, 0);
+  assert_true(fin);
 
-  assert_ptrdiff(0, ==, nread);
-  assert_null(nghttp3_conn_find_stream(conn, 3));
+  /* Body is read in NGHTTP3_STREAM_FILE_CHUNK_SIZE bytes at most. */
+  p = body;
+  ndata = 0;
 
-  nghttp3_conn_del(conn);
+  for (i = 0; i < nghttp3_ringbuf_len(&stream->outq); ++i) {
+    tbuf = nghttp3_ringbuf_get(&stream->outq, i);
+    if (tbuf->type != NGHTTP3_BUF_TYPE_FILE) {
+      continue;
+    }
 
-  /* 0 length unidirectional stream; first get 0 length without fin,
-     and then get 0 length with fin. */
-  setup_default_client(&conn);
+    len = (size_t)(tbuf->buf.last - tbuf->buf.begin);
 
-  nread = nghttp3_conn_read_stream2(conn, 3, NULL, 0, /* fin = */ 0, 0);
+    assert_size(NGHTTP3_STREAM_FILE_CHUNK_SIZE, >=, len);
 
-  assert_ptrdiff(0, ==, nread);
-  assert_not_null(nghttp3_conn_find_stream(conn, 3));
+    p = nghttp3_cpymem(p, tbuf->buf.begin, len);
+    ++ndata;
+  }
 
-  nread = nghttp3_conn_read_stream2(conn, 3, NULL, 0, /* fin = */ 1, 0);
+  assert_size(3, ==, ndata);
+  assert_size(35000, ==, (size_t)(p - body));
+  assert_memory_equal(35000, data + 1000, body);
+
+  rv = nghttp3_conn_add_ack_offset(conn, 0, written);
+
+  assert_int(0, ==, rv);
+  assert_size(0, ==, nghttp3_ringbuf_len(&stream->outq));
+  /* The buffers of body are owned by the library, and are not
+     reported. */
+  assert_uint64(0, ==, ud.ack.acc);
+
+  /* The file ends before the end of the range.  Only the stream is
+     reset, and the other stream is written instead. */
+  nghttp3_conn_create_stream(conn, &stream, 4);
+
+  dfd.offset = sizeof(data) - 100;
+  dfd.len = 200;
+
+  rv = nghttp3_conn_submit_response_fd(conn, 4, resp_nva,
+                                       nghttp3_arraylen(resp_nva), &dfd);
+
+  assert_int(0, ==, rv);
+
+  sveccnt = nghttp3_conn_writev_stream(conn, &stream_id, &fin, vec,
+                                       nghttp3_arraylen(vec));
+
+  assert_int64(4, ==, stream_id);
+
+  rv = nghttp3_conn_add_write_offset(conn, 4,
+                                     nghttp3_vec_len(vec, (size_t)sveccnt));
+
+  assert_int(0, ==, rv);
+
+  nghttp3_conn_create_stream(conn, &stream, 8);
+
+  rv = nghttp3_conn_submit_response(conn, 8, resp_nva,
+                                    nghttp3_arraylen(resp_nva), NULL);
+
+  assert_int(0, ==, rv);
+
+  sveccnt = nghttp3_conn_writev_stream(conn, &stream_id, &fin, vec,
+                                       nghttp3_arraylen(vec));
+
+  assert_ptrdiff(0, <, sveccnt);
+  assert_int64(8, ==, stream_id);
+  assert_true(fin);
+  assert_size(1, ==, ud.stop_sending_cb.ncalled);
+  assert_int64(4, ==, ud.stop_sending_cb.stream_id);
+  assert_uint64(NGHTTP3_H3_INTERNAL_ERROR, ==,
+                ud.stop_sending_cb.app_error_code);
+  assert_size(1, ==, ud.reset_stream_cb.ncalled);
+  assert_int64(4, ==, ud.reset_stream_cb.stream_id);
+  assert_uint64(NGHTTP3_H3_INTERNAL_ERROR, ==,
+                ud.reset_stream_cb.app_error_code);
+
+  stream = nghttp3_conn_find_stream(conn, 4);
+
+  assert_true(stream->flags & NGHTTP3_STREAM_FLAG_SHUT_WR);
+  assert_size(0, ==, nghttp3_ringbuf_len(&stream->frq));
+  assert_false(nghttp3_tnode_is_scheduled(&stream->node));
+
+  rv = nghttp3_conn_add_write_offset(conn, 8,
+                                     nghttp3_vec_len(vec, (size_t)sveccnt));
+
+  assert_int(0, ==, rv);
+
+  sveccnt = nghttp3_conn_writev_stream(conn, &stream_id, &fin, vec,
+                                       nghttp3_arraylen(vec));
+
+  assert_ptrdiff(0, ==, sveccnt);
+  assert_int64(-1, ==, stream_id);
+
+  /* nghttp3_conn_writev_streams also skips the stream which is
+     reset. */
+  nghttp3_conn_create_stream(conn, &stream, 12);
+
+  dfd.offset = sizeof(data);
+  dfd.len = 100;
+
+  rv = nghttp3_conn_submit_response_fd(conn, 12, resp_nva,
+                                       nghttp3_arraylen(resp_nva), &dfd);
+
+  assert_int(0, ==, rv);
+
+  nghttp3_conn_create_stream(conn, &stream, 16);
+
+  rv = nghttp3_conn_submit_response(conn, 16, resp_nva,
+                                    nghttp3_arraylen(resp_nva), NULL);
+
+  assert_int(0, ==, rv);
+
+  nsvec = nghttp3_conn_writev_streams(conn, svec, nghttp3_arraylen(svec), vec,
+                                      nghttp3_arraylen(vec), 65536);
+
+  assert_ptrdiff(1, ==, nsvec);
+  assert_int64(16, ==, svec[0].stream_id);
+  assert_true(svec[0].fin);
+  assert_size(2, ==, ud.reset_stream_cb.ncalled);
+  assert_int64(12, ==, ud.reset_stream_cb.stream_id);
+
+  /* Invalid file descriptor */
+  dfd.fd = -1;
+
+  rv = nghttp3_conn_submit_response_fd(conn, 0, resp_nva,
+                                       nghttp3_arraylen(resp_nva), &dfd);
+
+  assert_int(NGHTTP3_ERR_INVALID_ARGUMENT, ==, rv);
+
+  nghttp3_conn_del(conn);
+
+  fclose(fp);
+#endif /* defined(HAVE_PREAD) */
+}
+
+void test_nghttp3_conn_submit_info(void) {
+  nghttp3_conn *conn;
+  static const nghttp3_nv nva[] = {
+    MAKE_NV("foo", "bar"),
+  };
+  nghttp3_stream *stream;
+  int rv;
+  nghttp3_vec vec[256];
+  int fin;
+  int64_t stream_id;
+  nghttp3_ssize sveccnt;
+
+  setup_default_server(&conn);
+  conn_write_initial_streams(conn);
+
+  nghttp3_conn_create_stream(conn, &stream, 0);
+
+  rv = nghttp3_conn_submit_info(conn, 0, nva, nghttp3_arraylen(nva));
+
+  assert_int(0, ==, rv);
+
+  sveccnt = nghttp3_conn_writev_stream(conn, &stream_id, &fin, vec,
+                                       nghttp3_arraylen(vec));
+
+  assert_ptrdiff(0, <, sveccnt);
+
+  nghttp3_conn_del(conn);
+
+  /* Submitting non-final response against non-existing stream is
+     treated as error. */
+  setup_default_server(&conn);
+
+  rv = nghttp3_conn_submit_info(conn, 0, nva, nghttp3_arraylen(nva));
+
+  assert_int(NGHTTP3_ERR_STREAM_NOT_FOUND, ==, rv);
+
+  nghttp3_conn_del(conn);
+}
+
+static size_t conn_writev_request_stream(nghttp3_conn *conn,
+                                         int64_t expected_stream_id,
+                                         uint8_t *buf, size_t buflen) {
+  nghttp3_vec vec[256];
+  nghttp3_ssize sveccnt;
+  int64_t stream_id;
+  int fin;
+  uint8_t *p = buf;
+  size_t i;
+  int rv;
+
+  sveccnt = nghttp3_conn_writev_stream(conn, &stream_id, &fin, vec,
+                                       nghttp3_arraylen(vec));
+
+  assert_ptrdiff(0, <, sveccnt);
+  assert_int64(expected_stream_id, ==, stream_id);
+  assert_true(fin);
+  assert_uint64(buflen, >=, nghttp3_vec_len(vec, (size_t)sveccnt));
+
+  for (i = 0; i < (size_t)sveccnt; ++i) {
+    p = nghttp3_cpymem(p, vec[i].base, vec[i].len);
+  }
+
+  rv = nghttp3_conn_add_write_offset(conn, stream_id, (size_t)(p - buf));
+
+  assert_int(0, ==, rv);
+
+  return (size_t)(p - buf);
+}
+
+void test_nghttp3_conn_submit_prepared(void) {
+  nghttp3_conn *conn, *pconn;
+  static const nghttp3_nv nva[] = {
+    MAKE_NV(":method", "HEAD"),
+    MAKE_NV(":path", "/alpha/bravo/charlie"),
+    MAKE_NV(":authority", "example.com"),
+    MAKE_NV(":scheme", "https"),
+    MAKE_NV("user-agent", "nghttp3/prepared"),
+  };
+  static const nghttp3_nv resp_nva[] = {
+    MAKE_NV(":status", "200"),
+    MAKE_NV("server", "nghttp3"),
+    MAKE_NV("cache-control", "max-age=3600"),
+  };
+  nghttp3_prepared_nva *pnva;
+  nghttp3_stream *stream;
+  uint8_t buf[1024], pbuf[1024];
+  size_t len, plen;
+  int64_t stream_id;
+  int rv;
+
+  /* Prepared request header fields produce the same stream data as
+     the ordinary ones, and can be reused for multiple streams. */
+  rv = nghttp3_prepared_nva_new(&pnva, nva, nghttp3_arraylen(nva), NULL);
+
+  assert_int(0, ==, rv);
+
+  setup_default_client(&conn);
+  conn_write_initial_streams(conn);
+  setup_default_client(&pconn);
+  conn_write_initial_streams(pconn);
+
+  for (stream_id = 0; stream_id <= 4; stream_id += 4) {
+    rv = nghttp3_conn_submit_request(conn, stream_id, nva,
+                                     nghttp3_arraylen(nva), NULL, NULL);
+
+    assert_int(0, ==, rv);
+
+    rv = nghttp3_conn_submit_request_prepared(pconn, stream_id, pnva, NULL,
+                                              NULL);
+
+    assert_int(0, ==, rv);
+
+    stream = nghttp3_conn_find_stream(pconn, stream_id);
+
+    assert_not_null(stream);
+    assert_true(stream->rx.http.flags & NGHTTP3_HTTP_FLAG_METH_HEAD);
+    assert_true(stream->flags & NGHTTP3_STREAM_FLAG_WRITE_END_STREAM);
+  }
+
+  for (stream_id = 0; stream_id <= 4; stream_id += 4) {
+    len = conn_writev_request_stream(conn, stream_id, buf, sizeof(buf));
+    plen = conn_writev_request_stream(pconn, stream_id, pbuf, sizeof(pbuf));
+
+    assert_size(len, ==, plen);
+    assert_memory_equal(len, buf, pbuf);
+  }
+
+  nghttp3_conn_del(pconn);
+  nghttp3_conn_del(conn);
+  nghttp3_prepared_nva_del(pnva);
+
+  /* Prepared response header fields */
+  rv = nghttp3_prepared_nva_new(&pnva, resp_nva, nghttp3_arraylen(resp_nva),
+                                NULL);
+
+  assert_int(0, ==, rv);
+
+  setup_default_server(&conn);
+  conn_write_initial_streams(conn);
+  setup_default_server(&pconn);
+  conn_write_initial_streams(pconn);
+
+  nghttp3_conn_create_stream(conn, &stream, 0);
+  nghttp3_conn_create_stream(pconn, &stream, 0);
+
+  rv = nghttp3_conn_submit_response(conn, 0, resp_nva,
+                                    nghttp3_arraylen(resp_nva), NULL);
+
+  assert_int(0, ==, rv);
+
+  rv = nghttp3_conn_submit_response_prepared(pconn, 0, pnva, NULL);
+
+  assert_int(0, ==, rv);
+
+  len = conn_writev_request_stream(conn, 0, buf, sizeof(buf));
+  plen = conn_writev_request_stream(pconn, 0, pbuf, sizeof(pbuf));
+
+  assert_size(len, ==, plen);
+  assert_memory_equal(len, buf, pbuf);
+
+  nghttp3_conn_del(pconn);
+  nghttp3_conn_del(conn);
+
+  /* Submitting response against non-existing stream is treated as
+     error. */
+  setup_default_server(&conn);
+
+  rv = nghttp3_conn_submit_response_prepared(conn, 0, pnva, NULL);
+
+  assert_int(NGHTTP3_ERR_STREAM_NOT_FOUND, ==, rv);
+
+  nghttp3_conn_del(conn);
+  nghttp3_prepared_nva_del(pnva);
+}
+
+void test_nghttp3_conn_get_stats(void) {
+  const nghttp3_mem *mem = nghttp3_mem_default();
+  nghttp3_conn *conn;
+  nghttp3_settings settings;
+  nghttp3_qpack_encoder qenc;
+  nghttp3_conn_stats stats;
+  nghttp3_vec vec[256];
+  nghttp3_ssize sveccnt;
+  int64_t stream_id;
+  int fin;
+  uint64_t len;
+  uint8_t rawbuf[4096];
+  nghttp3_buf buf, ebuf;
+  nghttp3_frame fr;
+  nghttp3_ssize sconsumed;
+  conn_options opts;
+  int rv;
+  size_t i;
+  static const nghttp3_tstamp mixed_ts[][2] = {
+    {1000, UINT64_MAX},
+    {UINT64_MAX, 3000},
+  };
+
+  /* Frames and QPACK field lines sent */
+  setup_default_client(&conn);
+  conn_write_initial_streams(conn);
+
+  nghttp3_conn_get_stats(conn, &stats);
+
+  assert_uint64(1, ==,
+                stats.frame_sent[NGHTTP3_FRAME_STATS_TYPE_SETTINGS].frames);
+  assert_uint64(0, ==,
+                stats.frame_sent[NGHTTP3_FRAME_STATS_TYPE_HEADERS].frames);
+  assert_uint64(0, ==, stats.sched_pops);
+  assert_uint64(0, ==, stats.outq_bytes);
+
+  rv = nghttp3_conn_submit_request(conn, 0, req_nva, nghttp3_arraylen(req_nva),
+                                   NULL, NULL);
+
+  assert_int(0, ==, rv);
+
+  sveccnt = nghttp3_conn_writev_stream(conn, &stream_id, &fin, vec,
+                                       nghttp3_arraylen(vec));
+
+  assert_ptrdiff(0, <, sveccnt);
+  assert_int64(0, ==, stream_id);
+
+  len = nghttp3_vec_len(vec, (size_t)sveccnt);
+
+  rv = nghttp3_conn_add_write_offset(conn, 0, (size_t)len);
+
+  assert_int(0, ==, rv);
+
+  nghttp3_conn_get_stats(conn, &stats);
+
+  assert_uint64(1, ==, stats.sched_pops);
+  assert_uint64(1, ==,
+                stats.frame_sent[NGHTTP3_FRAME_STATS_TYPE_HEADERS].frames);
+  assert_uint64(len, ==,
+                stats.frame_sent[NGHTTP3_FRAME_STATS_TYPE_HEADERS].bytes);
+  assert_uint64(len - 2, ==, stats.header_bytes_sent);
+  assert_uint64(nghttp3_arraylen(req_nva), ==, stats.qpack_enc_static_hits);
+  assert_uint64(0, ==, stats.qpack_enc_dynamic_hits);
+  assert_uint64(0, ==, stats.qpack_enc_literals);
+  assert_uint64(0, <, stats.qpack_enc_huffman_bytes_saved);
+  assert_uint64(len, ==, stats.outq_bytes);
+
+  rv = nghttp3_conn_add_ack_offset(conn, 0, len);
+
+  assert_int(0, ==, rv);
+
+  nghttp3_conn_get_stats(conn, &stats);
+
+  assert_uint64(0, ==, stats.outq_bytes);
+
+  nghttp3_conn_del(conn);
+
+  /* Frames received, and a stream blocked by QPACK decoder */
+  nghttp3_settings_default(&settings);
+  settings.qpack_max_dtable_capacity = 4096;
+  settings.qpack_blocked_streams = 100;
+
+  nghttp3_buf_init(&ebuf);
+  nghttp3_buf_wrap_init(&buf, rawbuf, sizeof(rawbuf));
+
+  nghttp3_qpack_encoder_init(&qenc, settings.qpack_max_dtable_capacity,
+                             NGHTTP3_TEST_MAP_SEED, mem);
+  nghttp3_qpack_encoder_set_max_blocked_streams(&qenc,
+                                                settings.qpack_blocked_streams);
+  nghttp3_qpack_encoder_set_max_dtable_capacity(
+    &qenc, settings.qpack_max_dtable_capacity);
+
+  opts = (conn_options){
+    .settings = &settings,
+  };
+
+  setup_default_client_with_options(&conn, opts);
+  nghttp3_conn_bind_qpack_streams(conn, 2, 6);
+
+  rv = nghttp3_conn_submit_request(conn, 0, req_nva, nghttp3_arraylen(req_nva),
+                                   NULL, NULL);
+
+  assert_int(0, ==, rv);
+
+  fr.headers = (nghttp3_frame_headers){
+    .type = NGHTTP3_FRAME_HEADERS,
+    .nva = (nghttp3_nv *)resp_nva,
+    .nvlen = nghttp3_arraylen(resp_nva),
+  };
+
+  nghttp3_write_frame_qpack_dyn(&buf, &ebuf, &qenc, 0, &fr);
+
+  len = nghttp3_buf_len(&buf);
+
+  sconsumed = nghttp3_conn_read_stream2(conn, 0, buf.pos, nghttp3_buf_len(&buf),
+                                        /* fin = */ 0, 1000);
+
+  assert_ptrdiff(0, <, sconsumed);
+
+  nghttp3_conn_get_stats(conn, &stats);
+
+  assert_uint64(1, ==,
+                stats.frame_recv[NGHTTP3_FRAME_STATS_TYPE_HEADERS].frames);
+  assert_uint64(len, ==,
+                stats.frame_recv[NGHTTP3_FRAME_STATS_TYPE_HEADERS].bytes);
+  assert_uint64(len - 2, ==, stats.header_bytes_recv);
+  assert_uint64(1, ==, stats.qpack_blocked);
+  assert_uint64(0, ==, stats.qpack_blocked_duration);
+  assert_uint64(len - (uint64_t)sconsumed, ==, stats.inq_bytes);
+
+  nghttp3_buf_reset(&buf);
+  buf.last = nghttp3_put_uvarint(buf.last, NGHTTP3_STREAM_TYPE_QPACK_ENCODER);
+
+  sconsumed = nghttp3_conn_read_stream2(conn, 7, buf.pos, nghttp3_buf_len(&buf),
+                                        /* fin = */ 0, 2000);
+
+  assert_ptrdiff((nghttp3_ssize)nghttp3_buf_len(&buf), ==, sconsumed);
+
+  sconsumed = nghttp3_conn_read_stream2(
+    conn, 7, ebuf.pos, nghttp3_buf_len(&ebuf), /* fin = */ 0, 3000);
+
+  assert_ptrdiff((nghttp3_ssize)nghttp3_buf_len(&ebuf), ==, sconsumed);
+
+  nghttp3_conn_get_stats(conn, &stats);
+
+  assert_uint64(2000, ==, stats.qpack_blocked_duration);
+  assert_uint64(0, ==, stats.inq_bytes);
+  assert_uint64(nghttp3_arraylen(resp_nva), ==,
+                stats.qpack_dec_static_hits + stats.qpack_dec_dynamic_hits +
+                  stats.qpack_dec_literals);
+  assert_uint64(0, <, stats.qpack_dec_dynamic_hits);
+
+  nghttp3_conn_del(conn);
+  nghttp3_qpack_encoder_free(&qenc);
+  nghttp3_buf_free(&ebuf, mem);
+
+  /* A stream blocked and unblocked with the timestamps of both
+     nghttp3_conn_read_stream2 and nghttp3_conn_read_stream, which
+     passes UINT64_MAX. */
+  for (i = 0; i < nghttp3_arraylen(mixed_ts); ++i) {
+    nghttp3_buf_init(&ebuf);
+    nghttp3_buf_wrap_init(&buf, rawbuf, sizeof(rawbuf));
+
+    nghttp3_qpack_encoder_init(&qenc, settings.qpack_max_dtable_capacity,
+                               NGHTTP3_TEST_MAP_SEED, mem);
+    nghttp3_qpack_encoder_set_max_blocked_streams(
+      &qenc, settings.qpack_blocked_streams);
+    nghttp3_qpack_encoder_set_max_dtable_capacity(
+      &qenc, settings.qpack_max_dtable_capacity);
+
+    setup_default_client_with_options(&conn, opts);
+    nghttp3_conn_bind_qpack_streams(conn, 2, 6);
+
+    rv = nghttp3_conn_submit_request(conn, 0, req_nva,
+                                     nghttp3_arraylen(req_nva), NULL, NULL);
+
+    assert_int(0, ==, rv);
+
+    nghttp3_write_frame_qpack_dyn(&buf, &ebuf, &qenc, 0, &fr);
+
+    sconsumed = nghttp3_conn_read_stream2(
+      conn, 0, buf.pos, nghttp3_buf_len(&buf), /* fin = */ 0, mixed_ts[i][0]);
+
+    assert_ptrdiff(0, <, sconsumed);
+
+    nghttp3_buf_reset(&buf);
+    buf.last =
+      nghttp3_put_uvarint(buf.last, NGHTTP3_STREAM_TYPE_QPACK_ENCODER);
+    buf.last = nghttp3_cpymem(buf.last, ebuf.pos, nghttp3_buf_len(&ebuf));
+
+    sconsumed = nghttp3_conn_read_stream2(
+      conn, 7, buf.pos, nghttp3_buf_len(&buf), /* fin = */ 0, mixed_ts[i][1]);
+
+    assert_ptrdiff((nghttp3_ssize)nghttp3_buf_len(&buf), ==, sconsumed);
+
+    nghttp3_conn_get_stats(conn, &stats);
+
+    assert_uint64(1, ==, stats.qpack_blocked);
+    assert_uint64(0, ==, stats.qpack_blocked_duration);
+    assert_uint64(0, ==, stats.inq_bytes);
+
+    nghttp3_conn_del(conn);
+    nghttp3_qpack_encoder_free(&qenc);
+    nghttp3_buf_free(&ebuf, mem);
+  }
+}
+
+static size_t conn_mem_usage_sum(const nghttp3_conn_mem_usage *mu) {
+  return mu->conn + mu->out_chunk_objalloc + mu->stream_objalloc +
+         mu->qpack_encoder_dtable + mu->qpack_decoder_dtable + mu->stream_inq +
+         mu->stream_outq + mu->stream_chunks + mu->map + mu->ksl +
+         mu->qpack_buf;
+}
+
+void test_nghttp3_conn_get_mem_usage(void) {
+  const nghttp3_mem *mem = nghttp3_mem_default();
+  nghttp3_conn *conn;
+  nghttp3_settings settings;
+  nghttp3_qpack_encoder qenc;
+  nghttp3_conn_mem_usage mu;
+  uint8_t rawbuf[4096];
+  nghttp3_buf buf, ebuf;
+  nghttp3_frame fr;
+  nghttp3_ssize sconsumed;
+  conn_options opts;
+  int rv;
+
+  /* Freshly created connection */
+  setup_default_client(&conn);
+
+  nghttp3_conn_get_mem_usage(conn, &mu);
+
+  assert_size(sizeof(nghttp3_conn), ==, mu.conn);
+  assert_size(0, ==, mu.qpack_encoder_dtable);
+  assert_size(0, ==, mu.qpack_decoder_dtable);
+  assert_size(0, ==, mu.stream_inq);
+  assert_size(0, ==, mu.ksl);
+  assert_size(conn_mem_usage_sum(&mu), ==, mu.total);
+
+  conn_write_initial_streams(conn);
+
+  rv = nghttp3_conn_submit_request(conn, 0, req_nva, nghttp3_arraylen(req_nva),
+                                   NULL, NULL);
+
+  assert_int(0, ==, rv);
+
+  nghttp3_conn_get_mem_usage(conn, &mu);
+
+  assert_size(0, <, mu.map);
+  assert_size(0, <, mu.stream_outq);
+  assert_size(0, <, mu.stream_chunks);
+#ifndef NOMEMPOOL
+  assert_size(0, <, mu.stream_objalloc);
+  assert_size(0, <, mu.out_chunk_objalloc);
+#endif /* !defined(NOMEMPOOL) */
+  assert_size(conn_mem_usage_sum(&mu), ==, mu.total);
+
+  nghttp3_conn_del(conn);
+
+  /* A stream blocked by QPACK decoder, and QPACK dynamic table */
+  nghttp3_settings_default(&settings);
+  settings.qpack_max_dtable_capacity = 4096;
+  settings.qpack_blocked_streams = 100;
+
+  nghttp3_buf_init(&ebuf);
+  nghttp3_buf_wrap_init(&buf, rawbuf, sizeof(rawbuf));
+
+  nghttp3_qpack_encoder_init(&qenc, settings.qpack_max_dtable_capacity,
+                             NGHTTP3_TEST_MAP_SEED, mem);
+  nghttp3_qpack_encoder_set_max_blocked_streams(&qenc,
+                                                settings.qpack_blocked_streams);
+  nghttp3_qpack_encoder_set_max_dtable_capacity(
+    &qenc, settings.qpack_max_dtable_capacity);
+
+  opts = (conn_options){
+    .settings = &settings,
+  };
+
+  setup_default_client_with_options(&conn, opts);
+  nghttp3_conn_bind_qpack_streams(conn, 2, 6);
+
+  rv = nghttp3_conn_submit_request(conn, 0, req_nva, nghttp3_arraylen(req_nva),
+                                   NULL, NULL);
+
+  assert_int(0, ==, rv);
+
+  fr.headers = (nghttp3_frame_headers){
+    .type = NGHTTP3_FRAME_HEADERS,
+    .nva = (nghttp3_nv *)resp_nva,
+    .nvlen = nghttp3_arraylen(resp_nva),
+  };
+
+  nghttp3_write_frame_qpack_dyn(&buf, &ebuf, &qenc, 0, &fr);
+
+  sconsumed = nghttp3_conn_read_stream2(conn, 0, buf.pos, nghttp3_buf_len(&buf),
+                                        /* fin = */ 0, 0);
+
+  assert_ptrdiff(0, <, sconsumed);
+
+  nghttp3_conn_get_mem_usage(conn, &mu);
+
+#ifndef NOMEMPOOL
+  assert_size(NGHTTP3_STREAM_INQ_CHUNK_SIZE, <=, mu.stream_inq);
+#endif /* !defined(NOMEMPOOL) */
+  assert_size(0, ==, mu.qpack_decoder_dtable);
+  assert_size(conn_mem_usage_sum(&mu), ==, mu.total);
+
+  nghttp3_buf_reset(&buf);
+  buf.last = nghttp3_put_uvarint(buf.last, NGHTTP3_STREAM_TYPE_QPACK_ENCODER);
+
+  sconsumed = nghttp3_conn_read_stream2(conn, 7, buf.pos, nghttp3_buf_len(&buf),
+                                        /* fin = */ 0, 0);
+
+  assert_ptrdiff((nghttp3_ssize)nghttp3_buf_len(&buf), ==, sconsumed);
+
+  sconsumed = nghttp3_conn_read_stream2(
+    conn, 7, ebuf.pos, nghttp3_buf_len(&ebuf), /* fin = */ 0, 0);
+
+  assert_ptrdiff((nghttp3_ssize)nghttp3_buf_len(&ebuf), ==, sconsumed);
+
+  nghttp3_conn_get_mem_usage(conn, &mu);
+
+  assert_size(0, <, mu.qpack_decoder_dtable);
+  assert_size(0, <, mu.qpack_buf);
+  assert_size(conn_mem_usage_sum(&mu), ==, mu.total);
+
+  nghttp3_conn_del(conn);
+  nghttp3_qpack_encoder_free(&qenc);
+  nghttp3_buf_free(&ebuf, mem);
+}
+
+void test_nghttp3_conn_shrink(void) {
+  nghttp3_conn *conn;
+  nghttp3_conn_mem_usage mu, nmu;
+  nghttp3_vec vec[256];
+  nghttp3_ssize sveccnt;
+  int64_t stream_id;
+  int fin;
+  size_t i;
+  int rv;
+
+  setup_default_client(&conn);
+  conn_write_initial_streams(conn);
+
+  for (i = 0; i < 64; ++i) {
+    rv = nghttp3_conn_submit_request(conn, (int64_t)(i * 4), req_nva,
+                                     nghttp3_arraylen(req_nva), NULL, NULL);
+
+    assert_int(0, ==, rv);
+  }
+
+  for (;;) {
+    sveccnt = nghttp3_conn_writev_stream(conn, &stream_id, &fin, vec,
+                                         nghttp3_arraylen(vec));
+
+    assert_ptrdiff(0, <=, sveccnt);
+
+    if (stream_id == -1) {
+      break;
+    }
+
+    rv = nghttp3_conn_add_write_offset(
+      conn, stream_id, (size_t)nghttp3_vec_len(vec, (size_t)sveccnt));
+
+    assert_int(0, ==, rv);
+  }
+
+  for (i = 0; i < 64; ++i) {
+    rv = nghttp3_conn_close_stream(conn, (int64_t)(i * 4), NGHTTP3_H3_NO_ERROR);
+
+    assert_int(0, ==, rv);
+  }
+
+  nghttp3_conn_get_mem_usage(conn, &mu);
+
+  rv = nghttp3_conn_shrink(conn);
+
+  assert_int(0, ==, rv);
+
+  nghttp3_conn_get_mem_usage(conn, &nmu);
+
+  assert_size(mu.map, >, nmu.map);
+  assert_size(mu.stream_outq, >, nmu.stream_outq);
+  assert_size(0, ==, nmu.qpack_buf);
+#ifndef NOMEMPOOL
+  assert_size(mu.stream_objalloc, >, nmu.stream_objalloc);
+  assert_size(0, <, nmu.stream_objalloc);
+  assert_size(mu.out_chunk_objalloc, >, nmu.out_chunk_objalloc);
+#endif /* !defined(NOMEMPOOL) */
+
+  /* Shrinking again does not release anything more. */
+  rv = nghttp3_conn_shrink(conn);
+
+  assert_int(0, ==, rv);
+
+  nghttp3_conn_get_mem_usage(conn, &mu);
+
+  assert_size(nmu.total, ==, mu.total);
+
+  /* The connection still works after shrinking. */
+  rv = nghttp3_conn_submit_request(conn, 256, req_nva,
+                                   nghttp3_arraylen(req_nva), NULL, NULL);
+
+  assert_int(0, ==, rv);
+
+  sveccnt = nghttp3_conn_writev_stream(conn, &stream_id, &fin, vec,
+                                       nghttp3_arraylen(vec));
+
+  assert_ptrdiff(0, <, sveccnt);
+  assert_int64(256, ==, stream_id);
+  assert_true(fin);
+
+  nghttp3_conn_del(conn);
+}
+
+void test_nghttp3_conn_writev_streams(void) {
+  nghttp3_conn *conn;
+  nghttp3_callbacks callbacks = {0};
+  userdata ud;
+  conn_options opts;
+  nghttp3_data_reader dr = {
+    .read_data = step_read_data,
+  };
+  nghttp3_stream_vec svec[16];
+  nghttp3_vec vec[256];
+  nghttp3_ssize nsvec, sveccnt;
+  int64_t stream_id;
+  int fin;
+  size_t batch_sent[4] = {0}, sent[4] = {0};
+  size_t nfin, nbatch, ntotal;
+  size_t i, j, len;
+  int multi = 0;
+  int rv;
+
+  /* Batched writes send the same data as repeated calls of
+     nghttp3_conn_writev_stream. */
+  for (j = 0; j < 2; ++j) {
+    ud = (userdata){
+      .data.left = 40000,
+      .data.step = 1111,
+    };
+
+    opts = (conn_options){
+      .callbacks = &callbacks,
+      .user_data = &ud,
+    };
+
+    setup_default_client_with_options(&conn, opts);
+
+    for (i = 0; i < nghttp3_arraylen(sent); ++i) {
+      rv = nghttp3_conn_submit_request(conn, (int64_t)(i * 4), req_nva,
+                                       nghttp3_arraylen(req_nva), &dr, NULL);
+
+      assert_int(0, ==, rv);
+    }
+
+    nfin = 0;
+
+    if (j == 0) {
+      for (;;) {
+        nsvec = nghttp3_conn_writev_streams(conn, svec, nghttp3_arraylen(svec),
+                                            vec, nghttp3_arraylen(vec), 3000);
+
+        assert_ptrdiff(0, <=, nsvec);
+
+        if (nsvec == 0) {
+          break;
+        }
+
+        multi |= nsvec > 1;
+
+        len = 0;
+
+        for (i = 0; i < (size_t)nsvec; ++i) {
+          assert_true(svec[i].veccnt > 0 || svec[i].fin);
+
+          if (i > 0) {
+            assert_ptr_equal(svec[i - 1].vec + svec[i - 1].veccnt,
+                             svec[i].vec);
+          }
+
+          len += (size_t)nghttp3_vec_len(svec[i].vec, svec[i].veccnt);
+        }
+
+        assert_size(3000, >=, len);
+
+        for (i = 0; i < (size_t)nsvec; ++i) {
+          len = (size_t)nghttp3_vec_len(svec[i].vec, svec[i].veccnt);
+
+          if (nghttp3_client_stream_bidi(svec[i].stream_id)) {
+            batch_sent[svec[i].stream_id / 4] += len;
+            nfin += svec[i].fin != 0;
+          }
+
+          rv = nghttp3_conn_add_write_offset(conn, svec[i].stream_id, len);
+
+          assert_int(0, ==, rv);
+        }
+      }
+    } else {
+      for (;;) {
+        sveccnt = nghttp3_conn_writev_stream(conn, &stream_id, &fin, vec,
+                                             nghttp3_arraylen(vec));
+
+        assert_ptrdiff(0, <=, sveccnt);
+
+        if (stream_id == -1) {
+          break;
+        }
+
+        len = (size_t)nghttp3_vec_len(vec, (size_t)sveccnt);
+
+        if (nghttp3_client_stream_bidi(stream_id)) {
+          sent[stream_id / 4] += len;
+          nfin += fin != 0;
+        }
+
+        rv = nghttp3_conn_add_write_offset(conn, stream_id, len);
+
+        assert_int(0, ==, rv);
+      }
+    }
+
+    assert_size(nghttp3_arraylen(sent), ==, nfin);
+
+    nghttp3_conn_del(conn);
+  }
+
+  assert_true(multi);
+
+  nbatch = ntotal = 0;
+
+  for (i = 0; i < nghttp3_arraylen(sent); ++i) {
+    assert_size(0, <, batch_sent[i]);
+
+    nbatch += batch_sent[i];
+    ntotal += sent[i];
+  }
+
+  assert_size(ntotal, ==, nbatch);
+
+  /* The last stream data is truncated to fit in maxlen. */
+  setup_default_client(&conn);
+
+  rv = nghttp3_conn_submit_request(conn, 0, req_nva, nghttp3_arraylen(req_nva),
+                                   NULL, NULL);
+
+  assert_int(0, ==, rv);
+
+  nsvec = nghttp3_conn_writev_streams(conn, svec, nghttp3_arraylen(svec), vec,
+                                      nghttp3_arraylen(vec), 5);
+
+  assert_ptrdiff(1, ==, nsvec);
+  assert_int64(conn->tx.ctrl->node.id, ==, svec[0].stream_id);
+  assert_uint64(5, ==, nghttp3_vec_len(svec[0].vec, svec[0].veccnt));
+  assert_false(svec[0].fin);
+
+  rv = nghttp3_conn_add_write_offset(conn, svec[0].stream_id, 5);
+
+  assert_int(0, ==, rv);
+
+  nsvec = nghttp3_conn_writev_streams(conn, svec, nghttp3_arraylen(svec), vec,
+                                      nghttp3_arraylen(vec), 4096);
+
+  assert_ptrdiff(4, ==, nsvec);
+  assert_int64(conn->tx.ctrl->node.id, ==, svec[0].stream_id);
+  assert_int64(conn->tx.qdec->node.id, ==, svec[1].stream_id);
+  assert_int64(conn->tx.qenc->node.id, ==, svec[2].stream_id);
+  assert_int64(0, ==, svec[3].stream_id);
+  assert_true(svec[3].fin);
+
+  /* Only a single nghttp3_stream_vec fits. */
+  nsvec = nghttp3_conn_writev_streams(conn, svec, 1, vec,
+                                      nghttp3_arraylen(vec), 4096);
+
+  assert_ptrdiff(1, ==, nsvec);
+  assert_int64(conn->tx.ctrl->node.id, ==, svec[0].stream_id);
+
+  nghttp3_conn_del(conn);
+}
+
+typedef struct lifo_sched {
+  int64_t ids[16];
+  size_t nids;
+  size_t nschedule;
+  size_t nunschedule;
+  size_t non_written;
+  uint64_t nwrite;
+} lifo_sched;
+
+static int lifo_sched_schedule(nghttp3_conn *conn, int64_t stream_id,
+                               const nghttp3_pri *pri, void *sched_user_data) {
+  lifo_sched *ls = sched_user_data;
+  (void)conn;
+  (void)pri;
+
+  assert_size(nghttp3_arraylen(ls->ids), >, ls->nids);
+
+  ls->ids[ls->nids++] = stream_id;
+  ++ls->nschedule;
+
+  return 0;
+}
+
+static void lifo_sched_unschedule(nghttp3_conn *conn, int64_t stream_id,
+                                  void *sched_user_data) {
+  lifo_sched *ls = sched_user_data;
+  size_t i;
+  (void)conn;
+
+  for (i = 0; i < ls->nids; ++i) {
+    if (ls->ids[i] == stream_id) {
+      memmove(&ls->ids[i], &ls->ids[i + 1],
+              sizeof(ls->ids[0]) * (ls->nids - i - 1));
+      --ls->nids;
+      ++ls->nunschedule;
+
+      return;
+    }
+  }
+
+  assert_true(0);
+}
+
+static int64_t lifo_sched_next(nghttp3_conn *conn, void *sched_user_data) {
+  lifo_sched *ls = sched_user_data;
+  (void)conn;
+
+  if (ls->nids == 0) {
+    return -1;
+  }
+
+  return ls->ids[ls->nids - 1];
+}
+
+static int lifo_sched_on_written(nghttp3_conn *conn, int64_t stream_id,
+                                 uint64_t nwrite, void *sched_user_data) {
+  lifo_sched *ls = sched_user_data;
+  (void)conn;
+  (void)stream_id;
+
+  ++ls->non_written;
+  ls->nwrite += nwrite;
+
+  return 0;
+}
+
+void test_nghttp3_conn_set_scheduler(void) {
+  nghttp3_conn *conn;
+  nghttp3_callbacks callbacks = {0};
+  userdata ud;
+  conn_options opts;
+  nghttp3_data_reader dr = {
+    .read_data = step_read_data,
+  };
+  nghttp3_scheduler sched = {
+    .schedule = lifo_sched_schedule,
+    .unschedule = lifo_sched_unschedule,
+    .next = lifo_sched_next,
+    .on_written = lifo_sched_on_written,
+  };
+  nghttp3_scheduler bad_sched = {
+    .schedule = lifo_sched_schedule,
+  };
+  lifo_sched ls = {0};
+  nghttp3_vec vec[256];
+  nghttp3_ssize sveccnt;
+  int64_t stream_id;
+  int64_t order[3];
+  size_t norder = 0;
+  int fin;
+  size_t i;
+  int rv;
+
+  ud = (userdata){
+    .data.left = 3000,
+    .data.step = 1000,
+  };
+
+  opts = (conn_options){
+    .callbacks = &callbacks,
+    .user_data = &ud,
+  };
+
+  setup_default_client_with_options(&conn, opts);
+
+  rv = nghttp3_conn_set_scheduler(conn, &bad_sched, NULL);
+
+  assert_int(NGHTTP3_ERR_INVALID_ARGUMENT, ==, rv);
+
+  rv = nghttp3_conn_set_scheduler(conn, &sched, &ls);
+
+  assert_int(0, ==, rv);
+
+  /* Streams are written in the order the scheduler decides. */
+  for (i = 0; i < 3; ++i) {
+    rv = nghttp3_conn_submit_request(conn, (int64_t)(i * 4), req_nva,
+                                     nghttp3_arraylen(req_nva), NULL, NULL);
+
+    assert_int(0, ==, rv);
+  }
+
+  assert_size(3, ==, ls.nschedule);
+
+  /* The scheduler cannot be replaced while streams are scheduled. */
+  rv = nghttp3_conn_set_scheduler(conn, NULL, NULL);
+
+  assert_int(NGHTTP3_ERR_INVALID_STATE, ==, rv);
+
+  for (;;) {
+    sveccnt = nghttp3_conn_writev_stream(conn, &stream_id, &fin, vec,
+                                         nghttp3_arraylen(vec));
+
+    assert_ptrdiff(0, <=, sveccnt);
+
+    if (stream_id == -1) {
+      break;
+    }
+
+    if (nghttp3_client_stream_bidi(stream_id)) {
+      assert_true(fin);
+      assert_size(nghttp3_arraylen(order), >, norder);
+
+      order[norder++] = stream_id;
+    }
+
+    rv = nghttp3_conn_add_write_offset(
+      conn, stream_id, (size_t)nghttp3_vec_len(vec, (size_t)sveccnt));
+
+    assert_int(0, ==, rv);
+  }
+
+  assert_size(3, ==, norder);
+  assert_int64(8, ==, order[0]);
+  assert_int64(4, ==, order[1]);
+  assert_int64(0, ==, order[2]);
+  assert_size(3, ==, ls.nunschedule);
+  assert_size(0, ==, ls.nids);
+
+  /* Partial write of a scheduled stream is reported. */
+  rv = nghttp3_conn_submit_request(conn, 12, req_nva,
+                                   nghttp3_arraylen(req_nva), &dr, NULL);
+
+  assert_int(0, ==, rv);
+
+  sveccnt = nghttp3_conn_writev_stream(conn, &stream_id, &fin, vec,
+                                       nghttp3_arraylen(vec));
+
+  assert_ptrdiff(0, <, sveccnt);
+  assert_int64(12, ==, stream_id);
+
+  rv = nghttp3_conn_add_write_offset(conn, stream_id, 1);
+
+  assert_int(0, ==, rv);
+  assert_size(1, ==, ls.non_written);
+  assert_uint64(1, ==, ls.nwrite);
+  assert_size(1, ==, ls.nids);
+
+  rv = nghttp3_conn_close_stream(conn, 12, NGHTTP3_H3_NO_ERROR);
+
+  assert_int(0, ==, rv);
+  assert_size(0, ==, ls.nids);
+
+  /* The built-in scheduler can be restored. */
+  rv = nghttp3_conn_set_scheduler(conn, NULL, NULL);
+
+  assert_int(0, ==, rv);
+
+  rv = nghttp3_conn_submit_request(conn, 16, req_nva,
+                                   nghttp3_arraylen(req_nva), NULL, NULL);
+
+  assert_int(0, ==, rv);
+  assert_size(4, ==, ls.nschedule);
+
+  sveccnt = nghttp3_conn_writev_stream(conn, &stream_id, &fin, vec,
+                                       nghttp3_arraylen(vec));
+
+  assert_ptrdiff(0, <, sveccnt);
+  assert_int64(16, ==, stream_id);
+
+  nghttp3_conn_del(conn);
+}
+
+void test_nghttp3_conn_read_data_veccnt(void) {
+  nghttp3_conn *conn;
+  nghttp3_stream *stream;
+  nghttp3_settings settings;
+  userdata ud;
+  conn_options opts;
+  nghttp3_data_reader dr = {
+    .read_data = fill_read_data,
+  };
+  nghttp3_vec vec[256];
+  nghttp3_ssize sveccnt;
+  int64_t stream_id;
+  int fin;
+  size_t i;
+  int rv;
+  static const struct {
+    size_t veccnt;
+    size_t watermark;
+    size_t expected_veccnt;
+  } tests[] = {
+    {NGHTTP3_DEFAULT_READ_DATA_VECCNT, 0, NGHTTP3_DEFAULT_READ_DATA_VECCNT},
+    {1, 0, 1},
+    {32, 65536, 32},
+    /* 0 falls back to the default. */
+    {0, 0, NGHTTP3_DEFAULT_READ_DATA_VECCNT},
+    /* A too large value is clamped to the maximum. */
+    {NGHTTP3_MAX_READ_DATA_VECCNT + 1, 0, NGHTTP3_MAX_READ_DATA_VECCNT},
+  };
+
+  for (i = 0; i < nghttp3_arraylen(tests); ++i) {
+    nghttp3_settings_default(&settings);
+    settings.read_data_veccnt = tests[i].veccnt;
+    settings.unsent_bytes_watermark = tests[i].watermark;
+
+    ud = (userdata){
+      .data.left = 1000000,
+      .data.step = 100,
+    };
+
+    opts = (conn_options){
+      .settings = &settings,
+      .user_data = &ud,
+    };
+
+    setup_default_server_with_options(&conn, opts);
+    conn_write_initial_streams(conn);
+    conn->remote.bidi.max_client_streams = 1;
+
+    nghttp3_conn_create_stream(conn, &stream, 0);
+
+    rv = nghttp3_conn_submit_response(conn, 0, resp_nva,
+                                      nghttp3_arraylen(resp_nva), &dr);
+
+    assert_int(0, ==, rv);
+
+    sveccnt = nghttp3_conn_writev_stream(conn, &stream_id, &fin, vec,
+                                         nghttp3_arraylen(vec));
+
+    assert_int64(0, ==, stream_id);
+    assert_ptrdiff(0, <, sveccnt);
+    assert_size(tests[i].expected_veccnt, ==,
+                conn->local.settings.read_data_veccnt);
+    assert_size(tests[i].expected_veccnt, ==, ud.data.veccnt);
+
+    if (tests[i].watermark == 0) {
+      /* Only a single DATA frame is generated. */
+      assert_size(1000000 - tests[i].expected_veccnt * 100, ==,
+                  ud.data.left);
+    } else {
+      /* The library stops reading body as soon as the watermark is
+         reached.  A single DATA frame is at most 3 bytes of frame
+         header plus veccnt * 100 bytes of payload. */
+      assert_uint64(tests[i].watermark, <=, stream->unsent_bytes);
+      assert_uint64(tests[i].watermark + 3 + tests[i].expected_veccnt * 100,
+                    >, stream->unsent_bytes);
+    }
+
+    nghttp3_conn_del(conn);
+  }
+}
+
+void test_nghttp3_conn_data_coalesce(void) {
+  nghttp3_conn *conn;
+  nghttp3_stream *stream;
+  nghttp3_settings settings;
+  conn_options opts;
+  nghttp3_data_reader dr = {
+    .read_data = coalesce_read_data,
+  };
+  coalesce_source cs;
+  nghttp3_vec vec[256];
+  nghttp3_ssize sveccnt;
+  int64_t stream_id;
+  int fin;
+  size_t i;
+  int rv;
+  static const struct {
+    uint64_t coalesce_size;
+    size_t read_data_veccnt;
+    size_t left;
+    size_t flush_at;
+    size_t block_at;
+    size_t empty_at;
+    /* ncalled is the expected number of read_data calls. */
+    size_t ncalled;
+    /* datalen is the expected payload length of DATA frame. */
+    uint64_t datalen;
+  } tests[] = {
+    /* Coalescing is disabled */
+    {0, 8, 10000, 0, 0, 0, 1, 100},
+    /* Gather until the size is reached */
+    {1000, 16, 10000, 0, 0, 0, 10, 1000},
+    /* Gather until the vecs run out */
+    {1000, 8, 10000, 0, 0, 0, 8, 800},
+    /* Flush hint */
+    {1000, 16, 10000, 3, 0, 0, 3, 300},
+    /* End of body */
+    {1000, 16, 500, 0, 0, 0, 5, 500},
+    /* Blocked */
+    {1000, 16, 10000, 0, 5, 0, 5, 400},
+    /* No data without flags */
+    {1000, 16, 10000, 0, 0, 4, 4, 300},
+  };
+
+  for (i = 0; i < nghttp3_arraylen(tests); ++i) {
+    nghttp3_settings_default(&settings);
+    settings.data_coalesce_size = tests[i].coalesce_size;
+    settings.read_data_veccnt = tests[i].read_data_veccnt;
+
+    cs = (coalesce_source){
+      .left = tests[i].left,
+      .flush_at = tests[i].flush_at,
+      .block_at = tests[i].block_at,
+      .empty_at = tests[i].empty_at,
+    };
+
+    opts = (conn_options){
+      .settings = &settings,
+    };
+
+    setup_default_client_with_options(&conn, opts);
+    conn_write_initial_streams(conn);
+
+    rv = nghttp3_conn_submit_request(conn, 0, req_nva,
+                                     nghttp3_arraylen(req_nva), &dr, &cs);
+
+    assert_int(0, ==, rv);
+
+    sveccnt = nghttp3_conn_writev_stream(conn, &stream_id, &fin, vec,
+                                         nghttp3_arraylen(vec));
+
+    assert_int64(0, ==, stream_id);
+    assert_ptrdiff(0, <, sveccnt);
+    assert_size(tests[i].ncalled, ==, cs.ncalled);
+    assert_uint64(
+      1, ==, conn->stats.frame_sent[NGHTTP3_FRAME_STATS_TYPE_DATA].frames);
+    assert_uint64(tests[i].datalen, ==, conn->stats.data_bytes_sent);
+
+    stream = nghttp3_conn_find_stream(conn, 0);
+
+    assert_true(tests[i].block_at == 0 ||
+                (stream->flags & NGHTTP3_STREAM_FLAG_READ_DATA_BLOCKED));
+    assert_true(tests[i].left != tests[i].datalen ||
+                (stream->flags & NGHTTP3_STREAM_FLAG_WRITE_END_STREAM));
+
+    nghttp3_conn_del(conn);
+  }
+}
+
+void test_nghttp3_conn_shared_pool(void) {
+  nghttp3_conn *conna, *connb;
+  nghttp3_stream *stream, *streamb;
+  nghttp3_pool *pool;
+  nghttp3_settings settings;
+  nghttp3_conn_mem_usage mu;
+  conn_options opts;
+  nghttp3_vec vec[256];
+  nghttp3_ssize sveccnt;
+  int64_t stream_id;
+  int fin;
+  int rv;
+
+  rv = nghttp3_pool_new(&pool, NULL);
+
+  assert_int(0, ==, rv);
+
+  nghttp3_settings_default(&settings);
+  settings.pool = pool;
+
+  opts = (conn_options){
+    .settings = &settings,
+  };
+
+  setup_default_client_with_options(&conna, opts);
+  conn_write_initial_streams(conna);
+  setup_default_client_with_options(&connb, opts);
+  conn_write_initial_streams(connb);
+
+  assert_ptr_equal(pool, conna->pool);
+  assert_ptr_equal(pool, connb->pool);
+
+  rv = nghttp3_conn_submit_request(conna, 0, req_nva,
+                                   nghttp3_arraylen(req_nva), NULL, NULL);
+
+  assert_int(0, ==, rv);
+
+  sveccnt = nghttp3_conn_writev_stream(conna, &stream_id, &fin, vec,
+                                       nghttp3_arraylen(vec));
+
+  assert_int64(0, ==, stream_id);
+  assert_ptrdiff(0, <, sveccnt);
+
+  rv = nghttp3_conn_add_write_offset(
+    conna, stream_id, (size_t)nghttp3_vec_len(vec, (size_t)sveccnt));
+
+  assert_int(0, ==, rv);
+
+  stream = nghttp3_conn_find_stream(conna, 0);
+
+  assert_not_null(stream);
+
+  /* The pool is not owned by the connection. */
+  nghttp3_conn_get_mem_usage(conna, &mu);
+
+  assert_size(0, ==, mu.stream_objalloc);
+  assert_size(0, ==, mu.out_chunk_objalloc);
+
+  rv = nghttp3_conn_close_stream(conna, 0, NGHTTP3_H3_NO_ERROR);
+
+  assert_int(0, ==, rv);
+  assert_null(nghttp3_conn_find_stream(conna, 0));
+
+  /* The stream released by conna is reused by connb. */
+  rv = nghttp3_conn_submit_request(connb, 0, req_nva,
+                                   nghttp3_arraylen(req_nva), NULL, NULL);
+
+  assert_int(0, ==, rv);
+
+  streamb = nghttp3_conn_find_stream(connb, 0);
+
+  assert_not_null(streamb);
+#ifndef NOMEMPOOL
+  assert_ptr_equal(stream, streamb);
+#endif /* !defined(NOMEMPOOL) */
+
+  sveccnt = nghttp3_conn_writev_stream(connb, &stream_id, &fin, vec,
+                                       nghttp3_arraylen(vec));
+
+  assert_int64(0, ==, stream_id);
+  assert_ptrdiff(0, <, sveccnt);
+  assert_true(fin);
+
+  rv = nghttp3_conn_shrink(conna);
+
+  assert_int(0, ==, rv);
+
+  nghttp3_conn_del(conna);
+  nghttp3_pool_shrink(pool);
+  nghttp3_conn_del(connb);
+  nghttp3_pool_del(pool);
+}
+
+void test_nghttp3_conn_find_stream(void) {
+  nghttp3_conn *conn;
+  nghttp3_stream *stream;
+  size_t i;
+  int rv;
+
+  setup_default_client(&conn);
+
+  /* Sequential streams are stored in the slots. */
+  for (i = 0; i < 32; ++i) {
+    rv = nghttp3_conn_submit_request(conn, (int64_t)(i * 4), req_nva,
+                                     nghttp3_arraylen(req_nva), NULL, NULL);
+
+    assert_int(0, ==, rv);
+  }
+
+  assert_size(32, ==, conn->bidi_slots.len);
+  assert_size(0, ==, conn->nbidi_outliers);
+
+  for (i = 0; i < 32; ++i) {
+    stream = nghttp3_conn_find_stream(conn, (int64_t)(i * 4));
+
+    assert_not_null(stream);
+    assert_int64((int64_t)(i * 4), ==, stream->node.id);
+  }
+
+  assert_null(nghttp3_conn_find_stream(conn, 32 * 4));
+  assert_not_null(nghttp3_conn_find_stream(conn, conn->tx.ctrl->node.id));
+
+  /* A stream far ahead of the window is only in the map. */
+  rv = nghttp3_conn_submit_request(conn, 2000 * 4, req_nva,
+                                   nghttp3_arraylen(req_nva), NULL, NULL);
+
+  assert_int(0, ==, rv);
+  assert_size(1, ==, conn->nbidi_outliers);
+
+  stream = nghttp3_conn_find_stream(conn, 2000 * 4);
+
+  assert_not_null(stream);
+  assert_int64(2000 * 4, ==, stream->node.id);
+  assert_null(nghttp3_conn_find_stream(conn, 100 * 4));
+
+  /* Once the window is empty, it moves to the next stream. */
+  for (i = 0; i < 32; ++i) {
+    rv = nghttp3_conn_close_stream(conn, (int64_t)(i * 4),
+                                   NGHTTP3_H3_NO_ERROR);
+
+    assert_int(0, ==, rv);
+  }
+
+  assert_size(0, ==, conn->bidi_slots.len);
+
+  rv = nghttp3_conn_submit_request(conn, 3000 * 4, req_nva,
+                                   nghttp3_arraylen(req_nva), NULL, NULL);
+
+  assert_int(0, ==, rv);
+  assert_size(1, ==, conn->bidi_slots.len);
+  assert_uint64(3000, ==, conn->bidi_slots.base);
+  assert_not_null(nghttp3_conn_find_stream(conn, 2000 * 4));
+
+  rv = nghttp3_conn_close_stream(conn, 2000 * 4, NGHTTP3_H3_NO_ERROR);
+
+  assert_int(0, ==, rv);
+  assert_size(0, ==, conn->nbidi_outliers);
+  assert_null(nghttp3_conn_find_stream(conn, 2000 * 4));
+
+  /* The window grows up to NGHTTP3_SLOTS_MAX_NMEMB while the oldest
+     stream is alive. */
+  rv = nghttp3_conn_submit_request(
+    conn, (int64_t)(3000 + NGHTTP3_SLOTS_MAX_NMEMB - 1) * 4, req_nva,
+    nghttp3_arraylen(req_nva), NULL, NULL);
+
+  assert_int(0, ==, rv);
+  assert_size(NGHTTP3_SLOTS_MAX_NMEMB, ==, conn->bidi_slots.nmemb);
+  assert_size(0, ==, conn->nbidi_outliers);
+
+  rv = nghttp3_conn_submit_request(
+    conn, (int64_t)(3000 + NGHTTP3_SLOTS_MAX_NMEMB) * 4, req_nva,
+    nghttp3_arraylen(req_nva), NULL, NULL);
+
+  assert_int(0, ==, rv);
+  assert_size(1, ==, conn->nbidi_outliers);
+
+  /* The window slides past the released streams. */
+  rv = nghttp3_conn_close_stream(conn, 3000 * 4, NGHTTP3_H3_NO_ERROR);
+
+  assert_int(0, ==, rv);
+
+  rv = nghttp3_conn_submit_request(
+    conn, (int64_t)(3000 + NGHTTP3_SLOTS_MAX_NMEMB + 1) * 4, req_nva,
+    nghttp3_arraylen(req_nva), NULL, NULL);
+
+  assert_int(0, ==, rv);
+  assert_size(1, ==, conn->nbidi_outliers);
+  assert_uint64(3002, ==, conn->bidi_slots.base);
+
+  for (i = NGHTTP3_SLOTS_MAX_NMEMB - 1; i <= NGHTTP3_SLOTS_MAX_NMEMB + 1;
+       ++i) {
+    stream = nghttp3_conn_find_stream(conn, (int64_t)(3000 + i) * 4);
+
+    assert_not_null(stream);
+    assert_int64((int64_t)(3000 + i) * 4, ==, stream->node.id);
+  }
+
+  nghttp3_conn_del(conn);
+}
+
+void test_nghttp3_conn_submit_request_data_buf(void) {
+  nghttp3_conn *conn;
+  nghttp3_callbacks callbacks = {
+    .acked_stream_data = acked_stream_data,
+  };
+  userdata ud = {0};
+  conn_options opts;
+  nghttp3_data_buf_reader dbr = {
+    .read_data_buf = release_read_data_buf,
+  };
+  size_t released[3][3] = {0};
+  uint64_t written[3] = {0};
+  nghttp3_vec vec[256];
+  nghttp3_ssize sveccnt;
+  int64_t stream_id;
+  int fin;
+  uint64_t len, hdlen;
+  size_t i;
+  int rv;
+
+  opts = (conn_options){
+    .callbacks = &callbacks,
+    .user_data = &ud,
+  };
+
+  setup_default_client_with_options(&conn, opts);
+
+  for (i = 0; i < nghttp3_arraylen(released); ++i) {
+    rv = nghttp3_conn_submit_request_data_buf(
+      conn, (int64_t)(i * 4), req_nva, nghttp3_arraylen(req_nva), &dbr,
+      released[i]);
+
+    assert_int(0, ==, rv);
+  }
+
+  for (;;) {
+    sveccnt = nghttp3_conn_writev_stream(conn, &stream_id, &fin, vec,
+                                         nghttp3_arraylen(vec));
+
+    assert_ptrdiff(0, <=, sveccnt);
+
+    if (stream_id < 0) {
+      break;
+    }
+
+    len = nghttp3_vec_len(vec, (size_t)sveccnt);
+
+    rv = nghttp3_conn_add_write_offset(conn, stream_id, len);
+
+    assert_int(0, ==, rv);
+
+    if (nghttp3_client_stream_bidi(stream_id)) {
+      written[stream_id / 4] += len;
+    } else {
+      rv = nghttp3_conn_add_ack_offset(conn, stream_id, len);
+
+      assert_int(0, ==, rv);
+    }
+  }
+
+  /* 0 length buffer is released immediately. */
+  for (i = 0; i < nghttp3_arraylen(released); ++i) {
+    assert_uint64(300, <, written[i]);
+    assert_size(0, ==, released[i][0]);
+    assert_size(1, ==, released[i][1]);
+    assert_size(0, ==, released[i][2]);
+  }
+
+  /* Release each buffer as soon as it is fully acknowledged. */
+  hdlen = written[0] - 300;
+
+  rv = nghttp3_conn_update_ack_offset(conn, 0, hdlen + 99);
+
+  assert_int(0, ==, rv);
+  assert_size(0, ==, released[0][0]);
+  assert_uint64(99, ==, ud.ack.acc);
+
+  rv = nghttp3_conn_update_ack_offset(conn, 0, hdlen + 100);
+
+  assert_int(0, ==, rv);
+  assert_size(1, ==, released[0][0]);
+  assert_size(0, ==, released[0][2]);
+
+  rv = nghttp3_conn_update_ack_offset(conn, 0, written[0] - 1);
+
+  assert_int(0, ==, rv);
+  assert_size(0, ==, released[0][2]);
+
+  rv = nghttp3_conn_update_ack_offset(conn, 0, written[0]);
+
+  assert_int(0, ==, rv);
+  assert_size(1, ==, released[0][2]);
+  assert_uint64(300, ==, ud.ack.acc);
+
+  /* Closing stream releases the buffers which are not acknowledged
+     yet. */
+  rv = nghttp3_conn_update_ack_offset(conn, 4, written[1] - 200);
+
+  assert_int(0, ==, rv);
+  assert_size(1, ==, released[1][0]);
+  assert_size(0, ==, released[1][2]);
+
+  rv = nghttp3_conn_close_stream(conn, 4, NGHTTP3_H3_NO_ERROR);
+
+  assert_int(0, ==, rv);
+  assert_size(1, ==, released[1][0]);
+  assert_size(1, ==, released[1][1]);
+  assert_size(1, ==, released[1][2]);
+
+  /* Deleting connection releases the remaining buffers. */
+  nghttp3_conn_del(conn);
+
+  assert_size(1, ==, released[2][0]);
+  assert_size(1, ==, released[2][1]);
+  assert_size(1, ==, released[2][2]);
+}
+
+void test_nghttp3_conn_recv_uni(void) {
+  nghttp3_conn *conn;
+  nghttp3_ssize nread;
+  uint8_t buf[256];
+  size_t i;
+
+  /* 0 length unidirectional stream must be ignored */
+  setup_default_client(&conn);
+
+  nread = nghttp3_conn_read_stream2(conn, 3, NULL, 0, /* fin = */ 1, 0);
+
+  assert_ptrdiff(0, ==, nread);
+  assert_null(nghttp3_conn_find_stream(conn, 3));
+
+  nghttp3_conn_del(conn);
+
+  /* 0 length unidirectional stream; first get 0 length without fin,
+     and then get 0 length with fin. */
+  setup_default_client(&conn);
+
+  nread = nghttp3_conn_read_stream2(conn, 3, NULL, 0, /* fin = */ 0, 0);
+
+  assert_ptrdiff(0, ==, nread);
+  assert_not_null(nghttp3_conn_find_stream(conn, 3));
+
+  nread = nghttp3_conn_read_stream2(conn, 3, NULL, 0, /* fin = */ 1, 0);
 
   assert_ptrdiff(0, ==, nread);
   assert_null(nghttp3_conn_find_stream(conn, 3));
@@ -6754,6 +8671,93 @@ void test_nghttp3_conn_recv_unknown_frame(void) {
   nghttp3_conn_del(conn);
 }
 
+void test_nghttp3_conn_read_bidi_frame_boundary(void) {
+  const nghttp3_mem *mem = nghttp3_mem_default();
+  nghttp3_conn *conn;
+  static const nghttp3_callbacks callbacks = {
+    .recv_data = recv_data,
+    .end_stream = end_stream,
+  };
+  uint8_t rawbuf[1024];
+  nghttp3_buf buf;
+  nghttp3_frame fr;
+  nghttp3_ssize nconsumed;
+  nghttp3_qpack_encoder qenc;
+  nghttp3_stream *stream;
+  nghttp3_conn_stats stats;
+  userdata ud;
+  conn_options opts;
+  size_t hdlen, i;
+
+  nghttp3_buf_wrap_init(&buf, rawbuf, sizeof(rawbuf));
+  nghttp3_qpack_encoder_init(&qenc, 0, NGHTTP3_TEST_MAP_SEED, mem);
+
+  fr.headers = (nghttp3_frame_headers){
+    .type = NGHTTP3_FRAME_HEADERS,
+    .nva = (nghttp3_nv *)req_nva,
+    .nvlen = nghttp3_arraylen(req_nva),
+  };
+
+  nghttp3_write_frame_qpack(&buf, &qenc, 0, &fr);
+
+  hdlen = nghttp3_buf_len(&buf);
+
+  nghttp3_write_frame_data(&buf, 111);
+
+  /* The whole request, split at every possible position including
+     the middle of frame type and length. */
+  for (i = 1; i <= nghttp3_buf_len(&buf); ++i) {
+    ud = (userdata){0};
+    opts = (conn_options){
+      .callbacks = &callbacks,
+      .user_data = &ud,
+    };
+
+    setup_default_server_with_options(&conn, opts);
+
+    nconsumed =
+      nghttp3_conn_read_stream2(conn, 0, buf.pos, i, /* fin = */ 0, 0);
+
+    assert_ptrdiff(0, <=, nconsumed);
+
+    nconsumed = nghttp3_conn_read_stream2(
+      conn, 0, buf.pos + i, nghttp3_buf_len(&buf) - i, /* fin = */ 1, 0);
+
+    assert_ptrdiff(0, <=, nconsumed);
+    assert_uint64(111, ==, ud.recv_data_cb.datalen);
+    assert_size(1, ==, ud.end_stream_cb.ncalled);
+
+    stream = nghttp3_conn_find_stream(conn, 0);
+
+    assert_int(NGHTTP3_HTTP_STATE_REQ_END, ==, stream->rx.hstate);
+    assert_int(NGHTTP3_REQ_STREAM_STATE_FRAME_TYPE, ==, stream->rstate.state);
+
+    nghttp3_conn_get_stats(conn, &stats);
+
+    assert_uint64(1, ==,
+                  stats.frame_recv[NGHTTP3_FRAME_STATS_TYPE_HEADERS].frames);
+    assert_uint64(hdlen, ==,
+                  stats.frame_recv[NGHTTP3_FRAME_STATS_TYPE_HEADERS].bytes);
+    assert_uint64(1, ==,
+                  stats.frame_recv[NGHTTP3_FRAME_STATS_TYPE_DATA].frames);
+    assert_uint64(nghttp3_buf_len(&buf) - hdlen, ==,
+                  stats.frame_recv[NGHTTP3_FRAME_STATS_TYPE_DATA].bytes);
+
+    nghttp3_conn_del(conn);
+  }
+
+  /* Frame header is truncated by the end of stream. */
+  setup_default_server(&conn);
+
+  nconsumed = nghttp3_conn_read_stream2(conn, 0, buf.pos, 1, /* fin = */ 1, 0);
+
+  assert_ptrdiff(NGHTTP3_ERR_H3_FRAME_ERROR, ==, nconsumed);
+
+  nghttp3_conn_del(conn);
+
+  nghttp3_qpack_encoder_free(&qenc);
+}
+
 void test_nghttp3_conn_get_stream_user_data(void) {
   nghttp3_conn *conn;
   int64_t stream_user_data = 0;
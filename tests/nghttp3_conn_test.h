@@ -49,10 +49,23 @@ munit_void_test_decl(test_nghttp3_conn_http_ignore_content_length)
 munit_void_test_decl(test_nghttp3_conn_http_record_request_method)
 munit_void_test_decl(test_nghttp3_conn_http_error)
 munit_void_test_decl(test_nghttp3_conn_qpack_blocked_stream)
+munit_void_test_decl(test_nghttp3_conn_max_blocked_stream_data)
 munit_void_test_decl(test_nghttp3_conn_qpack_decoder_cancel_stream)
 munit_void_test_decl(test_nghttp3_conn_just_fin)
 munit_void_test_decl(test_nghttp3_conn_submit_response_read_blocked)
+munit_void_test_decl(test_nghttp3_conn_submit_response_fd)
 munit_void_test_decl(test_nghttp3_conn_submit_info)
+munit_void_test_decl(test_nghttp3_conn_submit_prepared)
+munit_void_test_decl(test_nghttp3_conn_get_stats)
+munit_void_test_decl(test_nghttp3_conn_get_mem_usage)
+munit_void_test_decl(test_nghttp3_conn_shrink)
+munit_void_test_decl(test_nghttp3_conn_writev_streams)
+munit_void_test_decl(test_nghttp3_conn_set_scheduler)
+munit_void_test_decl(test_nghttp3_conn_read_data_veccnt)
+munit_void_test_decl(test_nghttp3_conn_data_coalesce)
+munit_void_test_decl(test_nghttp3_conn_shared_pool)
+munit_void_test_decl(test_nghttp3_conn_find_stream)
+munit_void_test_decl(test_nghttp3_conn_submit_request_data_buf)
 munit_void_test_decl(test_nghttp3_conn_recv_uni)
 munit_void_test_decl(test_nghttp3_conn_recv_goaway)
 munit_void_test_decl(test_nghttp3_conn_shutdown_server)
@@ -70,6 +83,7 @@ munit_void_test_decl(test_nghttp3_conn_push)
 munit_void_test_decl(test_nghttp3_conn_recv_origin)
 munit_void_test_decl(test_nghttp3_conn_write_origin)
 munit_void_test_decl(test_nghttp3_conn_recv_unknown_frame)
+munit_void_test_decl(test_nghttp3_conn_read_bidi_frame_boundary)
 munit_void_test_decl(test_nghttp3_conn_get_stream_user_data)
 munit_void_test_decl(test_nghttp3_conn_is_stream_flushed)
 
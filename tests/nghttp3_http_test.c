@@ -28,13 +28,16 @@
 #include <assert.h>
 
 #include "nghttp3_http.h"
+#include "nghttp3_cpu.h"
 #include "nghttp3_macro.h"
 #include "nghttp3_test_helper.h"
 
 static const MunitTest tests[] = {
   munit_void_test(test_nghttp3_http_parse_priority),
   munit_void_test(test_nghttp3_check_header_value),
+  munit_void_test(test_nghttp3_http_value_scanner),
   munit_void_test(test_nghttp3_check_header_name),
+  munit_void_test(test_nghttp3_http_name_scanner),
   munit_test_end(),
 };
 
@@ -408,6 +411,47 @@ void test_nghttp3_check_header_value(void) {
   assert_false(nghttp3_check_header_value(t, sizeof(t)));
 }
 
+void test_nghttp3_http_value_scanner(void) {
+  static const uint32_t feature_sets[] = {
+    0,
+    NGHTTP3_CPU_FEATURE_SSE2,
+    NGHTTP3_CPU_FEATURE_SSE2 | NGHTTP3_CPU_FEATURE_AVX2,
+  };
+  uint32_t features = nghttp3_cpu_get_features();
+  nghttp3_http_value_scanner scanner;
+  uint8_t t[65];
+  size_t i, pos, len;
+  unsigned int b;
+  int bad;
+
+  for (i = 0; i < nghttp3_arraylen(feature_sets); ++i) {
+    if ((feature_sets[i] & features) != feature_sets[i]) {
+      continue;
+    }
+
+    scanner = nghttp3_http_select_value_scanner(feature_sets[i]);
+
+    memset(t, '_', sizeof(t));
+
+    for (len = 0; len <= sizeof(t); ++len) {
+      assert_false(scanner(t, t + len));
+    }
+
+    for (b = 0; b < 256; ++b) {
+      bad = (b < 0x20 && b != '\t') || b == 0x7F;
+
+      for (pos = 0; pos < sizeof(t); ++pos) {
+        memset(t, '_', sizeof(t));
+        t[pos] = (uint8_t)b;
+
+        assert_int(bad, ==, scanner(t, t + sizeof(t)));
+        /* The byte beyond the range is not examined. */
+        assert_false(scanner(t, t + pos));
+      }
+    }
+  }
+}
+
 #define check_header_name(S)                                                   \
   nghttp3_check_header_name((const uint8_t *)(S), nghttp3_strlen_lit(S))
 
@@ -422,3 +466,88 @@ void test_nghttp3_check_header_name(void) {
   assert_false(check_header_name("foO"));
   assert_false(check_header_name(":Foo"));
 }
+
+void test_nghttp3_http_name_scanner(void) {
+  static const uint32_t feature_sets[] = {
+    0,
+    NGHTTP3_CPU_FEATURE_SSE2,
+    NGHTTP3_CPU_FEATURE_SSE2 | NGHTTP3_CPU_FEATURE_AVX2,
+    NGHTTP3_CPU_FEATURE_NEON,
+  };
+  static const uint8_t valid[] = "!#$%&'*+-.^_`|~0123456789"
+                                 "abcdefghijklmnopqrstuvwxyz";
+  uint32_t features = nghttp3_cpu_get_features();
+  nghttp3_http_name_scanner scanner;
+  uint8_t t[65];
+  size_t i, pos, len;
+  unsigned int b;
+  int expected;
+
+  for (i = 0; i < nghttp3_arraylen(feature_sets); ++i) {
+    if ((feature_sets[i] & features) != feature_sets[i]) {
+      continue;
+    }
+
+    scanner = nghttp3_http_select_name_scanner(feature_sets[i]);
+
+    memset(t, 'a', sizeof(t));
+
+    for (len = 0; len <= sizeof(t); ++len) {
+      assert_int(1, ==, scanner(t, t + len));
+    }
+
+    for (b = 0; b < 256; ++b) {
+      if ('A' <= b && b <= 'Z') {
+        expected = -1;
+      } else if (b && memchr(valid, (int)b, sizeof(valid) - 1)) {
+        expected = 1;
+      } else {
+        expected = 0;
+      }
+
+      for (pos = 0; pos < sizeof(t); ++pos) {
+        memset(t, 'a', sizeof(t));
+        t[pos] = (uint8_t)b;
+
+        assert_int(expected, ==, scanner(t, t + sizeof(t)));
+        assert_int(1, ==, scanner(t, t + pos));
+      }
+    }
+
+    /* The first offending character decides the result. */
+    for (pos = 0; pos + 1 < sizeof(t); ++pos) {
+      memset(t, 'a', sizeof(t));
+      t[pos] = 'A';
+      t[pos + 1] = ' ';
+
+      assert_int(-1, ==, scanner(t, t + sizeof(t)));
+
+      t[pos] = ' ';
+      t[pos + 1] = 'A';
+
+      assert_int(0, ==, scanner(t, t + sizeof(t)));
+
+      t[pos + 1] = 'a';
+      t[sizeof(t) - 1] = 'A';
+
+      assert_int(0, ==, scanner(t, t + sizeof(t)));
+    }
+
+    /* The last block of a name whose length is not a multiple of the
+       block size overlaps the previous one. */
+    for (len = 2; len <= sizeof(t); ++len) {
+      for (pos = 0; pos + 1 < len; ++pos) {
+        memset(t, 'a', sizeof(t));
+        t[pos] = 'A';
+        t[len - 1] = ' ';
+
+        assert_int(-1, ==, scanner(t, t + len));
+
+        t[pos] = ' ';
+        t[len - 1] = 'A';
+
+        assert_int(0, ==, scanner(t, t + len));
+      }
+    }
+  }
+}
@@ -29,20 +29,28 @@
 
 #include "nghttp3_qpack.h"
 #include "nghttp3_macro.h"
+#include "nghttp3_str.h"
 #include "nghttp3_test_helper.h"
 
 static const MunitTest tests[] = {
   munit_void_test(test_nghttp3_qpack_encoder_encode),
   munit_void_test(test_nghttp3_qpack_encoder_encode_try_encode),
   munit_void_test(test_nghttp3_qpack_encoder_encode_indexing_strat_eager),
+  munit_void_test(test_nghttp3_qpack_encoder_dtable_map),
+  munit_void_test(test_nghttp3_qpack_encoder_encode_prepared),
   munit_void_test(test_nghttp3_qpack_encoder_still_blocked),
   munit_void_test(test_nghttp3_qpack_encoder_set_dtable_cap),
   munit_void_test(test_nghttp3_qpack_decoder_feedback),
   munit_void_test(test_nghttp3_qpack_decoder_stream_overflow),
+  munit_void_test(test_nghttp3_qpack_lookup_token),
   munit_void_test(test_nghttp3_qpack_huffman),
+  munit_void_test(test_nghttp3_qpack_huffman_encode_shorter),
   munit_void_test(test_nghttp3_qpack_huffman_decode_failure_state),
+  munit_void_test(test_nghttp3_qpack_huffman_decode_padding),
   munit_void_test(test_nghttp3_qpack_decoder_reconstruct_ricnt),
   munit_void_test(test_nghttp3_qpack_decoder_read_encoder),
+  munit_void_test(test_nghttp3_qpack_decoder_borrow_literals),
+  munit_void_test(test_nghttp3_qpack_decoder_field_flags),
   munit_void_test(test_nghttp3_qpack_encoder_read_decoder),
   munit_test_end(),
 };
@@ -384,6 +392,272 @@ void test_nghttp3_qpack_encoder_encode_indexing_strat_eager(void) {
   nghttp3_buf_free(&pbuf, mem);
 }
 
+void test_nghttp3_qpack_encoder_dtable_map(void) {
+  const nghttp3_mem *mem = nghttp3_mem_default();
+  nghttp3_qpack_encoder enc;
+  nghttp3_nv nva[1000];
+  char names[1000][8];
+  int rv;
+  nghttp3_buf pbuf, rbuf, ebuf;
+  nghttp3_qpack_entry *ent, *prev;
+  size_t i, n;
+
+  for (i = 0; i < nghttp3_arraylen(nva); ++i) {
+    snprintf(names[i], sizeof(names[i]), "x-%04zu", i);
+    nva[i] = (nghttp3_nv){
+      .name = (uint8_t *)names[i],
+      .value = (uint8_t *)"v",
+      .namelen = strlen(names[i]),
+      .valuelen = 1,
+    };
+  }
+
+  nghttp3_buf_init(&pbuf);
+  nghttp3_buf_init(&rbuf);
+  nghttp3_buf_init(&ebuf);
+  nghttp3_qpack_encoder_init(&enc, 65536, NGHTTP3_TEST_MAP_SEED, mem);
+  nghttp3_qpack_encoder_set_max_blocked_streams(&enc, 2);
+  nghttp3_qpack_encoder_set_max_dtable_capacity(&enc, 65536);
+  nghttp3_qpack_encoder_set_indexing_strat(&enc,
+                                           NGHTTP3_QPACK_INDEXING_STRAT_EAGER);
+
+  rv = nghttp3_qpack_encoder_encode(&enc, &pbuf, &rbuf, &ebuf, 0, nva,
+                                    nghttp3_arraylen(nva));
+
+  assert_int(0, ==, rv);
+  assert_size(1000, ==, nghttp3_ringbuf_len(&enc.ctx.dtable));
+  assert_size(1000, ==, enc.dtable_map.size);
+  assert_size(10, ==, enc.dtable_map.hashbits);
+
+  /* All fields are found in dynamic table. */
+  rv = nghttp3_qpack_encoder_encode(&enc, &pbuf, &rbuf, &ebuf, 4, nva,
+                                    nghttp3_arraylen(nva));
+
+  assert_int(0, ==, rv);
+  assert_uint64(1000, ==, enc.ctx.next_absidx);
+
+  n = 0;
+
+  for (i = 0; i < (1U << enc.dtable_map.hashbits); ++i) {
+    prev = NULL;
+
+    for (ent = enc.dtable_map.table[i]; ent; ent = ent->map_next) {
+      assert_size(i, ==, ent->hash & ((1U << enc.dtable_map.hashbits) - 1));
+      assert_ptr_equal(prev, ent->map_prev);
+
+      if (prev) {
+        assert_uint64(prev->absidx, >, ent->absidx);
+      }
+
+      prev = ent;
+      ++n;
+    }
+  }
+
+  assert_size(1000, ==, n);
+
+  n = 0;
+
+  for (i = 0; i < (1U << enc.dtable_map.hashbits); ++i) {
+    prev = NULL;
+
+    for (ent = enc.dtable_map.nvtable[i]; ent; ent = ent->nvmap_next) {
+      assert_size(i, ==, ent->nvhash & ((1U << enc.dtable_map.hashbits) - 1));
+
+      if (prev) {
+        assert_uint64(prev->absidx, >, ent->absidx);
+      }
+
+      prev = ent;
+      ++n;
+    }
+  }
+
+  assert_size(1000, ==, n);
+
+  nghttp3_qpack_encoder_free(&enc);
+
+  /* Many entries share a name, and old ones are evicted. */
+  for (i = 0; i < nghttp3_arraylen(nva); ++i) {
+    nva[i] = (nghttp3_nv){
+      .name = (uint8_t *)"x-request-id",
+      .value = (uint8_t *)names[i],
+      .namelen = sizeof("x-request-id") - 1,
+      .valuelen = strlen(names[i]),
+    };
+  }
+
+  nghttp3_buf_reset(&pbuf);
+  nghttp3_buf_reset(&rbuf);
+  nghttp3_buf_reset(&ebuf);
+  nghttp3_qpack_encoder_init(&enc, 16384, NGHTTP3_TEST_MAP_SEED, mem);
+  nghttp3_qpack_encoder_set_max_blocked_streams(&enc, 2);
+  nghttp3_qpack_encoder_set_max_dtable_capacity(&enc, 16384);
+  nghttp3_qpack_encoder_set_indexing_strat(&enc,
+                                           NGHTTP3_QPACK_INDEXING_STRAT_EAGER);
+
+  for (i = 0; i < nghttp3_arraylen(nva); i += 100) {
+    rv = nghttp3_qpack_encoder_encode(&enc, &pbuf, &rbuf, &ebuf, (int64_t)i * 4,
+                                      &nva[i], 100);
+
+    assert_int(0, ==, rv);
+
+    /* Acknowledge the field section so that the entries can be
+       evicted. */
+    rv = nghttp3_qpack_encoder_ack_header(&enc, (int64_t)i * 4);
+
+    assert_int(0, ==, rv);
+  }
+
+  n = nghttp3_ringbuf_len(&enc.ctx.dtable);
+
+  assert_size(1000, >, n);
+  assert_size(n, ==, enc.dtable_map.size);
+
+  /* The most recent value is found as an exact match, and the
+     evicted one only shares the name. */
+  rv = nghttp3_qpack_encoder_encode(&enc, &pbuf, &rbuf, &ebuf, 4000,
+                                    &nva[nghttp3_arraylen(nva) - 1], 1);
+
+  assert_int(0, ==, rv);
+  assert_size(n, ==, nghttp3_ringbuf_len(&enc.ctx.dtable));
+
+  rv = nghttp3_qpack_encoder_encode(&enc, &pbuf, &rbuf, &ebuf, 4004, &nva[0],
+                                    1);
+
+  assert_int(0, ==, rv);
+  assert_uint64(1001, ==, enc.ctx.next_absidx);
+
+  nghttp3_qpack_encoder_free(&enc);
+  nghttp3_buf_free(&ebuf, mem);
+  nghttp3_buf_free(&rbuf, mem);
+  nghttp3_buf_free(&pbuf, mem);
+}
+
+void test_nghttp3_qpack_encoder_encode_prepared(void) {
+  const nghttp3_mem *mem = nghttp3_mem_default();
+  nghttp3_qpack_encoder enc, penc;
+  nghttp3_qpack_decoder dec;
+  nghttp3_nv nva[] = {
+    MAKE_NV(":method", "GET"),
+    MAKE_NV(":path", "/rsrc.php/v3/yn/r/rIPZ9Qkrdd9.png"),
+    MAKE_NV(":authority", "static.xx.fbcdn.net"),
+    MAKE_NV("Content-Type", "text/html; charset=utf-8"),
+    MAKE_NV("x-nonstd", "Lorem ipsum dolor sit amet"),
+    MAKE_NV("authorization", "Basic dXNlcjpwYXNz"),
+    MAKE_NV("x-secret", "1234"),
+  };
+  nghttp3_nv lnva[nghttp3_arraylen(nva)];
+  uint8_t content_type[] = "content-type";
+  nghttp3_prepared_nva *pnva;
+  nghttp3_buf pbuf, rbuf, ebuf, ppbuf, prbuf, pebuf;
+  size_t i, j;
+  int rv;
+
+  nva[6].flags = NGHTTP3_NV_FLAG_NEVER_INDEX;
+
+  memcpy(lnva, nva, sizeof(nva));
+  lnva[3].name = content_type;
+
+  rv = nghttp3_prepared_nva_new(&pnva, nva, nghttp3_arraylen(nva), NULL);
+
+  assert_int(0, ==, rv);
+
+  /* The prepared set owns a lower-cased copy of the fields. */
+  assert_size(nghttp3_arraylen(nva), ==, pnva->nvlen);
+  assert_ptr_not_equal(nva[3].name, pnva->nva[3].name);
+  assert_memory_equal(pnva->nva[3].namelen, content_type, pnva->nva[3].name);
+
+  /* Without dynamic table, and with the eager indexing strategy and
+     dynamic table, the prepared field section must produce exactly
+     the same bytes as the ordinary encoder. */
+  for (i = 0; i < 2; ++i) {
+    nghttp3_buf_init(&pbuf);
+    nghttp3_buf_init(&rbuf);
+    nghttp3_buf_init(&ebuf);
+    nghttp3_buf_init(&ppbuf);
+    nghttp3_buf_init(&prbuf);
+    nghttp3_buf_init(&pebuf);
+    nghttp3_qpack_encoder_init(&enc, 4096, NGHTTP3_TEST_MAP_SEED, mem);
+    nghttp3_qpack_encoder_init(&penc, 4096, NGHTTP3_TEST_MAP_SEED, mem);
+    nghttp3_qpack_decoder_init(&dec, 4096, 1, mem);
+
+    if (i == 1) {
+      nghttp3_qpack_encoder_set_max_blocked_streams(&enc, 1);
+      nghttp3_qpack_encoder_set_max_blocked_streams(&penc, 1);
+      nghttp3_qpack_encoder_set_max_dtable_capacity(&enc, 4096);
+      nghttp3_qpack_encoder_set_max_dtable_capacity(&penc, 4096);
+      nghttp3_qpack_encoder_set_indexing_strat(
+        &enc, NGHTTP3_QPACK_INDEXING_STRAT_EAGER);
+      nghttp3_qpack_encoder_set_indexing_strat(
+        &penc, NGHTTP3_QPACK_INDEXING_STRAT_EAGER);
+    }
+
+    for (j = 0; j < 2; ++j) {
+      rv = nghttp3_qpack_encoder_encode(&enc, &pbuf, &rbuf, &ebuf,
+                                        (int64_t)(j * 4), lnva,
+                                        nghttp3_arraylen(lnva));
+
+      assert_int(0, ==, rv);
+
+      rv = nghttp3_qpack_encoder_encode_prepared(
+        &penc, &ppbuf, &prbuf, &pebuf, (int64_t)(j * 4), pnva);
+
+      assert_int(0, ==, rv);
+      assert_size(nghttp3_buf_len(&pbuf), ==, nghttp3_buf_len(&ppbuf));
+      assert_memory_equal(nghttp3_buf_len(&pbuf), pbuf.pos, ppbuf.pos);
+      assert_size(nghttp3_buf_len(&rbuf), ==, nghttp3_buf_len(&prbuf));
+      assert_memory_equal(nghttp3_buf_len(&rbuf), rbuf.pos, prbuf.pos);
+      assert_size(nghttp3_buf_len(&ebuf), ==, nghttp3_buf_len(&pebuf));
+
+      /* ebuf is empty without dynamic table, and its pos is NULL. */
+      if (nghttp3_buf_len(&ebuf)) {
+        assert_memory_equal(nghttp3_buf_len(&ebuf), ebuf.pos, pebuf.pos);
+      }
+
+      check_decode_header(&dec, &ppbuf, &prbuf, &pebuf, (int64_t)(j * 4),
+                          lnva, nghttp3_arraylen(lnva), mem);
+
+      nghttp3_buf_reset(&pbuf);
+      nghttp3_buf_reset(&rbuf);
+      nghttp3_buf_reset(&ebuf);
+    }
+
+    nghttp3_qpack_decoder_free(&dec);
+    nghttp3_qpack_encoder_free(&penc);
+    nghttp3_qpack_encoder_free(&enc);
+    nghttp3_buf_free(&pebuf, mem);
+    nghttp3_buf_free(&prbuf, mem);
+    nghttp3_buf_free(&ppbuf, mem);
+    nghttp3_buf_free(&ebuf, mem);
+    nghttp3_buf_free(&rbuf, mem);
+    nghttp3_buf_free(&pbuf, mem);
+  }
+
+  nghttp3_prepared_nva_del(pnva);
+
+  /* The total length of fields overflows. */
+  lnva[0] = (nghttp3_nv){
+    .name = content_type,
+    .namelen = sizeof(content_type) - 1,
+    .valuelen = SIZE_MAX - 16,
+  };
+  lnva[1] = (nghttp3_nv){
+    .name = content_type,
+    .namelen = SIZE_MAX / 2,
+    .valuelen = SIZE_MAX / 2,
+  };
+
+  for (i = 0; i < 2; ++i) {
+    pnva = NULL;
+
+    rv = nghttp3_prepared_nva_new(&pnva, &lnva[i], 1, NULL);
+
+    assert_int(NGHTTP3_ERR_NOMEM, ==, rv);
+    assert_null(pnva);
+  }
+}
+
 void test_nghttp3_qpack_encoder_still_blocked(void) {
   const nghttp3_mem *mem = nghttp3_mem_default();
   nghttp3_qpack_encoder enc;
@@ -853,10 +1127,118 @@ void test_nghttp3_qpack_decoder_stream_overflow(void) {
   nghttp3_qpack_decoder_free(&dec);
 }
 
+void test_nghttp3_qpack_lookup_token(void) {
+  static const struct {
+    const char *name;
+    int32_t token;
+  } tokens[] = {
+    {":authority", NGHTTP3_QPACK_TOKEN__AUTHORITY},
+    {":path", NGHTTP3_QPACK_TOKEN__PATH},
+    {"age", NGHTTP3_QPACK_TOKEN_AGE},
+    {"content-disposition", NGHTTP3_QPACK_TOKEN_CONTENT_DISPOSITION},
+    {"content-length", NGHTTP3_QPACK_TOKEN_CONTENT_LENGTH},
+    {"cookie", NGHTTP3_QPACK_TOKEN_COOKIE},
+    {"date", NGHTTP3_QPACK_TOKEN_DATE},
+    {"etag", NGHTTP3_QPACK_TOKEN_ETAG},
+    {"if-modified-since", NGHTTP3_QPACK_TOKEN_IF_MODIFIED_SINCE},
+    {"if-none-match", NGHTTP3_QPACK_TOKEN_IF_NONE_MATCH},
+    {"last-modified", NGHTTP3_QPACK_TOKEN_LAST_MODIFIED},
+    {"link", NGHTTP3_QPACK_TOKEN_LINK},
+    {"location", NGHTTP3_QPACK_TOKEN_LOCATION},
+    {"referer", NGHTTP3_QPACK_TOKEN_REFERER},
+    {"set-cookie", NGHTTP3_QPACK_TOKEN_SET_COOKIE},
+    {":method", NGHTTP3_QPACK_TOKEN__METHOD},
+    {":scheme", NGHTTP3_QPACK_TOKEN__SCHEME},
+    {":status", NGHTTP3_QPACK_TOKEN__STATUS},
+    {"accept", NGHTTP3_QPACK_TOKEN_ACCEPT},
+    {"accept-encoding", NGHTTP3_QPACK_TOKEN_ACCEPT_ENCODING},
+    {"accept-ranges", NGHTTP3_QPACK_TOKEN_ACCEPT_RANGES},
+    {"access-control-allow-headers",
+     NGHTTP3_QPACK_TOKEN_ACCESS_CONTROL_ALLOW_HEADERS},
+    {"access-control-allow-origin",
+     NGHTTP3_QPACK_TOKEN_ACCESS_CONTROL_ALLOW_ORIGIN},
+    {"cache-control", NGHTTP3_QPACK_TOKEN_CACHE_CONTROL},
+    {"content-encoding", NGHTTP3_QPACK_TOKEN_CONTENT_ENCODING},
+    {"content-type", NGHTTP3_QPACK_TOKEN_CONTENT_TYPE},
+    {"range", NGHTTP3_QPACK_TOKEN_RANGE},
+    {"strict-transport-security",
+     NGHTTP3_QPACK_TOKEN_STRICT_TRANSPORT_SECURITY},
+    {"vary", NGHTTP3_QPACK_TOKEN_VARY},
+    {"x-content-type-options", NGHTTP3_QPACK_TOKEN_X_CONTENT_TYPE_OPTIONS},
+    {"x-xss-protection", NGHTTP3_QPACK_TOKEN_X_XSS_PROTECTION},
+    {"accept-language", NGHTTP3_QPACK_TOKEN_ACCEPT_LANGUAGE},
+    {"access-control-allow-credentials",
+     NGHTTP3_QPACK_TOKEN_ACCESS_CONTROL_ALLOW_CREDENTIALS},
+    {"access-control-allow-methods",
+     NGHTTP3_QPACK_TOKEN_ACCESS_CONTROL_ALLOW_METHODS},
+    {"access-control-expose-headers",
+     NGHTTP3_QPACK_TOKEN_ACCESS_CONTROL_EXPOSE_HEADERS},
+    {"access-control-request-headers",
+     NGHTTP3_QPACK_TOKEN_ACCESS_CONTROL_REQUEST_HEADERS},
+    {"access-control-request-method",
+     NGHTTP3_QPACK_TOKEN_ACCESS_CONTROL_REQUEST_METHOD},
+    {"alt-svc", NGHTTP3_QPACK_TOKEN_ALT_SVC},
+    {"authorization", NGHTTP3_QPACK_TOKEN_AUTHORIZATION},
+    {"content-security-policy", NGHTTP3_QPACK_TOKEN_CONTENT_SECURITY_POLICY},
+    {"early-data", NGHTTP3_QPACK_TOKEN_EARLY_DATA},
+    {"expect-ct", NGHTTP3_QPACK_TOKEN_EXPECT_CT},
+    {"forwarded", NGHTTP3_QPACK_TOKEN_FORWARDED},
+    {"if-range", NGHTTP3_QPACK_TOKEN_IF_RANGE},
+    {"origin", NGHTTP3_QPACK_TOKEN_ORIGIN},
+    {"purpose", NGHTTP3_QPACK_TOKEN_PURPOSE},
+    {"server", NGHTTP3_QPACK_TOKEN_SERVER},
+    {"timing-allow-origin", NGHTTP3_QPACK_TOKEN_TIMING_ALLOW_ORIGIN},
+    {"upgrade-insecure-requests",
+     NGHTTP3_QPACK_TOKEN_UPGRADE_INSECURE_REQUESTS},
+    {"user-agent", NGHTTP3_QPACK_TOKEN_USER_AGENT},
+    {"x-forwarded-for", NGHTTP3_QPACK_TOKEN_X_FORWARDED_FOR},
+    {"x-frame-options", NGHTTP3_QPACK_TOKEN_X_FRAME_OPTIONS},
+    {"host", NGHTTP3_QPACK_TOKEN_HOST},
+    {"connection", NGHTTP3_QPACK_TOKEN_CONNECTION},
+    {"keep-alive", NGHTTP3_QPACK_TOKEN_KEEP_ALIVE},
+    {"proxy-connection", NGHTTP3_QPACK_TOKEN_PROXY_CONNECTION},
+    {"transfer-encoding", NGHTTP3_QPACK_TOKEN_TRANSFER_ENCODING},
+    {"upgrade", NGHTTP3_QPACK_TOKEN_UPGRADE},
+    {"te", NGHTTP3_QPACK_TOKEN_TE},
+    {":protocol", NGHTTP3_QPACK_TOKEN__PROTOCOL},
+    {"priority", NGHTTP3_QPACK_TOKEN_PRIORITY},
+  };
+  /* These names do not have a token.  Some of them share the length
+     and the last bytes with a token. */
+  static const char *const unknown_names[] = {
+    "",
+    "t",
+    "tf",
+    "Te",
+    "content-typo",
+    "cxxxxxxxxxpe",
+    ":authoritx",
+    ":xxxxxxxxy",
+    "Content-Type",
+    "x-request-id",
+    "access-control-allow-credentialss",
+  };
+  size_t i;
+
+  for (i = 0; i < nghttp3_arraylen(tokens); ++i) {
+    assert_int32(tokens[i].token, ==,
+                 nghttp3_qpack_lookup_token((const uint8_t *)tokens[i].name,
+                                            strlen(tokens[i].name)));
+  }
+
+  for (i = 0; i < nghttp3_arraylen(unknown_names); ++i) {
+    assert_int32(-1, ==,
+                 nghttp3_qpack_lookup_token((const uint8_t *)unknown_names[i],
+                                            strlen(unknown_names[i])));
+  }
+}
+
 void test_nghttp3_qpack_huffman(void) {
   size_t i, j;
   uint8_t raw[100], ebuf[4096], dbuf[4096];
-  uint8_t *end;
+  uint8_t *end, *p;
+  const uint8_t *q;
+  size_t len;
   nghttp3_qpack_huffman_decode_context ctx;
   nghttp3_ssize nwrite;
 
@@ -878,6 +1260,140 @@ void test_nghttp3_qpack_huffman(void) {
     assert_size(sizeof(raw), ==, (size_t)nwrite);
     assert_memory_equal(sizeof(raw), raw, dbuf);
   }
+
+  /* Feed huffman string in small chunks */
+  for (i = 0; i < 1000; ++i) {
+    for (j = 0; j < sizeof(raw); ++j) {
+      raw[j] = (uint8_t)((double)rand() / RAND_MAX * 255);
+    }
+    end = nghttp3_qpack_huffman_encode(ebuf, raw, sizeof(raw));
+
+    nghttp3_qpack_huffman_decode_context_init(&ctx);
+    p = dbuf;
+
+    for (q = ebuf; q != end;) {
+      len = nghttp3_min((size_t)(end - q), i % 7 + 1);
+      nwrite = nghttp3_qpack_huffman_decode(&ctx, p, q, len, q + len == end);
+
+      assert_ptrdiff(0, <=, nwrite);
+      assert_false(nghttp3_qpack_huffman_decode_failure_state(&ctx));
+
+      p += nwrite;
+      q += len;
+    }
+
+    assert_size(sizeof(raw), ==, (size_t)(p - dbuf));
+    assert_memory_equal(sizeof(raw), raw, dbuf);
+  }
+}
+
+void test_nghttp3_qpack_huffman_encode_shorter(void) {
+  size_t i, j, len, hlen;
+  uint8_t raw[256], ebuf[512], sbuf[512];
+  uint8_t *end;
+
+  srand(1000000007);
+
+  for (i = 0; i < 100000; ++i) {
+    len = (size_t)rand() % sizeof(raw);
+    for (j = 0; j < len; ++j) {
+      /* Mix in rarely used bytes so that both outcomes happen. */
+      raw[j] = (uint8_t)(i % 3 == 0 ? rand() % 256 : 'a' + rand() % 26);
+    }
+
+    hlen = nghttp3_qpack_huffman_encode_count(raw, len);
+
+    memset(sbuf, 0xCC, sizeof(sbuf));
+    end = nghttp3_qpack_huffman_encode_shorter(sbuf, raw, len);
+
+    for (j = len; j < sizeof(sbuf); ++j) {
+      assert_uint8(0xCC, ==, sbuf[j]);
+    }
+
+    if (hlen >= len) {
+      assert_null(end);
+      continue;
+    }
+
+    assert_not_null(end);
+    assert_size(hlen, ==, (size_t)(end - sbuf));
+
+    nghttp3_qpack_huffman_encode(ebuf, raw, len);
+
+    assert_memory_equal(hlen, ebuf, sbuf);
+  }
+}
+
+void test_nghttp3_qpack_huffman_decode_padding(void) {
+  nghttp3_qpack_huffman_decode_context ctx;
+  uint8_t buf[4096];
+  nghttp3_ssize nwrite;
+
+  /* "a" with 3 bits padding */
+  {
+    static const uint8_t data[] = {0x1F};
+
+    nghttp3_qpack_huffman_decode_context_init(&ctx);
+    nwrite = nghttp3_qpack_huffman_decode(&ctx, buf, data, sizeof(data), 1);
+
+    assert_ptrdiff(1, ==, nwrite);
+    assert_uint8('a', ==, buf[0]);
+  }
+
+  /* "a" with 11 bits padding */
+  {
+    static const uint8_t data[] = {0x1F, 0xFF};
+
+    nghttp3_qpack_huffman_decode_context_init(&ctx);
+    nwrite = nghttp3_qpack_huffman_decode(&ctx, buf, data, sizeof(data), 1);
+
+    assert_ptrdiff(NGHTTP3_ERR_QPACK_FATAL, ==, nwrite);
+  }
+
+  /* "a" with padding which contains 0 */
+  {
+    static const uint8_t data[] = {0x1E};
+
+    nghttp3_qpack_huffman_decode_context_init(&ctx);
+    nwrite = nghttp3_qpack_huffman_decode(&ctx, buf, data, sizeof(data), 1);
+
+    assert_ptrdiff(NGHTTP3_ERR_QPACK_FATAL, ==, nwrite);
+  }
+
+  /* Incomplete code which is not padding */
+  {
+    static const uint8_t data[] = {0xFF, 0xFE};
+
+    nghttp3_qpack_huffman_decode_context_init(&ctx);
+    nwrite = nghttp3_qpack_huffman_decode(&ctx, buf, data, sizeof(data), 1);
+
+    assert_ptrdiff(NGHTTP3_ERR_QPACK_FATAL, ==, nwrite);
+  }
+
+  /* EOS in the middle of the string */
+  {
+    static const uint8_t data[] = {0xFF, 0xFF, 0xFF, 0xFC, 0x00};
+
+    nghttp3_qpack_huffman_decode_context_init(&ctx);
+    nwrite = nghttp3_qpack_huffman_decode(&ctx, buf, data, sizeof(data), 1);
+
+    assert_ptrdiff(NGHTTP3_ERR_QPACK_FATAL, ==, nwrite);
+    assert_true(nghttp3_qpack_huffman_decode_failure_state(&ctx));
+  }
+
+  /* Padding split across chunks */
+  {
+    static const uint8_t data[] = {0x1F};
+
+    nghttp3_qpack_huffman_decode_context_init(&ctx);
+    nwrite = nghttp3_qpack_huffman_decode(&ctx, buf, data, sizeof(data), 0);
+
+    assert_ptrdiff(1, ==, nwrite);
+
+    nwrite = nghttp3_qpack_huffman_decode(&ctx, buf, NULL, 0, 1);
+
+    assert_ptrdiff(0, ==, nwrite);
+  }
 }
 
 void test_nghttp3_qpack_huffman_decode_failure_state(void) {
@@ -983,6 +1499,267 @@ void test_nghttp3_qpack_decoder_read_encoder(void) {
   nghttp3_buf_free(&pbuf, mem);
 }
 
+void test_nghttp3_qpack_decoder_borrow_literals(void) {
+  const nghttp3_mem *mem = nghttp3_mem_default();
+  nghttp3_qpack_encoder enc;
+  nghttp3_qpack_decoder dec;
+  nghttp3_qpack_stream_context sctx;
+  nghttp3_qpack_nv nv;
+  nghttp3_buf pbuf, rbuf, ebuf;
+  /* '~' is longer than 8 bits when Huffman encoded, so that these
+     strings are sent without Huffman encoding. */
+  static const nghttp3_nv nva[] = {
+    MAKE_NV(":path", "~~~~"),
+    MAKE_NV("~~~", "~~~~~"),
+    MAKE_NV("x-huffman", "aaaaaaaa"),
+    MAKE_NV("~", ""),
+  };
+  uint8_t src[256], *p;
+  size_t srclen, i, j, chunklen;
+  nghttp3_ssize nread;
+  uint8_t flags;
+  int rv;
+
+  nghttp3_buf_init(&pbuf);
+  nghttp3_buf_init(&rbuf);
+  nghttp3_buf_init(&ebuf);
+
+  nghttp3_qpack_encoder_init(&enc, 0, NGHTTP3_TEST_MAP_SEED, mem);
+
+  rv = nghttp3_qpack_encoder_encode(&enc, &pbuf, &rbuf, &ebuf, 0, nva,
+                                    nghttp3_arraylen(nva));
+
+  assert_int(0, ==, rv);
+  assert_size(0, ==, nghttp3_buf_len(&ebuf));
+
+  p = nghttp3_cpymem(src, pbuf.pos, nghttp3_buf_len(&pbuf));
+  p = nghttp3_cpymem(p, rbuf.pos, nghttp3_buf_len(&rbuf));
+  srclen = (size_t)(p - src);
+
+  /* chunklen == srclen feeds the whole field section at once, and
+     chunklen == 1 feeds it byte by byte. */
+  for (chunklen = srclen; chunklen; chunklen = chunklen == 1 ? 0 : 1) {
+    nghttp3_qpack_decoder_init(&dec, 0, 0, mem);
+    nghttp3_qpack_decoder_set_borrow_literals(&dec, 1);
+    nghttp3_qpack_stream_context_init(&sctx, 0, mem);
+
+    p = src;
+    i = 0;
+
+    for (;;) {
+      flags = NGHTTP3_QPACK_DECODE_FLAG_NONE;
+      nread = nghttp3_qpack_decoder_read_request(
+        &dec, &sctx, &nv, &flags, p,
+        nghttp3_min(chunklen, (size_t)(src + srclen - p)),
+        p + chunklen >= src + srclen);
+
+      assert_ptrdiff(0, <=, nread);
+
+      p += nread;
+
+      if (flags & NGHTTP3_QPACK_DECODE_FLAG_FINAL) {
+        break;
+      }
+
+      if (!(flags & NGHTTP3_QPACK_DECODE_FLAG_EMIT)) {
+        continue;
+      }
+
+      assert_size(nghttp3_arraylen(nva), >, i);
+      assert_memn_equal(nva[i].name, nva[i].namelen, nv.name->base,
+                        nv.name->len);
+      assert_memn_equal(nva[i].value, nva[i].valuelen, nv.value->base,
+                        nv.value->len);
+
+      if (chunklen == 1) {
+        assert_false(nghttp3_rcbuf_is_borrowed(nv.name));
+        /* A value of length 0 is always contained in the input. */
+        assert_int(nva[i].valuelen == 0, ==,
+                   nghttp3_rcbuf_is_borrowed(nv.value));
+      } else {
+        switch (i) {
+        case 0:
+          assert_true(nghttp3_rcbuf_is_static(nv.name));
+          assert_true(nghttp3_rcbuf_is_borrowed(nv.value));
+          break;
+        case 2:
+          assert_false(nghttp3_rcbuf_is_borrowed(nv.name));
+          assert_false(nghttp3_rcbuf_is_borrowed(nv.value));
+          break;
+        default:
+          assert_true(nghttp3_rcbuf_is_borrowed(nv.name));
+          assert_true(nghttp3_rcbuf_is_borrowed(nv.value));
+        }
+      }
+
+      if (nghttp3_rcbuf_is_borrowed(nv.value)) {
+        assert_ptr_equal(nv.value->base + nv.value->len, p);
+      }
+
+      nghttp3_rcbuf_decref(nv.name);
+      nghttp3_rcbuf_decref(nv.value);
+
+      ++i;
+    }
+
+    assert_size(nghttp3_arraylen(nva), ==, i);
+    assert_ptr_equal(src + srclen, p);
+
+    nghttp3_qpack_stream_context_free(&sctx);
+    nghttp3_qpack_decoder_free(&dec);
+  }
+
+  /* Borrowing is disabled by default. */
+  nghttp3_qpack_decoder_init(&dec, 0, 0, mem);
+  nghttp3_qpack_stream_context_init(&sctx, 0, mem);
+
+  for (p = src, j = 0;;) {
+    flags = NGHTTP3_QPACK_DECODE_FLAG_NONE;
+    nread = nghttp3_qpack_decoder_read_request(
+      &dec, &sctx, &nv, &flags, p, (size_t)(src + srclen - p), 1);
+
+    assert_ptrdiff(0, <=, nread);
+
+    p += nread;
+
+    if (flags & NGHTTP3_QPACK_DECODE_FLAG_FINAL) {
+      break;
+    }
+
+    assert_true(flags & NGHTTP3_QPACK_DECODE_FLAG_EMIT);
+    assert_false(nghttp3_rcbuf_is_borrowed(nv.name));
+    assert_false(nghttp3_rcbuf_is_borrowed(nv.value));
+
+    nghttp3_rcbuf_decref(nv.name);
+    nghttp3_rcbuf_decref(nv.value);
+
+    ++j;
+  }
+
+  assert_size(nghttp3_arraylen(nva), ==, j);
+
+  nghttp3_qpack_stream_context_free(&sctx);
+  nghttp3_qpack_decoder_free(&dec);
+  nghttp3_qpack_encoder_free(&enc);
+  nghttp3_buf_free(&ebuf, mem);
+  nghttp3_buf_free(&rbuf, mem);
+  nghttp3_buf_free(&pbuf, mem);
+}
+
+void test_nghttp3_qpack_decoder_field_flags(void) {
+  const nghttp3_mem *mem = nghttp3_mem_default();
+  nghttp3_qpack_encoder enc;
+  nghttp3_qpack_decoder dec;
+  nghttp3_qpack_stream_context sctx;
+  nghttp3_qpack_nv nv;
+  nghttp3_buf pbuf, rbuf, ebuf;
+  static const nghttp3_nv nva[] = {
+    MAKE_NV("accept", "*/*"),
+    MAKE_NV(":path", "/index.html"),
+    MAKE_NV("x-huffman", "aaaaaaaa"),
+    MAKE_NV("X-Huffman", "aaaaaaaa"),
+    MAKE_NV("x-huff man", "aaaaaaaa"),
+    MAKE_NV("X-huff man", "aaaaaaaa"),
+    MAKE_NV("x-huffman", "aaaaaaaaaaaaaaaaaaaa\x01"),
+    MAKE_NV("~~~", "~~~~~"),
+  };
+  static const uint8_t field_flags[] = {
+    NGHTTP3_QPACK_FIELD_FLAG_NAME_CLASSIFIED |
+      NGHTTP3_QPACK_FIELD_FLAG_VALUE_CLASSIFIED,
+    NGHTTP3_QPACK_FIELD_FLAG_VALUE_CLASSIFIED,
+    NGHTTP3_QPACK_FIELD_FLAG_NAME_CLASSIFIED |
+      NGHTTP3_QPACK_FIELD_FLAG_VALUE_CLASSIFIED,
+    NGHTTP3_QPACK_FIELD_FLAG_NAME_CLASSIFIED |
+      NGHTTP3_QPACK_FIELD_FLAG_NAME_UPPER |
+      NGHTTP3_QPACK_FIELD_FLAG_VALUE_CLASSIFIED,
+    NGHTTP3_QPACK_FIELD_FLAG_NAME_CLASSIFIED |
+      NGHTTP3_QPACK_FIELD_FLAG_NAME_BAD |
+      NGHTTP3_QPACK_FIELD_FLAG_VALUE_CLASSIFIED,
+    NGHTTP3_QPACK_FIELD_FLAG_NAME_CLASSIFIED |
+      NGHTTP3_QPACK_FIELD_FLAG_NAME_BAD | NGHTTP3_QPACK_FIELD_FLAG_NAME_UPPER |
+      NGHTTP3_QPACK_FIELD_FLAG_VALUE_CLASSIFIED,
+    NGHTTP3_QPACK_FIELD_FLAG_NAME_CLASSIFIED |
+      NGHTTP3_QPACK_FIELD_FLAG_VALUE_CLASSIFIED |
+      NGHTTP3_QPACK_FIELD_FLAG_VALUE_BAD,
+    /* '~' is longer than 8 bits when Huffman encoded, so that these
+       strings are sent without Huffman encoding. */
+    NGHTTP3_QPACK_FIELD_FLAG_NONE,
+  };
+  uint8_t src[256], *p;
+  size_t srclen, i, chunklen;
+  nghttp3_ssize nread;
+  uint8_t flags;
+  int rv;
+
+  nghttp3_buf_init(&pbuf);
+  nghttp3_buf_init(&rbuf);
+  nghttp3_buf_init(&ebuf);
+
+  nghttp3_qpack_encoder_init(&enc, 0, NGHTTP3_TEST_MAP_SEED, mem);
+
+  rv = nghttp3_qpack_encoder_encode(&enc, &pbuf, &rbuf, &ebuf, 0, nva,
+                                    nghttp3_arraylen(nva));
+
+  assert_int(0, ==, rv);
+  assert_size(0, ==, nghttp3_buf_len(&ebuf));
+
+  p = nghttp3_cpymem(src, pbuf.pos, nghttp3_buf_len(&pbuf));
+  p = nghttp3_cpymem(p, rbuf.pos, nghttp3_buf_len(&rbuf));
+  srclen = (size_t)(p - src);
+
+  /* chunklen == srclen feeds the whole field section at once, and
+     chunklen == 1 feeds it byte by byte. */
+  for (chunklen = srclen; chunklen; chunklen = chunklen == 1 ? 0 : 1) {
+    nghttp3_qpack_decoder_init(&dec, 0, 0, mem);
+    nghttp3_qpack_stream_context_init(&sctx, 0, mem);
+
+    p = src;
+    i = 0;
+
+    for (;;) {
+      flags = NGHTTP3_QPACK_DECODE_FLAG_NONE;
+      nread = nghttp3_qpack_decoder_read_request(
+        &dec, &sctx, &nv, &flags, p,
+        nghttp3_min(chunklen, (size_t)(src + srclen - p)),
+        p + chunklen >= src + srclen);
+
+      assert_ptrdiff(0, <=, nread);
+
+      p += nread;
+
+      if (flags & NGHTTP3_QPACK_DECODE_FLAG_FINAL) {
+        break;
+      }
+
+      if (!(flags & NGHTTP3_QPACK_DECODE_FLAG_EMIT)) {
+        continue;
+      }
+
+      assert_size(nghttp3_arraylen(nva), >, i);
+      assert_memn_equal(nva[i].name, nva[i].namelen, nv.name->base,
+                        nv.name->len);
+      assert_memn_equal(nva[i].value, nva[i].valuelen, nv.value->base,
+                        nv.value->len);
+      assert_uint8(field_flags[i], ==, sctx.field_flags);
+
+      nghttp3_rcbuf_decref(nv.name);
+      nghttp3_rcbuf_decref(nv.value);
+
+      ++i;
+    }
+
+    assert_size(nghttp3_arraylen(nva), ==, i);
+
+    nghttp3_qpack_stream_context_free(&sctx);
+    nghttp3_qpack_decoder_free(&dec);
+  }
+
+  nghttp3_qpack_encoder_free(&enc);
+  nghttp3_buf_free(&ebuf, mem);
+  nghttp3_buf_free(&rbuf, mem);
+  nghttp3_buf_free(&pbuf, mem);
+}
+
 void test_nghttp3_qpack_encoder_read_decoder(void) {
   const nghttp3_mem *mem = nghttp3_mem_default();
   nghttp3_qpack_encoder enc;
@@ -38,14 +38,21 @@ extern const MunitSuite qpack_suite;
 munit_void_test_decl(test_nghttp3_qpack_encoder_encode)
 munit_void_test_decl(test_nghttp3_qpack_encoder_encode_try_encode)
 munit_void_test_decl(test_nghttp3_qpack_encoder_encode_indexing_strat_eager)
+munit_void_test_decl(test_nghttp3_qpack_encoder_dtable_map)
+munit_void_test_decl(test_nghttp3_qpack_encoder_encode_prepared)
 munit_void_test_decl(test_nghttp3_qpack_encoder_still_blocked)
 munit_void_test_decl(test_nghttp3_qpack_encoder_set_dtable_cap)
 munit_void_test_decl(test_nghttp3_qpack_decoder_feedback)
 munit_void_test_decl(test_nghttp3_qpack_decoder_stream_overflow)
+munit_void_test_decl(test_nghttp3_qpack_lookup_token)
 munit_void_test_decl(test_nghttp3_qpack_huffman)
+munit_void_test_decl(test_nghttp3_qpack_huffman_encode_shorter)
 munit_void_test_decl(test_nghttp3_qpack_huffman_decode_failure_state)
+munit_void_test_decl(test_nghttp3_qpack_huffman_decode_padding)
 munit_void_test_decl(test_nghttp3_qpack_decoder_reconstruct_ricnt)
 munit_void_test_decl(test_nghttp3_qpack_decoder_read_encoder)
+munit_void_test_decl(test_nghttp3_qpack_decoder_borrow_literals)
+munit_void_test_decl(test_nghttp3_qpack_decoder_field_flags)
 munit_void_test_decl(test_nghttp3_qpack_encoder_read_decoder)
 
 #endif /* !defined(NGHTTP3_QPACK_TEST_H) */
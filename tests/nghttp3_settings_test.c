@@ -89,6 +89,12 @@ void test_nghttp3_settings_convert_to_latest(void) {
   assert_uint64(6831, ==, dest->glitch_ratelim_rate);
   assert_uint64(NGHTTP3_QPACK_INDEXING_STRAT_NONE, ==,
                 dest->qpack_indexing_strat);
+  assert_uint8(0, ==, dest->qpack_decoder_borrow_literals);
+  assert_size(NGHTTP3_DEFAULT_READ_DATA_VECCNT, ==, dest->read_data_veccnt);
+  assert_size(0, ==, dest->unsent_bytes_watermark);
+  assert_uint64(0, ==, dest->data_coalesce_size);
+  assert_null(dest->pool);
+  assert_size(0, ==, dest->max_blocked_stream_data);
 }
 
 void test_nghttp3_settings_convert_to_old(void) {
@@ -115,6 +121,7 @@ void test_nghttp3_settings_convert_to_old(void) {
   src.glitch_ratelim_burst = 74111;
   src.glitch_ratelim_rate = 6831;
   src.qpack_indexing_strat = NGHTTP3_QPACK_INDEXING_STRAT_EAGER;
+  src.qpack_decoder_borrow_literals = 1;
 
   nghttp3_settings_convert_to_old(NGHTTP3_SETTINGS_V3, dest, &src);
 
@@ -27,11 +27,14 @@
 #include <stdio.h>
 
 #include "nghttp3_tnode.h"
+#include "nghttp3_stream.h"
 #include "nghttp3_macro.h"
 #include "nghttp3_test_helper.h"
 
 static const MunitTest tests[] = {
   munit_void_test(test_nghttp3_tnode_schedule),
+  munit_void_test(test_nghttp3_tnode_queue),
+  munit_void_test(test_nghttp3_tnode_queue_out_of_order),
   munit_test_end(),
 };
 
@@ -40,33 +43,20 @@ const MunitSuite tnode_suite = {
   .tests = tests,
 };
 
-static int cycle_less(const nghttp3_pq_entry *lhsx,
-                      const nghttp3_pq_entry *rhsx) {
-  const nghttp3_tnode *lhs = nghttp3_struct_of(lhsx, nghttp3_tnode, pe);
-  const nghttp3_tnode *rhs = nghttp3_struct_of(rhsx, nghttp3_tnode, pe);
-
-  if (lhs->cycle == rhs->cycle) {
-    return lhs->id < rhs->id;
-  }
-
-  return rhs->cycle - lhs->cycle <= NGHTTP3_TNODE_MAX_CYCLE_GAP;
-}
-
 void test_nghttp3_tnode_schedule(void) {
   const nghttp3_mem *mem = nghttp3_mem_default();
   nghttp3_tnode node, node2;
-  nghttp3_pq pq;
+  nghttp3_tnode_queue q;
   int rv;
-  nghttp3_pq_entry *ent;
   nghttp3_tnode *p;
 
   /* Schedule node with incremental enabled */
   nghttp3_tnode_init(&node, 0);
   node.pri.inc = 1;
 
-  nghttp3_pq_init(&pq, cycle_less, mem);
+  nghttp3_tnode_queue_init(&q, mem);
 
-  rv = nghttp3_tnode_schedule(&node, &pq, 0);
+  rv = nghttp3_tnode_schedule(&node, &q, 0);
 
   assert_int(0, ==, rv);
   assert_uint64(0, ==, node.cycle);
@@ -75,32 +65,32 @@ void test_nghttp3_tnode_schedule(void) {
   nghttp3_tnode_init(&node2, 1);
   node.pri.inc = 1;
 
-  rv = nghttp3_tnode_schedule(&node2, &pq, 0);
+  rv = nghttp3_tnode_schedule(&node2, &q, 0);
 
   assert_int(0, ==, rv);
 
   /* Rescheduling node with nwrite > 0 */
 
-  rv = nghttp3_tnode_schedule(&node, &pq, 1000);
+  rv = nghttp3_tnode_schedule(&node, &q, 1000);
 
   assert_int(0, ==, rv);
   assert_uint64(1, ==, node.cycle);
 
   /* Rescheduling node with nwrite == 0 */
 
-  rv = nghttp3_tnode_schedule(&node, &pq, 0);
+  rv = nghttp3_tnode_schedule(&node, &q, 0);
 
   assert_int(0, ==, rv);
   assert_uint64(1, ==, node.cycle);
 
-  nghttp3_pq_free(&pq);
+  nghttp3_tnode_queue_free(&q);
 
   /* Schedule node without incremental */
   nghttp3_tnode_init(&node, 0);
 
-  nghttp3_pq_init(&pq, cycle_less, mem);
+  nghttp3_tnode_queue_init(&q, mem);
 
-  rv = nghttp3_tnode_schedule(&node, &pq, 0);
+  rv = nghttp3_tnode_schedule(&node, &q, 0);
 
   assert_int(0, ==, rv);
   assert_uint64(0, ==, node.cycle);
@@ -108,69 +98,288 @@ void test_nghttp3_tnode_schedule(void) {
   /* Schedule another node */
   nghttp3_tnode_init(&node2, 1);
 
-  rv = nghttp3_tnode_schedule(&node2, &pq, 0);
+  rv = nghttp3_tnode_schedule(&node2, &q, 0);
 
   assert_int(0, ==, rv);
 
   /* Rescheduling node with nwrite > 0 */
 
-  rv = nghttp3_tnode_schedule(&node, &pq, 1000);
+  rv = nghttp3_tnode_schedule(&node, &q, 1000);
 
   assert_int(0, ==, rv);
   assert_uint64(0, ==, node.cycle);
 
   /* Rescheduling node with nwrit == 0 */
 
-  rv = nghttp3_tnode_schedule(&node, &pq, 0);
+  rv = nghttp3_tnode_schedule(&node, &q, 0);
 
   assert_int(0, ==, rv);
   assert_uint64(0, ==, node.cycle);
 
-  nghttp3_pq_free(&pq);
+  nghttp3_tnode_queue_free(&q);
 
   /* Stream with lower stream ID takes precedence */
-  nghttp3_pq_init(&pq, cycle_less, mem);
+  nghttp3_tnode_queue_init(&q, mem);
 
   nghttp3_tnode_init(&node2, 1);
 
-  rv = nghttp3_tnode_schedule(&node2, &pq, 0);
+  rv = nghttp3_tnode_schedule(&node2, &q, 0);
 
   assert_int(0, ==, rv);
 
   nghttp3_tnode_init(&node, 0);
 
-  rv = nghttp3_tnode_schedule(&node, &pq, 0);
+  rv = nghttp3_tnode_schedule(&node, &q, 0);
 
   assert_int(0, ==, rv);
 
-  ent = nghttp3_pq_top(&pq);
-
-  p = nghttp3_struct_of(ent, nghttp3_tnode, pe);
+  p = nghttp3_tnode_queue_top(&q);
 
   assert_int64(0, ==, p->id);
 
-  nghttp3_pq_free(&pq);
+  nghttp3_tnode_queue_free(&q);
 
   /* Check the same reversing push order */
-  nghttp3_pq_init(&pq, cycle_less, mem);
+  nghttp3_tnode_queue_init(&q, mem);
 
   nghttp3_tnode_init(&node, 0);
 
-  rv = nghttp3_tnode_schedule(&node, &pq, 0);
+  rv = nghttp3_tnode_schedule(&node, &q, 0);
 
   assert_int(0, ==, rv);
 
   nghttp3_tnode_init(&node2, 1);
 
-  rv = nghttp3_tnode_schedule(&node2, &pq, 0);
+  rv = nghttp3_tnode_schedule(&node2, &q, 0);
 
   assert_int(0, ==, rv);
 
-  ent = nghttp3_pq_top(&pq);
-
-  p = nghttp3_struct_of(ent, nghttp3_tnode, pe);
+  p = nghttp3_tnode_queue_top(&q);
 
   assert_int64(0, ==, p->id);
 
-  nghttp3_pq_free(&pq);
+  nghttp3_tnode_queue_free(&q);
+}
+
+void test_nghttp3_tnode_queue(void) {
+  const nghttp3_mem *mem = nghttp3_mem_default();
+  nghttp3_tnode nodes[8];
+  nghttp3_tnode_queue q;
+  nghttp3_tnode *p;
+  size_t i;
+  int rv;
+
+  nghttp3_tnode_queue_init(&q, mem);
+
+  assert_null(nghttp3_tnode_queue_top(&q));
+
+  /* Nodes of the same cycle are ordered by id regardless of the
+     push order. */
+  for (i = 0; i < nghttp3_arraylen(nodes); ++i) {
+    nghttp3_tnode_init(&nodes[i], (int64_t)(i * 4));
+    nodes[i].pri.inc = 1;
+  }
+
+  rv = nghttp3_tnode_queue_push(&q, &nodes[2]);
+
+  assert_int(0, ==, rv);
+
+  rv = nghttp3_tnode_queue_push(&q, &nodes[0]);
+
+  assert_int(0, ==, rv);
+
+  rv = nghttp3_tnode_queue_push(&q, &nodes[3]);
+
+  assert_int(0, ==, rv);
+
+  rv = nghttp3_tnode_queue_push(&q, &nodes[1]);
+
+  assert_int(0, ==, rv);
+  assert_size(4, ==, nghttp3_tnode_queue_size(&q));
+
+  for (i = 0; i < 4; ++i) {
+    p = nghttp3_tnode_queue_top(&q);
+
+    assert_ptr_equal(&nodes[i], p);
+
+    nghttp3_tnode_queue_remove(&q, p);
+  }
+
+  assert_true(nghttp3_tnode_queue_empty(&q));
+  assert_null(nghttp3_tnode_queue_top(&q));
+
+  /* Incremental nodes are served in round-robin. */
+  for (i = 0; i < 3; ++i) {
+    rv = nghttp3_tnode_schedule(&nodes[i], &q, 0);
+
+    assert_int(0, ==, rv);
+  }
+
+  for (i = 0; i < 9; ++i) {
+    p = nghttp3_tnode_queue_top(&q);
+
+    assert_ptr_equal(&nodes[i % 3], p);
+    assert_uint64(i / 3, ==, p->cycle);
+
+    rv = nghttp3_tnode_schedule(p, &q, NGHTTP3_STREAM_MIN_WRITELEN);
+
+    assert_int(0, ==, rv);
+  }
+
+  /* A newly scheduled node starts at the lowest cycle. */
+  rv = nghttp3_tnode_schedule(&nodes[3], &q, 0);
+
+  assert_int(0, ==, rv);
+  assert_uint64(3, ==, nodes[3].cycle);
+
+  /* A large penalty is clamped to the window of the queue. */
+  rv = nghttp3_tnode_schedule(&nodes[0], &q,
+                              NGHTTP3_STREAM_MIN_WRITELEN * 1000);
+
+  assert_int(0, ==, rv);
+  assert_uint64(3 + NGHTTP3_TNODE_QUEUE_NBUCKETS - 1, ==, nodes[0].cycle);
+
+  p = nghttp3_tnode_queue_top(&q);
+
+  assert_ptr_equal(&nodes[1], p);
+
+  /* Removing nodes leaves the rest in order. */
+  nghttp3_tnode_unschedule(&nodes[1], &q);
+  nghttp3_tnode_unschedule(&nodes[3], &q);
+
+  assert_false(nghttp3_tnode_is_scheduled(&nodes[1]));
+  assert_ptr_equal(&nodes[2], nghttp3_tnode_queue_top(&q));
+
+  nghttp3_tnode_unschedule(&nodes[2], &q);
+
+  assert_ptr_equal(&nodes[0], nghttp3_tnode_queue_top(&q));
+
+  nghttp3_tnode_unschedule(&nodes[0], &q);
+
+  assert_true(nghttp3_tnode_queue_empty(&q));
+
+  /* Shrinking frees buckets of an empty queue, and the queue is
+     still usable. */
+  nghttp3_tnode_queue_shrink(&q);
+
+  assert_null(q.buckets);
+
+  rv = nghttp3_tnode_schedule(&nodes[4], &q, 0);
+
+  assert_int(0, ==, rv);
+  assert_ptr_equal(&nodes[4], nghttp3_tnode_queue_top(&q));
+
+  nghttp3_tnode_queue_shrink(&q);
+
+  assert_not_null(q.buckets);
+
+  nghttp3_tnode_queue_free(&q);
+}
+
+void test_nghttp3_tnode_queue_out_of_order(void) {
+  const nghttp3_mem *mem = nghttp3_mem_default();
+  nghttp3_tnode nodes[256];
+  size_t order[nghttp3_arraylen(nodes)];
+  nghttp3_tnode_queue q;
+  nghttp3_tnode *p;
+  size_t i, j, k, n, t;
+  uint32_t x = 12345;
+  int rv;
+
+  nghttp3_tnode_queue_init(&q, mem);
+
+  for (k = 0; k < 2; ++k) {
+    /* Push nodes in the reverse order of id, and then in a random
+       order.  Nodes are spread over 4 cycles.  nodes[0] is pushed
+       first so that the queue starts at the lowest cycle. */
+    order[0] = 0;
+
+    for (i = 0; i < nghttp3_arraylen(nodes); ++i) {
+      nghttp3_tnode_init(&nodes[i], (int64_t)(i * 4));
+      nodes[i].cycle = 100 + i % 4;
+
+      if (i) {
+        order[i] = nghttp3_arraylen(nodes) - i;
+      }
+    }
+
+    if (k == 1) {
+      for (i = nghttp3_arraylen(order) - 1; i > 1; --i) {
+        x = x * 1103515245 + 12345;
+        j = 1 + (x >> 16) % i;
+        t = order[i];
+        order[i] = order[j];
+        order[j] = t;
+      }
+    }
+
+    for (i = 0; i < nghttp3_arraylen(order); ++i) {
+      rv = nghttp3_tnode_queue_push(&q, &nodes[order[i]]);
+
+      assert_int(0, ==, rv);
+    }
+
+    assert_size(nghttp3_arraylen(nodes), ==, nghttp3_tnode_queue_size(&q));
+
+    for (i = 0; i < NGHTTP3_TNODE_QUEUE_NBUCKETS; ++i) {
+      if (q.buckets[i].heap) {
+        break;
+      }
+    }
+
+    assert_size(NGHTTP3_TNODE_QUEUE_NBUCKETS, >, i);
+
+    /* Removing nodes from the middle keeps the order. */
+    for (i = 0; i < nghttp3_arraylen(nodes); i += 7) {
+      nghttp3_tnode_unschedule(&nodes[i], &q);
+    }
+
+    n = 0;
+
+    for (j = 0; j < 4; ++j) {
+      for (i = j; i < nghttp3_arraylen(nodes); i += 4) {
+        if (i % 7 == 0 || (i % 11 == 0 && n)) {
+          continue;
+        }
+
+        p = nghttp3_tnode_queue_top(&q);
+
+        assert_ptr_equal(&nodes[i], p);
+
+        nghttp3_tnode_queue_remove(&q, p);
+
+        assert_false(p->in_heap);
+        assert_null(p->child);
+
+        if (n++ == 0) {
+          /* Removing the top has linked the rest of the heap.  Remove
+             nodes from the middle again. */
+          for (t = 0; t < nghttp3_arraylen(nodes); t += 11) {
+            if (t % 7 && nghttp3_tnode_is_scheduled(&nodes[t])) {
+              nghttp3_tnode_unschedule(&nodes[t], &q);
+            }
+          }
+        }
+      }
+    }
+
+    for (i = 0; i < nghttp3_arraylen(nodes); ++i) {
+      if (i % 7 == 0 || (i % 11 == 0 && i)) {
+        continue;
+      }
+
+      --n;
+    }
+
+    assert_size(0, ==, n);
+    assert_true(nghttp3_tnode_queue_empty(&q));
+    assert_null(nghttp3_tnode_queue_top(&q));
+    assert_uint64(0, ==, q.nonempty);
+  }
+
+  nghttp3_tnode_queue_shrink(&q);
+
+  assert_null(q.buckets);
+
+  nghttp3_tnode_queue_free(&q);
 }
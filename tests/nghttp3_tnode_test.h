@@ -36,5 +36,7 @@
 extern const MunitSuite tnode_suite;
 
 munit_void_test_decl(test_nghttp3_tnode_schedule)
+munit_void_test_decl(test_nghttp3_tnode_queue)
+munit_void_test_decl(test_nghttp3_tnode_queue_out_of_order)
 
 #endif /* !defined(NGHTTP3_TNODE_TEST_H) */